@@ -1,3362 +1,8840 @@
-// TextCanvas.hpp --- TextCanvas by katahiromz
-///////////////////////////////////////////////////////////////////////////
-
-#ifndef TEXT_CANVAS_HPP_
-#define TEXT_CANVAS_HPP_ 33 // Version 33
-
-#if _MSC_VER > 1000
-#pragma once
-#endif
-
-#include <algorithm> // for std::swap
-#include <cassert>   // for assert macro
-#include <cmath>     // for std::sqrt, std::atan2, std::fmod, ...
-#include <cstring>   // for std::memset, std::memcpy, ...
-#include <set>       // for std::set
-#include <string>    // for std::string
-#include <vector>    // for std::vector
-
-#if __cplusplus >= 201103L
-#include <cstdint> // uint8_t, uint16_t, ...
-#else
-#include "pstdint.h" // uint8_t, uint16_t, ...
-#endif
-
-#include "japanese.hpp"
-
-#define TEXTCANVAS_NO_N88_FONTS
-#define TEXTCANVAS_NO_QBASIC_FONTS
-
-///////////////////////////////////////////////////////////////////////////
-
-namespace textcanvas {
-typedef std::string string_type;
-typedef string_type::value_type char_type;
-typedef char_type color_t;
-typedef std::ptrdiff_t coord_t;
-
-#ifdef M_PI
-static const double pi = M_PI;
-#else
-static const double pi = 3.14159265358979323846;
-#endif
-static const double epsilon = 0.00001;
-
-static const color_t zero = color_t(0);
-static const color_t one = color_t(1);
-static const color_t space = color_t(' ');
-static const color_t newline = color_t('\n');
-static const color_t asterisk = color_t('*');
-static const color_t sharp = color_t('#');
-
-///////////////////////////////////////////////////////////////////////////
-
-struct Point;
-class XbmImage;
-class XbmFont;
-class TextCanvas;
-
-///////////////////////////////////////////////////////////////////////////
-// Point and Points
-
-struct Point
-{
-    coord_t x, y;
-    Point() {}
-    Point(coord_t x_, coord_t y_)
-      : x(x_)
-      , y(y_)
-    {}
-};
-typedef Point Size;
-typedef std::vector<Point> Points;
-
-inline bool
-operator==(const Point& p0, const Point& p1)
-{
-    return p0.x == p1.x && p0.y == p1.y;
-}
-inline bool
-operator!=(const Point& p0, const Point& p1)
-{
-    return p0.x != p1.x || p0.y != p1.y;
-}
-struct point_less
-{
-    inline bool operator()(const Point& p0, const Point& p1) const
-    {
-        if (p0.x < p1.x)
-            return true;
-        return p0.x == p1.x && p0.y < p1.y;
-    }
-};
-
-///////////////////////////////////////////////////////////////////////////
-// functions
-
-inline coord_t
-do_round(double d)
-{
-    return coord_t(d + 0.5);
-}
-
-double
-normalize_radian(double radian);
-
-bool
-get_polygon_box(Point& p0, Point& p1, size_t num_points, const Point* points);
-
-size_t
-crossing_number(const Point& p, const Points& points);
-coord_t
-winding_number(const Point& p, const Points& points);
-
-bool
-check_range(double at, bool clockwise, double a0, double a1);
-
-///////////////////////////////////////////////////////////////////////////
-// XbmImage
-
-class XbmImage
-{
-  public:
-    typedef uint8_t value_type;
-
-    XbmImage(coord_t width,
-             coord_t height,
-             const void* data = NULL,
-             void* alloc = NULL)
-      : m_data(NULL)
-      , m_alloc(NULL)
-    {
-        reset(width, height, data, alloc);
-    }
-    XbmImage(const XbmImage& image)
-      : m_data(NULL)
-      , m_alloc(NULL)
-    {
-        *this = image;
-    }
-    XbmImage& operator=(const XbmImage& image);
-    virtual ~XbmImage() { clear(); }
-
-    void clear()
-    {
-        delete[] m_alloc;
-        m_alloc = NULL;
-    }
-
-    void reset(coord_t width,
-               coord_t height,
-               const void* data = NULL,
-               void* alloc = NULL);
-
-    value_type* cast(const void* data) const
-    {
-        return reinterpret_cast<value_type*>(const_cast<void*>(data));
-    }
-
-    coord_t width() const { return m_width; }
-    coord_t height() const { return m_height; }
-    coord_t stride() const { return m_stride; }
-    coord_t size() const { return stride() * height(); }
-    value_type* data() { return m_data; }
-    const value_type* data() const { return m_data; }
-
-    bool in_range(coord_t x, coord_t y) const;
-
-    bool get_dot(coord_t x, coord_t y) const;
-    void put_dot(coord_t x, coord_t y, bool dot);
-
-    std::string to_str(const char* name) const;
-
-    void get_subimage(TextCanvas& image,
-                      coord_t x0,
-                      coord_t y0,
-                      coord_t x1,
-                      coord_t y1) const;
-    void get_subimage(XbmImage& image,
-                      coord_t x0,
-                      coord_t y0,
-                      coord_t x1,
-                      coord_t y1) const;
-    void put_subimage(coord_t x0, coord_t y0, const TextCanvas& image);
-    void put_subimage(coord_t x0, coord_t y0, const XbmImage& image);
-
-  protected:
-    value_type* m_data;
-    value_type* m_alloc;
-    coord_t m_width;
-    coord_t m_height;
-    coord_t m_stride;
-};
-
-///////////////////////////////////////////////////////////////////////////
-// XbmFont
-
-class XbmFont : public XbmImage
-{
-  public:
-    XbmFont(coord_t width,
-            coord_t height,
-            const void* data,
-            coord_t columns,
-            coord_t rows,
-            coord_t cell_width,
-            coord_t cell_height)
-      : XbmImage(width, height, data)
-      , m_columns(columns)
-      , m_rows(rows)
-      , m_cell_width(cell_width)
-      , m_cell_height(cell_height)
-    {}
-
-    coord_t columns() const { return m_columns; }
-    coord_t rows() const { return m_rows; }
-    coord_t cell_width() const { return m_cell_width; }
-    coord_t cell_height() const { return m_cell_height; }
-
-  protected:
-    coord_t m_columns;
-    coord_t m_rows;
-    coord_t m_cell_width;
-    coord_t m_cell_height;
-};
-
-///////////////////////////////////////////////////////////////////////////
-// supported fonts
-
-#ifndef TEXTCANVAS_NO_QBASIC_FONTS
-inline const XbmFont&
-qbasic8x16_font()
-{
-// QBasic 8x16 bitmap font
-#include "fonts/qbasic8x16_chars.xbm"
-    static const XbmFont qbasic8x16_chars(qbasic8x16_chars_width,
-                                          qbasic8x16_chars_height,
-                                          qbasic8x16_chars_bits,
-                                          16,
-                                          16,
-                                          8,
-                                          16);
-    return qbasic8x16_chars;
-}
-#endif
-
-#ifndef TEXTCANVAS_NO_N88_FONTS
-inline const XbmFont&
-n88_normal_font()
-{
-// PC-8801 bitmap font
-#include "fonts/n88_normal_chars.xbm"
-    static const XbmFont n88_normal_chars(n88_normal_chars_width,
-                                          n88_normal_chars_height,
-                                          n88_normal_chars_bits,
-                                          256,
-                                          1,
-                                          8,
-                                          16);
-    return n88_normal_chars;
-}
-inline const XbmFont&
-n88_quality_font()
-{
-// PC-9801 bitmap font
-#include "fonts/n88_quality_chars.xbm"
-    static const XbmFont n88_quality_chars(n88_quality_chars_width,
-                                           n88_quality_chars_height,
-                                           n88_quality_chars_bits,
-                                           256,
-                                           1,
-                                           8,
-                                           16);
-    return n88_quality_chars;
-}
-inline const XbmFont&
-n88_graph_font()
-{
-// PC-8801 graphical bitmap font
-#include "fonts/n88_graph_chars.xbm"
-    static const XbmFont n88_graph_chars(n88_graph_chars_width,
-                                         n88_graph_chars_height,
-                                         n88_graph_chars_bits,
-                                         256,
-                                         1,
-                                         8,
-                                         16);
-    return n88_graph_chars;
-}
-inline const XbmFont&
-n88_quarter_font()
-{
-// PC-9801 quarter bitmap font
-#include "fonts/n88_quarter_chars.xbm"
-    static const XbmFont n88_quarter_chars(n88_quarter_chars_width,
-                                           n88_quarter_chars_height,
-                                           n88_quarter_chars_bits,
-                                           256,
-                                           1,
-                                           8,
-                                           8);
-    return n88_quarter_chars;
-}
-#endif
-
-#ifndef TEXTCANVAS_NO_KHDOTFONT
-inline const XbmFont&
-kh_dot_zenkaku_font()
-{
-// "KH Dot Kodenmachou 16 Ki" Zenkaku font
-#include "fonts/KH-Dot-Kodenmachou-16-Ki.xbm"
-    static const XbmFont kh_dot_font_zenkaku_chars(
-      KH_Dot_Kodenmachou_16_Ki_width,
-      KH_Dot_Kodenmachou_16_Ki_height,
-      KH_Dot_Kodenmachou_16_Ki_bits,
-      0x7E - 0x21 + 1,
-      0x7E - 0x21 + 1,
-      16,
-      16);
-    return kh_dot_font_zenkaku_chars;
-}
-inline const XbmFont&
-kh_dot_hankaku_font()
-{
-// "KH Dot Kodenmachou 16 Ki" Hankaku font
-#include "fonts/KH-Dot-Kodenmachou-16-Ki-ASCII.xbm"
-    static const XbmFont kh_dot_font_hankaku_chars(
-      KH_Dot_Kodenmachou_16_Ki_ASCII_width,
-      KH_Dot_Kodenmachou_16_Ki_ASCII_height,
-      KH_Dot_Kodenmachou_16_Ki_ASCII_bits,
-      16,
-      16,
-      8,
-      16);
-    return kh_dot_font_hankaku_chars;
-}
-#endif
-
-///////////////////////////////////////////////////////////////////////////
-// TextCanvas
-
-class TextCanvas
-{
-  public:
-    TextCanvas();
-    TextCanvas(coord_t width,
-               coord_t height,
-               color_t fore_color = sharp,
-               color_t back_color = space);
-    TextCanvas(const XbmImage& binary,
-               color_t fore_color = sharp,
-               color_t back_color = space);
-    TextCanvas(const TextCanvas& tc);
-    TextCanvas& operator=(const TextCanvas& tc);
-    virtual ~TextCanvas();
-
-  protected:
-    coord_t m_width;
-    coord_t m_height;
-    string_type m_text;
-    color_t m_fore_color;
-    color_t m_back_color;
-    Point m_pos;
-
-  public:
-    coord_t width() const;
-    coord_t height() const;
-    coord_t count() const;
-    Point& pos();
-    const Point& pos() const;
-    color_t& operator[](size_t index);
-    const color_t& operator[](size_t index) const;
-
-    string_type to_str() const;
-    bool in_range(coord_t x, coord_t y) const;
-    bool in_range(const Point& p) const;
-    string_type& data();
-    const string_type& data() const;
-    bool same_size(const TextCanvas& tc) const;
-
-    void clear();
-    void clear(color_t ch);
-    void reset(coord_t width, coord_t height);
-    void reset(coord_t width, coord_t height, color_t ch);
-    void resize(coord_t width_, coord_t height_);
-    void resize(coord_t width_, coord_t height_, color_t ch);
-
-    color_t get_pixel(coord_t x, coord_t y) const;
-    color_t get_pixel(const Point& p) const;
-    void put_pixel(coord_t x, coord_t y, color_t ch);
-    void put_pixel(const Point& p, color_t ch);
-    void put_pixel(coord_t x, coord_t y);
-    void put_pixel(const Point& p);
-
-    bool get_dot(coord_t x, coord_t y) const;
-    void put_dot(coord_t x, coord_t y, bool dot);
-
-    color_t fore_color() const;
-    void fore_color(color_t ch);
-
-    color_t back_color() const;
-    void back_color(color_t ch);
-
-    friend TextCanvas operator!(const TextCanvas& bin);
-    friend TextCanvas operator&(const TextCanvas& bin1, const TextCanvas& bin2);
-    friend TextCanvas operator|(const TextCanvas& bin1, const TextCanvas& bin2);
-    friend TextCanvas operator^(const TextCanvas& bin1, const TextCanvas& bin2);
-
-    void fill(const TextCanvas& bin);
-    void do_mask(const TextCanvas& image, const TextCanvas& mask);
-
-    void get_subimage(TextCanvas& image,
-                      coord_t x0,
-                      coord_t y0,
-                      coord_t x1,
-                      coord_t y1) const;
-    void get_subimage(TextCanvas& image, Point& p0, Point& p1) const;
-    void get_subimage(XbmImage& image,
-                      coord_t x0,
-                      coord_t y0,
-                      coord_t x1,
-                      coord_t y1) const;
-    void get_subimage(XbmImage& image, Point& p0, Point& p1) const;
-
-    void put_subimage(coord_t x0, coord_t y0, const TextCanvas& image);
-    void put_subimage(coord_t x0, coord_t y0, const XbmImage& image);
-    template<typename T_PUTTER0, typename T_PUTTER1>
-    void put_subimage(coord_t x0,
-                      coord_t y0,
-                      const TextCanvas& image,
-                      T_PUTTER0& fore,
-                      T_PUTTER1& back);
-    template<typename T_PUTTER0, typename T_PUTTER1>
-    void put_subimage(coord_t x0,
-                      coord_t y0,
-                      const XbmImage& image,
-                      T_PUTTER0& fore,
-                      T_PUTTER1& back);
-
-    Size put_char(coord_t x0,
-                  coord_t y0,
-                  const XbmFont& font,
-                  coord_t char_code);
-    Size put_char(coord_t x0,
-                  coord_t y0,
-                  const XbmFont& font,
-                  coord_t iColumn,
-                  coord_t iRow);
-
-    template<typename T_CONVERTER>
-    Size put_char(coord_t x0,
-                  coord_t y0,
-                  const XbmFont& font,
-                  coord_t char_code,
-                  T_CONVERTER& conv);
-    template<typename T_CONVERTER>
-    Size put_char(coord_t x0,
-                  coord_t y0,
-                  const XbmFont& font,
-                  coord_t iColumn,
-                  coord_t iRow,
-                  T_CONVERTER& conv);
-    template<typename T_CONVERTER, typename T_PUTTER0, typename T_PUTTER1>
-    Size put_char(coord_t x0,
-                  coord_t y0,
-                  const XbmFont& font,
-                  coord_t char_code,
-                  T_CONVERTER& conv,
-                  T_PUTTER0& fore,
-                  T_PUTTER1& back);
-    template<typename T_CONVERTER, typename T_PUTTER0, typename T_PUTTER1>
-    Size put_char(coord_t x0,
-                  coord_t y0,
-                  const XbmFont& font,
-                  coord_t iColumn,
-                  coord_t iRow,
-                  T_CONVERTER& conv,
-                  T_PUTTER0& fore,
-                  T_PUTTER1& back);
-
-    Size jis_put_char(coord_t x0,
-                      coord_t y0,
-                      const XbmFont& font,
-                      coord_t jis_code);
-    Size jis_put_char(coord_t x0,
-                      coord_t y0,
-                      const XbmFont& font,
-                      coord_t iColumn,
-                      coord_t iRow);
-
-    template<typename T_CONVERTER>
-    Size jis_put_char(coord_t x0,
-                      coord_t y0,
-                      const XbmFont& font,
-                      coord_t jis_code,
-                      T_CONVERTER& conv);
-    template<typename T_CONVERTER>
-    Size jis_put_char(coord_t x0,
-                      coord_t y0,
-                      const XbmFont& font,
-                      coord_t iColumn,
-                      coord_t iRow,
-                      T_CONVERTER& conv);
-    template<typename T_CONVERTER, typename T_PUTTER0, typename T_PUTTER1>
-    Size jis_put_char(coord_t x0,
-                      coord_t y0,
-                      const XbmFont& font,
-                      coord_t jis_code,
-                      T_CONVERTER& conv,
-                      T_PUTTER0& fore,
-                      T_PUTTER1& back);
-    template<typename T_CONVERTER, typename T_PUTTER0, typename T_PUTTER1>
-    Size jis_put_char(coord_t x0,
-                      coord_t y0,
-                      const XbmFont& font,
-                      coord_t iColumn,
-                      coord_t iRow,
-                      T_CONVERTER& conv,
-                      T_PUTTER0& fore,
-                      T_PUTTER1& back);
-
-    // draw text rightward
-    void text_to_right(coord_t x0,
-                       coord_t y0,
-                       const XbmFont& font,
-                       const string_type& text);
-    void text_to_right(const Point& p0,
-                       const XbmFont& font,
-                       const string_type& text);
-    template<typename T_CONVERTER>
-    void text_to_right(coord_t x0,
-                       coord_t y0,
-                       const XbmFont& font,
-                       const string_type& text,
-                       T_CONVERTER& conv);
-    template<typename T_CONVERTER>
-    void text_to_right(const Point& p0,
-                       const XbmFont& font,
-                       const string_type& text,
-                       T_CONVERTER& conv);
-
-    // japanese draw text rightward
-    void sjis_text_to_right(coord_t x0,
-                            coord_t y0,
-                            const XbmFont& zenkaku_font,
-                            const XbmFont& hankaku_font,
-                            const string_type& text);
-    void sjis_text_to_right(const Point& p0,
-                            const XbmFont& zenkaku_font,
-                            const XbmFont& hankaku_font,
-                            const string_type& text);
-    template<typename T_CONVERTER>
-    void sjis_text_to_right(coord_t x0,
-                            coord_t y0,
-                            const XbmFont& zenkaku_font,
-                            const XbmFont& hankaku_font,
-                            const string_type& text,
-                            T_CONVERTER& conv);
-    template<typename T_CONVERTER>
-    void sjis_text_to_right(const Point& p0,
-                            const XbmFont& zenkaku_font,
-                            const XbmFont& hankaku_font,
-                            const string_type& text,
-                            T_CONVERTER& conv);
-
-    void flood_fill(coord_t x, coord_t y, color_t ch, bool surface = false);
-    void flood_fill(const Point& p, color_t ch, bool surface = false);
-    void flood_fill_bordered(coord_t x, coord_t y, color_t border_ch);
-    void flood_fill_bordered(const Point& p, color_t border_ch);
-    void flood_fill_surface(coord_t x, coord_t y, color_t surface_ch);
-    void flood_fill_surface(const Point& p, color_t surface_ch);
-
-    void move_to(coord_t x, coord_t y);
-    void move_to(const Point& p);
-
-    void line_to(coord_t x, coord_t y);
-    void line_to(const Point& p);
-    template<typename T_PUTTER>
-    void line_to(coord_t x, coord_t y, T_PUTTER& putter);
-    template<typename T_PUTTER>
-    void line_to(const Point& p, T_PUTTER& putter);
-
-    void line(coord_t x0, coord_t y0, coord_t x1, coord_t y1);
-    void line(const Point& p0, const Point& p1);
-    template<typename T_PUTTER>
-    void line(coord_t x0, coord_t y0, coord_t x1, coord_t y1, T_PUTTER& putter);
-
-    void rectangle(coord_t x0, coord_t y0, coord_t x1, coord_t y1);
-    void rectangle(const Point& p0, const Point& p1);
-    template<typename T_PUTTER>
-    void rectangle(coord_t x0,
-                   coord_t y0,
-                   coord_t x1,
-                   coord_t y1,
-                   T_PUTTER& putter);
-
-    void fill_rectangle(coord_t x0, coord_t y0, coord_t x1, coord_t y1);
-    void fill_rectangle(const Point& p0, const Point& p1);
-    template<typename T_PUTTER>
-    void fill_rectangle(coord_t x0,
-                        coord_t y0,
-                        coord_t x1,
-                        coord_t y1,
-                        T_PUTTER& putter);
-
-    void circle(coord_t x0, coord_t y0, coord_t r);
-    void circle(const Point& c, coord_t r);
-    template<typename T_PUTTER>
-    void circle(coord_t x0, coord_t y0, coord_t r, T_PUTTER& putter);
-
-    void fill_circle(coord_t x0, coord_t y0, coord_t r);
-    void fill_circle(const Point& c, coord_t r);
-    template<typename T_PUTTER>
-    void fill_circle(coord_t x0, coord_t y0, coord_t r, T_PUTTER& putter);
-
-    void ellipse(coord_t x0, coord_t y0, coord_t x1, coord_t y1);
-    void ellipse(const Point& p0, const Point& p1);
-    template<typename T_PUTTER>
-    void ellipse(coord_t x0,
-                 coord_t y0,
-                 coord_t x1,
-                 coord_t y1,
-                 T_PUTTER& putter);
-
-    void fill_ellipse(coord_t x0, coord_t y0, coord_t x1, coord_t y1);
-    void fill_ellipse(const Point& p0, const Point& p1);
-    template<typename T_PUTTER>
-    void fill_ellipse(coord_t x0,
-                      coord_t y0,
-                      coord_t x1,
-                      coord_t y1,
-                      T_PUTTER& putter);
-
-    void arc(coord_t x0,
-             coord_t y0,
-             coord_t x1,
-             coord_t y1,
-             double start_radian,
-             double end_radian,
-             bool clockwise = false);
-    void arc(const Point& p0,
-             const Point& p1,
-             double start_radian,
-             double end_radian,
-             bool clockwise = false);
-    template<typename T_PUTTER>
-    void arc(coord_t x0,
-             coord_t y0,
-             coord_t x1,
-             coord_t y1,
-             double start_radian,
-             double end_radian,
-             bool clockwise,
-             T_PUTTER& putter);
-
-    void arc_to(coord_t x0,
-                coord_t y0,
-                coord_t x1,
-                coord_t y1,
-                double start_radian,
-                double end_radian,
-                bool clockwise = false);
-    void arc_to(const Point& p0,
-                const Point& p1,
-                double start_radian,
-                double end_radian,
-                bool clockwise = false);
-    template<typename T_PUTTER>
-    void arc_to(coord_t x0,
-                coord_t y0,
-                coord_t x1,
-                coord_t y1,
-                double start_radian,
-                double end_radian,
-                bool clockwise,
-                T_PUTTER& putter);
-
-    void pie(coord_t x0,
-             coord_t y0,
-             coord_t x1,
-             coord_t y1,
-             double start_radian,
-             double end_radian);
-    void pie(const Point& p0,
-             const Point& p1,
-             double start_radian,
-             double end_radian);
-    template<typename T_PUTTER>
-    void pie(coord_t x0,
-             coord_t y0,
-             coord_t x1,
-             coord_t y1,
-             double start_radian,
-             double end_radian,
-             T_PUTTER& putter);
-
-    void fill_pie(coord_t x0,
-                  coord_t y0,
-                  coord_t x1,
-                  coord_t y1,
-                  double start_radian,
-                  double end_radian,
-                  bool clockwise = false);
-    void fill_pie(const Point& p0,
-                  const Point& p1,
-                  double start_radian,
-                  double end_radian,
-                  bool clockwise = false);
-    template<typename T_PUTTER>
-    void fill_pie(coord_t x0,
-                  coord_t y0,
-                  coord_t x1,
-                  coord_t y1,
-                  double start_radian,
-                  double end_radian,
-                  bool clockwise,
-                  T_PUTTER& putter);
-
-    void round_rect(coord_t x0,
-                    coord_t y0,
-                    coord_t x1,
-                    coord_t y1,
-                    coord_t rx,
-                    coord_t ry);
-    void round_rect(const Point& p0, const Point& p1, coord_t rx, coord_t ry);
-    template<typename T_PUTTER>
-    void round_rect(coord_t x0,
-                    coord_t y0,
-                    coord_t x1,
-                    coord_t y1,
-                    coord_t rx,
-                    coord_t ry,
-                    T_PUTTER& putter);
-
-    void fill_round_rect(coord_t x0,
-                         coord_t y0,
-                         coord_t x1,
-                         coord_t y1,
-                         coord_t rx,
-                         coord_t ry);
-    void fill_round_rect(const Point& p0,
-                         const Point& p1,
-                         coord_t rx,
-                         coord_t ry);
-    template<typename T_PUTTER>
-    void fill_round_rect(coord_t x0,
-                         coord_t y0,
-                         coord_t x1,
-                         coord_t y1,
-                         coord_t rx,
-                         coord_t ry,
-                         T_PUTTER& putter);
-
-    void lines(size_t num_points, const Point* points);
-    void lines(const Points& points);
-    template<typename T_PUTTER>
-    void lines(size_t num_points, const Point* points, T_PUTTER& putter);
-
-    void polyline(size_t num_points, const Point* points);
-    void polyline(const Points& points);
-    template<typename T_PUTTER>
-    void polyline(size_t num_points, const Point* points, T_PUTTER& putter);
-
-    void polygon(size_t num_points, const Point* points);
-    void polygon(const Points& points);
-    template<typename T_PUTTER>
-    void polygon(size_t num_points, const Point* points, T_PUTTER& putter);
-
-    void fill_polygon(size_t num_points,
-                      const Point* points,
-                      bool alternate = false);
-    void fill_polygon(const Points& points, bool alternate = false);
-    template<typename T_PUTTER>
-    void fill_polygon(size_t num_points,
-                      const Point* points,
-                      bool alternate,
-                      T_PUTTER& putter);
-
-    template<typename T_PUTTER>
-    void fill_polygon_alternate(size_t num_points,
-                                const Point* points,
-                                T_PUTTER& putter);
-    template<typename T_PUTTER>
-    void fill_polygon_alternate(const Points& points, T_PUTTER& putter);
-
-    template<typename T_PUTTER>
-    void fill_polygon_winding(size_t num_points,
-                              const Point* points,
-                              T_PUTTER& putter);
-    template<typename T_PUTTER>
-    void fill_polygon_winding(const Points& points, T_PUTTER& putter);
-
-    void swap(TextCanvas& other);
-
-    void rotate_left(const TextCanvas& other);
-    void rotate_right(const TextCanvas& other);
-    void rotate_180(const TextCanvas& other);
-
-    void rotate_left();
-    void rotate_right();
-    void rotate_180();
-
-    void scale(const TextCanvas& other, coord_t width, coord_t height);
-    void scale(coord_t width, coord_t height);
-
-    void scale_cross(const TextCanvas& other, coord_t x_multi, coord_t y_multi);
-    void scale_cross(coord_t x_multi, coord_t y_multi);
-
-    void scale_percent(const TextCanvas& other,
-                       coord_t x_percent,
-                       coord_t y_percent);
-    void scale_percent(coord_t x_percent, coord_t y_percent);
-
-    void mirror_h(const TextCanvas& other);
-    void mirror_v(const TextCanvas& other);
-
-    void mirror_h();
-    void mirror_v();
-};
-
-///////////////////////////////////////////////////////////////////////////
-// pixel putters
-
-struct NonePutter
-{
-    NonePutter() {}
-    void operator()(coord_t x, coord_t y) {}
-};
-struct SimplePutter
-{
-    TextCanvas& m_tc;
-    SimplePutter(TextCanvas& tc)
-      : m_tc(tc)
-    {}
-    void operator()(coord_t x, coord_t y) { m_tc.put_pixel(x, y); }
-};
-struct ColorPutter
-{
-    TextCanvas& m_tc;
-    color_t m_color;
-    ColorPutter(TextCanvas& tc, color_t color)
-      : m_tc(tc)
-      , m_color(color)
-    {}
-    void operator()(coord_t x, coord_t y) { m_tc.put_pixel(x, y, m_color); }
-};
-struct XorPutter
-{
-    TextCanvas& m_tc;
-    XorPutter(TextCanvas& tc)
-      : m_tc(tc)
-    {}
-    void operator()(coord_t x, coord_t y)
-    {
-        color_t c = m_tc.get_pixel(x, y);
-        m_tc.put_pixel(x, y, c ^ m_tc.fore_color());
-    }
-};
-struct WidenPutter
-{
-    TextCanvas& m_tc;
-    WidenPutter(TextCanvas& tc)
-      : m_tc(tc)
-    {}
-    void operator()(coord_t x, coord_t y)
-    {
-        m_tc.put_pixel(x, y);
-        m_tc.put_pixel(x - 1, y);
-        m_tc.put_pixel(x + 1, y);
-        m_tc.put_pixel(x, y - 1);
-        m_tc.put_pixel(x, y + 1);
-    }
-};
-
-///////////////////////////////////////////////////////////////////////////
-// image converters
-
-struct NoneConverter
-{
-    void operator()(TextCanvas& tc) {}
-};
-struct YokoNibaiKaku
-{
-    void operator()(TextCanvas& tc) { tc.scale_cross(2, 1); }
-};
-struct TateNibaiKaku
-{
-    void operator()(TextCanvas& tc) { tc.scale_cross(1, 2); }
-};
-struct YonBaiKaku
-{
-    void operator()(TextCanvas& tc) { tc.scale_cross(2, 2); }
-};
-struct LeftRotator
-{
-    void operator()(TextCanvas& tc) { tc.rotate_left(); }
-};
-struct RightRotator
-{
-    void operator()(TextCanvas& tc) { tc.rotate_right(); }
-};
-template<typename T_LEFT_CONV, typename T_RIGHT_CONV>
-struct PairConverter
-{
-    T_LEFT_CONV& m_left;
-    T_RIGHT_CONV& m_right;
-    PairConverter(T_LEFT_CONV& left, T_RIGHT_CONV& right)
-      : m_left(left)
-      , m_right(right)
-    {}
-    void operator()(TextCanvas& tc)
-    {
-        m_left(tc);
-        m_right(tc);
-    }
-};
-
-///////////////////////////////////////////////////////////////////////////
-
-inline double
-normalize_radian(double radian)
-{
-    radian = fmod(radian, 2 * pi);
-    if (radian < -pi)
-        radian += 2 * pi;
-    else if (radian > pi)
-        radian -= 2 * pi;
-    return radian;
-}
-
-inline bool
-check_range(double at, bool clockwise, double a0, double a1)
-{
-    if (clockwise) {
-        if ((-pi <= at && at <= a0 + epsilon) ||
-            (a1 - epsilon <= at && at <= pi)) {
-            return true;
-        }
-    } else {
-        if (a0 - epsilon <= at && at <= a1 + epsilon) {
-            return true;
-        }
-    }
-    return false;
-}
-
-inline bool
-get_polygon_box(Point& p0, Point& p1, size_t num_points, const Point* points)
-{
-    if (num_points == 0)
-        return false;
-
-    p0 = p1 = points[0];
-    for (size_t i = 1; i < num_points; ++i) {
-        coord_t x = points[i].x;
-        if (x < p0.x)
-            p0.x = x;
-        if (x > p1.x)
-            p1.x = x;
-        coord_t y = points[i].y;
-        if (y < p0.y)
-            p0.y = y;
-        if (y > p1.y)
-            p1.y = y;
-    }
-    return true;
-}
-
-inline size_t
-crossing_number(const Point& p, const Points& points)
-{
-    size_t ret = 0;
-    for (size_t i = 0; i < points.size() - 1; ++i) {
-        if ((points[i].y <= p.y && points[i + 1].y > p.y) ||
-            (points[i].y > p.y && points[i + 1].y <= p.y)) {
-            double f =
-              double(p.y - points[i].y) / (points[i + 1].y - points[i].y);
-            if (p.x - points[i].x < f * (points[i + 1].x - points[i].x)) {
-                ++ret;
-            }
-        }
-    }
-    return ret;
-}
-inline coord_t
-winding_number(const Point& p, const Points& points)
-{
-    coord_t ret = 0;
-    for (size_t i = 0; i < points.size() - 1; ++i) {
-        if (points[i].y <= p.y && points[i + 1].y > p.y) {
-            double f =
-              double(p.y - points[i].y) / (points[i + 1].y - points[i].y);
-            if (p.x - points[i].x < f * (points[i + 1].x - points[i].x))
-                ++ret;
-        } else if (points[i].y > p.y && points[i + 1].y <= p.y) {
-            double f =
-              double(p.y - points[i].y) / (points[i + 1].y - points[i].y);
-            if (p.x - points[i].x < f * (points[i + 1].x - points[i].x))
-                --ret;
-        }
-    }
-    return ret;
-}
-
-///////////////////////////////////////////////////////////////////////////
-
-bool
-XbmImage::in_range(coord_t x, coord_t y) const
-{
-    return 0 <= x && x < width() && 0 <= y && y < height();
-}
-
-inline bool
-XbmImage::get_dot(coord_t x, coord_t y) const
-{
-    if (!in_range(x, y))
-        return false;
-
-    value_type byte = data()[stride() * y + x / 8];
-    return (byte & (1 << (x & 7))) != 0;
-}
-inline void
-XbmImage::put_dot(coord_t x, coord_t y, bool dot)
-{
-    if (!in_range(x, y))
-        return;
-
-    value_type byte = data()[stride() * y + x / 8];
-    coord_t shift = x & 7;
-    if (dot)
-        byte |= (1 << shift);
-    else
-        byte &= ~(1 << shift);
-    data()[stride() * y + x / 8] = byte;
-}
-
-inline XbmImage&
-XbmImage::operator=(const XbmImage& image)
-{
-    if (this != &image) {
-        reset(image.width(), image.height(), NULL, image.m_alloc);
-    }
-    return *this;
-}
-
-inline void
-XbmImage::reset(coord_t width, coord_t height, const void* data, void* alloc)
-{
-    assert(width);
-    assert(height);
-    assert(sizeof(value_type) == 1);
-
-    clear();
-
-    m_width = width;
-    m_height = height;
-    m_stride = (width + 7) / 8;
-    coord_t total_size = m_stride * m_height;
-    if (total_size == 0) {
-        m_data = m_alloc = NULL;
-    } else if (!data && !alloc) {
-        m_data = m_alloc = new value_type[total_size];
-        memset(m_data, 0, total_size);
-    } else if (!data && alloc) {
-        m_data = m_alloc = new value_type[total_size];
-        memcpy(m_data, alloc, total_size);
-    } else if (data && !alloc) {
-        m_data = cast(data);
-        m_alloc = NULL;
-    } else if (data && alloc) {
-        m_data = cast(data);
-        m_alloc = cast(alloc);
-    }
-}
-
-inline std::string
-XbmImage::to_str(const char* name) const
-{
-    std::string str;
-    char buf[32];
-
-    str += "#define ";
-    str += name;
-    str += "_width ";
-    sprintf(buf, "%u", (int)width());
-    str += buf;
-    str += "\n";
-
-    str += "#define ";
-    str += name;
-    str += "_height ";
-    sprintf(buf, "%u", (int)height());
-    str += buf;
-    str += "\n";
-
-    str += "static const unsigned char ";
-    str += name;
-    str += "_bits[] = {\n";
-
-    size_t i, k = 0;
-    for (i = 0; i < stride() * height() - 1; ++i) {
-        if (k == 0)
-            str += "   ";
-        sprintf(buf, "0x%02x, ", data()[i]);
-        str += buf;
-        ++k;
-        if (k == 12) {
-            k = 0;
-            str += "\n";
-        }
-    }
-    if (k == 0)
-        str += "  ";
-    sprintf(buf, "0x%02x };\n", data()[i]);
-    str += buf;
-    return str;
-}
-
-inline void
-XbmImage::get_subimage(TextCanvas& image,
-                       coord_t x0,
-                       coord_t y0,
-                       coord_t x1,
-                       coord_t y1) const
-{
-    if (x0 > x1)
-        std::swap(x0, x1);
-    if (y0 > y1)
-        std::swap(y0, y1);
-
-    coord_t width = x1 - x0 + 1;
-    coord_t height = y1 - y0 + 1;
-    if (width != image.width() || height != image.height()) {
-        image.reset(width, height);
-    }
-
-    coord_t py = 0;
-    for (coord_t y = y0; y <= y1; ++y) {
-        coord_t px = 0;
-        for (coord_t x = x0; x <= x1; ++x) {
-            image.put_dot(px, py, get_dot(x, y));
-            ++px;
-        }
-        ++py;
-    }
-}
-inline void
-XbmImage::get_subimage(XbmImage& image,
-                       coord_t x0,
-                       coord_t y0,
-                       coord_t x1,
-                       coord_t y1) const
-{
-    if (x0 > x1)
-        std::swap(x0, x1);
-    if (y0 > y1)
-        std::swap(y0, y1);
-
-    coord_t width = x1 - x0 + 1;
-    coord_t height = y1 - y0 + 1;
-    if (width != image.width() || height != image.height()) {
-        image.reset(width, height);
-    }
-
-    coord_t py = 0;
-    for (coord_t y = y0; y <= y1; ++y) {
-        coord_t px = 0;
-        for (coord_t x = x0; x <= x1; ++x) {
-            image.put_dot(px, py, get_dot(x, y));
-            ++px;
-        }
-        ++py;
-    }
-}
-inline void
-XbmImage::put_subimage(coord_t x0, coord_t y0, const TextCanvas& image)
-{
-    for (coord_t y = 0; y < image.height(); ++y) {
-        for (coord_t x = 0; x < image.width(); ++x) {
-            put_dot(x0 + x, y0 + y, image.get_dot(x, y));
-        }
-    }
-}
-inline void
-XbmImage::put_subimage(coord_t x0, coord_t y0, const XbmImage& image)
-{
-    for (coord_t y = 0; y < image.height(); ++y) {
-        for (coord_t x = 0; x < image.width(); ++x) {
-            put_dot(x0 + x, y0 + y, image.get_dot(x, y));
-        }
-    }
-}
-
-///////////////////////////////////////////////////////////////////////////
-// internal methods
-
-inline TextCanvas::TextCanvas()
-  : m_width(0)
-  , m_height(0)
-  , m_text()
-  , m_fore_color(sharp)
-  , m_back_color(space)
-  , m_pos(0, 0)
-{}
-inline TextCanvas::TextCanvas(coord_t width,
-                              coord_t height,
-                              color_t fore_color,
-                              color_t back_color)
-  : m_width(width)
-  , m_height(height)
-  , m_text(width * height, back_color)
-  , m_fore_color(fore_color)
-  , m_back_color(back_color)
-  , m_pos(0, 0)
-{}
-inline TextCanvas::TextCanvas(const TextCanvas& tc)
-  : m_width(tc.m_width)
-  , m_height(tc.m_height)
-  , m_text(tc.m_text)
-  , m_fore_color(tc.m_fore_color)
-  , m_back_color(tc.m_back_color)
-  , m_pos(tc.m_pos)
-{}
-inline TextCanvas&
-TextCanvas::operator=(const TextCanvas& tc)
-{
-    m_width = tc.m_width;
-    m_height = tc.m_height;
-    m_text = tc.m_text;
-    m_fore_color = tc.m_fore_color;
-    m_back_color = tc.m_back_color;
-    m_pos = tc.m_pos;
-    return *this;
-}
-inline TextCanvas::TextCanvas(const XbmImage& binary,
-                              color_t fore_color,
-                              color_t back_color)
-  : m_width(binary.width())
-  , m_height(binary.height())
-  , m_text(binary.width() * binary.height(), 0)
-  , m_fore_color(fore_color)
-  , m_back_color(back_color)
-  , m_pos(0, 0)
-{
-    for (coord_t y = 0; y < height(); ++y) {
-        for (coord_t x = 0; x < width(); ++x) {
-            if (binary.get_dot(x, y))
-                put_pixel(x, y, fore_color);
-            else
-                put_pixel(x, y, back_color);
-        }
-    }
-}
-inline TextCanvas::~TextCanvas() {}
-
-inline coord_t
-TextCanvas::width() const
-{
-    return m_width;
-}
-inline coord_t
-TextCanvas::height() const
-{
-    return m_height;
-}
-inline coord_t
-TextCanvas::count() const
-{
-    return m_width * m_height;
-}
-inline Point&
-TextCanvas::pos()
-{
-    return m_pos;
-}
-inline const Point&
-TextCanvas::pos() const
-{
-    return m_pos;
-}
-inline color_t& TextCanvas::operator[](size_t index)
-{
-    return data()[index];
-}
-inline const color_t& TextCanvas::operator[](size_t index) const
-{
-    return data()[index];
-}
-inline string_type
-TextCanvas::to_str() const
-{
-    string_type ret;
-    for (coord_t y = 0; y < height(); ++y) {
-        ret += data().substr(y * width(), width());
-        ret += newline;
-    }
-    return ret;
-}
-
-inline string_type&
-TextCanvas::data()
-{
-    return m_text;
-}
-inline const string_type&
-TextCanvas::data() const
-{
-    return m_text;
-}
-inline void
-TextCanvas::clear(color_t ch)
-{
-    m_text.assign(width() * height(), ch);
-}
-
-inline void
-TextCanvas::reset(coord_t width, coord_t height, color_t ch)
-{
-    m_width = width;
-    m_height = height;
-    m_text.assign(width * height, ch);
-    m_pos.x = m_pos.y = 0;
-}
-
-inline void
-TextCanvas::resize(coord_t width_, coord_t height_, color_t ch)
-{
-    const coord_t min_width = std::min(width(), width_);
-    const coord_t min_height = std::min(height(), height_);
-    string_type str(width_ * height_, ch);
-    for (coord_t y = 0; y < min_height; ++y) {
-        for (coord_t x = 0; x < min_width; ++x) {
-            str[y * width_ + x] = m_text[y * width() + x];
-        }
-    }
-    std::swap(str, m_text);
-    m_width = width_;
-    m_height = height_;
-}
-
-inline color_t
-TextCanvas::get_pixel(coord_t x, coord_t y) const
-{
-    if (in_range(x, y)) {
-        return m_text[y * width() + x];
-    }
-    return m_back_color;
-}
-inline color_t
-TextCanvas::get_pixel(const Point& p) const
-{
-    return get_pixel(p.x, p.y);
-}
-inline void
-TextCanvas::put_pixel(coord_t x, coord_t y, color_t ch)
-{
-    if (in_range(x, y)) {
-        m_text[y * width() + x] = ch;
-    }
-    m_pos.x = x;
-    m_pos.y = y;
-}
-inline void
-TextCanvas::put_pixel(const Point& p, color_t ch)
-{
-    put_pixel(p.x, p.y, ch);
-}
-inline void
-TextCanvas::put_pixel(coord_t x, coord_t y)
-{
-    put_pixel(x, y, m_fore_color);
-}
-inline void
-TextCanvas::put_pixel(const Point& p)
-{
-    put_pixel(p, m_fore_color);
-}
-
-inline void
-TextCanvas::swap(TextCanvas& other)
-{
-    std::swap(m_width, other.m_width);
-    std::swap(m_height, other.m_height);
-    std::swap(m_text, other.m_text);
-    std::swap(m_fore_color, other.m_fore_color);
-    std::swap(m_back_color, other.m_back_color);
-    std::swap(m_pos, other.m_pos);
-}
-
-inline color_t
-TextCanvas::fore_color() const
-{
-    return m_fore_color;
-}
-inline void
-TextCanvas::fore_color(color_t ch)
-{
-    m_fore_color = ch;
-}
-
-inline color_t
-TextCanvas::back_color() const
-{
-    return m_back_color;
-}
-inline void
-TextCanvas::back_color(color_t ch)
-{
-    m_back_color = ch;
-}
-
-inline void
-TextCanvas::move_to(coord_t x, coord_t y)
-{
-    m_pos.x = x;
-    m_pos.y = y;
-}
-inline void
-TextCanvas::move_to(const Point& p)
-{
-    m_pos = p;
-}
-
-///////////////////////////////////////////////////////////////////////////
-
-inline bool
-TextCanvas::get_dot(coord_t x, coord_t y) const
-{
-    return get_pixel(x, y) == fore_color();
-}
-inline void
-TextCanvas::put_dot(coord_t x, coord_t y, bool dot)
-{
-    if (dot)
-        put_pixel(x, y, fore_color());
-    else
-        put_pixel(x, y, back_color());
-}
-
-inline bool
-TextCanvas::in_range(coord_t x, coord_t y) const
-{
-    return (0 <= x && x < width() && 0 <= y && y < height());
-}
-inline bool
-TextCanvas::in_range(const Point& p) const
-{
-    return in_range(p.x, p.y);
-}
-
-inline bool
-TextCanvas::same_size(const TextCanvas& tc) const
-{
-    return width() == tc.width() && height() == tc.height();
-}
-
-inline void
-TextCanvas::clear()
-{
-    clear(back_color());
-}
-inline void
-TextCanvas::reset(coord_t width, coord_t height)
-{
-    reset(width, height, back_color());
-}
-
-inline void
-TextCanvas::resize(coord_t width_, coord_t height_)
-{
-    resize(width_, height_, back_color());
-}
-
-inline TextCanvas operator!(const TextCanvas& bin)
-{
-    TextCanvas ret(bin.width(), bin.height(), zero);
-    for (coord_t i = 0; i < bin.count(); ++i) {
-        ret[i] = !bin[i];
-    }
-    return ret;
-}
-inline TextCanvas operator&(const TextCanvas& bin1, const TextCanvas& bin2)
-{
-    assert(bin1.same_size(bin2));
-    TextCanvas ret(bin1.width(), bin1.height(), zero);
-    for (coord_t i = 0; i < bin1.count(); ++i) {
-        ret[i] = bin1[i] & bin2[i];
-    }
-    return ret;
-}
-inline TextCanvas
-operator|(const TextCanvas& bin1, const TextCanvas& bin2)
-{
-    assert(bin1.same_size(bin2));
-    TextCanvas ret(bin1.width(), bin1.height(), zero);
-    for (coord_t i = 0; i < bin1.count(); ++i) {
-        ret[i] = bin1[i] | bin2[i];
-    }
-    return ret;
-}
-inline TextCanvas
-operator^(const TextCanvas& bin1, const TextCanvas& bin2)
-{
-    assert(bin1.same_size(bin2));
-    TextCanvas ret(bin1.width(), bin1.height(), zero);
-    for (coord_t i = 0; i < bin1.count(); ++i) {
-        ret[i] = bin1[i] ^ bin2[i];
-    }
-    return ret;
-}
-
-inline void
-TextCanvas::fill(const TextCanvas& bin)
-{
-    assert(same_size(bin));
-    for (coord_t i = 0; i < count(); ++i) {
-        if (bin[i]) {
-            data()[i] = fore_color();
-        }
-    }
-}
-inline void
-TextCanvas::do_mask(const TextCanvas& image, const TextCanvas& mask)
-{
-    assert(same_size(image));
-    assert(same_size(mask));
-    for (coord_t i = 0; i < count(); ++i) {
-        if (mask[i] && image[i]) {
-            data()[i] = image[i];
-        }
-    }
-}
-
-inline void
-TextCanvas::get_subimage(TextCanvas& image,
-                         coord_t x0,
-                         coord_t y0,
-                         coord_t x1,
-                         coord_t y1) const
-{
-    if (x0 > x1)
-        std::swap(x0, x1);
-    if (y0 > y1)
-        std::swap(y0, y1);
-
-    coord_t width = x1 - x0 + 1;
-    coord_t height = y1 - y0 + 1;
-    if (width != image.width() || height != image.height()) {
-        image.reset(width, height);
-    }
-
-    coord_t py = 0;
-    for (coord_t y = y0; y <= y1; ++y) {
-        coord_t px = 0;
-        for (coord_t x = x0; x <= x1; ++x) {
-            color_t ch = get_pixel(x, y);
-            image.put_pixel(px, py, ch);
-            ++px;
-        }
-        ++py;
-    }
-}
-inline void
-TextCanvas::get_subimage(XbmImage& image,
-                         coord_t x0,
-                         coord_t y0,
-                         coord_t x1,
-                         coord_t y1) const
-{
-    if (x0 > x1)
-        std::swap(x0, x1);
-    if (y0 > y1)
-        std::swap(y0, y1);
-
-    coord_t width = x1 - x0 + 1;
-    coord_t height = y1 - y0 + 1;
-    if (image.width() != width || image.height() != height) {
-        image.reset(width, height);
-    }
-
-    coord_t py = 0;
-    for (coord_t y = y0; y <= y1; ++y) {
-        coord_t px = 0;
-        for (coord_t x = x0; x <= x1; ++x) {
-            image.put_dot(px, py, get_dot(x, y));
-            ++px;
-        }
-        ++py;
-    }
-}
-
-inline void
-TextCanvas::get_subimage(TextCanvas& image, Point& p0, Point& p1) const
-{
-    get_subimage(image, p0.x, p0.y, p1.x, p1.y);
-}
-inline void
-TextCanvas::get_subimage(XbmImage& image, Point& p0, Point& p1) const
-{
-    get_subimage(image, p0.x, p0.y, p1.x, p1.y);
-}
-
-inline void
-TextCanvas::put_subimage(coord_t x0, coord_t y0, const TextCanvas& image)
-{
-    for (coord_t py = 0; py < image.height(); ++py) {
-        for (coord_t px = 0; px < image.width(); ++px) {
-            put_pixel(x0 + px, y0 + py, image.get_pixel(px, py));
-        }
-    }
-}
-inline void
-TextCanvas::put_subimage(coord_t x0, coord_t y0, const XbmImage& image)
-{
-    for (coord_t py = 0; py < image.height(); ++py) {
-        for (coord_t px = 0; px < image.width(); ++px) {
-            put_dot(x0 + px, y0 + py, image.get_dot(px, py));
-        }
-    }
-}
-
-template<typename T_PUTTER0, typename T_PUTTER1>
-inline void
-TextCanvas::put_subimage(coord_t x0,
-                         coord_t y0,
-                         const TextCanvas& image,
-                         T_PUTTER0& fore,
-                         T_PUTTER1& back)
-{
-    for (coord_t py = 0; py < image.height(); ++py) {
-        for (coord_t px = 0; px < image.width(); ++px) {
-            if (image.get_dot(px, py))
-                fore(x0 + px, y0 + py);
-            else
-                back(x0 + px, y0 + py);
-        }
-    }
-}
-template<typename T_PUTTER0, typename T_PUTTER1>
-inline void
-TextCanvas::put_subimage(coord_t x0,
-                         coord_t y0,
-                         const XbmImage& image,
-                         T_PUTTER0& fore,
-                         T_PUTTER1& back)
-{
-    for (coord_t py = 0; py < image.height(); ++py) {
-        for (coord_t px = 0; px < image.width(); ++px) {
-            if (image.get_dot(px, py))
-                fore(x0 + px, y0 + py);
-            else
-                back(x0 + px, y0 + py);
-        }
-    }
-}
-
-template<typename T_CONVERTER, typename T_PUTTER0, typename T_PUTTER1>
-inline Size
-TextCanvas::put_char(coord_t x0,
-                     coord_t y0,
-                     const XbmFont& font,
-                     coord_t iColumn,
-                     coord_t iRow,
-                     T_CONVERTER& conv,
-                     T_PUTTER0& fore,
-                     T_PUTTER1& back)
-{
-    assert(0 <= iColumn && iColumn < font.columns());
-    assert(0 <= iRow && iRow < font.rows());
-    coord_t qx0 = iColumn * font.cell_width();
-    coord_t qy0 = iRow * font.cell_height();
-    coord_t qx1 = qx0 + font.cell_width() - 1;
-    coord_t qy1 = qy0 + font.cell_height() - 1;
-    TextCanvas other;
-    font.get_subimage(other, qx0, qy0, qx1, qy1);
-    conv(other);
-    put_subimage(x0, y0, other, fore, back);
-    return Size(other.width(), other.height());
-}
-template<typename T_CONVERTER, typename T_PUTTER0, typename T_PUTTER1>
-inline Size
-TextCanvas::put_char(coord_t x0,
-                     coord_t y0,
-                     const XbmFont& font,
-                     coord_t char_code,
-                     T_CONVERTER& conv,
-                     T_PUTTER0& fore,
-                     T_PUTTER1& back)
-{
-    coord_t iColumn = coord_t(char_code % font.columns());
-    coord_t iRow = coord_t(char_code / font.columns());
-    return put_char(x0, y0, font, iColumn, iRow, conv, fore, back);
-}
-template<typename T_CONVERTER>
-inline Size
-TextCanvas::put_char(coord_t x0,
-                     coord_t y0,
-                     const XbmFont& font,
-                     coord_t iColumn,
-                     coord_t iRow,
-                     T_CONVERTER& conv)
-{
-    ColorPutter fore(*this, fore_color());
-    ColorPutter back(*this, back_color());
-    return put_char(x0, y0, font, iColumn, iRow, conv, fore, back);
-}
-template<typename T_CONVERTER>
-inline Size
-TextCanvas::put_char(coord_t x0,
-                     coord_t y0,
-                     const XbmFont& font,
-                     coord_t char_code,
-                     T_CONVERTER& conv)
-{
-    coord_t iColumn = coord_t(char_code % font.columns());
-    coord_t iRow = coord_t(char_code / font.columns());
-    return put_char(x0, y0, font, iColumn, iRow, conv);
-}
-inline Size
-TextCanvas::put_char(coord_t x0,
-                     coord_t y0,
-                     const XbmFont& font,
-                     coord_t iColumn,
-                     coord_t iRow)
-{
-    NoneConverter conv;
-    return put_char(x0, y0, font, iColumn, iRow, conv);
-}
-inline Size
-TextCanvas::put_char(coord_t x0,
-                     coord_t y0,
-                     const XbmFont& font,
-                     coord_t char_code)
-{
-    NoneConverter conv;
-    return put_char(x0, y0, font, char_code, conv);
-}
-
-template<typename T_CONVERTER, typename T_PUTTER0, typename T_PUTTER1>
-inline Size
-TextCanvas::jis_put_char(coord_t x0,
-                         coord_t y0,
-                         const XbmFont& font,
-                         coord_t jis_code,
-                         T_CONVERTER& conv,
-                         T_PUTTER0& fore,
-                         T_PUTTER1& back)
-{
-    assert(japanese::is_jis_code(jis_code));
-    coord_t iColumn = uint8_t(jis_code) - 0x21;
-    coord_t iRow = uint8_t(jis_code >> 8) - 0x21;
-    return jis_put_char(x0, y0, font, iColumn, iRow, conv, fore, back);
-}
-template<typename T_CONVERTER, typename T_PUTTER0, typename T_PUTTER1>
-inline Size
-TextCanvas::jis_put_char(coord_t x0,
-                         coord_t y0,
-                         const XbmFont& font,
-                         coord_t iColumn,
-                         coord_t iRow,
-                         T_CONVERTER& conv,
-                         T_PUTTER0& fore,
-                         T_PUTTER1& back)
-{
-    assert(0 <= iColumn && iColumn < font.columns());
-    assert(0 <= iRow && iRow < font.rows());
-    coord_t qx0 = iColumn * font.cell_width();
-    coord_t qy0 = iRow * font.cell_height();
-    coord_t qx1 = qx0 + font.cell_width() - 1;
-    coord_t qy1 = qy0 + font.cell_height() - 1;
-    TextCanvas other;
-    font.get_subimage(other, qx0, qy0, qx1, qy1);
-    conv(other);
-    put_subimage(x0, y0, other, fore, back);
-    return Size(other.width(), other.height());
-}
-template<typename T_CONVERTER>
-inline Size
-TextCanvas::jis_put_char(coord_t x0,
-                         coord_t y0,
-                         const XbmFont& font,
-                         coord_t iColumn,
-                         coord_t iRow,
-                         T_CONVERTER& conv)
-{
-    ColorPutter fore(*this, fore_color());
-    ColorPutter back(*this, back_color());
-    return jis_put_char(x0, y0, font, iColumn, iRow, conv, fore, back);
-}
-template<typename T_CONVERTER>
-inline Size
-TextCanvas::jis_put_char(coord_t x0,
-                         coord_t y0,
-                         const XbmFont& font,
-                         coord_t jis_code,
-                         T_CONVERTER& conv)
-{
-    assert(japanese::is_jis_code(jis_code));
-    coord_t iColumn = uint8_t(jis_code) - 0x21;
-    coord_t iRow = uint8_t(jis_code >> 8) - 0x21;
-    return jis_put_char(x0, y0, font, iColumn, iRow, conv);
-}
-inline Size
-TextCanvas::jis_put_char(coord_t x0,
-                         coord_t y0,
-                         const XbmFont& font,
-                         coord_t iColumn,
-                         coord_t iRow)
-{
-    NoneConverter conv;
-    return jis_put_char(x0, y0, font, iColumn, iRow, conv);
-}
-inline Size
-TextCanvas::jis_put_char(coord_t x0,
-                         coord_t y0,
-                         const XbmFont& font,
-                         coord_t jis_code)
-{
-    NoneConverter conv;
-    return jis_put_char(x0, y0, font, jis_code, conv);
-}
-
-template<typename T_CONVERTER>
-inline void
-TextCanvas::text_to_right(coord_t x0,
-                          coord_t y0,
-                          const XbmFont& font,
-                          const string_type& text,
-                          T_CONVERTER& conv)
-{
-    for (size_t i = 0; i < text.size(); ++i) {
-        x0 += put_char(x0, y0, font, text[i], conv).x;
-    }
-}
-template<typename T_CONVERTER>
-inline void
-TextCanvas::text_to_right(const Point& p0,
-                          const XbmFont& font,
-                          const string_type& text,
-                          T_CONVERTER& conv)
-{
-    text_to_right(p0.x, p0.y, font, text, conv);
-}
-inline void
-TextCanvas::text_to_right(coord_t x0,
-                          coord_t y0,
-                          const XbmFont& font,
-                          const string_type& text)
-{
-    for (size_t i = 0; i < text.size(); ++i) {
-        x0 += put_char(x0, y0, font, text[i]).x;
-    }
-}
-inline void
-TextCanvas::text_to_right(const Point& p0,
-                          const XbmFont& font,
-                          const string_type& text)
-{
-    text_to_right(p0.x, p0.y, font, text);
-}
-
-inline void
-TextCanvas::sjis_text_to_right(coord_t x0,
-                               coord_t y0,
-                               const XbmFont& zenkaku_font,
-                               const XbmFont& hankaku_font,
-                               const string_type& text)
-{
-    NoneConverter conv;
-    sjis_text_to_right(x0, y0, zenkaku_font, hankaku_font, text, conv);
-}
-inline void
-TextCanvas::sjis_text_to_right(const Point& p0,
-                               const XbmFont& zenkaku_font,
-                               const XbmFont& hankaku_font,
-                               const string_type& text)
-{
-    NoneConverter conv;
-    sjis_text_to_right(p0.x, p0.y, zenkaku_font, hankaku_font, text, conv);
-}
-template<typename T_CONVERTER>
-inline void
-TextCanvas::sjis_text_to_right(coord_t x0,
-                               coord_t y0,
-                               const XbmFont& zenkaku_font,
-                               const XbmFont& hankaku_font,
-                               const string_type& text,
-                               T_CONVERTER& conv)
-{
-    for (size_t i = 0; i < text.size(); ++i) {
-        if (i + 1 < text.size() && japanese::is_sjis_lead(text[i]) &&
-            japanese::is_sjis_trail(text[i + 1])) {
-            uint16_t jis_code = japanese::sjis2jis(text[i], text[i + 1]);
-            x0 += jis_put_char(x0, y0, zenkaku_font, jis_code, conv).x;
-            ++i;
-        } else {
-            x0 += put_char(x0, y0, hankaku_font, (uint8_t)text[i], conv).x;
-        }
-    }
-}
-template<typename T_CONVERTER>
-inline void
-TextCanvas::sjis_text_to_right(const Point& p0,
-                               const XbmFont& zenkaku_font,
-                               const XbmFont& hankaku_font,
-                               const string_type& text,
-                               T_CONVERTER& conv)
-{
-    sjis_text_to_right(p0.x, p0.y, zenkaku_font, hankaku_font, text, conv);
-}
-
-inline void
-TextCanvas::flood_fill(coord_t x, coord_t y, color_t ch, bool surface)
-{
-    if (surface)
-        flood_fill_surface(x, y, ch);
-    else
-        flood_fill_bordered(x, y, ch);
-}
-inline void
-TextCanvas::flood_fill(const Point& p, color_t ch, bool surface)
-{
-    flood_fill(p.x, p.y, ch, surface);
-}
-inline void
-TextCanvas::flood_fill_bordered(coord_t x, coord_t y, color_t border_ch)
-{
-    Point p(x, y);
-    if (!in_range(p))
-        return;
-
-    Points points;
-    points.push_back(p);
-
-    std::set<Point, point_less> point_set;
-    point_set.insert(p);
-    for (size_t i = 0; i < points.size(); ++i) {
-        p = points[i];
-        if (get_pixel(p) == border_ch)
-            continue;
-
-        put_pixel(p);
-
-        --p.x; // left
-        if (get_pixel(p) != border_ch && !point_set.count(p)) {
-            points.push_back(p);
-            point_set.insert(p);
-        }
-        ++p.x;
-        --p.y; // up
-        if (get_pixel(p) != border_ch && !point_set.count(p)) {
-            points.push_back(p);
-            point_set.insert(p);
-        }
-        ++p.x;
-        ++p.y; // right
-        if (get_pixel(p) != border_ch && !point_set.count(p)) {
-            points.push_back(p);
-            point_set.insert(p);
-        }
-        --p.x;
-        ++p.y; // down
-        if (get_pixel(p) != border_ch && !point_set.count(p)) {
-            points.push_back(p);
-            point_set.insert(p);
-        }
-    }
-
-    move_to(x, y);
-}
-inline void
-TextCanvas::flood_fill_surface(coord_t x, coord_t y, color_t surface_ch)
-{
-    Point p(x, y);
-    if (!in_range(p))
-        return;
-
-    Points points;
-    points.push_back(p);
-    for (size_t i = 0; i < points.size(); ++i) {
-        p = points[i];
-        if (get_pixel(p) != surface_ch)
-            continue;
-
-        put_pixel(p);
-
-        --p.x; // left
-        if (get_pixel(p) == surface_ch)
-            points.push_back(p);
-        ++p.x;
-        --p.y; // up
-        if (get_pixel(p) == surface_ch)
-            points.push_back(p);
-        ++p.x;
-        ++p.y; // right
-        if (get_pixel(p) == surface_ch)
-            points.push_back(p);
-        --p.x;
-        ++p.y; // down
-        if (get_pixel(p) == surface_ch)
-            points.push_back(p);
-    }
-
-    move_to(x, y);
-}
-inline void
-TextCanvas::flood_fill_bordered(const Point& p, color_t border_ch)
-{
-    flood_fill_bordered(p.x, p.y, border_ch);
-}
-inline void
-TextCanvas::flood_fill_surface(const Point& p, color_t surface_ch)
-{
-    flood_fill_surface(p.x, p.y, surface_ch);
-}
-
-inline void
-TextCanvas::line_to(coord_t x, coord_t y)
-{
-    line(pos().x, pos().y, x, y);
-}
-inline void
-TextCanvas::line_to(const Point& p)
-{
-    line(pos(), p);
-}
-template<typename T_PUTTER>
-inline void
-TextCanvas::line_to(coord_t x, coord_t y, T_PUTTER& putter)
-{
-    line(pos().x, pos().y, x, y, putter);
-}
-template<typename T_PUTTER>
-inline void
-TextCanvas::line_to(const Point& p, T_PUTTER& putter)
-{
-    line_to(p.x, p.y, putter);
-}
-
-inline void
-TextCanvas::line(coord_t x0, coord_t y0, coord_t x1, coord_t y1)
-{
-    SimplePutter putter(*this);
-    line(x0, y0, x1, y1, putter);
-}
-inline void
-TextCanvas::line(const Point& p0, const Point& p1)
-{
-    line(p0.x, p0.y, p1.x, p1.y);
-}
-template<typename T_PUTTER>
-inline void
-TextCanvas::line(coord_t x0,
-                 coord_t y0,
-                 coord_t x1,
-                 coord_t y1,
-                 T_PUTTER& putter)
-{
-    // Bresenham's line algorithm
-    const coord_t dx = std::abs(x1 - x0), dy = std::abs(y1 - y0);
-    const coord_t sx = (x0 < x1) ? 1 : -1, sy = (y0 < y1) ? 1 : -1;
-    coord_t err = dx - dy;
-    for (;;) {
-        putter(x0, y0);
-        if (x0 == x1 && y0 == y1)
-            break;
-
-        coord_t e2 = err * 2;
-        if (e2 > -dy) {
-            err -= dy;
-            x0 += sx;
-        }
-        if (e2 < dx) {
-            err += dx;
-            y0 += sy;
-        }
-    }
-
-    move_to(x1, y1);
-}
-
-inline void
-TextCanvas::rectangle(coord_t x0, coord_t y0, coord_t x1, coord_t y1)
-{
-    SimplePutter putter(*this);
-    rectangle(x0, y0, x1, y1, putter);
-}
-inline void
-TextCanvas::rectangle(const Point& p0, const Point& p1)
-{
-    rectangle(p0.x, p0.y, p1.x, p1.y);
-}
-template<typename T_PUTTER>
-inline void
-TextCanvas::rectangle(coord_t x0,
-                      coord_t y0,
-                      coord_t x1,
-                      coord_t y1,
-                      T_PUTTER& putter)
-{
-    line(x0, y0, x1, y0, putter);
-    line(x1, y0, x1, y1, putter);
-    line(x1, y1, x0, y1, putter);
-    line(x0, y1, x0, y0, putter);
-
-    move_to(x1, y1);
-}
-
-inline void
-TextCanvas::fill_rectangle(coord_t x0, coord_t y0, coord_t x1, coord_t y1)
-{
-    SimplePutter putter(*this);
-    fill_rectangle(x0, y0, x1, y1, putter);
-}
-inline void
-TextCanvas::fill_rectangle(const Point& p0, const Point& p1)
-{
-    fill_rectangle(p0.x, p0.y, p1.x, p1.y);
-}
-template<typename T_PUTTER>
-inline void
-TextCanvas::fill_rectangle(coord_t x0,
-                           coord_t y0,
-                           coord_t x1,
-                           coord_t y1,
-                           T_PUTTER& putter)
-{
-    const coord_t x2 = x1, y2 = y1;
-    if (x0 > x1)
-        std::swap(x0, x1);
-    if (y0 > y1)
-        std::swap(y0, y1);
-    if (x0 < 0)
-        x0 = 0;
-    if (x1 > width())
-        x1 = width() - 1;
-    if (y0 < 0)
-        y0 = 0;
-    if (y1 > height())
-        y1 = height() - 1;
-    for (coord_t y = y0; y <= y1; ++y) {
-        for (coord_t x = x0; x <= x1; ++x) {
-            putter(x, y);
-        }
-    }
-
-    move_to(x2, y2);
-}
-
-inline void
-TextCanvas::circle(coord_t x0, coord_t y0, coord_t r)
-{
-    SimplePutter putter(*this);
-    circle(x0, y0, r, putter);
-}
-inline void
-TextCanvas::circle(const Point& c, coord_t r)
-{
-    circle(c.x, c.y, r);
-}
-template<typename T_PUTTER>
-inline void
-TextCanvas::circle(coord_t x0, coord_t y0, coord_t r, T_PUTTER& putter)
-{
-    coord_t x = r, y = 0;
-    coord_t f = 3 - 2 * x;
-
-    while (x >= y) {
-        putter(x0 + x, y0 + y);
-        putter(x0 - x, y0 + y);
-        putter(x0 + x, y0 - y);
-        putter(x0 - x, y0 - y);
-        putter(x0 + y, y0 + x);
-        putter(x0 - y, y0 + x);
-        putter(x0 + y, y0 - x);
-        putter(x0 - y, y0 - x);
-        if (f >= 0) {
-            --x;
-            f -= 4 * x;
-        }
-        ++y;
-        f += 4 * y + 2;
-    }
-
-    move_to(x0, y0);
-}
-
-inline void
-TextCanvas::fill_circle(coord_t x0, coord_t y0, coord_t r)
-{
-    SimplePutter putter(*this);
-    fill_circle(x0, y0, r, putter);
-}
-inline void
-TextCanvas::fill_circle(const Point& c, coord_t r)
-{
-    fill_circle(c.x, c.y, r);
-}
-template<typename T_PUTTER>
-inline void
-TextCanvas::fill_circle(coord_t x0, coord_t y0, coord_t r, T_PUTTER& putter)
-{
-    coord_t x = r, y = 0;
-    coord_t f = 3 - 2 * x;
-
-    while (x >= y) {
-        for (coord_t px = x0 - x; px <= x0 + x; ++px) {
-            putter(px, y0 + y);
-            putter(px, y0 - y);
-        }
-        for (coord_t px = x0 - y; px <= x0 + y; ++px) {
-            putter(px, y0 + x);
-            putter(px, y0 - x);
-        }
-        if (f >= 0) {
-            --x;
-            f -= 4 * x;
-        }
-        ++y;
-        f += 4 * y + 2;
-    }
-
-    move_to(x0, y0);
-}
-
-template<typename T_PUTTER>
-inline void
-TextCanvas::ellipse(coord_t x0,
-                    coord_t y0,
-                    coord_t x1,
-                    coord_t y1,
-                    T_PUTTER& putter)
-{
-    if (x0 > x1)
-        std::swap(x0, x1);
-    if (y0 > y1)
-        std::swap(y0, y1);
-
-    coord_t dx = x1 - x0, dy = y1 - y0;
-    double u = dx * 0.5, v = dy * 0.5;
-    coord_t u0 = coord_t(u), v0 = coord_t(v);
-    double px = x0 + u, py = y0 + v;
-
-    if (dx <= 1 || dy <= 1) {
-        for (coord_t y = y0; y <= y1; ++y) {
-            for (coord_t x = x0; x <= x1; ++x) {
-                putter(x, y);
-            }
-        }
-
-        move_to(do_round(px), do_round(py));
-        return;
-    }
-
-    if (dy & 1)
-        --py;
-    double a = double(v * v);
-    double b = double(u * u);
-    double r = double(u * v);
-    double x = double(u), y = 0;
-    double d = u * (v * v);
-    double F = (double)(-2.0 * d) + a + 2 * b;
-    double H = (double)(-4.0 * d) + 2 * a + b;
-
-    if (!(dy & 1) && dx < 3) {
-        putter(coord_t(px + x), do_round(py + y));
-        putter(coord_t(px - x), do_round(py + y));
-    }
-
-    while (x >= 0) {
-        if (dy & 1) {
-            putter(do_round(px + x), do_round(py + y) + 1);
-            putter(do_round(px - x), do_round(py + y) + 1);
-            putter(do_round(px + x), do_round(py - y));
-            putter(do_round(px - x), do_round(py - y));
-        } else if (dx < 3) {
-            putter(do_round(px + x), do_round(py + y) + 1);
-            putter(do_round(px - x), do_round(py + y) + 1);
-            putter(do_round(px + x), do_round(py - y) - 1);
-            putter(do_round(px - x), do_round(py - y) - 1);
-        } else {
-            putter(do_round(px + x), do_round(py + y));
-            putter(do_round(px - x), do_round(py + y));
-            putter(do_round(px + x), do_round(py - y));
-            putter(do_round(px - x), do_round(py - y));
-        }
-        if (F >= 0) {
-            x -= 1;
-            F -= 4 * a * x;
-            H -= 4 * a * x - 2 * a;
-        }
-        if (H < 0) {
-            y += 1;
-            F += 4 * b * y + 2 * b;
-            H += 4 * b * y;
-        }
-    }
-    y += 1;
-    while (y <= v0) {
-        if (dy & 1) {
-            if (!(dx & 1)) {
-                putter(do_round(px), do_round(py - y));
-                putter(do_round(px), do_round(py + y) + 1);
-            }
-        } else {
-            if (dx & 1) {
-                putter(do_round(px), do_round(py - y));
-                putter(do_round(px), do_round(py + y));
-                putter(do_round(px) - 1, do_round(py - y));
-                putter(do_round(px) - 1, do_round(py + y));
-            } else {
-                putter(do_round(px), do_round(py - y));
-                putter(do_round(px), do_round(py + y));
-            }
-        }
-        y += 1;
-    }
-
-    move_to(do_round(px), do_round(py));
-}
-template<typename T_PUTTER>
-inline void
-TextCanvas::fill_ellipse(coord_t x0,
-                         coord_t y0,
-                         coord_t x1,
-                         coord_t y1,
-                         T_PUTTER& putter)
-{
-    if (x0 > x1)
-        std::swap(x0, x1);
-    if (y0 > y1)
-        std::swap(y0, y1);
-
-    coord_t dx = x1 - x0, dy = y1 - y0;
-    double u = dx * 0.5, v = dy * 0.5;
-    coord_t u0 = coord_t(u), v0 = coord_t(v);
-    double px = x0 + u, py = y0 + v;
-
-    if (dx <= 1 || dy <= 1) {
-        for (coord_t y = y0; y <= y1; ++y) {
-            for (coord_t x = x0; x <= x1; ++x) {
-                putter(x, y);
-            }
-        }
-
-        move_to(do_round(px), do_round(py));
-        return;
-    }
-
-    if (dy & 1)
-        --py;
-    double a = double(v * v);
-    double b = double(u * u);
-    double r = double(u * v);
-    double x = double(u), y = 0;
-    double d = u * (v * v);
-    double F = (double)(-2.0 * d) + a + 2 * b;
-    double H = (double)(-4.0 * d) + 2 * a + b;
-
-    if (!(dy & 1) && dx < 3) {
-        for (coord_t qx = do_round(px - x); qx <= do_round(px + x); ++qx) {
-            putter(qx, do_round(py + y));
-        }
-    }
-
-    while (x >= 0) {
-        if (dy & 1) {
-            for (coord_t qx = do_round(px - x); qx <= do_round(px + x); ++qx) {
-                putter(qx, do_round(py + y) + 1);
-                putter(qx, do_round(py - y));
-            }
-        } else if (dx < 3) {
-            for (coord_t qx = do_round(px - x); qx <= do_round(px + x); ++qx) {
-                putter(qx, do_round(py + y) + 1);
-                putter(qx, do_round(py - y) - 1);
-            }
-        } else {
-            for (coord_t qx = do_round(px - x); qx <= do_round(px + x); ++qx) {
-                putter(qx, do_round(py + y));
-                putter(qx, do_round(py - y));
-            }
-        }
-        if (F >= 0) {
-            x -= 1;
-            F -= 4 * a * x;
-            H -= 4 * a * x - 2 * a;
-        }
-        if (H < 0) {
-            y += 1;
-            F += 4 * b * y + 2 * b;
-            H += 4 * b * y;
-        }
-    }
-    y += 1;
-    while (y <= v0) {
-        if (dy & 1) {
-            if (!(dx & 1)) {
-                putter(do_round(px), do_round(py - y));
-                putter(do_round(px), do_round(py + y) + 1);
-            }
-        } else {
-            if (dx & 1) {
-                putter(do_round(px), do_round(py - y));
-                putter(do_round(px), do_round(py + y));
-                putter(do_round(px) - 1, do_round(py - y));
-                putter(do_round(px) - 1, do_round(py + y));
-            } else {
-                putter(do_round(px), do_round(py - y));
-                putter(do_round(px), do_round(py + y));
-            }
-        }
-        y += 1;
-    }
-
-    move_to(do_round(px), do_round(py));
-}
-
-inline void
-TextCanvas::ellipse(coord_t x0, coord_t y0, coord_t x1, coord_t y1)
-{
-    SimplePutter putter(*this);
-    ellipse(x0, y0, x1, y1, putter);
-}
-inline void
-TextCanvas::fill_ellipse(coord_t x0, coord_t y0, coord_t x1, coord_t y1)
-{
-    SimplePutter putter(*this);
-    fill_ellipse(x0, y0, x1, y1, putter);
-}
-
-template<typename T_PUTTER>
-inline void
-TextCanvas::arc(coord_t x0,
-                coord_t y0,
-                coord_t x1,
-                coord_t y1,
-                double start_radian,
-                double end_radian,
-                bool clockwise,
-                T_PUTTER& putter)
-{
-    bool whole_range = fabs(end_radian - start_radian) >= 2 * pi;
-    start_radian = normalize_radian(start_radian);
-    end_radian = normalize_radian(end_radian);
-    if (start_radian > end_radian) {
-        std::swap(start_radian, end_radian);
-        clockwise = !clockwise;
-    }
-
-    if (x0 > x1)
-        std::swap(x0, x1);
-    if (y0 > y1)
-        std::swap(y0, y1);
-
-    coord_t dx = x1 - x0, dy = y1 - y0;
-    double u = dx * 0.5, v = dy * 0.5;
-    coord_t u0 = coord_t(u), v0 = coord_t(v);
-    double px = x0 + u, py = y0 + v;
-
-    struct PUTTER
-    {
-        T_PUTTER& putter;
-        double px, py, u, v;
-        double start_radian, end_radian;
-        bool clockwise, whole_range;
-        PUTTER(T_PUTTER& putter_,
-               double px_,
-               double py_,
-               double u_,
-               double v_,
-               double start_radian_,
-               double end_radian_,
-               bool clockwise_,
-               bool whole_range_)
-          : putter(putter_)
-          , px(px_)
-          , py(py_)
-          , u(u_)
-          , v(v_)
-          , start_radian(start_radian_)
-          , end_radian(end_radian_)
-          , clockwise(clockwise_)
-          , whole_range(whole_range_)
-        {}
-        bool check(double& at, coord_t x, coord_t y) const
-        {
-            at = atan2(-u * (y - py), v * (x - px));
-            return whole_range ||
-                   check_range(at, clockwise, start_radian, end_radian);
-        }
-        void operator()(coord_t x, coord_t y)
-        {
-            double at;
-            if (check(at, x, y)) {
-                putter(x, y);
-            }
-        }
-    } another_putter(
-      putter, px, py, u, v, start_radian, end_radian, clockwise, whole_range);
-    ellipse(x0, y0, x1, y1, another_putter);
-}
-inline void
-TextCanvas::arc(coord_t x0,
-                coord_t y0,
-                coord_t x1,
-                coord_t y1,
-                double start_radian,
-                double end_radian,
-                bool clockwise)
-{
-    SimplePutter putter(*this);
-    arc(x0, y0, x1, y1, start_radian, end_radian, clockwise, putter);
-}
-
-template<typename T_PUTTER>
-inline void
-TextCanvas::arc_to(coord_t x0,
-                   coord_t y0,
-                   coord_t x1,
-                   coord_t y1,
-                   double start_radian,
-                   double end_radian,
-                   bool clockwise,
-                   T_PUTTER& putter)
-{
-    Point old_pos = pos();
-
-    bool whole_range = fabs(end_radian - start_radian) >= 2 * pi;
-    start_radian = normalize_radian(start_radian);
-    end_radian = normalize_radian(end_radian);
-    if (start_radian > end_radian) {
-        std::swap(start_radian, end_radian);
-        clockwise = !clockwise;
-    }
-
-    if (x0 > x1)
-        std::swap(x0, x1);
-    if (y0 > y1)
-        std::swap(y0, y1);
-
-    coord_t dx = x1 - x0, dy = y1 - y0;
-    double u = dx * 0.5, v = dy * 0.5;
-    coord_t u0 = coord_t(u), v0 = coord_t(v);
-    double px = x0 + u, py = y0 + v;
-
-    struct PUTTER
-    {
-        T_PUTTER& putter;
-        double px, py, u, v;
-        double start_radian, end_radian;
-        bool clockwise, whole_range;
-        double q_radian, qx, qy;
-        double r_radian, rx, ry;
-        PUTTER(T_PUTTER& putter_,
-               double px_,
-               double py_,
-               double u_,
-               double v_,
-               double start_radian_,
-               double end_radian_,
-               bool clockwise_,
-               bool whole_range_,
-               double q_radian_,
-               double qx_,
-               double qy_,
-               double r_radian_,
-               double rx_,
-               double ry_)
-          : putter(putter_)
-          , px(px_)
-          , py(py_)
-          , u(u_)
-          , v(v_)
-          , start_radian(start_radian_)
-          , end_radian(end_radian_)
-          , clockwise(clockwise_)
-          , whole_range(whole_range_)
-          , q_radian(q_radian_)
-          , qx(qx_)
-          , qy(qy_)
-          , r_radian(r_radian_)
-          , rx(rx_)
-          , ry(ry_)
-        {}
-        bool check(double& at, coord_t x, coord_t y) const
-        {
-            at = atan2(-u * (y - py), v * (x - px));
-            return whole_range ||
-                   check_range(at, clockwise, start_radian, end_radian);
-        }
-        void operator()(coord_t x, coord_t y)
-        {
-            double at;
-            if (check(at, x, y)) {
-                putter(x, y);
-                update(at, x, y);
-            }
-        }
-        void update(double at, coord_t x, coord_t y)
-        {
-            if (fabs(at - start_radian) < fabs(q_radian - start_radian)) {
-                q_radian = at;
-                qx = double(x);
-                qy = double(y);
-            }
-            if (fabs(at - end_radian) < fabs(r_radian - end_radian)) {
-                r_radian = at;
-                rx = double(x);
-                ry = double(y);
-            }
-        }
-    } another_putter(putter,
-                     px,
-                     py,
-                     u,
-                     v,
-                     start_radian,
-                     end_radian,
-                     clockwise,
-                     whole_range,
-                     100,
-                     px,
-                     py,
-                     -100,
-                     px,
-                     py);
-    ellipse(x0, y0, x1, y1, another_putter);
-    line(old_pos.x,
-         old_pos.y,
-         do_round(another_putter.qx),
-         do_round(another_putter.qy),
-         putter);
-}
-inline void
-TextCanvas::arc_to(coord_t x0,
-                   coord_t y0,
-                   coord_t x1,
-                   coord_t y1,
-                   double start_radian,
-                   double end_radian,
-                   bool clockwise)
-{
-    SimplePutter putter(*this);
-    arc_to(x0, y0, x1, y1, start_radian, end_radian, clockwise, putter);
-}
-
-template<typename T_PUTTER>
-inline void
-TextCanvas::pie(coord_t x0,
-                coord_t y0,
-                coord_t x1,
-                coord_t y1,
-                double start_radian,
-                double end_radian,
-                T_PUTTER& putter)
-{
-    bool clockwise = false;
-    bool whole_range = fabs(end_radian - start_radian) >= 2 * pi;
-    start_radian = normalize_radian(start_radian);
-    end_radian = normalize_radian(end_radian);
-    if (start_radian > end_radian) {
-        std::swap(start_radian, end_radian);
-        clockwise = !clockwise;
-    }
-
-    if (x0 > x1)
-        std::swap(x0, x1);
-    if (y0 > y1)
-        std::swap(y0, y1);
-
-    coord_t dx = x1 - x0, dy = y1 - y0;
-    double u = dx * 0.5, v = dy * 0.5;
-    coord_t u0 = coord_t(u), v0 = coord_t(v);
-    double px = x0 + u, py = y0 + v;
-
-    struct PUTTER
-    {
-        T_PUTTER& putter;
-        double px, py, u, v;
-        double start_radian, end_radian;
-        bool clockwise, whole_range;
-        double q_radian, qx, qy;
-        double r_radian, rx, ry;
-        PUTTER(T_PUTTER& putter_,
-               double px_,
-               double py_,
-               double u_,
-               double v_,
-               double start_radian_,
-               double end_radian_,
-               bool clockwise_,
-               bool whole_range_,
-               double q_radian_,
-               double qx_,
-               double qy_,
-               double r_radian_,
-               double rx_,
-               double ry_)
-          : putter(putter_)
-          , px(px_)
-          , py(py_)
-          , u(u_)
-          , v(v_)
-          , start_radian(start_radian_)
-          , end_radian(end_radian_)
-          , clockwise(clockwise_)
-          , whole_range(whole_range_)
-          , q_radian(q_radian_)
-          , qx(qx_)
-          , qy(qy_)
-          , r_radian(r_radian_)
-          , rx(rx_)
-          , ry(ry_)
-        {}
-        bool check(double& at, coord_t x, coord_t y) const
-        {
-            at = atan2(-u * (y - py), v * (x - px));
-            return whole_range ||
-                   check_range(at, clockwise, start_radian, end_radian);
-        }
-        void operator()(coord_t x, coord_t y)
-        {
-            double at;
-            if (check(at, x, y)) {
-                putter(x, y);
-                update(at, x, y);
-            }
-        }
-        void update(double at, coord_t x, coord_t y)
-        {
-            if (fabs(at - start_radian) < fabs(q_radian - start_radian)) {
-                q_radian = at;
-                qx = double(x);
-                qy = double(y);
-            }
-            if (fabs(at - end_radian) < fabs(r_radian - end_radian)) {
-                r_radian = at;
-                rx = double(x);
-                ry = double(y);
-            }
-        }
-    } another_putter(putter,
-                     px,
-                     py,
-                     u,
-                     v,
-                     start_radian,
-                     end_radian,
-                     clockwise,
-                     whole_range,
-                     100,
-                     px,
-                     py,
-                     -100,
-                     px,
-                     py);
-    ellipse(x0, y0, x1, y1, another_putter);
-
-    line(coord_t(px),
-         coord_t(py),
-         do_round(another_putter.qx),
-         do_round(another_putter.qy),
-         putter);
-    line(coord_t(px),
-         coord_t(py),
-         do_round(another_putter.rx),
-         do_round(another_putter.ry),
-         putter);
-}
-
-inline void
-TextCanvas::pie(coord_t x0,
-                coord_t y0,
-                coord_t x1,
-                coord_t y1,
-                double start_radian,
-                double end_radian)
-{
-    SimplePutter putter(*this);
-    pie(x0, y0, x1, y1, start_radian, end_radian, putter);
-}
-
-template<typename T_PUTTER>
-inline void
-TextCanvas::fill_pie(coord_t x0,
-                     coord_t y0,
-                     coord_t x1,
-                     coord_t y1,
-                     double start_radian,
-                     double end_radian,
-                     bool clockwise,
-                     T_PUTTER& putter)
-{
-    bool whole_range = fabs(end_radian - start_radian) >= 2 * pi;
-    start_radian = normalize_radian(start_radian);
-    end_radian = normalize_radian(end_radian);
-    if (start_radian > end_radian) {
-        std::swap(start_radian, end_radian);
-        clockwise = !clockwise;
-    }
-
-    if (x0 > x1)
-        std::swap(x0, x1);
-    if (y0 > y1)
-        std::swap(y0, y1);
-
-    coord_t dx = x1 - x0, dy = y1 - y0;
-    double u = dx * 0.5, v = dy * 0.5;
-    coord_t u0 = coord_t(u), v0 = coord_t(v);
-    double px = x0 + u, py = y0 + v;
-
-    struct PUTTER
-    {
-        T_PUTTER& putter;
-        double px, py, u, v;
-        double start_radian, end_radian;
-        bool clockwise, whole_range;
-        PUTTER(T_PUTTER& putter_,
-               double px_,
-               double py_,
-               double u_,
-               double v_,
-               double start_radian_,
-               double end_radian_,
-               bool clockwise_,
-               bool whole_range_)
-          : putter(putter_)
-          , px(px_)
-          , py(py_)
-          , u(u_)
-          , v(v_)
-          , start_radian(start_radian_)
-          , end_radian(end_radian_)
-          , clockwise(clockwise_)
-          , whole_range(whole_range_)
-        {}
-        bool check(double& at, coord_t x, coord_t y) const
-        {
-            at = atan2(-u * (y - py), v * (x - px));
-            return whole_range ||
-                   check_range(at, clockwise, start_radian, end_radian);
-        }
-        void operator()(coord_t x, coord_t y)
-        {
-            double at;
-            if (check(at, x, y)) {
-                putter(x, y);
-            }
-        }
-    } another_putter(
-      putter, px, py, u, v, start_radian, end_radian, clockwise, whole_range);
-    fill_ellipse(x0, y0, x1, y1, another_putter);
-    putter(coord_t(px), coord_t(py));
-}
-inline void
-TextCanvas::fill_pie(coord_t x0,
-                     coord_t y0,
-                     coord_t x1,
-                     coord_t y1,
-                     double start_radian,
-                     double end_radian,
-                     bool clockwise)
-{
-    SimplePutter putter(*this);
-    fill_pie(x0, y0, x1, y1, start_radian, end_radian, clockwise, putter);
-}
-
-inline void
-TextCanvas::ellipse(const Point& p0, const Point& p1)
-{
-    ellipse(p0.x, p0.y, p1.x, p1.y);
-}
-inline void
-TextCanvas::fill_ellipse(const Point& p0, const Point& p1)
-{
-    fill_ellipse(p0.x, p0.y, p1.x, p1.y);
-}
-inline void
-TextCanvas::arc(const Point& p0,
-                const Point& p1,
-                double start_radian,
-                double end_radian,
-                bool clockwise)
-{
-    arc(p0.x, p0.y, p1.x, p1.y, start_radian, end_radian, clockwise);
-}
-inline void
-TextCanvas::arc_to(const Point& p0,
-                   const Point& p1,
-                   double start_radian,
-                   double end_radian,
-                   bool clockwise)
-{
-    arc_to(p0.x, p0.y, p1.x, p1.y, start_radian, end_radian, clockwise);
-}
-inline void
-TextCanvas::pie(const Point& p0,
-                const Point& p1,
-                double start_radian,
-                double end_radian)
-{
-    pie(p0.x, p0.y, p1.x, p1.y, start_radian, end_radian);
-}
-inline void
-TextCanvas::fill_pie(const Point& p0,
-                     const Point& p1,
-                     double start_radian,
-                     double end_radian,
-                     bool clockwise)
-{
-    fill_pie(p0.x, p0.y, p1.x, p1.y, start_radian, end_radian, clockwise);
-}
-
-template<typename T_PUTTER>
-inline void
-TextCanvas::round_rect(coord_t x0,
-                       coord_t y0,
-                       coord_t x1,
-                       coord_t y1,
-                       coord_t rx,
-                       coord_t ry,
-                       T_PUTTER& putter)
-{
-    Point old_pos = pos();
-
-    if (x0 > x1)
-        std::swap(x0, x1);
-    if (y0 > y1)
-        std::swap(y0, y1);
-
-    coord_t dx = x1 - x0, dy = y1 - y0;
-    if (dx <= 2 * rx)
-        rx = dx / 2;
-    if (dy <= 2 * ry)
-        ry = dy / 2;
-
-    line(x0 + rx, y0, x1 - rx, y0, putter);
-    arc(x1 - 2 * rx, y0, x1, y0 + 2 * ry, pi / 2, 0, true, putter);
-    line(x1, y0 + ry, x1, y1 - ry, putter);
-    arc(x1 - 2 * rx, y1 - 2 * ry, x1, y1, 0, pi / -2, true, putter);
-    line(x1 - rx, y1, x0 + rx, y1, putter);
-    arc(x0, y1 - 2 * rx, x0 + 2 * rx, y1, pi / -2, -pi, true, putter);
-    line(x0, y1 - ry, x0, y0 + ry, putter);
-    arc(x0, y0, x0 + 2 * rx, y0 + 2 * ry, pi, pi / 2, true, putter);
-
-    pos() = old_pos;
-}
-inline void
-TextCanvas::round_rect(coord_t x0,
-                       coord_t y0,
-                       coord_t x1,
-                       coord_t y1,
-                       coord_t rx,
-                       coord_t ry)
-{
-    SimplePutter putter(*this);
-    round_rect(x0, y0, x1, y1, rx, ry, putter);
-}
-inline void
-TextCanvas::round_rect(const Point& p0, const Point& p1, coord_t rx, coord_t ry)
-{
-    round_rect(p0.x, p0.y, p1.x, p1.y, rx, ry);
-}
-
-template<typename T_PUTTER>
-inline void
-TextCanvas::fill_round_rect(coord_t x0,
-                            coord_t y0,
-                            coord_t x1,
-                            coord_t y1,
-                            coord_t rx,
-                            coord_t ry,
-                            T_PUTTER& putter)
-{
-    Point old_pos = pos();
-
-    if (x0 > x1)
-        std::swap(x0, x1);
-    if (y0 > y1)
-        std::swap(y0, y1);
-
-    coord_t dx = x1 - x0, dy = y1 - y0;
-    if (dx <= 2 * rx)
-        rx = dx / 2;
-    if (dy <= 2 * ry)
-        ry = dy / 2;
-
-    fill_rectangle(x0 + rx, y0, x1 - rx, y0 + ry, putter);
-    fill_pie(x1 - 2 * rx, y0, x1, y0 + 2 * ry, pi / 2, 0, true, putter);
-    fill_rectangle(x1 - rx, y0 + ry, x1, y1 - ry, putter);
-    fill_pie(x1 - 2 * rx, y1 - 2 * ry, x1, y1, 0, pi / -2, true, putter);
-    fill_rectangle(x1 - rx, y1 - ry, x0 + rx, y1, putter);
-    fill_pie(x0, y1 - 2 * rx, x0 + 2 * rx, y1, pi / -2, -pi, true, putter);
-    fill_rectangle(x0, y1 - ry, x0 + rx, y0 + ry, putter);
-    fill_pie(x0, y0, x0 + 2 * rx, y0 + 2 * ry, pi, pi / 2, true, putter);
-
-    fill_rectangle(x0 + rx, y0 + ry, x1 - rx, y1 - ry, putter);
-
-    pos() = old_pos;
-}
-inline void
-TextCanvas::fill_round_rect(coord_t x0,
-                            coord_t y0,
-                            coord_t x1,
-                            coord_t y1,
-                            coord_t rx,
-                            coord_t ry)
-{
-    SimplePutter putter(*this);
-    fill_round_rect(x0, y0, x1, y1, rx, ry, putter);
-}
-inline void
-TextCanvas::fill_round_rect(const Point& p0,
-                            const Point& p1,
-                            coord_t rx,
-                            coord_t ry)
-{
-    fill_round_rect(p0.x, p0.y, p1.x, p1.y, rx, ry);
-}
-
-inline void
-TextCanvas::lines(size_t num_points, const Point* points)
-{
-    for (size_t i = 0; i < num_points / 2; ++i) {
-        line(points[2 * i], points[2 * i + 1]);
-    }
-}
-inline void
-TextCanvas::lines(const Points& points)
-{
-    lines(points.size(), &points[0]);
-}
-template<typename T_PUTTER>
-inline void
-TextCanvas::lines(size_t num_points, const Point* points, T_PUTTER& putter)
-{
-    for (size_t i = 0; i < num_points / 2; ++i) {
-        line(points[2 * i], points[2 * i + 1], putter);
-    }
-}
-
-inline void
-TextCanvas::polyline(size_t num_points, const Point* points)
-{
-    if (num_points > 0) {
-        move_to(points[0]);
-        for (size_t i = 1; i < num_points; ++i) {
-            line_to(points[i]);
-        }
-    }
-}
-inline void
-TextCanvas::polyline(const Points& points)
-{
-    polyline(points.size(), &points[0]);
-}
-template<typename T_PUTTER>
-inline void
-TextCanvas::polyline(size_t num_points, const Point* points, T_PUTTER& putter)
-{
-    if (num_points > 0) {
-        move_to(points[0]);
-        for (size_t i = 1; i < num_points; ++i) {
-            line_to(points[i], putter);
-        }
-    }
-}
-
-inline void
-TextCanvas::polygon(size_t num_points, const Point* points)
-{
-    SimplePutter putter(*this);
-    polygon(num_points, points, putter);
-}
-inline void
-TextCanvas::polygon(const Points& points)
-{
-    polygon(points.size(), &points[0]);
-}
-template<typename T_PUTTER>
-inline void
-TextCanvas::polygon(size_t num_points, const Point* points, T_PUTTER& putter)
-{
-    if (num_points > 0) {
-        move_to(points[0]);
-        for (size_t i = 1; i < num_points; ++i) {
-            line_to(points[i], putter);
-        }
-        line_to(points[0], putter);
-    }
-}
-
-template<typename T_PUTTER>
-inline void
-TextCanvas::fill_polygon_alternate(const Points& points, T_PUTTER& putter)
-{
-    fill_polygon_alternate(points.size(), &points[0], putter);
-}
-template<typename T_PUTTER>
-inline void
-TextCanvas::fill_polygon_winding(const Points& points, T_PUTTER& putter)
-{
-    fill_polygon_winding(points.size(), &points[0], putter);
-}
-
-template<typename T_PUTTER>
-inline void
-TextCanvas::fill_polygon_alternate(size_t num_points,
-                                   const Point* points,
-                                   T_PUTTER& putter)
-{
-    Point p0, p1;
-    if (get_polygon_box(p0, p1, num_points, points)) {
-        Points new_points(&points[0], &points[num_points]);
-        new_points.push_back(points[0]);
-
-        for (coord_t y = p0.y; y <= p1.y; ++y) {
-            for (coord_t x = p0.x; x <= p1.x; ++x) {
-                if (crossing_number(Point(x, y), new_points) & 1) {
-                    putter(x, y);
-                }
-            }
-        }
-        polyline(num_points + 1, &new_points[0], putter);
-    }
-}
-template<typename T_PUTTER>
-inline void
-TextCanvas::fill_polygon_winding(size_t num_points,
-                                 const Point* points,
-                                 T_PUTTER& putter)
-{
-    Point p0, p1;
-    if (get_polygon_box(p0, p1, num_points, points)) {
-        Points new_points(&points[0], &points[num_points]);
-        new_points.push_back(points[0]);
-
-        for (coord_t y = p0.y; y <= p1.y; ++y) {
-            for (coord_t x = p0.x; x <= p1.x; ++x) {
-                if (winding_number(Point(x, y), new_points)) {
-                    putter(x, y);
-                }
-            }
-        }
-        polyline(num_points + 1, &new_points[0], putter);
-    }
-}
-
-inline void
-TextCanvas::fill_polygon(size_t num_points, const Point* points, bool alternate)
-{
-    SimplePutter putter(*this);
-    if (alternate)
-        fill_polygon_alternate(num_points, points, putter);
-    else
-        fill_polygon_winding(num_points, points, putter);
-}
-inline void
-TextCanvas::fill_polygon(const Points& points, bool alternate)
-{
-    SimplePutter putter(*this);
-    if (alternate)
-        fill_polygon_alternate(points, putter);
-    else
-        fill_polygon_winding(points, putter);
-}
-template<typename T_PUTTER>
-inline void
-TextCanvas::fill_polygon(size_t num_points,
-                         const Point* points,
-                         bool alternate,
-                         T_PUTTER& putter)
-{
-    if (alternate)
-        fill_polygon_alternate(num_points, points, putter);
-    else
-        fill_polygon_winding(num_points, points, putter);
-}
-
-inline void
-TextCanvas::rotate_left(const TextCanvas& other)
-{
-    reset(other.height(), other.width());
-    for (coord_t y = 0; y < other.width(); ++y) {
-        for (coord_t x = 0; x < other.height(); ++x) {
-            color_t ch = other.get_pixel(other.width() - (y + 1), x);
-            put_pixel(x, y, ch);
-        }
-    }
-}
-inline void
-TextCanvas::rotate_right(const TextCanvas& other)
-{
-    reset(other.height(), other.width());
-    for (coord_t y = 0; y < other.width(); ++y) {
-        for (coord_t x = 0; x < other.height(); ++x) {
-            color_t ch = other.get_pixel(y, other.height() - (x + 1));
-            put_pixel(x, y, ch);
-        }
-    }
-}
-inline void
-TextCanvas::rotate_180(const TextCanvas& other)
-{
-    reset(other.width(), other.height());
-    for (coord_t y = 0; y < other.height(); ++y) {
-        for (coord_t x = 0; x < other.width(); ++x) {
-            color_t ch = other.get_pixel(other.width() - (x + 1),
-                                         other.height() - (y + 1));
-            put_pixel(x, y, ch);
-        }
-    }
-}
-
-inline void
-TextCanvas::rotate_left()
-{
-    TextCanvas other;
-    other.rotate_left(*this);
-    swap(other);
-}
-inline void
-TextCanvas::rotate_right()
-{
-    TextCanvas other;
-    other.rotate_right(*this);
-    swap(other);
-}
-inline void
-TextCanvas::rotate_180()
-{
-    TextCanvas other;
-    other.rotate_180(*this);
-    swap(other);
-}
-
-inline void
-TextCanvas::mirror_h(const TextCanvas& other)
-{
-    reset(other.width(), other.height());
-    for (coord_t y = 0; y < other.height(); ++y) {
-        for (coord_t x = 0; x < other.width(); ++x) {
-            color_t ch = other.get_pixel(other.width() - (x + 1), y);
-            put_pixel(x, y, ch);
-        }
-    }
-}
-inline void
-TextCanvas::mirror_v(const TextCanvas& other)
-{
-    reset(other.width(), other.height());
-    for (coord_t y = 0; y < other.height(); ++y) {
-        for (coord_t x = 0; x < other.width(); ++x) {
-            color_t ch = other.get_pixel(x, other.height() - (y + 1));
-            put_pixel(x, y, ch);
-        }
-    }
-}
-
-inline void
-TextCanvas::mirror_h()
-{
-    TextCanvas other;
-    other.mirror_h(*this);
-    swap(other);
-}
-inline void
-TextCanvas::mirror_v()
-{
-    TextCanvas other;
-    other.mirror_v(*this);
-    swap(other);
-}
-
-inline void
-TextCanvas::scale(const TextCanvas& other, coord_t width, coord_t height)
-{
-    reset(width, height);
-
-    for (coord_t py = 0; py < height; ++py) {
-        for (coord_t px = 0; px < width; ++px) {
-            coord_t qx = px * other.width() / width;
-            coord_t qy = py * other.height() / height;
-            color_t ch = other.get_pixel(qx, qy);
-            put_pixel(px, py, ch);
-        }
-    }
-}
-inline void
-TextCanvas::scale_cross(const TextCanvas& other,
-                        coord_t x_multi,
-                        coord_t y_multi)
-{
-    coord_t new_width = other.width() * x_multi;
-    coord_t new_height = other.height() * y_multi;
-    reset(new_width, new_height);
-
-    for (coord_t qy = 0; qy < other.height(); ++qy) {
-        for (coord_t qx = 0; qx < other.width(); ++qx) {
-            color_t ch = other.get_pixel(qx, qy);
-            for (coord_t y = 0; y < y_multi; ++y) {
-                for (coord_t x = 0; x < x_multi; ++x) {
-                    put_pixel(qx * x_multi + x, qy * y_multi + y, ch);
-                }
-            }
-        }
-    }
-}
-inline void
-TextCanvas::scale_percent(const TextCanvas& other,
-                          coord_t x_percent,
-                          coord_t y_percent)
-{
-    coord_t new_width = other.width() * x_percent / 100;
-    coord_t new_height = other.height() * y_percent / 100;
-    reset(new_width, new_height);
-
-    for (coord_t py = 0; py < new_height; ++py) {
-        for (coord_t px = 0; px < new_width; ++px) {
-            coord_t qx = px * other.width() / new_width;
-            coord_t qy = py * other.height() / new_height;
-            color_t ch = other.get_pixel(qx, qy);
-            put_pixel(px, py, ch);
-        }
-    }
-}
-
-inline void
-TextCanvas::scale(coord_t width, coord_t height)
-{
-    TextCanvas other;
-    other.scale(*this, width, height);
-    swap(other);
-}
-inline void
-TextCanvas::scale_cross(coord_t x_multi, coord_t y_multi)
-{
-    TextCanvas other;
-    other.scale_cross(*this, x_multi, y_multi);
-    swap(other);
-}
-inline void
-TextCanvas::scale_percent(coord_t x_percent, coord_t y_percent)
-{
-    TextCanvas other;
-    other.scale_percent(*this, x_percent, y_percent);
-    swap(other);
-}
-
-} // namespace textcanvas
-
-namespace std {
-template<>
-inline void
-swap(textcanvas::TextCanvas& left, textcanvas::TextCanvas& right)
-{
-    left.swap(right);
-}
-} // namespace std
-
-///////////////////////////////////////////////////////////////////////////
-
-#endif // ndef TEXT_CANVAS_HPP_
+// TextCanvas.hpp --- TextCanvas by katahiromz
+///////////////////////////////////////////////////////////////////////////
+
+#ifndef TEXT_CANVAS_HPP_
+#define TEXT_CANVAS_HPP_ 57 // Version 57
+
+#if _MSC_VER > 1000
+#pragma once
+#endif
+
+#include <algorithm> // for std::swap
+#include <cassert>   // for assert macro
+#include <cmath>     // for std::sqrt, std::atan2, std::fmod, ...
+#include <cstring>   // for std::memset, std::memcpy, ...
+#include <list>      // for std::list
+#include <map>       // for std::map
+#include <set>       // for std::set
+#include <string>    // for std::string
+#include <typeinfo>  // for typeid
+#include <vector>    // for std::vector
+
+#if __cplusplus >= 201103L
+#include <cstdint> // uint8_t, uint16_t, ...
+#else
+#include "pstdint.h" // uint8_t, uint16_t, ...
+#endif
+
+// threads are used under C++11 or later, unless TEXTCANVAS_NO_THREADS is
+// defined. link with the thread library (e.g. -pthread) then.
+#if __cplusplus >= 201103L && !defined(TEXTCANVAS_NO_THREADS) && \
+    !defined(TEXTCANVAS_USE_THREADS)
+#define TEXTCANVAS_USE_THREADS
+#endif
+#ifdef TEXTCANVAS_USE_THREADS
+#include <mutex>   // for std::mutex
+#include <thread>  // for std::thread
+#endif
+
+// SSE2 is used if available, unless TEXTCANVAS_NO_SIMD is defined
+#if !defined(TEXTCANVAS_NO_SIMD) && !defined(TEXTCANVAS_USE_SSE2)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TEXTCANVAS_USE_SSE2
+#endif
+#endif
+#ifdef TEXTCANVAS_USE_SSE2
+#include <emmintrin.h> // for SSE2 intrinsics
+#endif
+
+// define TEXTCANVAS_ROW_ALIGNMENT (a power of two) to align the cells of
+// TextCanvas to it. see TextCanvas::row.
+#ifdef TEXTCANVAS_ROW_ALIGNMENT
+#include <new>       // for operator new
+#endif
+
+#include "japanese.hpp"
+
+#define TEXTCANVAS_NO_N88_FONTS
+#define TEXTCANVAS_NO_QBASIC_FONTS
+
+///////////////////////////////////////////////////////////////////////////
+
+namespace textcanvas {
+typedef std::string string_type;
+typedef string_type::value_type char_type;
+typedef char_type color_t;
+typedef std::ptrdiff_t coord_t;
+
+#ifdef TEXTCANVAS_ROW_ALIGNMENT
+// an allocator aligning to ALIGN bytes
+template<typename T, size_t ALIGN>
+class AlignedAllocator
+{
+  public:
+    typedef T value_type;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+    template<typename U>
+    struct rebind
+    {
+        typedef AlignedAllocator<U, ALIGN> other;
+    };
+
+    AlignedAllocator() {}
+    template<typename U>
+    AlignedAllocator(const AlignedAllocator<U, ALIGN>&)
+    {}
+
+    pointer address(reference x) const { return &x; }
+    const_pointer address(const_reference x) const { return &x; }
+    size_type max_size() const { return size_type(-1) / sizeof(T); }
+
+    // the pointer from operator new is kept before the aligned block
+    pointer allocate(size_type n, const void* = NULL)
+    {
+        char* raw = static_cast<char*>(
+            ::operator new(n * sizeof(T) + ALIGN + sizeof(void*)));
+        size_t addr = reinterpret_cast<size_t>(raw + sizeof(void*));
+        addr = (addr + ALIGN - 1) & ~size_t(ALIGN - 1);
+        reinterpret_cast<void**>(addr)[-1] = raw;
+        return reinterpret_cast<pointer>(addr);
+    }
+    void deallocate(pointer p, size_type)
+    {
+        ::operator delete(reinterpret_cast<void**>(p)[-1]);
+    }
+
+    void construct(pointer p, const T& value) { new (p) T(value); }
+    void destroy(pointer p) { p->~T(); }
+
+    bool operator==(const AlignedAllocator&) const { return true; }
+    bool operator!=(const AlignedAllocator&) const { return false; }
+};
+// the cells of a TextCanvas
+typedef std::vector<color_t, AlignedAllocator<color_t, TEXTCANVAS_ROW_ALIGNMENT> >
+    buffer_type;
+#else
+typedef string_type buffer_type;
+#endif
+
+#ifdef M_PI
+static const double pi = M_PI;
+#else
+static const double pi = 3.14159265358979323846;
+#endif
+static const double epsilon = 0.00001;
+
+static const color_t zero = color_t(0);
+static const color_t one = color_t(1);
+static const color_t space = color_t(' ');
+static const color_t newline = color_t('\n');
+static const color_t asterisk = color_t('*');
+static const color_t sharp = color_t('#');
+
+///////////////////////////////////////////////////////////////////////////
+
+struct Point;
+struct Rect;
+class XbmImage;
+class XbmFont;
+class TextRun;
+class TextLayout;
+class TextCanvas;
+class SpanBuffer;
+struct StrokeStyle;
+class SpriteAtlas;
+class LayerStack;
+class SceneGraph;
+template<typename T_CONVERTER> class GlyphCache;
+class VerticalGlyphCache;
+
+///////////////////////////////////////////////////////////////////////////
+// Point and Points
+
+struct Point
+{
+    coord_t x, y;
+    Point() {}
+    Point(coord_t x_, coord_t y_)
+      : x(x_)
+      , y(y_)
+    {}
+};
+typedef Point Size;
+typedef std::vector<Point> Points;
+
+inline bool
+operator==(const Point& p0, const Point& p1)
+{
+    return p0.x == p1.x && p0.y == p1.y;
+}
+inline bool
+operator!=(const Point& p0, const Point& p1)
+{
+    return p0.x != p1.x || p0.y != p1.y;
+}
+struct point_less
+{
+    inline bool operator()(const Point& p0, const Point& p1) const
+    {
+        if (p0.x < p1.x)
+            return true;
+        return p0.x == p1.x && p0.y < p1.y;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////
+// Rect (inclusive like the other primitives)
+
+struct Rect
+{
+    coord_t x0, y0, x1, y1;
+    Rect() {}
+    Rect(coord_t x0_, coord_t y0_, coord_t x1_, coord_t y1_)
+      : x0(x0_)
+      , y0(y0_)
+      , x1(x1_)
+      , y1(y1_)
+    {}
+    Rect(const Point& p0, const Point& p1)
+      : x0(p0.x)
+      , y0(p0.y)
+      , x1(p1.x)
+      , y1(p1.y)
+    {}
+
+    coord_t width() const { return x1 - x0 + 1; }
+    coord_t height() const { return y1 - y0 + 1; }
+    bool empty() const { return x1 < x0 || y1 < y0; }
+
+    bool contains(coord_t x, coord_t y) const
+    {
+        return x0 <= x && x <= x1 && y0 <= y && y <= y1;
+    }
+    bool contains(const Rect& rc) const
+    {
+        return x0 <= rc.x0 && rc.x1 <= x1 && y0 <= rc.y0 && rc.y1 <= y1;
+    }
+    bool intersects(const Rect& rc) const
+    {
+        return x0 <= rc.x1 && rc.x0 <= x1 && y0 <= rc.y1 && rc.y0 <= y1;
+    }
+};
+
+inline bool
+operator==(const Rect& rc0, const Rect& rc1)
+{
+    return rc0.x0 == rc1.x0 && rc0.y0 == rc1.y0 && rc0.x1 == rc1.x1 &&
+           rc0.y1 == rc1.y1;
+}
+inline bool
+operator!=(const Rect& rc0, const Rect& rc1)
+{
+    return !(rc0 == rc1);
+}
+inline Rect
+intersect_rect(const Rect& rc0, const Rect& rc1)
+{
+    return Rect(std::max(rc0.x0, rc1.x0),
+                std::max(rc0.y0, rc1.y0),
+                std::min(rc0.x1, rc1.x1),
+                std::min(rc0.y1, rc1.y1));
+}
+inline Rect
+union_rect(const Rect& rc0, const Rect& rc1)
+{
+    if (rc0.empty())
+        return rc1;
+    if (rc1.empty())
+        return rc0;
+    return Rect(std::min(rc0.x0, rc1.x0),
+                std::min(rc0.y0, rc1.y0),
+                std::max(rc0.x1, rc1.x1),
+                std::max(rc0.y1, rc1.y1));
+}
+
+///////////////////////////////////////////////////////////////////////////
+// functions
+
+inline coord_t
+do_round(double d)
+{
+    return coord_t(d + 0.5);
+}
+
+double
+normalize_radian(double radian);
+
+bool
+get_polygon_box(Point& p0, Point& p1, size_t num_points, const Point* points);
+
+size_t
+crossing_number(const Point& p, const Points& points);
+coord_t
+winding_number(const Point& p, const Points& points);
+
+bool
+check_range(double at, bool clockwise, double a0, double a1);
+
+void
+quarter_ellipse_widths(std::vector<coord_t>& widths, coord_t rx, coord_t ry);
+
+template<typename T_SPAN>
+void
+ellipse_spans(coord_t x0, coord_t y0, coord_t dx, coord_t dy, T_SPAN& span);
+
+void
+stroke_segment(SpanBuffer& spans, const Point& p0, const Point& p1, double h);
+void
+stroke_join(SpanBuffer& spans,
+            const Point& p0,
+            const Point& p1,
+            const Point& p2,
+            double h,
+            const StrokeStyle& style);
+void
+stroke_cap(SpanBuffer& spans,
+           const Point& p0,
+           const Point& p1,
+           double h,
+           const StrokeStyle& style);
+
+///////////////////////////////////////////////////////////////////////////
+// MorphElement --- a structuring element of the morphology
+//
+// A rectangle of (2 * rx + 1) x (2 * ry + 1) pixels, or a cross of the
+// same arms, centered at the pixel. A rectangle is applied as a row pass
+// and a column pass. Outside the image is background for dilation and
+// foreground for erosion, so the edges neither grow nor wear away.
+
+enum MorphShape
+{
+    MORPH_RECT,
+    MORPH_CROSS
+};
+
+struct MorphElement
+{
+    coord_t rx, ry;
+    MorphShape shape;
+    MorphElement(coord_t rx_ = 1, coord_t ry_ = 1, MorphShape shape_ = MORPH_RECT)
+      : rx(rx_)
+      , ry(ry_)
+      , shape(shape_)
+    {}
+};
+
+///////////////////////////////////////////////////////////////////////////
+// XbmImage
+
+class XbmImage
+{
+  public:
+    typedef uint8_t value_type;
+
+    XbmImage(coord_t width,
+             coord_t height,
+             const void* data = NULL,
+             void* alloc = NULL)
+      : m_data(NULL)
+      , m_alloc(NULL)
+    {
+        reset(width, height, data, alloc);
+    }
+    XbmImage(const XbmImage& image)
+      : m_data(NULL)
+      , m_alloc(NULL)
+    {
+        *this = image;
+    }
+    XbmImage& operator=(const XbmImage& image);
+    virtual ~XbmImage() { clear(); }
+
+    void clear()
+    {
+        delete[] m_alloc;
+        m_alloc = NULL;
+    }
+
+    void reset(coord_t width,
+               coord_t height,
+               const void* data = NULL,
+               void* alloc = NULL);
+
+    value_type* cast(const void* data) const
+    {
+        return reinterpret_cast<value_type*>(const_cast<void*>(data));
+    }
+
+    coord_t width() const { return m_width; }
+    coord_t height() const { return m_height; }
+    coord_t stride() const { return m_stride; }
+    coord_t size() const { return stride() * height(); }
+    value_type* data() { return m_data; }
+    const value_type* data() const { return m_data; }
+
+    bool in_range(coord_t x, coord_t y) const;
+
+    bool get_dot(coord_t x, coord_t y) const;
+    void put_dot(coord_t x, coord_t y, bool dot);
+
+    std::string to_str(const char* name) const;
+
+    void get_subimage(TextCanvas& image,
+                      coord_t x0,
+                      coord_t y0,
+                      coord_t x1,
+                      coord_t y1) const;
+    void get_subimage(XbmImage& image,
+                      coord_t x0,
+                      coord_t y0,
+                      coord_t x1,
+                      coord_t y1) const;
+    void put_subimage(coord_t x0, coord_t y0, const TextCanvas& image);
+    void put_subimage(coord_t x0, coord_t y0, const XbmImage& image);
+
+    // combine whole packed rows. x0 must not be negative.
+    void or_subimage(coord_t x0, coord_t y0, const XbmImage& image);
+    void and_not_subimage(coord_t x0, coord_t y0, const XbmImage& image);
+
+    // fill the 4-connected pixels of the same dot as (x, y) with dot,
+    // by 64 pixels at a time
+    void flood_fill(coord_t x, coord_t y, bool dot);
+
+    // morphology of the set pixels, by 64 pixels at a time
+    void dilate(const MorphElement& elem);
+    void erode(const MorphElement& elem);
+    void open(const MorphElement& elem);
+    void close(const MorphElement& elem);
+
+  protected:
+    value_type* m_data;
+    value_type* m_alloc;
+    coord_t m_width;
+    coord_t m_height;
+    coord_t m_stride;
+};
+
+///////////////////////////////////////////////////////////////////////////
+// XbmFont
+
+class XbmFont : public XbmImage
+{
+  public:
+    XbmFont(coord_t width,
+            coord_t height,
+            const void* data,
+            coord_t columns,
+            coord_t rows,
+            coord_t cell_width,
+            coord_t cell_height)
+      : XbmImage(width, height, data)
+      , m_columns(columns)
+      , m_rows(rows)
+      , m_cell_width(cell_width)
+      , m_cell_height(cell_height)
+      , m_jis_codes(NULL)
+      , m_jis_count(0)
+    {}
+    // a subset font. the cell i holds the character jis_codes[i].
+    // jis_codes must be sorted in ascending order.
+    XbmFont(coord_t width,
+            coord_t height,
+            const void* data,
+            coord_t columns,
+            coord_t rows,
+            coord_t cell_width,
+            coord_t cell_height,
+            const uint16_t* jis_codes,
+            size_t jis_count)
+      : XbmImage(width, height, data)
+      , m_columns(columns)
+      , m_rows(rows)
+      , m_cell_width(cell_width)
+      , m_cell_height(cell_height)
+      , m_jis_codes(jis_codes)
+      , m_jis_count(jis_count)
+    {}
+
+    coord_t columns() const { return m_columns; }
+    coord_t rows() const { return m_rows; }
+    coord_t cell_width() const { return m_cell_width; }
+    coord_t cell_height() const { return m_cell_height; }
+
+    bool is_subset() const { return m_jis_codes != NULL; }
+    bool has_jis_char(uint16_t jis_code) const;
+    // the cell of a JIS X 0208 character (column, row).
+    // a subset font gives the geta mark or the first cell for a missing one.
+    Point jis_cell(uint16_t jis_code) const;
+
+  protected:
+    coord_t m_columns;
+    coord_t m_rows;
+    coord_t m_cell_width;
+    coord_t m_cell_height;
+    const uint16_t* m_jis_codes;
+    size_t m_jis_count;
+
+    size_t jis_index(uint16_t jis_code) const;
+};
+
+///////////////////////////////////////////////////////////////////////////
+// supported fonts
+
+#ifndef TEXTCANVAS_NO_QBASIC_FONTS
+inline const XbmFont&
+qbasic8x16_font()
+{
+// QBasic 8x16 bitmap font
+#include "fonts/qbasic8x16_chars.xbm"
+    static const XbmFont qbasic8x16_chars(qbasic8x16_chars_width,
+                                          qbasic8x16_chars_height,
+                                          qbasic8x16_chars_bits,
+                                          16,
+                                          16,
+                                          8,
+                                          16);
+    return qbasic8x16_chars;
+}
+#endif
+
+#ifndef TEXTCANVAS_NO_N88_FONTS
+inline const XbmFont&
+n88_normal_font()
+{
+// PC-8801 bitmap font
+#include "fonts/n88_normal_chars.xbm"
+    static const XbmFont n88_normal_chars(n88_normal_chars_width,
+                                          n88_normal_chars_height,
+                                          n88_normal_chars_bits,
+                                          256,
+                                          1,
+                                          8,
+                                          16);
+    return n88_normal_chars;
+}
+inline const XbmFont&
+n88_quality_font()
+{
+// PC-9801 bitmap font
+#include "fonts/n88_quality_chars.xbm"
+    static const XbmFont n88_quality_chars(n88_quality_chars_width,
+                                           n88_quality_chars_height,
+                                           n88_quality_chars_bits,
+                                           256,
+                                           1,
+                                           8,
+                                           16);
+    return n88_quality_chars;
+}
+inline const XbmFont&
+n88_graph_font()
+{
+// PC-8801 graphical bitmap font
+#include "fonts/n88_graph_chars.xbm"
+    static const XbmFont n88_graph_chars(n88_graph_chars_width,
+                                         n88_graph_chars_height,
+                                         n88_graph_chars_bits,
+                                         256,
+                                         1,
+                                         8,
+                                         16);
+    return n88_graph_chars;
+}
+inline const XbmFont&
+n88_quarter_font()
+{
+// PC-9801 quarter bitmap font
+#include "fonts/n88_quarter_chars.xbm"
+    static const XbmFont n88_quarter_chars(n88_quarter_chars_width,
+                                           n88_quarter_chars_height,
+                                           n88_quarter_chars_bits,
+                                           256,
+                                           1,
+                                           8,
+                                           8);
+    return n88_quarter_chars;
+}
+#endif
+
+#ifndef TEXTCANVAS_NO_KHDOTFONT
+inline const XbmFont&
+kh_dot_zenkaku_font()
+{
+// "KH Dot Kodenmachou 16 Ki" Zenkaku font
+#include "fonts/KH-Dot-Kodenmachou-16-Ki.xbm"
+    static const XbmFont kh_dot_font_zenkaku_chars(
+      KH_Dot_Kodenmachou_16_Ki_width,
+      KH_Dot_Kodenmachou_16_Ki_height,
+      KH_Dot_Kodenmachou_16_Ki_bits,
+      0x7E - 0x21 + 1,
+      0x7E - 0x21 + 1,
+      16,
+      16);
+    return kh_dot_font_zenkaku_chars;
+}
+
+// "KH Dot Kodenmachou 16 Ki" Hankaku font, generated from its XBM file.
+// The bits are constexpr for StaticBanner since C++11.
+#if __cplusplus >= 201103L
+#define TEXTCANVAS_FONT_CONSTEXPR constexpr
+#else
+#define TEXTCANVAS_FONT_CONSTEXPR const
+#endif
+#include "fonts/KH-Dot-Kodenmachou-16-Ki-ASCII-bits.h"
+#undef TEXTCANVAS_FONT_CONSTEXPR
+
+inline const XbmFont&
+kh_dot_hankaku_font()
+{
+    static const XbmFont kh_dot_font_hankaku_chars(
+      kh_dot_hankaku_width,
+      kh_dot_hankaku_height,
+      kh_dot_hankaku_bits,
+      16,
+      16,
+      8,
+      16);
+    return kh_dot_font_hankaku_chars;
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////
+// TextRun --- a string decoded into font cells once
+
+class TextRun
+{
+  public:
+    struct Glyph
+    {
+        const XbmFont* font;
+        coord_t column;
+        coord_t row;
+        coord_t advance;
+        uint16_t code; // the character code or the JIS code
+        bool zenkaku;  // is code a JIS code?
+    };
+
+    TextRun()
+      : m_extent(0, 0)
+    {}
+    TextRun(const XbmFont& font, const string_type& text)
+      : m_extent(0, 0)
+    {
+        assign(font, text);
+    }
+
+    void clear()
+    {
+        m_glyphs.clear();
+        m_extent = Size(0, 0);
+    }
+
+    void assign(const XbmFont& font, const string_type& text);
+    void assign_sjis(const XbmFont& zenkaku_font,
+                     const XbmFont& hankaku_font,
+                     const string_type& text);
+    void assign_utf8(const XbmFont& zenkaku_font,
+                     const XbmFont& hankaku_font,
+                     const string_type& text);
+
+    void push_char(const XbmFont& font, coord_t char_code);
+    void push_jis_char(const XbmFont& font, coord_t jis_code);
+    void push_cell(const XbmFont& font, coord_t iColumn, coord_t iRow);
+
+    size_t size() const { return m_glyphs.size(); }
+    bool empty() const { return m_glyphs.empty(); }
+    const Glyph& operator[](size_t index) const { return m_glyphs[index]; }
+
+    // the total size of the run when drawn rightward
+    const Size& extent() const { return m_extent; }
+
+  protected:
+    std::vector<Glyph> m_glyphs;
+    Size m_extent;
+
+    void push_glyph(const XbmFont& font,
+                    coord_t iColumn,
+                    coord_t iRow,
+                    uint16_t code,
+                    bool zenkaku);
+    void push_ascii(const XbmFont& font, const char* str, size_t len);
+};
+
+///////////////////////////////////////////////////////////////////////////
+// TextLayout --- line breaking and alignment from font metrics only
+//
+// A TextLayout owns a copy of its run, so it can be kept and redrawn
+// as long as the text and the box do not change.
+
+enum TextAlign
+{
+    ALIGN_LEFT,
+    ALIGN_CENTER,
+    ALIGN_RIGHT
+};
+
+class TextLayout
+{
+  public:
+    struct Line
+    {
+        size_t first;  // the first glyph index
+        size_t last;   // the glyph index after the line
+        coord_t x;     // the offset after alignment
+        coord_t y;
+        coord_t width; // without the trailing spaces
+        coord_t height;
+    };
+
+    TextLayout()
+      : m_extent(0, 0)
+    {}
+    TextLayout(const TextRun& run,
+               coord_t max_width = 0,
+               TextAlign align = ALIGN_LEFT,
+               coord_t line_gap = 0)
+      : m_extent(0, 0)
+    {
+        layout(run, max_width, align, line_gap);
+    }
+
+    // max_width <= 0 means no wrapping
+    void layout(const TextRun& run,
+                coord_t max_width = 0,
+                TextAlign align = ALIGN_LEFT,
+                coord_t line_gap = 0);
+
+    const TextRun& run() const { return m_run; }
+    size_t line_count() const { return m_lines.size(); }
+    const Line& line(size_t index) const { return m_lines[index]; }
+
+    // the box of all the lines
+    const Size& extent() const { return m_extent; }
+
+  protected:
+    TextRun m_run;
+    std::vector<Line> m_lines;
+    Size m_extent;
+
+    bool is_space(size_t i) const;
+    bool is_newline(size_t i) const;
+    bool can_break(size_t i) const;
+};
+
+///////////////////////////////////////////////////////////////////////////
+// StrokeStyle and SpanBuffer --- thick strokes
+//
+// A stroke is the union of convex pieces (the segments, the joins and
+// the caps) gathered as spans of cells by a SpanBuffer. The spans of each
+// row are merged before they are put, so each cell is put once.
+// A cell is covered when its center is inside a piece, with the right and
+// bottom edges excluded.
+
+enum LineJoin
+{
+    JOIN_MITER,
+    JOIN_ROUND,
+    JOIN_BEVEL
+};
+
+enum LineCap
+{
+    CAP_BUTT,
+    CAP_ROUND,
+    CAP_SQUARE
+};
+
+struct StrokeStyle
+{
+    coord_t width;
+    LineJoin join;
+    LineCap cap;
+    double miter_limit; // the longest miter in widths, beveled beyond it
+    StrokeStyle(coord_t width_ = 1,
+                LineJoin join_ = JOIN_MITER,
+                LineCap cap_ = CAP_BUTT,
+                double miter_limit_ = 4)
+      : width(width_)
+      , join(join_)
+      , cap(cap_)
+      , miter_limit(miter_limit_)
+    {}
+};
+
+class SpanBuffer
+{
+  public:
+    // the spans are clipped by clip
+    SpanBuffer(const Rect& clip);
+
+    const Rect& clip() const { return m_clip; }
+    bool empty() const { return m_count == 0; }
+
+    void add(coord_t left, coord_t right, coord_t y);
+    void operator()(coord_t x, coord_t y) { add(x, x, y); }
+
+    // the convex polygon of num_points vertices
+    void add_convex(size_t num_points, const double* xs, const double* ys);
+    // the ellipse of radii (rx, ry) centered at (cx, cy)
+    void add_ellipse(double cx, double cy, double rx, double ry);
+    // the outer ellipse minus the inner one, both centered at (cx, cy)
+    void add_ring(double cx,
+                  double cy,
+                  double outer_rx,
+                  double outer_ry,
+                  double inner_rx,
+                  double inner_ry);
+
+    // put the merged spans from top to bottom and clear them
+    template<typename T_PUTTER>
+    void flush(T_PUTTER& putter);
+    void clear();
+
+  protected:
+    typedef std::pair<coord_t, coord_t> Span;
+    Rect m_clip;
+    std::vector<std::vector<Span> > m_rows;
+    size_t m_count;
+};
+
+///////////////////////////////////////////////////////////////////////////
+// raster operations of TextCanvas::blit
+//
+// The operations combine the values of the cells bit by bit, except
+// ROP_KEY, which copies the source cells other than the key color.
+// The rows are combined 16 cells at a time with SSE2 when available.
+
+enum RasterOp
+{
+    ROP_COPY,        // dest = src
+    ROP_AND,         // dest = dest & src
+    ROP_OR,          // dest = dest | src
+    ROP_XOR,         // dest = dest ^ src
+    ROP_AND_NOT,     // dest = dest & ~src
+    ROP_INVERT_DEST, // dest = ~dest
+    ROP_KEY          // dest = (src == key) ? dest : src
+};
+
+struct RopAnd
+{
+    color_t operator()(color_t d, color_t s) const { return color_t(d & s); }
+#ifdef TEXTCANVAS_USE_SSE2
+    __m128i operator()(__m128i d, __m128i s) const
+    {
+        return _mm_and_si128(d, s);
+    }
+#endif
+};
+struct RopOr
+{
+    color_t operator()(color_t d, color_t s) const { return color_t(d | s); }
+#ifdef TEXTCANVAS_USE_SSE2
+    __m128i operator()(__m128i d, __m128i s) const
+    {
+        return _mm_or_si128(d, s);
+    }
+#endif
+};
+struct RopXor
+{
+    color_t operator()(color_t d, color_t s) const { return color_t(d ^ s); }
+#ifdef TEXTCANVAS_USE_SSE2
+    __m128i operator()(__m128i d, __m128i s) const
+    {
+        return _mm_xor_si128(d, s);
+    }
+#endif
+};
+struct RopAndNot
+{
+    color_t operator()(color_t d, color_t s) const { return color_t(d & ~s); }
+#ifdef TEXTCANVAS_USE_SSE2
+    __m128i operator()(__m128i d, __m128i s) const
+    {
+        return _mm_andnot_si128(s, d);
+    }
+#endif
+};
+struct RopInvertDest
+{
+    color_t operator()(color_t d, color_t) const { return color_t(~d); }
+#ifdef TEXTCANVAS_USE_SSE2
+    __m128i operator()(__m128i d, __m128i) const
+    {
+        return _mm_xor_si128(d, _mm_set1_epi8(char(-1)));
+    }
+#endif
+};
+struct RopKey
+{
+    color_t m_key;
+    RopKey(color_t key)
+      : m_key(key)
+    {}
+    color_t operator()(color_t d, color_t s) const
+    {
+        return (s == m_key) ? d : s;
+    }
+#ifdef TEXTCANVAS_USE_SSE2
+    __m128i operator()(__m128i d, __m128i s) const
+    {
+        const __m128i keyed = _mm_cmpeq_epi8(s, _mm_set1_epi8(char(m_key)));
+        return _mm_or_si128(_mm_and_si128(keyed, d), _mm_andnot_si128(keyed, s));
+    }
+#endif
+};
+
+#ifdef TEXTCANVAS_USE_SSE2
+// 16 bits to 16 bytes of 0xFF or 0. select is the bit of each byte.
+inline __m128i
+sse2_expand_bits(unsigned bits, const __m128i& select)
+{
+    const int lo = int((bits & 0xFF) * 0x01010101U);
+    const int hi = int(((bits >> 8) & 0xFF) * 0x01010101U);
+    const __m128i v = _mm_set_epi32(hi, hi, lo, lo);
+    return _mm_cmpeq_epi8(_mm_and_si128(v, select), select);
+}
+#endif
+
+// combine a row of n cells
+template<typename T_ROP>
+inline void
+rop_row(color_t* dest, const color_t* src, coord_t n, const T_ROP& rop)
+{
+    coord_t x = 0;
+#ifdef TEXTCANVAS_USE_SSE2
+    for (; x + 16 <= n; x += 16) {
+        __m128i* d = reinterpret_cast<__m128i*>(&dest[x]);
+        const __m128i* s = reinterpret_cast<const __m128i*>(&src[x]);
+        _mm_storeu_si128(d, rop(_mm_loadu_si128(d), _mm_loadu_si128(s)));
+    }
+#endif
+    for (; x < n; ++x) {
+        dest[x] = rop(dest[x], src[x]);
+    }
+}
+inline void
+rop_row(color_t* dest, const color_t* src, coord_t n, RasterOp rop, color_t key)
+{
+    switch (rop) {
+    case ROP_COPY:
+        std::memmove(dest, src, n);
+        break;
+    case ROP_AND:
+        rop_row(dest, src, n, RopAnd());
+        break;
+    case ROP_OR:
+        rop_row(dest, src, n, RopOr());
+        break;
+    case ROP_XOR:
+        rop_row(dest, src, n, RopXor());
+        break;
+    case ROP_AND_NOT:
+        rop_row(dest, src, n, RopAndNot());
+        break;
+    case ROP_INVERT_DEST:
+        rop_row(dest, src, n, RopInvertDest());
+        break;
+    case ROP_KEY:
+        rop_row(dest, src, n, RopKey(key));
+        break;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+// CanvasRow and CanvasRows --- the raw rows of TextCanvas
+
+template<typename T>
+struct CanvasRow
+{
+    T* cells;
+    coord_t width;
+    CanvasRow(T* cells_, coord_t width_)
+      : cells(cells_)
+      , width(width_)
+    {}
+    T& operator[](coord_t x) const
+    {
+        assert(0 <= x && x < width);
+        return cells[x];
+    }
+    T* begin() const { return cells; }
+    T* end() const { return cells + width; }
+};
+
+template<typename T>
+class CanvasRows
+{
+  public:
+    class iterator
+    {
+      public:
+        iterator()
+          : m_cells(NULL)
+          , m_width(0)
+          , m_stride(0)
+        {}
+        iterator(T* cells, coord_t width, coord_t stride)
+          : m_cells(cells)
+          , m_width(width)
+          , m_stride(stride)
+        {}
+        CanvasRow<T> operator*() const
+        {
+            return CanvasRow<T>(m_cells, m_width);
+        }
+        iterator& operator++()
+        {
+            m_cells += m_stride;
+            return *this;
+        }
+        iterator operator++(int)
+        {
+            iterator it = *this;
+            m_cells += m_stride;
+            return it;
+        }
+        bool operator==(const iterator& it) const
+        {
+            return m_cells == it.m_cells;
+        }
+        bool operator!=(const iterator& it) const
+        {
+            return m_cells != it.m_cells;
+        }
+
+      protected:
+        T* m_cells;
+        coord_t m_width;
+        coord_t m_stride;
+    };
+
+    CanvasRows(T* cells, coord_t width, coord_t height, coord_t stride)
+      : m_cells(cells)
+      , m_width(width)
+      , m_height(height)
+      , m_stride(stride)
+    {}
+
+    coord_t size() const { return m_height; }
+    CanvasRow<T> operator[](coord_t y) const
+    {
+        assert(0 <= y && y < m_height);
+        return CanvasRow<T>(m_cells + y * m_stride, m_width);
+    }
+    iterator begin() const { return iterator(m_cells, m_width, m_stride); }
+    iterator end() const
+    {
+        return iterator(m_cells + m_height * m_stride, m_width, m_stride);
+    }
+
+  protected:
+    T* m_cells;
+    coord_t m_width;
+    coord_t m_height;
+    coord_t m_stride;
+};
+
+///////////////////////////////////////////////////////////////////////////
+// TextCanvas
+
+class TextCanvas
+{
+  public:
+    TextCanvas();
+    TextCanvas(coord_t width,
+               coord_t height,
+               color_t fore_color = sharp,
+               color_t back_color = space);
+    TextCanvas(const XbmImage& binary,
+               color_t fore_color = sharp,
+               color_t back_color = space);
+    TextCanvas(const TextCanvas& tc);
+    TextCanvas& operator=(const TextCanvas& tc);
+    virtual ~TextCanvas();
+
+  protected:
+    struct ClipState
+    {
+        Rect rect;      // within the canvas
+        XbmImage mask;  // of the canvas size if masked
+        bool masked;
+        ClipState(const Rect& rect_)
+          : rect(rect_)
+          , mask(1, 1)
+          , masked(false)
+        {}
+    };
+
+    coord_t m_width;
+    coord_t m_height;
+    buffer_type m_text;
+    color_t m_fore_color;
+    color_t m_back_color;
+    Point m_pos;
+    std::vector<ClipState> m_clips;
+    VerticalGlyphCache* m_own_vertical;
+    VerticalGlyphCache* m_shared_vertical;
+
+  public:
+    coord_t width() const;
+    coord_t height() const;
+    coord_t count() const;
+    Point& pos();
+    const Point& pos() const;
+    color_t& operator[](size_t index);
+    const color_t& operator[](size_t index) const;
+
+    string_type to_str() const;
+    bool in_range(coord_t x, coord_t y) const;
+    bool in_range(const Point& p) const;
+
+    // the clip region. push_clip_rect and push_clip_mask narrow the
+    // current clip to a rectangle or to the set bits of a mask placed at
+    // (x0, y0); pop_clip restores the previous one. all the drawing is
+    // clipped except clear, resize, morphology and the operators.
+    void push_clip_rect(const Rect& rect);
+    void push_clip_mask(coord_t x0, coord_t y0, const XbmImage& mask);
+    void pop_clip();
+    bool has_clip() const;
+    // the bounds of the clip, or of the canvas without a clip
+    Rect clip_rect() const;
+    bool in_clip(coord_t x, coord_t y) const;
+
+    // put ch on the cells x0 to x1 of row y within the clip
+    void fill_span(coord_t y, coord_t x0, coord_t x1, color_t ch);
+
+    // the raw rows of cells for the custom kernels. row(y) has width()
+    // contiguous cells, and the rows are stride() cells apart in order.
+    // the pointers are valid until the canvas is resized, reset or
+    // assigned. writing through them skips the clip and the pen position.
+    // under TEXTCANVAS_ROW_ALIGNMENT, row(0) is aligned to it, and so is
+    // every row if aligned_rows().
+    CanvasRow<color_t> row(coord_t y);
+    CanvasRow<const color_t> row(coord_t y) const;
+    CanvasRows<color_t> rows();
+    CanvasRows<const color_t> rows() const;
+    coord_t stride() const;
+    bool aligned_rows() const;
+
+    buffer_type& data();
+    const buffer_type& data() const;
+    bool same_size(const TextCanvas& tc) const;
+
+    void clear();
+    void clear(color_t ch);
+    void reset(coord_t width, coord_t height);
+    void reset(coord_t width, coord_t height, color_t ch);
+    void resize(coord_t width_, coord_t height_);
+    void resize(coord_t width_, coord_t height_, color_t ch);
+
+    color_t get_pixel(coord_t x, coord_t y) const;
+    color_t get_pixel(const Point& p) const;
+    void put_pixel(coord_t x, coord_t y, color_t ch);
+    void put_pixel(const Point& p, color_t ch);
+    void put_pixel(coord_t x, coord_t y);
+    void put_pixel(const Point& p);
+
+    bool get_dot(coord_t x, coord_t y) const;
+    void put_dot(coord_t x, coord_t y, bool dot);
+
+    color_t fore_color() const;
+    void fore_color(color_t ch);
+
+    color_t back_color() const;
+    void back_color(color_t ch);
+
+    friend TextCanvas operator!(const TextCanvas& bin);
+    friend TextCanvas operator&(const TextCanvas& bin1, const TextCanvas& bin2);
+    friend TextCanvas operator|(const TextCanvas& bin1, const TextCanvas& bin2);
+    friend TextCanvas operator^(const TextCanvas& bin1, const TextCanvas& bin2);
+
+    void fill(const TextCanvas& bin);
+    void do_mask(const TextCanvas& image, const TextCanvas& mask);
+
+    void get_subimage(TextCanvas& image,
+                      coord_t x0,
+                      coord_t y0,
+                      coord_t x1,
+                      coord_t y1) const;
+    void get_subimage(TextCanvas& image, Point& p0, Point& p1) const;
+    void get_subimage(XbmImage& image,
+                      coord_t x0,
+                      coord_t y0,
+                      coord_t x1,
+                      coord_t y1) const;
+    void get_subimage(XbmImage& image, Point& p0, Point& p1) const;
+
+    void put_subimage(coord_t x0, coord_t y0, const TextCanvas& image);
+    void put_subimage(coord_t x0, coord_t y0, const XbmImage& image);
+    template<typename T_PUTTER0, typename T_PUTTER1>
+    void put_subimage(coord_t x0,
+                      coord_t y0,
+                      const TextCanvas& image,
+                      T_PUTTER0& fore,
+                      T_PUTTER1& back);
+    template<typename T_PUTTER0, typename T_PUTTER1>
+    void put_subimage(coord_t x0,
+                      coord_t y0,
+                      const XbmImage& image,
+                      T_PUTTER0& fore,
+                      T_PUTTER1& back);
+
+    // copy the opaque runs of a sprite
+    void put_sprite(coord_t x0,
+                    coord_t y0,
+                    const SpriteAtlas& atlas,
+                    coord_t index);
+    void put_sprite(coord_t x0,
+                    coord_t y0,
+                    const SpriteAtlas& atlas,
+                    coord_t index,
+                    const Rect& clip);
+
+    Size put_char(coord_t x0,
+                  coord_t y0,
+                  const XbmFont& font,
+                  coord_t char_code);
+    Size put_char(coord_t x0,
+                  coord_t y0,
+                  const XbmFont& font,
+                  coord_t iColumn,
+                  coord_t iRow);
+
+    template<typename T_CONVERTER>
+    Size put_char(coord_t x0,
+                  coord_t y0,
+                  const XbmFont& font,
+                  coord_t char_code,
+                  T_CONVERTER& conv);
+    template<typename T_CONVERTER>
+    Size put_char(coord_t x0,
+                  coord_t y0,
+                  const XbmFont& font,
+                  coord_t iColumn,
+                  coord_t iRow,
+                  T_CONVERTER& conv);
+    template<typename T_CONVERTER, typename T_PUTTER0, typename T_PUTTER1>
+    Size put_char(coord_t x0,
+                  coord_t y0,
+                  const XbmFont& font,
+                  coord_t char_code,
+                  T_CONVERTER& conv,
+                  T_PUTTER0& fore,
+                  T_PUTTER1& back);
+    template<typename T_CONVERTER, typename T_PUTTER0, typename T_PUTTER1>
+    Size put_char(coord_t x0,
+                  coord_t y0,
+                  const XbmFont& font,
+                  coord_t iColumn,
+                  coord_t iRow,
+                  T_CONVERTER& conv,
+                  T_PUTTER0& fore,
+                  T_PUTTER1& back);
+
+    Size jis_put_char(coord_t x0,
+                      coord_t y0,
+                      const XbmFont& font,
+                      coord_t jis_code);
+    Size jis_put_char(coord_t x0,
+                      coord_t y0,
+                      const XbmFont& font,
+                      coord_t iColumn,
+                      coord_t iRow);
+
+    template<typename T_CONVERTER>
+    Size jis_put_char(coord_t x0,
+                      coord_t y0,
+                      const XbmFont& font,
+                      coord_t jis_code,
+                      T_CONVERTER& conv);
+    template<typename T_CONVERTER>
+    Size jis_put_char(coord_t x0,
+                      coord_t y0,
+                      const XbmFont& font,
+                      coord_t iColumn,
+                      coord_t iRow,
+                      T_CONVERTER& conv);
+    template<typename T_CONVERTER, typename T_PUTTER0, typename T_PUTTER1>
+    Size jis_put_char(coord_t x0,
+                      coord_t y0,
+                      const XbmFont& font,
+                      coord_t jis_code,
+                      T_CONVERTER& conv,
+                      T_PUTTER0& fore,
+                      T_PUTTER1& back);
+    template<typename T_CONVERTER, typename T_PUTTER0, typename T_PUTTER1>
+    Size jis_put_char(coord_t x0,
+                      coord_t y0,
+                      const XbmFont& font,
+                      coord_t iColumn,
+                      coord_t iRow,
+                      T_CONVERTER& conv,
+                      T_PUTTER0& fore,
+                      T_PUTTER1& back);
+
+    // draw a glyph converted once by the cache
+    template<typename T_CONVERTER>
+    Size put_char(coord_t x0,
+                  coord_t y0,
+                  const XbmFont& font,
+                  coord_t char_code,
+                  GlyphCache<T_CONVERTER>& cache);
+    template<typename T_CONVERTER>
+    Size put_char(coord_t x0,
+                  coord_t y0,
+                  const XbmFont& font,
+                  coord_t iColumn,
+                  coord_t iRow,
+                  GlyphCache<T_CONVERTER>& cache);
+    template<typename T_CONVERTER>
+    Size jis_put_char(coord_t x0,
+                      coord_t y0,
+                      const XbmFont& font,
+                      coord_t jis_code,
+                      GlyphCache<T_CONVERTER>& cache);
+    template<typename T_CONVERTER>
+    Size jis_put_char(coord_t x0,
+                      coord_t y0,
+                      const XbmFont& font,
+                      coord_t iColumn,
+                      coord_t iRow,
+                      GlyphCache<T_CONVERTER>& cache);
+
+    // copy an XbmImage in the fore and back colors
+    Size put_image(coord_t x0, coord_t y0, const XbmImage& image);
+
+    // combine the cells of src from src_origin into dest_rect by rop,
+    // clipped by both canvases. an XbmImage is taken as the fore color
+    // for the set pixels and the back color (the key) for the others.
+    void blit(const Rect& dest_rect,
+              const TextCanvas& src,
+              const Point& src_origin,
+              RasterOp rop = ROP_COPY,
+              color_t key = space);
+    void blit(const Rect& dest_rect,
+              const XbmImage& src,
+              const Point& src_origin,
+              RasterOp rop = ROP_COPY);
+
+    // draw text rightward
+    void text_to_right(coord_t x0,
+                       coord_t y0,
+                       const XbmFont& font,
+                       const string_type& text);
+    void text_to_right(const Point& p0,
+                       const XbmFont& font,
+                       const string_type& text);
+    template<typename T_CONVERTER>
+    void text_to_right(coord_t x0,
+                       coord_t y0,
+                       const XbmFont& font,
+                       const string_type& text,
+                       T_CONVERTER& conv);
+    template<typename T_CONVERTER>
+    void text_to_right(const Point& p0,
+                       const XbmFont& font,
+                       const string_type& text,
+                       T_CONVERTER& conv);
+
+    // draw a pre-encoded text run rightward
+    void text_to_right(coord_t x0, coord_t y0, const TextRun& run);
+    void text_to_right(const Point& p0, const TextRun& run);
+    template<typename T_CONVERTER>
+    void text_to_right(coord_t x0,
+                       coord_t y0,
+                       const TextRun& run,
+                       T_CONVERTER& conv);
+    template<typename T_CONVERTER>
+    void text_to_right(const Point& p0, const TextRun& run, T_CONVERTER& conv);
+    template<typename T_CONVERTER>
+    void text_to_right(coord_t x0,
+                       coord_t y0,
+                       const TextRun& run,
+                       GlyphCache<T_CONVERTER>& cache);
+
+    // copy one font cell without a converter
+    Size put_glyph(coord_t x0,
+                   coord_t y0,
+                   const XbmFont& font,
+                   coord_t iColumn,
+                   coord_t iRow);
+    Size put_glyph(coord_t x0,
+                   coord_t y0,
+                   const XbmFont& font,
+                   coord_t iColumn,
+                   coord_t iRow,
+                   const Rect& clip);
+
+    // draw a text layout. glyphs outside the clip box are skipped.
+    void put_layout(coord_t x0, coord_t y0, const TextLayout& layout);
+    void put_layout(const Point& p0, const TextLayout& layout);
+    void put_layout(coord_t x0,
+                    coord_t y0,
+                    const TextLayout& layout,
+                    const Rect& clip);
+
+    // japanese draw text rightward
+    void sjis_text_to_right(coord_t x0,
+                            coord_t y0,
+                            const XbmFont& zenkaku_font,
+                            const XbmFont& hankaku_font,
+                            const string_type& text);
+    void sjis_text_to_right(const Point& p0,
+                            const XbmFont& zenkaku_font,
+                            const XbmFont& hankaku_font,
+                            const string_type& text);
+    template<typename T_CONVERTER>
+    void sjis_text_to_right(coord_t x0,
+                            coord_t y0,
+                            const XbmFont& zenkaku_font,
+                            const XbmFont& hankaku_font,
+                            const string_type& text,
+                            T_CONVERTER& conv);
+    template<typename T_CONVERTER>
+    void sjis_text_to_right(const Point& p0,
+                            const XbmFont& zenkaku_font,
+                            const XbmFont& hankaku_font,
+                            const string_type& text,
+                            T_CONVERTER& conv);
+
+    // UTF-8 draw text rightward
+    void utf8_text_to_right(coord_t x0,
+                            coord_t y0,
+                            const XbmFont& zenkaku_font,
+                            const XbmFont& hankaku_font,
+                            const string_type& text);
+    void utf8_text_to_right(const Point& p0,
+                            const XbmFont& zenkaku_font,
+                            const XbmFont& hankaku_font,
+                            const string_type& text);
+    template<typename T_CONVERTER>
+    void utf8_text_to_right(coord_t x0,
+                            coord_t y0,
+                            const XbmFont& zenkaku_font,
+                            const XbmFont& hankaku_font,
+                            const string_type& text,
+                            T_CONVERTER& conv);
+    template<typename T_CONVERTER>
+    void utf8_text_to_right(const Point& p0,
+                            const XbmFont& zenkaku_font,
+                            const XbmFont& hankaku_font,
+                            const string_type& text,
+                            T_CONVERTER& conv);
+
+    // the rotated and shifted glyphs of vertical writing. a canvas keeps
+    // its own cache (not copied with it) unless the caller shares one with
+    // set_vertical_cache(&cache); NULL goes back to the own one. clear the
+    // cache when a font drawn with it is destroyed. a shared cache is not
+    // locked; share it between the canvases of one thread.
+    VerticalGlyphCache& vertical_cache();
+    void set_vertical_cache(VerticalGlyphCache* cache);
+
+    // draw one character of vertical writing. returns the advance.
+    // the column is as wide as the cell height of the hankaku font.
+    Size vertical_put_char(coord_t x0,
+                           coord_t y0,
+                           const XbmFont& font,
+                           coord_t char_code);
+    Size vertical_jis_put_char(coord_t x0,
+                               coord_t y0,
+                               const XbmFont& font,
+                               coord_t jis_code);
+
+    // draw text downward (vertical writing)
+    void text_to_down(coord_t x0,
+                      coord_t y0,
+                      const XbmFont& font,
+                      const string_type& text);
+    void text_to_down(const Point& p0,
+                      const XbmFont& font,
+                      const string_type& text);
+
+    // japanese draw text downward
+    void sjis_text_to_down(coord_t x0,
+                           coord_t y0,
+                           const XbmFont& zenkaku_font,
+                           const XbmFont& hankaku_font,
+                           const string_type& text);
+    void sjis_text_to_down(const Point& p0,
+                           const XbmFont& zenkaku_font,
+                           const XbmFont& hankaku_font,
+                           const string_type& text);
+
+    // UTF-8 draw text downward
+    void utf8_text_to_down(coord_t x0,
+                           coord_t y0,
+                           const XbmFont& zenkaku_font,
+                           const XbmFont& hankaku_font,
+                           const string_type& text);
+    void utf8_text_to_down(const Point& p0,
+                           const XbmFont& zenkaku_font,
+                           const XbmFont& hankaku_font,
+                           const string_type& text);
+
+    void flood_fill(coord_t x, coord_t y, color_t ch, bool surface = false);
+    void flood_fill(const Point& p, color_t ch, bool surface = false);
+    void flood_fill_bordered(coord_t x, coord_t y, color_t border_ch);
+    void flood_fill_bordered(const Point& p, color_t border_ch);
+    void flood_fill_surface(coord_t x, coord_t y, color_t surface_ch);
+    void flood_fill_surface(const Point& p, color_t surface_ch);
+
+    // the cells of ch as the set pixels of mask of the same size
+    void get_mask(XbmImage& mask, color_t ch) const;
+
+    // morphology of the cells of the fore color. the cells turned off
+    // get the back color.
+    void dilate(const MorphElement& elem);
+    void erode(const MorphElement& elem);
+    void open(const MorphElement& elem);
+    void close(const MorphElement& elem);
+
+    void move_to(coord_t x, coord_t y);
+    void move_to(const Point& p);
+
+    void line_to(coord_t x, coord_t y);
+    void line_to(const Point& p);
+    template<typename T_PUTTER>
+    void line_to(coord_t x, coord_t y, T_PUTTER& putter);
+    template<typename T_PUTTER>
+    void line_to(const Point& p, T_PUTTER& putter);
+
+    void line(coord_t x0, coord_t y0, coord_t x1, coord_t y1);
+    void line(const Point& p0, const Point& p1);
+    template<typename T_PUTTER>
+    void line(coord_t x0, coord_t y0, coord_t x1, coord_t y1, T_PUTTER& putter);
+
+    void rectangle(coord_t x0, coord_t y0, coord_t x1, coord_t y1);
+    void rectangle(const Point& p0, const Point& p1);
+    template<typename T_PUTTER>
+    void rectangle(coord_t x0,
+                   coord_t y0,
+                   coord_t x1,
+                   coord_t y1,
+                   T_PUTTER& putter);
+
+    void fill_rectangle(coord_t x0, coord_t y0, coord_t x1, coord_t y1);
+    void fill_rectangle(const Point& p0, const Point& p1);
+    template<typename T_PUTTER>
+    void fill_rectangle(coord_t x0,
+                        coord_t y0,
+                        coord_t x1,
+                        coord_t y1,
+                        T_PUTTER& putter);
+
+    void circle(coord_t x0, coord_t y0, coord_t r);
+    void circle(const Point& c, coord_t r);
+    template<typename T_PUTTER>
+    void circle(coord_t x0, coord_t y0, coord_t r, T_PUTTER& putter);
+
+    void fill_circle(coord_t x0, coord_t y0, coord_t r);
+    void fill_circle(const Point& c, coord_t r);
+    template<typename T_PUTTER>
+    void fill_circle(coord_t x0, coord_t y0, coord_t r, T_PUTTER& putter);
+
+    void ellipse(coord_t x0, coord_t y0, coord_t x1, coord_t y1);
+    void ellipse(const Point& p0, const Point& p1);
+    template<typename T_PUTTER>
+    void ellipse(coord_t x0,
+                 coord_t y0,
+                 coord_t x1,
+                 coord_t y1,
+                 T_PUTTER& putter);
+
+    void fill_ellipse(coord_t x0, coord_t y0, coord_t x1, coord_t y1);
+    void fill_ellipse(const Point& p0, const Point& p1);
+    template<typename T_PUTTER>
+    void fill_ellipse(coord_t x0,
+                      coord_t y0,
+                      coord_t x1,
+                      coord_t y1,
+                      T_PUTTER& putter);
+
+    void arc(coord_t x0,
+             coord_t y0,
+             coord_t x1,
+             coord_t y1,
+             double start_radian,
+             double end_radian,
+             bool clockwise = false);
+    void arc(const Point& p0,
+             const Point& p1,
+             double start_radian,
+             double end_radian,
+             bool clockwise = false);
+    template<typename T_PUTTER>
+    void arc(coord_t x0,
+             coord_t y0,
+             coord_t x1,
+             coord_t y1,
+             double start_radian,
+             double end_radian,
+             bool clockwise,
+             T_PUTTER& putter);
+
+    void arc_to(coord_t x0,
+                coord_t y0,
+                coord_t x1,
+                coord_t y1,
+                double start_radian,
+                double end_radian,
+                bool clockwise = false);
+    void arc_to(const Point& p0,
+                const Point& p1,
+                double start_radian,
+                double end_radian,
+                bool clockwise = false);
+    template<typename T_PUTTER>
+    void arc_to(coord_t x0,
+                coord_t y0,
+                coord_t x1,
+                coord_t y1,
+                double start_radian,
+                double end_radian,
+                bool clockwise,
+                T_PUTTER& putter);
+
+    void pie(coord_t x0,
+             coord_t y0,
+             coord_t x1,
+             coord_t y1,
+             double start_radian,
+             double end_radian);
+    void pie(const Point& p0,
+             const Point& p1,
+             double start_radian,
+             double end_radian);
+    template<typename T_PUTTER>
+    void pie(coord_t x0,
+             coord_t y0,
+             coord_t x1,
+             coord_t y1,
+             double start_radian,
+             double end_radian,
+             T_PUTTER& putter);
+
+    void fill_pie(coord_t x0,
+                  coord_t y0,
+                  coord_t x1,
+                  coord_t y1,
+                  double start_radian,
+                  double end_radian,
+                  bool clockwise = false);
+    void fill_pie(const Point& p0,
+                  const Point& p1,
+                  double start_radian,
+                  double end_radian,
+                  bool clockwise = false);
+    template<typename T_PUTTER>
+    void fill_pie(coord_t x0,
+                  coord_t y0,
+                  coord_t x1,
+                  coord_t y1,
+                  double start_radian,
+                  double end_radian,
+                  bool clockwise,
+                  T_PUTTER& putter);
+
+    void round_rect(coord_t x0,
+                    coord_t y0,
+                    coord_t x1,
+                    coord_t y1,
+                    coord_t rx,
+                    coord_t ry);
+    void round_rect(const Point& p0, const Point& p1, coord_t rx, coord_t ry);
+    template<typename T_PUTTER>
+    void round_rect(coord_t x0,
+                    coord_t y0,
+                    coord_t x1,
+                    coord_t y1,
+                    coord_t rx,
+                    coord_t ry,
+                    T_PUTTER& putter);
+
+    void fill_round_rect(coord_t x0,
+                         coord_t y0,
+                         coord_t x1,
+                         coord_t y1,
+                         coord_t rx,
+                         coord_t ry);
+    void fill_round_rect(const Point& p0,
+                         const Point& p1,
+                         coord_t rx,
+                         coord_t ry);
+    template<typename T_PUTTER>
+    void fill_round_rect(coord_t x0,
+                         coord_t y0,
+                         coord_t x1,
+                         coord_t y1,
+                         coord_t rx,
+                         coord_t ry,
+                         T_PUTTER& putter);
+
+    void lines(size_t num_points, const Point* points);
+    void lines(const Points& points);
+    template<typename T_PUTTER>
+    void lines(size_t num_points, const Point* points, T_PUTTER& putter);
+
+    void polyline(size_t num_points, const Point* points);
+    void polyline(const Points& points);
+    template<typename T_PUTTER>
+    void polyline(size_t num_points, const Point* points, T_PUTTER& putter);
+
+    void polygon(size_t num_points, const Point* points);
+    void polygon(const Points& points);
+    template<typename T_PUTTER>
+    void polygon(size_t num_points, const Point* points, T_PUTTER& putter);
+
+    void fill_polygon(size_t num_points,
+                      const Point* points,
+                      bool alternate = false);
+    void fill_polygon(const Points& points, bool alternate = false);
+    template<typename T_PUTTER>
+    void fill_polygon(size_t num_points,
+                      const Point* points,
+                      bool alternate,
+                      T_PUTTER& putter);
+
+    template<typename T_PUTTER>
+    void fill_polygon_alternate(size_t num_points,
+                                const Point* points,
+                                T_PUTTER& putter);
+    template<typename T_PUTTER>
+    void fill_polygon_alternate(const Points& points, T_PUTTER& putter);
+
+    template<typename T_PUTTER>
+    void fill_polygon_winding(size_t num_points,
+                              const Point* points,
+                              T_PUTTER& putter);
+    template<typename T_PUTTER>
+    void fill_polygon_winding(const Points& points, T_PUTTER& putter);
+
+    // thick strokes, see StrokeStyle and SpanBuffer
+    void stroke_line(coord_t x0,
+                     coord_t y0,
+                     coord_t x1,
+                     coord_t y1,
+                     const StrokeStyle& style);
+    template<typename T_PUTTER>
+    void stroke_line(coord_t x0,
+                     coord_t y0,
+                     coord_t x1,
+                     coord_t y1,
+                     const StrokeStyle& style,
+                     T_PUTTER& putter);
+
+    void stroke_polyline(size_t num_points,
+                         const Point* points,
+                         const StrokeStyle& style);
+    void stroke_polyline(const Points& points, const StrokeStyle& style);
+    template<typename T_PUTTER>
+    void stroke_polyline(size_t num_points,
+                         const Point* points,
+                         const StrokeStyle& style,
+                         T_PUTTER& putter);
+    template<typename T_PUTTER>
+    void stroke_polyline(const Points& points,
+                         const StrokeStyle& style,
+                         T_PUTTER& putter);
+
+    void stroke_polygon(size_t num_points,
+                        const Point* points,
+                        const StrokeStyle& style);
+    void stroke_polygon(const Points& points, const StrokeStyle& style);
+    template<typename T_PUTTER>
+    void stroke_polygon(size_t num_points,
+                        const Point* points,
+                        const StrokeStyle& style,
+                        T_PUTTER& putter);
+    template<typename T_PUTTER>
+    void stroke_polygon(const Points& points,
+                        const StrokeStyle& style,
+                        T_PUTTER& putter);
+
+    void stroke_rectangle(coord_t x0,
+                          coord_t y0,
+                          coord_t x1,
+                          coord_t y1,
+                          const StrokeStyle& style);
+    template<typename T_PUTTER>
+    void stroke_rectangle(coord_t x0,
+                          coord_t y0,
+                          coord_t x1,
+                          coord_t y1,
+                          const StrokeStyle& style,
+                          T_PUTTER& putter);
+
+    void stroke_circle(coord_t x0,
+                       coord_t y0,
+                       coord_t r,
+                       const StrokeStyle& style);
+    template<typename T_PUTTER>
+    void stroke_circle(coord_t x0,
+                       coord_t y0,
+                       coord_t r,
+                       const StrokeStyle& style,
+                       T_PUTTER& putter);
+
+    void stroke_ellipse(coord_t x0,
+                        coord_t y0,
+                        coord_t x1,
+                        coord_t y1,
+                        const StrokeStyle& style);
+    template<typename T_PUTTER>
+    void stroke_ellipse(coord_t x0,
+                        coord_t y0,
+                        coord_t x1,
+                        coord_t y1,
+                        const StrokeStyle& style,
+                        T_PUTTER& putter);
+
+    void swap(TextCanvas& other);
+
+    void rotate_left(const TextCanvas& other);
+    void rotate_right(const TextCanvas& other);
+    void rotate_180(const TextCanvas& other);
+
+    void rotate_left();
+    void rotate_right();
+    void rotate_180();
+
+    void scale(const TextCanvas& other, coord_t width, coord_t height);
+    void scale(coord_t width, coord_t height);
+
+    void scale_cross(const TextCanvas& other, coord_t x_multi, coord_t y_multi);
+    void scale_cross(coord_t x_multi, coord_t y_multi);
+
+    void scale_percent(const TextCanvas& other,
+                       coord_t x_percent,
+                       coord_t y_percent);
+    void scale_percent(coord_t x_percent, coord_t y_percent);
+
+    void mirror_h(const TextCanvas& other);
+    void mirror_v(const TextCanvas& other);
+
+    void mirror_h();
+    void mirror_v();
+
+  protected:
+    void put_mask_change(const XbmImage& before, const XbmImage& after);
+    // the cells of a row written directly are put back outside the mask
+    bool clip_masked() const;
+    void unclip_row(coord_t y, coord_t x0, const string_type& saved);
+    // where the box of two corners of a primitive is against the clip.
+    // a primitive inside the clip is drawn by an UncheckedPutter.
+    enum BoxClip
+    {
+        BOX_OUTSIDE,
+        BOX_PARTIAL,
+        BOX_INSIDE
+    };
+    BoxClip clip_box(coord_t x0, coord_t y0, coord_t x1, coord_t y1) const;
+    static Point ellipse_center(coord_t x0, coord_t y0, coord_t x1, coord_t y1);
+    bool clip_blit(Rect& dest_rect,
+                   Point& src_origin,
+                   coord_t src_width,
+                   coord_t src_height) const;
+    void morph(const MorphElement& elem,
+               void (XbmImage::*op)(const MorphElement&));
+
+    void stroke_path(SpanBuffer& spans,
+                     size_t num_points,
+                     const Point* points,
+                     bool closed,
+                     const StrokeStyle& style);
+};
+
+///////////////////////////////////////////////////////////////////////////
+// pixel putters
+
+struct NonePutter
+{
+    NonePutter() {}
+    void operator()(coord_t, coord_t) {}
+};
+struct SimplePutter
+{
+    TextCanvas& m_tc;
+    SimplePutter(TextCanvas& tc)
+      : m_tc(tc)
+    {}
+    void operator()(coord_t x, coord_t y) { m_tc.put_pixel(x, y); }
+};
+struct ColorPutter
+{
+    TextCanvas& m_tc;
+    color_t m_color;
+    ColorPutter(TextCanvas& tc, color_t color)
+      : m_tc(tc)
+      , m_color(color)
+    {}
+    void operator()(coord_t x, coord_t y) { m_tc.put_pixel(x, y, m_color); }
+};
+struct ClipPutter // put in the color within the clip box
+{
+    TextCanvas& m_tc;
+    color_t m_color;
+    const Rect& m_clip;
+    ClipPutter(TextCanvas& tc, color_t color, const Rect& clip)
+      : m_tc(tc)
+      , m_color(color)
+      , m_clip(clip)
+    {}
+    void operator()(coord_t x, coord_t y)
+    {
+        if (m_clip.contains(x, y))
+            m_tc.put_pixel(x, y, m_color);
+    }
+};
+struct UncheckedPutter // for the cells known to be in the clip
+{
+    color_t* m_text;
+    coord_t m_width;
+    color_t m_color;
+    UncheckedPutter(TextCanvas& tc)
+      : m_text(&tc[0])
+      , m_width(tc.width())
+      , m_color(tc.fore_color())
+    {}
+    void operator()(coord_t x, coord_t y)
+    {
+        assert(0 <= x && x < m_width && 0 <= y);
+        m_text[y * m_width + x] = m_color;
+    }
+};
+
+// put the cells x0 to x1 of row y. the canvas putters fill the span
+// within the clip at once.
+template<typename T_PUTTER>
+inline void
+put_span(T_PUTTER& putter, coord_t y, coord_t x0, coord_t x1)
+{
+    for (coord_t x = x0; x <= x1; ++x) {
+        putter(x, y);
+    }
+}
+inline void
+put_span(SimplePutter& putter, coord_t y, coord_t x0, coord_t x1)
+{
+    putter.m_tc.fill_span(y, x0, x1, putter.m_tc.fore_color());
+}
+inline void
+put_span(ColorPutter& putter, coord_t y, coord_t x0, coord_t x1)
+{
+    putter.m_tc.fill_span(y, x0, x1, putter.m_color);
+}
+inline void
+put_span(UncheckedPutter& putter, coord_t y, coord_t x0, coord_t x1)
+{
+    if (x0 <= x1)
+        std::memset(&putter.m_text[y * putter.m_width + x0], putter.m_color,
+                    x1 - x0 + 1);
+}
+
+struct XorPutter
+{
+    TextCanvas& m_tc;
+    XorPutter(TextCanvas& tc)
+      : m_tc(tc)
+    {}
+    void operator()(coord_t x, coord_t y)
+    {
+        color_t c = m_tc.get_pixel(x, y);
+        m_tc.put_pixel(x, y, c ^ m_tc.fore_color());
+    }
+};
+struct WidenPutter
+{
+    TextCanvas& m_tc;
+    WidenPutter(TextCanvas& tc)
+      : m_tc(tc)
+    {}
+    void operator()(coord_t x, coord_t y)
+    {
+        m_tc.put_pixel(x, y);
+        m_tc.put_pixel(x - 1, y);
+        m_tc.put_pixel(x + 1, y);
+        m_tc.put_pixel(x, y - 1);
+        m_tc.put_pixel(x, y + 1);
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////
+// text sinks for japanese::Iso2022JpDecoder and japanese::EucJpDecoder
+
+struct TextRunSink
+{
+    TextRun& m_run;
+    const XbmFont& m_zenkaku_font;
+    const XbmFont& m_hankaku_font;
+    TextRunSink(TextRun& run,
+                const XbmFont& zenkaku_font,
+                const XbmFont& hankaku_font)
+      : m_run(run)
+      , m_zenkaku_font(zenkaku_font)
+      , m_hankaku_font(hankaku_font)
+    {}
+    void hankaku(uint8_t ch) { m_run.push_char(m_hankaku_font, ch); }
+    void zenkaku(uint16_t jis_code)
+    {
+        m_run.push_jis_char(m_zenkaku_font, jis_code);
+    }
+};
+struct TextPutSink
+{
+    TextCanvas& m_tc;
+    const XbmFont& m_zenkaku_font;
+    const XbmFont& m_hankaku_font;
+    Point m_pos;
+    TextPutSink(TextCanvas& tc,
+                const XbmFont& zenkaku_font,
+                const XbmFont& hankaku_font,
+                const Point& pos)
+      : m_tc(tc)
+      , m_zenkaku_font(zenkaku_font)
+      , m_hankaku_font(hankaku_font)
+      , m_pos(pos)
+    {}
+    void hankaku(uint8_t ch)
+    {
+        const XbmFont& font = m_hankaku_font;
+        m_pos.x += m_tc.put_glyph(m_pos.x,
+                                  m_pos.y,
+                                  font,
+                                  ch % font.columns(),
+                                  ch / font.columns()).x;
+    }
+    void zenkaku(uint16_t jis_code)
+    {
+        Point cell = m_zenkaku_font.jis_cell(jis_code);
+        m_pos.x += m_tc.put_glyph(m_pos.x,
+                                  m_pos.y,
+                                  m_zenkaku_font,
+                                  cell.x,
+                                  cell.y).x;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////
+// image converters
+
+// A mapped converter also tells the size of its output and which source
+// pixel each output pixel comes from:
+//     static Size size(const Size& s);
+//     static Point source(const Size& s, const Point& p);
+// Such converters can be fused by FusedConverter and cached by GlyphCache.
+// GlyphCache calls T_CONVERTER::convert_glyph to make a cached glyph.
+
+template<typename T_CONVERTER>
+struct MappedConverter
+{
+    // map a font cell in one pass
+    static XbmImage
+    convert_glyph(const XbmFont& font, coord_t iColumn, coord_t iRow)
+    {
+        const Size s(font.cell_width(), font.cell_height());
+        const Size d = T_CONVERTER::size(s);
+        const coord_t qx0 = iColumn * s.x, qy0 = iRow * s.y;
+        XbmImage image(d.x, d.y);
+        for (coord_t y = 0; y < d.y; ++y) {
+            for (coord_t x = 0; x < d.x; ++x) {
+                Point q = T_CONVERTER::source(s, Point(x, y));
+                if (q.x < 0 || q.y < 0 || q.x >= s.x || q.y >= s.y)
+                    continue;
+                if (font.get_dot(qx0 + q.x, qy0 + q.y))
+                    image.put_dot(x, y, true);
+            }
+        }
+        return image;
+    }
+};
+
+struct NoneConverter : MappedConverter<NoneConverter>
+{
+    void operator()(TextCanvas&) {}
+    static Size size(const Size& s) { return s; }
+    static Point source(const Size&, const Point& p) { return p; }
+};
+struct YokoNibaiKaku : MappedConverter<YokoNibaiKaku>
+{
+    void operator()(TextCanvas& tc) { tc.scale_cross(2, 1); }
+    static Size size(const Size& s) { return Size(s.x * 2, s.y); }
+    static Point source(const Size&, const Point& p)
+    {
+        return Point(p.x / 2, p.y);
+    }
+};
+struct TateNibaiKaku : MappedConverter<TateNibaiKaku>
+{
+    void operator()(TextCanvas& tc) { tc.scale_cross(1, 2); }
+    static Size size(const Size& s) { return Size(s.x, s.y * 2); }
+    static Point source(const Size&, const Point& p)
+    {
+        return Point(p.x, p.y / 2);
+    }
+};
+struct YonBaiKaku : MappedConverter<YonBaiKaku>
+{
+    void operator()(TextCanvas& tc) { tc.scale_cross(2, 2); }
+    static Size size(const Size& s) { return Size(s.x * 2, s.y * 2); }
+    static Point source(const Size&, const Point& p)
+    {
+        return Point(p.x / 2, p.y / 2);
+    }
+};
+struct LeftRotator : MappedConverter<LeftRotator>
+{
+    void operator()(TextCanvas& tc) { tc.rotate_left(); }
+    static Size size(const Size& s) { return Size(s.y, s.x); }
+    static Point source(const Size& s, const Point& p)
+    {
+        return Point(s.x - (p.y + 1), p.x);
+    }
+};
+struct RightRotator : MappedConverter<RightRotator>
+{
+    void operator()(TextCanvas& tc) { tc.rotate_right(); }
+    static Size size(const Size& s) { return Size(s.y, s.x); }
+    static Point source(const Size& s, const Point& p)
+    {
+        return Point(p.y, s.y - (p.x + 1));
+    }
+};
+
+// is T a MappedConverter?
+template<typename T>
+struct is_mapped_converter
+{
+    template<typename T_CONVERTER>
+    static char check(const MappedConverter<T_CONVERTER>*);
+    static long check(...);
+    enum { value = (sizeof(check(static_cast<const T*>(NULL))) == 1) };
+};
+
+template<bool B>
+struct converter_tag { };
+
+template<typename T_CONVERTER>
+inline void
+map_convert(TextCanvas& tc, const TextCanvas& other);
+
+template<typename T_LEFT_CONV, typename T_RIGHT_CONV>
+struct PairConverter;
+
+// run T_CONVERTER made by its default constructor
+template<typename T_CONVERTER>
+struct DefaultConverter
+{
+    static void convert(TextCanvas& tc)
+    {
+        T_CONVERTER conv;
+        conv(tc);
+    }
+};
+template<typename T_LEFT_CONV, typename T_RIGHT_CONV>
+struct DefaultConverter<PairConverter<T_LEFT_CONV, T_RIGHT_CONV> >
+{
+    static void convert(TextCanvas& tc)
+    {
+        DefaultConverter<T_LEFT_CONV>::convert(tc);
+        DefaultConverter<T_RIGHT_CONV>::convert(tc);
+    }
+};
+
+// convert a font cell on a TextCanvas, for GlyphCache
+template<typename T_CONVERTER>
+struct CanvasConverter
+{
+    static XbmImage
+    convert_glyph(const XbmFont& font, coord_t iColumn, coord_t iRow)
+    {
+        const coord_t qx0 = iColumn * font.cell_width();
+        const coord_t qy0 = iRow * font.cell_height();
+        TextCanvas tc;
+        font.get_subimage(tc, qx0, qy0, qx0 + font.cell_width() - 1,
+                          qy0 + font.cell_height() - 1);
+        DefaultConverter<T_CONVERTER>::convert(tc);
+        XbmImage image(tc.width(), tc.height());
+        tc.get_subimage(image, 0, 0, tc.width() - 1, tc.height() - 1);
+        return image;
+    }
+};
+
+// a pair is mapped only if both of its converters are
+template<bool MAPPED, typename T_CONVERTER>
+struct PairConverterBase : MappedConverter<T_CONVERTER> { };
+template<typename T_CONVERTER>
+struct PairConverterBase<false, T_CONVERTER> : CanvasConverter<T_CONVERTER> { };
+
+// T_LEFT_CONV then T_RIGHT_CONV. If both are mapped, it is mapped and
+// runs in one pass like FusedConverter; otherwise in two passes.
+template<typename T_LEFT_CONV, typename T_RIGHT_CONV>
+struct PairConverter
+  : PairConverterBase<is_mapped_converter<T_LEFT_CONV>::value &&
+                          is_mapped_converter<T_RIGHT_CONV>::value,
+                      PairConverter<T_LEFT_CONV, T_RIGHT_CONV> >
+{
+    T_LEFT_CONV& m_left;
+    T_RIGHT_CONV& m_right;
+    PairConverter(T_LEFT_CONV& left, T_RIGHT_CONV& right)
+      : m_left(left)
+      , m_right(right)
+    {}
+    void operator()(TextCanvas& tc)
+    {
+        convert(tc, converter_tag<
+            is_mapped_converter<T_LEFT_CONV>::value &&
+            is_mapped_converter<T_RIGHT_CONV>::value>());
+    }
+    static Size size(const Size& s)
+    {
+        return T_RIGHT_CONV::size(T_LEFT_CONV::size(s));
+    }
+    static Point source(const Size& s, const Point& p)
+    {
+        Point q = T_RIGHT_CONV::source(T_LEFT_CONV::size(s), p);
+        return T_LEFT_CONV::source(s, q);
+    }
+
+  protected:
+    void convert(TextCanvas& tc, converter_tag<true>)
+    {
+        TextCanvas other;
+        map_convert<PairConverter>(other, tc);
+        tc.swap(other);
+    }
+    void convert(TextCanvas& tc, converter_tag<false>)
+    {
+        m_left(tc);
+        m_right(tc);
+    }
+};
+
+// convert by the mapping of T_CONVERTER in one pass
+template<typename T_CONVERTER>
+inline void
+map_convert(TextCanvas& tc, const TextCanvas& other)
+{
+    const Size s(other.width(), other.height());
+    const Size d = T_CONVERTER::size(s);
+    tc.reset(d.x, d.y);
+    for (coord_t y = 0; y < d.y; ++y) {
+        for (coord_t x = 0; x < d.x; ++x) {
+            Point q = T_CONVERTER::source(s, Point(x, y));
+            tc.put_pixel(x, y, other.get_pixel(q));
+        }
+    }
+}
+
+// T_LEFT_CONV then T_RIGHT_CONV, fused into one pass
+template<typename T_LEFT_CONV, typename T_RIGHT_CONV>
+struct FusedConverter
+  : MappedConverter<FusedConverter<T_LEFT_CONV, T_RIGHT_CONV> >
+{
+    typedef PairConverter<T_LEFT_CONV, T_RIGHT_CONV> pair_type;
+    void operator()(TextCanvas& tc)
+    {
+        TextCanvas other;
+        map_convert<FusedConverter>(other, tc);
+        tc.swap(other);
+    }
+    static Size size(const Size& s) { return pair_type::size(s); }
+    static Point source(const Size& s, const Point& p)
+    {
+        return pair_type::source(s, p);
+    }
+};
+
+// shift by half a cell to the upper right, for vertical punctuation
+struct VerticalShifter : MappedConverter<VerticalShifter>
+{
+    void operator()(TextCanvas& tc)
+    {
+        TextCanvas other;
+        map_convert<VerticalShifter>(other, tc);
+        tc.swap(other);
+    }
+    static Size size(const Size& s) { return s; }
+    static Point source(const Size& s, const Point& p)
+    {
+        return Point(p.x - s.x / 2, p.y + s.y / 2);
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////
+// glyph effects
+//
+// An effect converts the output of T_CONVERTER by combining packed rows:
+//     static XbmImage effect(const XbmImage& image);
+// It works on a TextCanvas and inside GlyphCache, e.g.
+// GlyphCache<Bold<YonBaiKaku> >.
+
+template<typename T_EFFECT, typename T_CONVERTER>
+struct EffectConverter
+{
+    void operator()(TextCanvas& tc)
+    {
+        T_CONVERTER conv;
+        conv(tc);
+        XbmImage image(tc.width(), tc.height());
+        tc.get_subimage(image, 0, 0, tc.width() - 1, tc.height() - 1);
+        XbmImage result = T_EFFECT::effect(image);
+        tc.reset(result.width(), result.height());
+        tc.put_subimage(0, 0, result);
+    }
+    static XbmImage
+    convert_glyph(const XbmFont& font, coord_t iColumn, coord_t iRow)
+    {
+        return T_EFFECT::effect(
+            T_CONVERTER::convert_glyph(font, iColumn, iRow));
+    }
+};
+
+// emboldening: one pixel wider, each row ORed with itself moved by one
+template<typename T_CONVERTER = NoneConverter>
+struct Bold : EffectConverter<Bold<T_CONVERTER>, T_CONVERTER>
+{
+    static XbmImage effect(const XbmImage& image)
+    {
+        XbmImage result(image.width() + 1, image.height());
+        result.or_subimage(0, 0, image);
+        result.or_subimage(1, 0, image);
+        return result;
+    }
+};
+
+// oblique: each row moved rightward by one pixel per SLANT rows from
+// the bottom
+template<typename T_CONVERTER = NoneConverter, int SLANT = 4>
+struct Italic : EffectConverter<Italic<T_CONVERTER, SLANT>, T_CONVERTER>
+{
+    static XbmImage effect(const XbmImage& image)
+    {
+        const coord_t cy = image.height();
+        XbmImage result(image.width() + (cy - 1) / SLANT, cy);
+        for (coord_t y = 0; y < cy; ++y) {
+            XbmImage row(image.width(), 1, &image.data()[y * image.stride()]);
+            result.or_subimage((cy - 1 - y) / SLANT, y, row);
+        }
+        return result;
+    }
+};
+
+// outline: the 3x3 dilation minus the original, one pixel larger on
+// each side
+template<typename T_CONVERTER = NoneConverter>
+struct Outline : EffectConverter<Outline<T_CONVERTER>, T_CONVERTER>
+{
+    static XbmImage effect(const XbmImage& image)
+    {
+        XbmImage wide(image.width() + 2, image.height());
+        wide.or_subimage(0, 0, image);
+        wide.or_subimage(1, 0, image);
+        wide.or_subimage(2, 0, image);
+        XbmImage result(image.width() + 2, image.height() + 2);
+        result.or_subimage(0, 0, wide);
+        result.or_subimage(0, 1, wide);
+        result.or_subimage(0, 2, wide);
+        result.and_not_subimage(1, 1, image);
+        return result;
+    }
+};
+
+// drop shadow: the original composited over itself moved by (1, 1)
+template<typename T_CONVERTER = NoneConverter>
+struct Shadow : EffectConverter<Shadow<T_CONVERTER>, T_CONVERTER>
+{
+    static XbmImage effect(const XbmImage& image)
+    {
+        XbmImage result(image.width() + 1, image.height() + 1);
+        result.or_subimage(0, 0, image);
+        result.or_subimage(1, 1, image);
+        return result;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////
+// GlyphCache --- font cells converted once by a converter
+
+template<typename T_CONVERTER>
+class GlyphCache
+{
+  public:
+    GlyphCache() {}
+
+    const XbmImage& get(const XbmFont& font, coord_t iColumn, coord_t iRow)
+    {
+        assert(0 <= iColumn && iColumn < font.columns());
+        assert(0 <= iRow && iRow < font.rows());
+        key_type key(&font, iRow * font.columns() + iColumn);
+        typename map_type::iterator it = m_map.find(key);
+        if (it != m_map.end())
+            return it->second;
+
+        XbmImage image = T_CONVERTER::convert_glyph(font, iColumn, iRow);
+        it = m_map.insert(std::make_pair(key, image)).first;
+        return it->second;
+    }
+
+    size_t size() const { return m_map.size(); }
+    void clear() { m_map.clear(); }
+
+  protected:
+    typedef std::pair<const XbmFont*, coord_t> key_type;
+    typedef std::map<key_type, XbmImage> map_type;
+    map_type m_map;
+};
+
+// the caches of vertical writing. see TextCanvas::vertical_cache.
+class VerticalGlyphCache
+{
+  public:
+    GlyphCache<RightRotator> rotated;
+    GlyphCache<VerticalShifter> shifted;
+
+    size_t size() const { return rotated.size() + shifted.size(); }
+    void clear()
+    {
+        rotated.clear();
+        shifted.clear();
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////
+// BannerCache --- LRU cache of whole rendered strings
+//
+// A banner is the mask of a string drawn rightward, keyed by the text,
+// the fonts, the converter type and the colors. A hit is one put_image.
+// The least recently used banners are dropped to keep within the budget.
+// With TEXTCANVAS_USE_THREADS, all the methods lock a mutex, but only to
+// look up and insert: the banners are rasterized and blitted unlocked.
+
+class BannerCache
+{
+  public:
+    explicit BannerCache(size_t budget = 1024 * 1024)
+      : m_budget(budget)
+      , m_bytes(0)
+      , m_hits(0)
+      , m_misses(0)
+    {}
+
+    Size text_to_right(TextCanvas& tc,
+                       coord_t x0,
+                       coord_t y0,
+                       const XbmFont& font,
+                       const string_type& text)
+    {
+        NoneConverter conv;
+        return text_to_right(tc, x0, y0, font, text, conv);
+    }
+    template<typename T_CONVERTER>
+    Size text_to_right(TextCanvas& tc,
+                       coord_t x0,
+                       coord_t y0,
+                       const XbmFont& font,
+                       const string_type& text,
+                       T_CONVERTER& conv)
+    {
+        return draw(tc, x0, y0, MODE_SINGLE, font, font, text, conv);
+    }
+
+    Size sjis_text_to_right(TextCanvas& tc,
+                            coord_t x0,
+                            coord_t y0,
+                            const XbmFont& zenkaku_font,
+                            const XbmFont& hankaku_font,
+                            const string_type& text)
+    {
+        NoneConverter conv;
+        return sjis_text_to_right(tc, x0, y0, zenkaku_font, hankaku_font,
+                                  text, conv);
+    }
+    template<typename T_CONVERTER>
+    Size sjis_text_to_right(TextCanvas& tc,
+                            coord_t x0,
+                            coord_t y0,
+                            const XbmFont& zenkaku_font,
+                            const XbmFont& hankaku_font,
+                            const string_type& text,
+                            T_CONVERTER& conv)
+    {
+        return draw(tc, x0, y0, MODE_SJIS, zenkaku_font, hankaku_font, text,
+                    conv);
+    }
+
+    Size utf8_text_to_right(TextCanvas& tc,
+                            coord_t x0,
+                            coord_t y0,
+                            const XbmFont& zenkaku_font,
+                            const XbmFont& hankaku_font,
+                            const string_type& text)
+    {
+        NoneConverter conv;
+        return utf8_text_to_right(tc, x0, y0, zenkaku_font, hankaku_font,
+                                  text, conv);
+    }
+    template<typename T_CONVERTER>
+    Size utf8_text_to_right(TextCanvas& tc,
+                            coord_t x0,
+                            coord_t y0,
+                            const XbmFont& zenkaku_font,
+                            const XbmFont& hankaku_font,
+                            const string_type& text,
+                            T_CONVERTER& conv)
+    {
+        return draw(tc, x0, y0, MODE_UTF8, zenkaku_font, hankaku_font, text,
+                    conv);
+    }
+
+    size_t budget() const
+    {
+        Lock lock(*this);
+        return m_budget;
+    }
+    void set_budget(size_t budget)
+    {
+        Lock lock(*this);
+        m_budget = budget;
+        trim();
+    }
+    size_t size() const
+    {
+        Lock lock(*this);
+        return m_map.size();
+    }
+    size_t bytes() const
+    {
+        Lock lock(*this);
+        return m_bytes;
+    }
+    size_t hits() const
+    {
+        Lock lock(*this);
+        return m_hits;
+    }
+    size_t misses() const
+    {
+        Lock lock(*this);
+        return m_misses;
+    }
+    void clear()
+    {
+        Lock lock(*this);
+        m_map.clear();
+        m_list.clear();
+        m_bytes = 0;
+    }
+
+  protected:
+    enum Mode
+    {
+        MODE_SINGLE,
+        MODE_SJIS,
+        MODE_UTF8
+    };
+    struct Key
+    {
+        string_type text;
+        std::string conv;
+        const XbmFont* zenkaku_font;
+        const XbmFont* hankaku_font;
+        color_t fore, back;
+        Mode mode;
+
+        bool operator<(const Key& key) const
+        {
+            if (text != key.text)
+                return text < key.text;
+            if (conv != key.conv)
+                return conv < key.conv;
+            if (zenkaku_font != key.zenkaku_font)
+                return zenkaku_font < key.zenkaku_font;
+            if (hankaku_font != key.hankaku_font)
+                return hankaku_font < key.hankaku_font;
+            if (fore != key.fore)
+                return fore < key.fore;
+            if (back != key.back)
+                return back < key.back;
+            return mode < key.mode;
+        }
+    };
+    struct Entry
+    {
+        Key key;
+        XbmImage mask;
+        size_t bytes;
+        Entry(const Key& key_, const XbmImage& mask_)
+          : key(key_)
+          , mask(mask_)
+          , bytes(sizeof(Entry) + key_.text.size() + mask_.size())
+        {}
+    };
+    typedef std::list<Entry> list_type;
+    typedef std::map<Key, list_type::iterator> map_type;
+
+    size_t m_budget;
+    size_t m_bytes;
+    size_t m_hits;
+    size_t m_misses;
+    list_type m_list; // the most recently used first
+    map_type m_map;
+
+#ifdef TEXTCANVAS_USE_THREADS
+    mutable std::mutex m_mutex;
+    struct Lock
+    {
+        std::unique_lock<std::mutex> m_guard;
+        explicit Lock(const BannerCache& cache)
+          : m_guard(cache.m_mutex)
+        {}
+        void unlock() { m_guard.unlock(); }
+    };
+#else
+    struct Lock
+    {
+        explicit Lock(const BannerCache&) {}
+        void unlock() {}
+    };
+#endif
+
+    template<typename T_CONVERTER>
+    Size draw(TextCanvas& tc,
+              coord_t x0,
+              coord_t y0,
+              Mode mode,
+              const XbmFont& zenkaku_font,
+              const XbmFont& hankaku_font,
+              const string_type& text,
+              T_CONVERTER& conv)
+    {
+        Key key;
+        key.text = text;
+        key.conv = typeid(T_CONVERTER).name();
+        key.zenkaku_font = &zenkaku_font;
+        key.hankaku_font = &hankaku_font;
+        key.fore = tc.fore_color();
+        key.back = tc.back_color();
+        key.mode = mode;
+
+        Lock lock(*this);
+        map_type::iterator it = m_map.find(key);
+        if (it != m_map.end()) {
+            // a hit copies the mask out, to blit it unlocked
+            ++m_hits;
+            m_list.splice(m_list.begin(), m_list, it->second);
+            const XbmImage mask(it->second->mask);
+            lock.unlock();
+            return tc.put_image(x0, y0, mask);
+        }
+        ++m_misses;
+        lock.unlock();
+
+        // a miss rasterizes the banner unlocked
+        TextRun run;
+        switch (mode) {
+        case MODE_SINGLE:
+            run.assign(hankaku_font, text);
+            break;
+        case MODE_SJIS:
+            run.assign_sjis(zenkaku_font, hankaku_font, text);
+            break;
+        case MODE_UTF8:
+            run.assign_utf8(zenkaku_font, hankaku_font, text);
+            break;
+        }
+        if (run.empty())
+            return Size(0, 0);
+
+        // the converted cell sizes give the banner size
+        Size zenkaku_size = cell_size(zenkaku_font, conv);
+        Size hankaku_size = cell_size(hankaku_font, conv);
+        Size extent(0, 0);
+        for (size_t i = 0; i < run.size(); ++i) {
+            const Size& s = run[i].zenkaku ? zenkaku_size : hankaku_size;
+            extent.x += s.x;
+            extent.y = std::max(extent.y, s.y);
+        }
+
+        TextCanvas banner(extent.x, extent.y, one, zero);
+        banner.text_to_right(0, 0, run, conv);
+        XbmImage mask(extent.x, extent.y);
+        banner.get_subimage(mask, 0, 0, extent.x - 1, extent.y - 1);
+
+        insert(key, mask);
+        return tc.put_image(x0, y0, mask);
+    }
+
+    // another thread may have inserted the same banner meanwhile
+    void insert(const Key& key, const XbmImage& mask)
+    {
+        Lock lock(*this);
+        map_type::iterator it = m_map.find(key);
+        if (it != m_map.end()) {
+            m_list.splice(m_list.begin(), m_list, it->second);
+            return;
+        }
+        m_list.push_front(Entry(key, mask));
+        m_map.insert(std::make_pair(key, m_list.begin()));
+        m_bytes += m_list.front().bytes;
+        trim();
+    }
+
+    template<typename T_CONVERTER>
+    static Size cell_size(const XbmFont& font, T_CONVERTER& conv)
+    {
+        TextCanvas cell(font.cell_width(), font.cell_height());
+        conv(cell);
+        return Size(cell.width(), cell.height());
+    }
+
+    // drop the least recently used banners
+    void trim()
+    {
+        while (m_bytes > m_budget && !m_list.empty()) {
+            m_bytes -= m_list.back().bytes;
+            m_map.erase(m_list.back().key);
+            m_list.pop_back();
+        }
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////
+// DisplayList --- recorded drawing replayed tile by tile
+//
+// The commands are recorded with their colors and bounding boxes. On
+// replay, the commands off the canvas are culled, the commands hidden
+// under later opaque ones (fill_rectangle and glyphs) are dropped, and
+// the rest are binned into tiles and drawn tile by tile in the recorded
+// order. A shape is rasterized once, at its first visible tile, into
+// spans sorted by row; each tile then fills only the parts of the spans
+// in its own rows and columns. The cells are the same as drawn
+// immediately; the pen position and the colors of the canvas are kept.
+
+// the cells x0 to x1 of row y
+struct CellSpan
+{
+    coord_t y;
+    coord_t x0;
+    coord_t x1;
+    bool operator<(const CellSpan& span) const
+    {
+        return y < span.y || (y == span.y && x0 < span.x0);
+    }
+};
+
+// the cells put within the bounds, as spans
+struct SpanRecorder
+{
+    std::vector<CellSpan>& m_spans;
+    Rect m_bounds;
+    SpanRecorder(std::vector<CellSpan>& spans, const Rect& bounds)
+      : m_spans(spans)
+      , m_bounds(bounds)
+    {}
+    void operator()(coord_t x, coord_t y) { span(y, x, x); }
+    void span(coord_t y, coord_t x0, coord_t x1)
+    {
+        if (y < m_bounds.y0 || y > m_bounds.y1)
+            return;
+        x0 = std::max(x0, m_bounds.x0);
+        x1 = std::min(x1, m_bounds.x1);
+        if (x0 > x1)
+            return;
+
+        // the cells of a line extend the last span of the row
+        if (!m_spans.empty()) {
+            CellSpan& last = m_spans.back();
+            if (last.y == y && x0 <= last.x1 + 1 && last.x0 <= x1 + 1) {
+                last.x0 = std::min(last.x0, x0);
+                last.x1 = std::max(last.x1, x1);
+                return;
+            }
+        }
+        CellSpan s;
+        s.y = y;
+        s.x0 = x0;
+        s.x1 = x1;
+        m_spans.push_back(s);
+    }
+
+    // sort the spans by row and join the touching ones. the spans of
+    // lines and fills come in order or in reverse order.
+    void finish()
+    {
+        if (ordered(m_spans.rbegin(), m_spans.rend()))
+            std::reverse(m_spans.begin(), m_spans.end());
+        else if (!ordered(m_spans.begin(), m_spans.end()))
+            std::sort(m_spans.begin(), m_spans.end());
+        size_t n = 0;
+        for (size_t i = 0; i < m_spans.size(); ++i) {
+            if (n > 0 && m_spans[n - 1].y == m_spans[i].y &&
+                m_spans[i].x0 <= m_spans[n - 1].x1 + 1) {
+                m_spans[n - 1].x1 = std::max(m_spans[n - 1].x1, m_spans[i].x1);
+            } else {
+                m_spans[n++] = m_spans[i];
+            }
+        }
+        m_spans.resize(n);
+    }
+
+    template<typename T_ITER>
+    static bool ordered(T_ITER first, T_ITER last)
+    {
+        if (first == last)
+            return true;
+        for (T_ITER it = first; ++it != last; first = it) {
+            if (*it < *first)
+                return false;
+        }
+        return true;
+    }
+};
+inline void
+put_span(SpanRecorder& putter, coord_t y, coord_t x0, coord_t x1)
+{
+    putter.span(y, x0, x1);
+}
+
+class DisplayList
+{
+  public:
+    DisplayList(coord_t tile_width = 64, coord_t tile_height = 32)
+      : m_tile_width(std::max(tile_width, coord_t(1)))
+      , m_tile_height(std::max(tile_height, coord_t(1)))
+      , m_culled(0)
+      , m_occluded(0)
+      , m_draws(0)
+    {}
+
+    void line(coord_t x0, coord_t y0, coord_t x1, coord_t y1, color_t color)
+    {
+        push(CMD_LINE, x0, y0, x1, y1, color,
+             Rect(std::min(x0, x1), std::min(y0, y1),
+                  std::max(x0, x1), std::max(y0, y1)));
+    }
+    void rectangle(coord_t x0,
+                   coord_t y0,
+                   coord_t x1,
+                   coord_t y1,
+                   color_t color)
+    {
+        push(CMD_RECTANGLE, x0, y0, x1, y1, color, box(x0, y0, x1, y1));
+    }
+    void fill_rectangle(coord_t x0,
+                        coord_t y0,
+                        coord_t x1,
+                        coord_t y1,
+                        color_t color)
+    {
+        push(CMD_FILL_RECTANGLE, x0, y0, x1, y1, color,
+             box(x0, y0, x1, y1));
+    }
+    void circle(coord_t x0, coord_t y0, coord_t r, color_t color)
+    {
+        push(CMD_CIRCLE, x0, y0, r, r, color,
+             Rect(x0 - r, y0 - r, x0 + r, y0 + r));
+    }
+    void fill_circle(coord_t x0, coord_t y0, coord_t r, color_t color)
+    {
+        push(CMD_FILL_CIRCLE, x0, y0, r, r, color,
+             Rect(x0 - r, y0 - r, x0 + r, y0 + r));
+    }
+    void ellipse(coord_t x0, coord_t y0, coord_t x1, coord_t y1, color_t color)
+    {
+        push(CMD_ELLIPSE, x0, y0, x1, y1, color, box(x0, y0, x1, y1));
+    }
+    void fill_ellipse(coord_t x0,
+                      coord_t y0,
+                      coord_t x1,
+                      coord_t y1,
+                      color_t color)
+    {
+        push(CMD_FILL_ELLIPSE, x0, y0, x1, y1, color, box(x0, y0, x1, y1));
+    }
+
+    // a font cell in the fore and back colors
+    void put_char(coord_t x0,
+                  coord_t y0,
+                  const XbmFont& font,
+                  coord_t char_code,
+                  color_t fore,
+                  color_t back)
+    {
+        put_glyph(x0, y0, font, char_code % font.columns(),
+                  char_code / font.columns(), fore, back);
+    }
+    void jis_put_char(coord_t x0,
+                      coord_t y0,
+                      const XbmFont& font,
+                      coord_t jis_code,
+                      color_t fore,
+                      color_t back)
+    {
+        Point cell = font.jis_cell(uint16_t(jis_code));
+        put_glyph(x0, y0, font, cell.x, cell.y, fore, back);
+    }
+    void put_glyph(coord_t x0,
+                   coord_t y0,
+                   const XbmFont& font,
+                   coord_t iColumn,
+                   coord_t iRow,
+                   color_t fore,
+                   color_t back)
+    {
+        push(CMD_GLYPH, x0, y0, iColumn, iRow, fore,
+             Rect(x0, y0, x0 + font.cell_width() - 1,
+                  y0 + font.cell_height() - 1));
+        m_commands.back().back = back;
+        m_commands.back().font = &font;
+    }
+
+    size_t size() const { return m_commands.size(); }
+    void clear() { m_commands.clear(); }
+
+    coord_t tile_width() const { return m_tile_width; }
+    coord_t tile_height() const { return m_tile_height; }
+
+    // the statistics of the last replay
+    size_t culled() const { return m_culled; }
+    size_t occluded() const { return m_occluded; }
+    size_t draws() const { return m_draws; } // per tile
+
+    void replay(TextCanvas& tc)
+    {
+        m_culled = m_occluded = m_draws = 0;
+        if (tc.width() <= 0 || tc.height() <= 0) {
+            m_culled = m_commands.size();
+            return;
+        }
+
+        // cull and bin
+        const Rect canvas(0, 0, tc.width() - 1, tc.height() - 1);
+        const coord_t nx = (tc.width() + m_tile_width - 1) / m_tile_width;
+        const coord_t ny = (tc.height() + m_tile_height - 1) / m_tile_height;
+        std::vector<std::vector<size_t> > bins(nx * ny);
+        for (size_t i = 0; i < m_commands.size(); ++i) {
+            const Rect rc = intersect_rect(m_commands[i].box, canvas);
+            if (rc.empty()) {
+                ++m_culled;
+                continue;
+            }
+            for (coord_t ty = rc.y0 / m_tile_height;
+                 ty <= rc.y1 / m_tile_height; ++ty) {
+                for (coord_t tx = rc.x0 / m_tile_width;
+                     tx <= rc.x1 / m_tile_width; ++tx) {
+                    bins[ty * nx + tx].push_back(i);
+                }
+            }
+        }
+
+        const color_t fore = tc.fore_color(), back = tc.back_color();
+        const Point pos = tc.pos();
+        const Rect clip = tc.clip_rect();
+        std::vector<bool> drawn(m_commands.size(), false);
+        std::vector<std::vector<CellSpan> > spans(m_commands.size());
+        std::vector<size_t> visible;
+        std::vector<Rect> opaques;
+        for (coord_t ty = 0; ty < ny; ++ty) {
+            for (coord_t tx = 0; tx < nx; ++tx) {
+                const Rect tile = intersect_rect(
+                    canvas, Rect(tx * m_tile_width, ty * m_tile_height,
+                                 (tx + 1) * m_tile_width - 1,
+                                 (ty + 1) * m_tile_height - 1));
+
+                // from the last, skip what the later opaque ones cover
+                const std::vector<size_t>& bin = bins[ty * nx + tx];
+                visible.clear();
+                opaques.clear();
+                for (size_t k = bin.size(); k-- > 0;) {
+                    const Command& cmd = m_commands[bin[k]];
+                    const Rect rc = intersect_rect(cmd.box, tile);
+                    if (covered(rc, opaques))
+                        continue;
+                    visible.push_back(bin[k]);
+                    if (cmd.type == CMD_FILL_RECTANGLE ||
+                        cmd.type == CMD_GLYPH) {
+                        if (rc == tile)
+                            break;
+                        opaques.push_back(rc);
+                    }
+                }
+
+                const Rect rc = intersect_rect(tile, clip);
+                for (size_t k = visible.size(); k-- > 0;) {
+                    const size_t i = visible[k];
+                    if (!drawn[i])
+                        rasterize(tc, m_commands[i], canvas, spans[i]);
+                    if (!rc.empty())
+                        draw(tc, m_commands[i], spans[i], rc);
+                    drawn[i] = true;
+                }
+                m_draws += visible.size();
+            }
+        }
+        for (size_t i = 0; i < m_commands.size(); ++i) {
+            if (!drawn[i])
+                ++m_occluded;
+        }
+        m_occluded -= m_culled;
+
+        tc.fore_color(fore);
+        tc.back_color(back);
+        tc.move_to(pos);
+    }
+
+  protected:
+    enum Type
+    {
+        CMD_LINE,
+        CMD_RECTANGLE,
+        CMD_FILL_RECTANGLE,
+        CMD_CIRCLE,
+        CMD_FILL_CIRCLE,
+        CMD_ELLIPSE,
+        CMD_FILL_ELLIPSE,
+        CMD_GLYPH
+    };
+    struct Command
+    {
+        Type type;
+        coord_t x0, y0, x1, y1; // r is x1 for circles
+        color_t fore, back;
+        const XbmFont* font;
+        Rect box;
+    };
+
+    coord_t m_tile_width;
+    coord_t m_tile_height;
+    std::vector<Command> m_commands;
+    size_t m_culled;
+    size_t m_occluded;
+    size_t m_draws;
+
+    static Rect box(coord_t x0, coord_t y0, coord_t x1, coord_t y1)
+    {
+        return Rect(std::min(x0, x1), std::min(y0, y1), std::max(x0, x1),
+                    std::max(y0, y1));
+    }
+
+    void push(Type type,
+              coord_t x0,
+              coord_t y0,
+              coord_t x1,
+              coord_t y1,
+              color_t color,
+              const Rect& box)
+    {
+        Command cmd;
+        cmd.type = type;
+        cmd.x0 = x0;
+        cmd.y0 = y0;
+        cmd.x1 = x1;
+        cmd.y1 = y1;
+        cmd.fore = cmd.back = color;
+        cmd.font = NULL;
+        cmd.box = box;
+        m_commands.push_back(cmd);
+    }
+
+    static bool covered(const Rect& rc, const std::vector<Rect>& opaques)
+    {
+        for (size_t i = 0; i < opaques.size(); ++i) {
+            if (opaques[i].contains(rc))
+                return true;
+        }
+        return false;
+    }
+
+    // the spans of a shape on the canvas
+    static void rasterize(TextCanvas& tc,
+                          const Command& cmd,
+                          const Rect& canvas,
+                          std::vector<CellSpan>& spans)
+    {
+        SpanRecorder putter(spans, canvas);
+        switch (cmd.type) {
+        case CMD_LINE:
+            tc.line(cmd.x0, cmd.y0, cmd.x1, cmd.y1, putter);
+            break;
+        case CMD_RECTANGLE:
+            tc.rectangle(cmd.x0, cmd.y0, cmd.x1, cmd.y1, putter);
+            break;
+        case CMD_CIRCLE:
+            tc.circle(cmd.x0, cmd.y0, cmd.x1, putter);
+            break;
+        case CMD_FILL_CIRCLE:
+            tc.fill_circle(cmd.x0, cmd.y0, cmd.x1, putter);
+            break;
+        case CMD_ELLIPSE:
+            tc.ellipse(cmd.x0, cmd.y0, cmd.x1, cmd.y1, putter);
+            break;
+        case CMD_FILL_ELLIPSE:
+            tc.fill_ellipse(cmd.x0, cmd.y0, cmd.x1, cmd.y1, putter);
+            break;
+        default:
+            // rectangles and glyphs are drawn from their commands
+            return;
+        }
+        putter.finish();
+    }
+
+    // draw a command within rc, a tile in the clip of the canvas
+    static void draw(TextCanvas& tc,
+                     const Command& cmd,
+                     const std::vector<CellSpan>& spans,
+                     const Rect& rc)
+    {
+        switch (cmd.type) {
+        case CMD_FILL_RECTANGLE:
+            {
+                const Rect box = intersect_rect(cmd.box, rc);
+                for (coord_t y = box.y0; y <= box.y1; ++y) {
+                    fill(tc, y, box.x0, box.x1, cmd.fore);
+                }
+            }
+            break;
+        case CMD_GLYPH:
+            tc.fore_color(cmd.fore);
+            tc.back_color(cmd.back);
+            tc.put_glyph(cmd.x0, cmd.y0, *cmd.font, cmd.x1, cmd.y1, rc);
+            break;
+        default:
+            {
+                // the first span of row rc.y0; the spans are on the canvas
+                CellSpan first;
+                first.y = rc.y0;
+                first.x0 = first.x1 = 0;
+                std::vector<CellSpan>::const_iterator it =
+                  std::lower_bound(spans.begin(), spans.end(), first);
+                for (; it != spans.end() && it->y <= rc.y1; ++it) {
+                    const coord_t x0 = std::max(it->x0, rc.x0);
+                    const coord_t x1 = std::min(it->x1, rc.x1);
+                    if (x0 <= x1)
+                        fill(tc, it->y, x0, x1, cmd.fore);
+                }
+            }
+            break;
+        }
+    }
+
+    // x0 to x1 of row y are in the clip rectangle
+    static void fill(TextCanvas& tc, coord_t y, coord_t x0, coord_t x1,
+                     color_t ch)
+    {
+        if (tc.has_clip())
+            tc.fill_span(y, x0, x1, ch);
+        else
+            std::memset(&tc.row(y)[x0], ch, x1 - x0 + 1);
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////
+// SpriteAtlas --- colour-keyed sprites in one buffer
+//
+// A sprite is added from a TextCanvas (or a rectangle of a sprite sheet)
+// with a key color. The cells other than the key are kept as runs per
+// row, and the opaque cells of all the sprites are packed into one
+// buffer. TextCanvas::put_sprite copies the runs only; the key cells
+// leave the canvas as it was.
+
+struct SpriteRun
+{
+    coord_t x;          // the first column in the sprite
+    coord_t count;      // the number of cells
+    size_t offset;      // the index of the first cell in the atlas
+};
+
+class SpriteAtlas
+{
+  public:
+    SpriteAtlas()
+    {
+        m_rows.push_back(0);
+    }
+
+    // add a sprite and return its index
+    coord_t add(const TextCanvas& image, color_t key = space)
+    {
+        return add(image, Rect(0, 0, image.width() - 1, image.height() - 1),
+                   key);
+    }
+    coord_t add(const TextCanvas& sheet, const Rect& rect, color_t key = space)
+    {
+        const Rect rc = intersect_rect(
+            rect, Rect(0, 0, sheet.width() - 1, sheet.height() - 1));
+        Sprite sprite;
+        sprite.width = std::max(rc.x1 - rc.x0 + 1, coord_t(0));
+        sprite.height = std::max(rc.y1 - rc.y0 + 1, coord_t(0));
+        sprite.first_row = m_rows.size() - 1;
+        for (coord_t y = 0; y < sprite.height; ++y) {
+            coord_t x = 0;
+            while (x < sprite.width) {
+                if (sheet.get_pixel(rc.x0 + x, rc.y0 + y) == key) {
+                    ++x;
+                    continue;
+                }
+                SpriteRun run;
+                run.x = x;
+                run.offset = m_cells.size();
+                for (; x < sprite.width; ++x) {
+                    const color_t ch = sheet.get_pixel(rc.x0 + x, rc.y0 + y);
+                    if (ch == key)
+                        break;
+                    m_cells += ch;
+                }
+                run.count = x - run.x;
+                m_runs.push_back(run);
+            }
+            m_rows.push_back(m_runs.size());
+        }
+        m_sprites.push_back(sprite);
+        return coord_t(m_sprites.size()) - 1;
+    }
+
+    coord_t size() const { return coord_t(m_sprites.size()); }
+    coord_t width(coord_t index) const { return get(index).width; }
+    coord_t height(coord_t index) const { return get(index).height; }
+
+    // the runs of row y of a sprite
+    const SpriteRun* row_begin(coord_t index, coord_t y) const
+    {
+        assert(0 <= y && y < height(index));
+        return run_at(m_rows[get(index).first_row + y]);
+    }
+    const SpriteRun* row_end(coord_t index, coord_t y) const
+    {
+        assert(0 <= y && y < height(index));
+        return run_at(m_rows[get(index).first_row + y + 1]);
+    }
+    const color_t* cells() const { return m_cells.c_str(); }
+
+    size_t run_count() const { return m_runs.size(); }
+    size_t cell_count() const { return m_cells.size(); }
+
+    void clear()
+    {
+        m_sprites.clear();
+        m_rows.assign(1, 0);
+        m_runs.clear();
+        m_cells.clear();
+    }
+
+  protected:
+    struct Sprite
+    {
+        coord_t width, height;
+        size_t first_row;       // the index in m_rows
+    };
+    std::vector<Sprite> m_sprites;
+    std::vector<size_t> m_rows;     // the first run of each row, and the end
+    std::vector<SpriteRun> m_runs;
+    string_type m_cells;
+
+    const Sprite& get(coord_t index) const
+    {
+        assert(0 <= index && index < size());
+        return m_sprites[index];
+    }
+    const SpriteRun* run_at(size_t i) const
+    {
+        return m_runs.empty() ? NULL : &m_runs[0] + i;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////
+// dirty rectangles --- the damage of LayerStack and SceneGraph
+
+// add rect to the dirty rectangles, merging the overlapping ones
+inline void
+add_dirty_rect(std::vector<Rect>& dirty, Rect rect)
+{
+    if (rect.empty())
+        return;
+
+    for (size_t i = 0; i < dirty.size();) {
+        if (dirty[i].intersects(rect)) {
+            rect = union_rect(rect, dirty[i]);
+            dirty.erase(dirty.begin() + i);
+            i = 0;
+        } else {
+            ++i;
+        }
+    }
+    dirty.push_back(rect);
+}
+
+///////////////////////////////////////////////////////////////////////////
+// LayerStack --- layers composited over the dirty regions
+//
+// Each layer is a TextCanvas with a z-order, a visibility, an offset and
+// a transparent key color. The layers are drawn through edit(), which
+// marks the edited rectangle dirty; moving, hiding or reordering a layer
+// marks its old and new bounds. compose() rebuilds only the dirty regions
+// of the result, from the back color upward, with the keyed blits of
+// TextCanvas::blit. A layer with the same z as another stays above the
+// ones added before it.
+
+class LayerStack
+{
+  public:
+    LayerStack(coord_t width, coord_t height, color_t back = space)
+      : m_result(width, height, back, back)
+      , m_blank(width, height, back, back)
+      , m_recomposed(0)
+    {
+        invalidate();
+    }
+
+    coord_t width() const { return m_result.width(); }
+    coord_t height() const { return m_result.height(); }
+
+    // add a transparent layer and return its index
+    coord_t add(coord_t width,
+                coord_t height,
+                int z = 0,
+                color_t key = space)
+    {
+        Layer layer;
+        layer.canvas.reset(width, height, key);
+        layer.canvas.back_color(key);
+        layer.offset = Point(0, 0);
+        layer.z = z;
+        layer.key = key;
+        layer.visible = true;
+        m_layers.push_back(layer);
+        return coord_t(m_layers.size()) - 1;
+    }
+    coord_t size() const { return coord_t(m_layers.size()); }
+
+    // the canvas of a layer to draw on, marking rect (or all) dirty
+    TextCanvas& edit(coord_t index)
+    {
+        invalidate(bounds(index));
+        return get(index).canvas;
+    }
+    TextCanvas& edit(coord_t index, const Rect& rect)
+    {
+        const Point& offset = get(index).offset;
+        invalidate(Rect(rect.x0 + offset.x, rect.y0 + offset.y,
+                        rect.x1 + offset.x, rect.y1 + offset.y));
+        return get(index).canvas;
+    }
+    const TextCanvas& layer(coord_t index) const { return get(index).canvas; }
+
+    void offset(coord_t index, const Point& offset)
+    {
+        invalidate(bounds(index));
+        get(index).offset = offset;
+        invalidate(bounds(index));
+    }
+    const Point& offset(coord_t index) const { return get(index).offset; }
+    void visible(coord_t index, bool visible)
+    {
+        get(index).visible = visible;
+        invalidate(bounds(index));
+    }
+    bool visible(coord_t index) const { return get(index).visible; }
+    void z(coord_t index, int z)
+    {
+        get(index).z = z;
+        invalidate(bounds(index));
+    }
+    int z(coord_t index) const { return get(index).z; }
+    void key(coord_t index, color_t key)
+    {
+        get(index).key = key;
+        invalidate(bounds(index));
+    }
+    color_t key(coord_t index) const { return get(index).key; }
+
+    // the area of the stack on the result of layer index
+    Rect bounds(coord_t index) const
+    {
+        const Layer& layer = get(index);
+        return Rect(layer.offset.x,
+                    layer.offset.y,
+                    layer.offset.x + layer.canvas.width() - 1,
+                    layer.offset.y + layer.canvas.height() - 1);
+    }
+
+    void invalidate()
+    {
+        invalidate(Rect(0, 0, width() - 1, height() - 1));
+    }
+    void invalidate(const Rect& rect)
+    {
+        add_dirty_rect(m_dirty, intersect_rect(
+            rect, Rect(0, 0, width() - 1, height() - 1)));
+    }
+    const std::vector<Rect>& dirty() const { return m_dirty; }
+
+    // recompose the dirty regions and return the result
+    const TextCanvas& compose()
+    {
+        std::vector<coord_t> order;
+        for (coord_t i = 0; i < size(); ++i) {
+            if (m_layers[i].visible)
+                order.push_back(i);
+        }
+        std::stable_sort(order.begin(), order.end(), ZLess(m_layers));
+
+        m_recomposed = 0;
+        for (size_t k = 0; k < m_dirty.size(); ++k) {
+            const Rect& rc = m_dirty[k];
+            m_result.blit(rc, m_blank, Point(rc.x0, rc.y0));
+            for (size_t i = 0; i < order.size(); ++i) {
+                const Layer& layer = m_layers[order[i]];
+                const Point origin(rc.x0 - layer.offset.x,
+                                   rc.y0 - layer.offset.y);
+                m_result.blit(rc, layer.canvas, origin, ROP_KEY, layer.key);
+            }
+            m_recomposed += (rc.x1 - rc.x0 + 1) * (rc.y1 - rc.y0 + 1);
+        }
+        m_dirty.clear();
+        return m_result;
+    }
+    const TextCanvas& result() const { return m_result; }
+
+    // the number of cells recomposed by the last compose()
+    coord_t recomposed() const { return m_recomposed; }
+
+  protected:
+    struct Layer
+    {
+        TextCanvas canvas;
+        Point offset;
+        int z;
+        color_t key;
+        bool visible;
+    };
+    struct ZLess
+    {
+        const std::vector<Layer>& m_layers;
+        ZLess(const std::vector<Layer>& layers)
+          : m_layers(layers)
+        {}
+        bool operator()(coord_t a, coord_t b) const
+        {
+            return m_layers[a].z < m_layers[b].z;
+        }
+    };
+    std::vector<Layer> m_layers;
+    TextCanvas m_result;
+    TextCanvas m_blank;
+    std::vector<Rect> m_dirty;
+    coord_t m_recomposed;
+
+    Layer& get(coord_t index)
+    {
+        assert(0 <= index && index < size());
+        return m_layers[index];
+    }
+    const Layer& get(coord_t index) const
+    {
+        assert(0 <= index && index < size());
+        return m_layers[index];
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////
+// SceneGraph --- retained nodes with damage tracking and picking
+//
+// The nodes (rectangles, ellipses, polygons, texts and sprites) are kept
+// with a translation and a style, and drawn in the order they were added.
+// Adding, moving, restyling or removing a node damages its old and new
+// bounding boxes; render() redraws only the damaged regions, with the
+// spans of the nodes cut to them. The nodes are indexed in a uniform
+// grid of the canvas, which answers pick() and the nodes to redraw
+// without scanning all the nodes.
+
+enum NodeType
+{
+    NODE_RECT,
+    NODE_ELLIPSE,
+    NODE_POLYGON,
+    NODE_TEXT,
+    NODE_SPRITE
+};
+
+class SceneGraph
+{
+  public:
+    SceneGraph(coord_t width,
+               coord_t height,
+               color_t back = space,
+               coord_t grid_width = 16,
+               coord_t grid_height = 8)
+      : m_width(width)
+      , m_height(height)
+      , m_back(back)
+      , m_grid_width(std::max(grid_width, coord_t(1)))
+      , m_grid_height(std::max(grid_height, coord_t(1)))
+      , m_columns((width + m_grid_width - 1) / m_grid_width)
+      , m_rows((height + m_grid_height - 1) / m_grid_height)
+      , m_grid(m_columns * m_rows)
+      , m_redrawn(0)
+      , m_draws(0)
+    {
+        invalidate(Rect(0, 0, width - 1, height - 1));
+    }
+
+    coord_t width() const { return m_width; }
+    coord_t height() const { return m_height; }
+
+    // add a node and return its id. the coordinates are untranslated.
+    coord_t add_rect(const Rect& rect, color_t color, bool filled = false)
+    {
+        Node node(NODE_RECT, color, filled);
+        node.points.push_back(Point(rect.x0, rect.y0));
+        node.points.push_back(Point(rect.x1, rect.y1));
+        return add(node);
+    }
+    coord_t add_ellipse(const Rect& rect, color_t color, bool filled = false)
+    {
+        Node node(NODE_ELLIPSE, color, filled);
+        node.points.push_back(Point(rect.x0, rect.y0));
+        node.points.push_back(Point(rect.x1, rect.y1));
+        return add(node);
+    }
+    coord_t add_polygon(const Points& points,
+                        color_t color,
+                        bool filled = false)
+    {
+        Node node(NODE_POLYGON, color, filled);
+        node.points = points;
+        return add(node);
+    }
+    coord_t add_text(const Point& p0,
+                     const XbmFont& font,
+                     const string_type& text,
+                     color_t fore,
+                     color_t back = space)
+    {
+        Node node(NODE_TEXT, fore, true);
+        node.back = back;
+        node.points.push_back(p0);
+        node.layout.layout(TextRun(font, text));
+        return add(node);
+    }
+    coord_t add_sprite(const Point& p0,
+                       const SpriteAtlas& atlas,
+                       coord_t index)
+    {
+        Node node(NODE_SPRITE, sharp, true);
+        node.points.push_back(p0);
+        node.atlas = &atlas;
+        node.index = index;
+        return add(node);
+    }
+
+    void remove(coord_t id)
+    {
+        Node& node = get(id);
+        damage(id);
+        unindex(id);
+        node.removed = true;
+    }
+    bool removed(coord_t id) const
+    {
+        return 0 <= id && id < coord_t(m_nodes.size()) && m_nodes[id].removed;
+    }
+
+    // the translation of a node
+    void move_to(coord_t id, const Point& offset)
+    {
+        damage(id);
+        unindex(id);
+        get(id).offset = offset;
+        index(id);
+        damage(id);
+    }
+    void move_by(coord_t id, coord_t dx, coord_t dy)
+    {
+        const Point& offset = get(id).offset;
+        move_to(id, Point(offset.x + dx, offset.y + dy));
+    }
+    const Point& offset(coord_t id) const { return get(id).offset; }
+
+    // the style of a node
+    void style(coord_t id, color_t color, bool filled)
+    {
+        get(id).color = color;
+        get(id).filled = filled;
+        damage(id);
+    }
+    void visible(coord_t id, bool visible)
+    {
+        get(id).visible = visible;
+        damage(id);
+    }
+    bool visible(coord_t id) const { return get(id).visible; }
+
+    // the bounding box of a node, translated
+    Rect bounds(coord_t id) const
+    {
+        const Node& node = get(id);
+        return Rect(node.box.x0 + node.offset.x, node.box.y0 + node.offset.y,
+                    node.box.x1 + node.offset.x, node.box.y1 + node.offset.y);
+    }
+
+    // whether (x, y) is on the area of a node (inside the outlines too)
+    bool hit(coord_t id, coord_t x, coord_t y) const
+    {
+        const Node& node = get(id);
+        if (!node.visible || !bounds(id).contains(x, y))
+            return false;
+        x -= node.offset.x;
+        y -= node.offset.y;
+        switch (node.type) {
+        case NODE_ELLIPSE:
+        case NODE_POLYGON:
+            {
+                // the last span of the row starting at or before x
+                CellSpan key;
+                key.y = y;
+                key.x0 = key.x1 = x;
+                std::vector<CellSpan>::const_iterator it =
+                    std::upper_bound(node.spans.begin(), node.spans.end(), key);
+                if (it == node.spans.begin())
+                    return false;
+                --it;
+                return it->y == y && x <= it->x1;
+            }
+        case NODE_SPRITE:
+            {
+                const SpriteRun* end = node.atlas->row_end(node.index, y - node.box.y0);
+                for (const SpriteRun* run = node.atlas->row_begin(node.index, y - node.box.y0);
+                     run != end; ++run) {
+                    if (run->x <= x - node.box.x0 && x - node.box.x0 < run->x + run->count)
+                        return true;
+                }
+                return false;
+            }
+        default:
+            return true;
+        }
+    }
+
+    // the topmost node at (x, y), or -1
+    coord_t pick(coord_t x, coord_t y) const
+    {
+        if (x < 0 || y < 0 || x >= m_width || y >= m_height)
+            return -1;
+        const std::vector<coord_t>& cell =
+            m_grid[(y / m_grid_height) * m_columns + x / m_grid_width];
+        for (size_t k = cell.size(); k-- > 0;) {
+            if (hit(cell[k], x, y))
+                return cell[k];
+        }
+        return -1;
+    }
+
+    void invalidate(const Rect& rect)
+    {
+        add_dirty_rect(m_dirty, intersect_rect(
+            rect, Rect(0, 0, m_width - 1, m_height - 1)));
+    }
+    const std::vector<Rect>& dirty() const { return m_dirty; }
+
+    // redraw the damaged regions of tc (of the size of the graph)
+    void render(TextCanvas& tc)
+    {
+        const color_t fore = tc.fore_color(), back = tc.back_color();
+        const Point pos = tc.pos();
+        std::vector<coord_t> ids;
+        m_redrawn = m_draws = 0;
+        for (size_t k = 0; k < m_dirty.size(); ++k) {
+            const Rect& rc = m_dirty[k];
+            ColorPutter putter(tc, m_back);
+            tc.fill_rectangle(rc.x0, rc.y0, rc.x1, rc.y1, putter);
+            m_redrawn += (rc.x1 - rc.x0 + 1) * (rc.y1 - rc.y0 + 1);
+
+            // the nodes in the grid cells of rc, in the order of addition
+            ids.clear();
+            for (coord_t gy = rc.y0 / m_grid_height; gy <= rc.y1 / m_grid_height; ++gy) {
+                for (coord_t gx = rc.x0 / m_grid_width; gx <= rc.x1 / m_grid_width; ++gx) {
+                    const std::vector<coord_t>& cell = m_grid[gy * m_columns + gx];
+                    ids.insert(ids.end(), cell.begin(), cell.end());
+                }
+            }
+            std::sort(ids.begin(), ids.end());
+            ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+
+            for (size_t i = 0; i < ids.size(); ++i) {
+                if (m_nodes[ids[i]].visible && bounds(ids[i]).intersects(rc)) {
+                    draw(tc, m_nodes[ids[i]], rc);
+                    ++m_draws;
+                }
+            }
+        }
+        m_dirty.clear();
+
+        tc.fore_color(fore);
+        tc.back_color(back);
+        tc.move_to(pos);
+    }
+
+    // the cells and the node draws of the last render()
+    coord_t redrawn() const { return m_redrawn; }
+    size_t draws() const { return m_draws; }
+
+  protected:
+    struct Node
+    {
+        NodeType type;
+        color_t color, back;
+        bool filled;
+        bool visible;
+        bool removed;
+        Points points;
+        TextLayout layout;
+        const SpriteAtlas* atlas;
+        coord_t index;
+        Rect box;       // untranslated
+        Point offset;
+        std::vector<CellSpan> spans; // the filled cells, untranslated
+
+        Node(NodeType type_, color_t color_, bool filled_)
+          : type(type_)
+          , color(color_)
+          , back(space)
+          , filled(filled_)
+          , visible(true)
+          , removed(false)
+          , atlas(NULL)
+          , index(0)
+          , offset(0, 0)
+        {}
+    };
+
+    coord_t m_width;
+    coord_t m_height;
+    color_t m_back;
+    coord_t m_grid_width;
+    coord_t m_grid_height;
+    coord_t m_columns;
+    coord_t m_rows;
+    std::vector<std::vector<coord_t> > m_grid;
+    std::vector<Node> m_nodes;
+    std::vector<Rect> m_dirty;
+    coord_t m_redrawn;
+    size_t m_draws;
+
+    Node& get(coord_t id)
+    {
+        assert(0 <= id && id < coord_t(m_nodes.size()) && !m_nodes[id].removed);
+        return m_nodes[id];
+    }
+    const Node& get(coord_t id) const
+    {
+        assert(0 <= id && id < coord_t(m_nodes.size()) && !m_nodes[id].removed);
+        return m_nodes[id];
+    }
+
+    coord_t add(Node& node)
+    {
+        switch (node.type) {
+        case NODE_RECT:
+        case NODE_ELLIPSE:
+            node.box = Rect(std::min(node.points[0].x, node.points[1].x),
+                            std::min(node.points[0].y, node.points[1].y),
+                            std::max(node.points[0].x, node.points[1].x),
+                            std::max(node.points[0].y, node.points[1].y));
+            break;
+        case NODE_POLYGON:
+            node.box = Rect(0, 0, -1, -1);
+            for (size_t i = 0; i < node.points.size(); ++i) {
+                const Point& pt = node.points[i];
+                node.box = union_rect(node.box, Rect(pt.x, pt.y, pt.x, pt.y));
+            }
+            break;
+        case NODE_TEXT:
+            node.box = Rect(node.points[0].x,
+                            node.points[0].y,
+                            node.points[0].x + node.layout.extent().x - 1,
+                            node.points[0].y + node.layout.extent().y - 1);
+            break;
+        case NODE_SPRITE:
+            node.box = Rect(node.points[0].x,
+                            node.points[0].y,
+                            node.points[0].x + node.atlas->width(node.index) - 1,
+                            node.points[0].y + node.atlas->height(node.index) - 1);
+            break;
+        }
+        if (node.type == NODE_ELLIPSE || node.type == NODE_POLYGON)
+            rasterize(node);
+        m_nodes.push_back(node);
+        const coord_t id = coord_t(m_nodes.size()) - 1;
+        index(id);
+        damage(id);
+        return id;
+    }
+
+    void damage(coord_t id)
+    {
+        invalidate(bounds(id));
+    }
+
+    // the cells of an ellipse or a polygon for hit(), as draw() puts them
+    // filled and outlined
+    static void rasterize(Node& node)
+    {
+        TextCanvas tc;
+        SpanRecorder putter(node.spans, node.box);
+        if (node.type == NODE_ELLIPSE) {
+            tc.fill_ellipse(node.box.x0, node.box.y0,
+                            node.box.x1, node.box.y1, putter);
+            tc.ellipse(node.box.x0, node.box.y0,
+                       node.box.x1, node.box.y1, putter);
+        } else if (!node.points.empty()) {
+            const Points& pts = node.points;
+            tc.fill_polygon(pts.size(), &pts[0], false, putter);
+            tc.polygon(pts.size(), &pts[0], putter);
+        }
+        putter.finish();
+    }
+
+    // the ids in each cell are kept in the order of addition
+    void index(coord_t id)
+    {
+        const Rect rc = intersect_rect(bounds(id),
+                                       Rect(0, 0, m_width - 1, m_height - 1));
+        if (rc.empty())
+            return;
+        for (coord_t gy = rc.y0 / m_grid_height; gy <= rc.y1 / m_grid_height; ++gy) {
+            for (coord_t gx = rc.x0 / m_grid_width; gx <= rc.x1 / m_grid_width; ++gx) {
+                std::vector<coord_t>& cell = m_grid[gy * m_columns + gx];
+                cell.insert(std::lower_bound(cell.begin(), cell.end(), id), id);
+            }
+        }
+    }
+    void unindex(coord_t id)
+    {
+        const Rect rc = intersect_rect(bounds(id),
+                                       Rect(0, 0, m_width - 1, m_height - 1));
+        if (rc.empty())
+            return;
+        for (coord_t gy = rc.y0 / m_grid_height; gy <= rc.y1 / m_grid_height; ++gy) {
+            for (coord_t gx = rc.x0 / m_grid_width; gx <= rc.x1 / m_grid_width; ++gx) {
+                std::vector<coord_t>& cell = m_grid[gy * m_columns + gx];
+                cell.erase(std::lower_bound(cell.begin(), cell.end(), id));
+            }
+        }
+    }
+
+    // draw a node within clip. the shapes go through the clip of the
+    // canvas, so that their spans are cut to it before they are filled.
+    void draw(TextCanvas& tc, const Node& node, const Rect& clip) const
+    {
+        const coord_t dx = node.offset.x, dy = node.offset.y;
+        const Rect box(node.box.x0 + dx, node.box.y0 + dy,
+                       node.box.x1 + dx, node.box.y1 + dy);
+        tc.fore_color(node.color);
+        switch (node.type) {
+        case NODE_RECT:
+            if (node.filled) {
+                fill_clipped(tc, box, clip);
+            } else {
+                fill_clipped(tc, Rect(box.x0, box.y0, box.x1, box.y0), clip);
+                fill_clipped(tc, Rect(box.x0, box.y1, box.x1, box.y1), clip);
+                fill_clipped(tc, Rect(box.x0, box.y0, box.x0, box.y1), clip);
+                fill_clipped(tc, Rect(box.x1, box.y0, box.x1, box.y1), clip);
+            }
+            break;
+        case NODE_ELLIPSE:
+            tc.push_clip_rect(clip);
+            if (node.filled)
+                tc.fill_ellipse(box.x0, box.y0, box.x1, box.y1);
+            else
+                tc.ellipse(box.x0, box.y0, box.x1, box.y1);
+            tc.pop_clip();
+            break;
+        case NODE_POLYGON:
+            {
+                Points pts(node.points);
+                for (size_t i = 0; i < pts.size(); ++i) {
+                    pts[i].x += dx;
+                    pts[i].y += dy;
+                }
+                tc.push_clip_rect(clip);
+                if (node.filled)
+                    tc.fill_polygon(pts.size(), &pts[0], false);
+                tc.polygon(pts.size(), &pts[0]);
+                tc.pop_clip();
+            }
+            break;
+        case NODE_TEXT:
+            tc.back_color(node.back);
+            tc.put_layout(box.x0, box.y0, node.layout, clip);
+            break;
+        case NODE_SPRITE:
+            tc.put_sprite(box.x0, box.y0, *node.atlas, node.index, clip);
+            break;
+        }
+    }
+    static void fill_clipped(TextCanvas& tc, const Rect& rect, const Rect& clip)
+    {
+        const Rect rc = intersect_rect(rect, clip);
+        if (!rc.empty())
+            tc.fill_rectangle(rc.x0, rc.y0, rc.x1, rc.y1);
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////
+// connected components --- two-pass union-find labeling
+//
+// label_components labels the cells of a color on a TextCanvas, or the
+// set bits of an XbmImage, in 4- or 8-connectivity. The labels are
+// numbered from 1 in the raster order of their first cells; 0 is the
+// background. With TEXTCANVAS_USE_THREADS, threads > 1 labels horizontal
+// stripes in parallel and merges them at the seams. The result does not
+// depend on the number of threads.
+
+enum Connectivity
+{
+    CONNECT_4 = 4,
+    CONNECT_8 = 8
+};
+
+struct ComponentLabels
+{
+    coord_t width, height;
+    std::vector<uint32_t> labels; // width * height
+    std::vector<Rect> boxes;      // boxes[label - 1]
+    std::vector<size_t> areas;    // areas[label - 1]
+
+    ComponentLabels()
+      : width(0)
+      , height(0)
+    {}
+
+    size_t count() const { return areas.size(); }
+    uint32_t label(coord_t x, coord_t y) const
+    {
+        return labels[y * width + x];
+    }
+};
+
+// the rows of the cells to label, as 0 or 1 for each cell
+struct CanvasRowSource
+{
+    const TextCanvas& m_tc;
+    color_t m_ch;
+    CanvasRowSource(const TextCanvas& tc, color_t ch)
+      : m_tc(tc)
+      , m_ch(ch)
+    {}
+    coord_t width() const { return m_tc.width(); }
+    coord_t height() const { return m_tc.height(); }
+    void get_row(coord_t y, uint8_t* row) const
+    {
+        const color_t* src = &m_tc[y * m_tc.width()];
+        for (coord_t x = 0; x < m_tc.width(); ++x) {
+            row[x] = (src[x] == m_ch);
+        }
+    }
+};
+struct XbmRowSource
+{
+    const XbmImage& m_image;
+    XbmRowSource(const XbmImage& image)
+      : m_image(image)
+    {}
+    coord_t width() const { return m_image.width(); }
+    coord_t height() const { return m_image.height(); }
+    void get_row(coord_t y, uint8_t* row) const
+    {
+        const XbmImage::value_type* src = &m_image.data()[y * m_image.stride()];
+        const coord_t cx = m_image.width();
+        for (coord_t x = 0; x < cx; x += 8) {
+            const XbmImage::value_type bits = src[x >> 3];
+            const coord_t n = std::min(coord_t(8), cx - x);
+            if (bits == 0) {
+                std::memset(&row[x], 0, n);
+                continue;
+            }
+            for (coord_t i = 0; i < n; ++i) {
+                row[x + i] = (bits >> i) & 1;
+            }
+        }
+    }
+};
+
+// the union-find forest of the provisional labels. a provisional label
+// is one more than the index of the cell that made it, so the stripes
+// never share labels.
+inline uint32_t
+find_label(std::vector<uint32_t>& parents, uint32_t label)
+{
+    while (parents[label] != label) {
+        parents[label] = parents[parents[label]];
+        label = parents[label];
+    }
+    return label;
+}
+inline void
+unite_labels(std::vector<uint32_t>& parents, uint32_t a, uint32_t b)
+{
+    a = find_label(parents, a);
+    b = find_label(parents, b);
+    if (a < b)
+        parents[b] = a;
+    else if (b < a)
+        parents[a] = b;
+}
+
+// the first pass over the rows [y0, y1)
+template<typename T_SOURCE>
+inline void
+label_stripe(ComponentLabels& comps,
+             std::vector<uint32_t>& parents,
+             const T_SOURCE& source,
+             Connectivity conn,
+             coord_t y0,
+             coord_t y1)
+{
+    const coord_t cx = comps.width;
+    std::vector<uint8_t> row(cx);
+    for (coord_t y = y0; y < y1; ++y) {
+        source.get_row(y, row.empty() ? NULL : &row[0]);
+        uint32_t* labels = &comps.labels[y * cx];
+        const uint32_t* above = (y > y0) ? labels - cx : NULL;
+        for (coord_t x = 0; x < cx; ++x) {
+            if (!row[x]) {
+                labels[x] = 0;
+                continue;
+            }
+
+            uint32_t label = 0;
+            uint32_t neighbors[4];
+            size_t n = 0;
+            if (x > 0 && labels[x - 1])
+                neighbors[n++] = labels[x - 1];
+            if (above) {
+                if (above[x])
+                    neighbors[n++] = above[x];
+                if (conn == CONNECT_8) {
+                    if (x > 0 && above[x - 1])
+                        neighbors[n++] = above[x - 1];
+                    if (x + 1 < cx && above[x + 1])
+                        neighbors[n++] = above[x + 1];
+                }
+            }
+            if (n == 0) {
+                label = uint32_t(y * cx + x + 1);
+                parents[label] = label;
+            } else {
+                label = neighbors[0];
+                for (size_t i = 1; i < n; ++i) {
+                    unite_labels(parents, label, neighbors[i]);
+                }
+            }
+            labels[x] = label;
+        }
+    }
+}
+
+#ifdef TEXTCANVAS_USE_THREADS
+template<typename T_SOURCE>
+struct LabelStripeTask
+{
+    ComponentLabels* comps;
+    std::vector<uint32_t>* parents;
+    const T_SOURCE* source;
+    Connectivity conn;
+    coord_t y0, y1;
+    void operator()() const
+    {
+        label_stripe(*comps, *parents, *source, conn, y0, y1);
+    }
+};
+#endif
+
+template<typename T_SOURCE>
+inline void
+label_components(ComponentLabels& comps,
+                 const T_SOURCE& source,
+                 Connectivity conn,
+                 unsigned threads)
+{
+    const coord_t cx = source.width(), cy = source.height();
+    comps.width = cx;
+    comps.height = cy;
+    comps.labels.assign(size_t(cx) * cy, 0);
+    comps.boxes.clear();
+    comps.areas.clear();
+    if (cx <= 0 || cy <= 0)
+        return;
+
+    std::vector<uint32_t> parents(size_t(cx) * cy + 1, 0);
+
+    // the first pass, by stripes
+    std::vector<coord_t> seams;
+    if (threads < 1)
+        threads = 1;
+    if (coord_t(threads) > cy)
+        threads = unsigned(cy);
+#ifdef TEXTCANVAS_USE_THREADS
+    if (threads > 1) {
+        std::vector<std::thread> workers;
+        for (unsigned i = 0; i < threads; ++i) {
+            LabelStripeTask<T_SOURCE> task;
+            task.comps = &comps;
+            task.parents = &parents;
+            task.source = &source;
+            task.conn = conn;
+            task.y0 = coord_t(cy * i / threads);
+            task.y1 = coord_t(cy * (i + 1) / threads);
+            if (i > 0)
+                seams.push_back(task.y0);
+            workers.push_back(std::thread(task));
+        }
+        for (size_t i = 0; i < workers.size(); ++i) {
+            workers[i].join();
+        }
+    } else
+#endif
+    {
+        label_stripe(comps, parents, source, conn, 0, cy);
+    }
+
+    // merge at the seams
+    for (size_t i = 0; i < seams.size(); ++i) {
+        const uint32_t* labels = &comps.labels[seams[i] * cx];
+        const uint32_t* above = labels - cx;
+        for (coord_t x = 0; x < cx; ++x) {
+            if (!labels[x])
+                continue;
+            if (above[x])
+                unite_labels(parents, labels[x], above[x]);
+            if (conn == CONNECT_8) {
+                if (x > 0 && above[x - 1])
+                    unite_labels(parents, labels[x], above[x - 1]);
+                if (x + 1 < cx && above[x + 1])
+                    unite_labels(parents, labels[x], above[x + 1]);
+            }
+        }
+    }
+
+    // the second pass: the final labels, the boxes and the areas
+    std::vector<uint32_t> finals(parents.size(), 0);
+    for (coord_t y = 0; y < cy; ++y) {
+        uint32_t* labels = &comps.labels[y * cx];
+        for (coord_t x = 0; x < cx; ++x) {
+            if (!labels[x])
+                continue;
+            uint32_t& id = finals[find_label(parents, labels[x])];
+            if (!id) {
+                comps.boxes.push_back(Rect(x, y, x, y));
+                comps.areas.push_back(0);
+                id = uint32_t(comps.areas.size());
+            }
+            labels[x] = id;
+            Rect& box = comps.boxes[id - 1];
+            box.x0 = std::min(box.x0, x);
+            box.x1 = std::max(box.x1, x);
+            box.y1 = y;
+            ++comps.areas[id - 1];
+        }
+    }
+}
+
+// the cells of the color ch on tc
+inline void
+label_components(ComponentLabels& comps,
+                 const TextCanvas& tc,
+                 color_t ch,
+                 Connectivity conn = CONNECT_4,
+                 unsigned threads = 1)
+{
+    label_components(comps, CanvasRowSource(tc, ch), conn, threads);
+}
+
+// the set bits of image
+inline void
+label_components(ComponentLabels& comps,
+                 const XbmImage& image,
+                 Connectivity conn = CONNECT_4,
+                 unsigned threads = 1)
+{
+    label_components(comps, XbmRowSource(image), conn, threads);
+}
+
+#if __cplusplus >= 201402L && !defined(TEXTCANVAS_NO_KHDOTFONT)
+///////////////////////////////////////////////////////////////////////////
+// StaticBanner --- a string literal rasterized at compile time (C++14)
+//
+//     constexpr auto banner = make_static_banner("READY");
+//     banner.draw(tc, x0, y0); // only a blit at run time
+//
+// The glyphs come from kh_dot_hankaku_bits, the bits of
+// kh_dot_hankaku_font().
+
+template<size_t N>
+struct StaticBanner
+{
+    static_assert(N > 1, "StaticBanner needs a non-empty string literal");
+
+    // the glyphs are 8 pixels wide, so a glyph row is one byte and
+    // the stride is the length of the text
+    unsigned char bits[(N - 1) * 16];
+
+    constexpr StaticBanner(const char (&text)[N])
+      : bits()
+    {
+        for (size_t i = 0; i + 1 < N; ++i) {
+            const size_t ch = static_cast<unsigned char>(text[i]);
+            for (size_t y = 0; y < 16; ++y) {
+                size_t index =
+                  ((ch / 16) * 16 + y) * (kh_dot_hankaku_width / 8) + ch % 16;
+                bits[y * (N - 1) + i] = kh_dot_hankaku_bits[index];
+            }
+        }
+    }
+
+    constexpr coord_t width() const { return coord_t(N - 1) * 8; }
+    constexpr coord_t height() const { return 16; }
+
+    Size draw(TextCanvas& tc, coord_t x0, coord_t y0) const
+    {
+        return tc.put_image(x0, y0, XbmImage(width(), height(), bits));
+    }
+};
+
+template<size_t N>
+constexpr StaticBanner<N>
+make_static_banner(const char (&text)[N])
+{
+    return StaticBanner<N>(text);
+}
+#endif // C++14
+
+///////////////////////////////////////////////////////////////////////////
+
+inline double
+normalize_radian(double radian)
+{
+    radian = fmod(radian, 2 * pi);
+    if (radian < -pi)
+        radian += 2 * pi;
+    else if (radian > pi)
+        radian -= 2 * pi;
+    return radian;
+}
+
+inline bool
+check_range(double at, bool clockwise, double a0, double a1)
+{
+    if (clockwise) {
+        if ((-pi <= at && at <= a0 + epsilon) ||
+            (a1 - epsilon <= at && at <= pi)) {
+            return true;
+        }
+    } else {
+        if (a0 - epsilon <= at && at <= a1 + epsilon) {
+            return true;
+        }
+    }
+    return false;
+}
+
+inline bool
+get_polygon_box(Point& p0, Point& p1, size_t num_points, const Point* points)
+{
+    if (num_points == 0)
+        return false;
+
+    p0 = p1 = points[0];
+    for (size_t i = 1; i < num_points; ++i) {
+        coord_t x = points[i].x;
+        if (x < p0.x)
+            p0.x = x;
+        if (x > p1.x)
+            p1.x = x;
+        coord_t y = points[i].y;
+        if (y < p0.y)
+            p0.y = y;
+        if (y > p1.y)
+            p1.y = y;
+    }
+    return true;
+}
+
+inline size_t
+crossing_number(const Point& p, const Points& points)
+{
+    size_t ret = 0;
+    for (size_t i = 0; i < points.size() - 1; ++i) {
+        if ((points[i].y <= p.y && points[i + 1].y > p.y) ||
+            (points[i].y > p.y && points[i + 1].y <= p.y)) {
+            double f =
+              double(p.y - points[i].y) / (points[i + 1].y - points[i].y);
+            if (p.x - points[i].x < f * (points[i + 1].x - points[i].x)) {
+                ++ret;
+            }
+        }
+    }
+    return ret;
+}
+inline coord_t
+winding_number(const Point& p, const Points& points)
+{
+    coord_t ret = 0;
+    for (size_t i = 0; i < points.size() - 1; ++i) {
+        if (points[i].y <= p.y && points[i + 1].y > p.y) {
+            double f =
+              double(p.y - points[i].y) / (points[i + 1].y - points[i].y);
+            if (p.x - points[i].x < f * (points[i + 1].x - points[i].x))
+                ++ret;
+        } else if (points[i].y > p.y && points[i + 1].y <= p.y) {
+            double f =
+              double(p.y - points[i].y) / (points[i + 1].y - points[i].y);
+            if (p.x - points[i].x < f * (points[i + 1].x - points[i].x))
+                --ret;
+        }
+    }
+    return ret;
+}
+
+// widths[j] is the half width of the quarter ellipse of radii (rx, ry)
+// at the row j from its center row (0 <= j <= ry)
+inline void
+quarter_ellipse_widths(std::vector<coord_t>& widths, coord_t rx, coord_t ry)
+{
+    widths.resize(ry + 1);
+    const int64_t a = int64_t(rx) * rx, b = int64_t(ry) * ry;
+    const int64_t limit = a * b + int64_t(rx) * ry * (rx + ry) / 2;
+    coord_t w = rx;
+    for (coord_t j = 0; j <= ry; ++j) {
+        while (w > 0 && w * w * b + j * j * a > limit)
+            --w;
+        widths[j] = w;
+    }
+}
+
+// the ends of the spans of ellipse_spans
+template<typename T_PUTTER>
+struct EllipseEdges
+{
+    T_PUTTER& putter;
+    EllipseEdges(T_PUTTER& putter_)
+      : putter(putter_)
+    {}
+    void operator()(coord_t left, coord_t right, coord_t y)
+    {
+        putter(right, y);
+        putter(left, y);
+    }
+    void point(coord_t x, coord_t y) { putter(x, y); }
+};
+
+// the union of the spans of each row in (x0, y0)-(x1, y1)
+struct RowExtents
+{
+    coord_t y0;
+    std::vector<coord_t> lefts, rights;
+    RowExtents(coord_t x0, coord_t y0_, coord_t x1, coord_t y1)
+      : y0(y0_)
+      , lefts(y1 - y0_ + 1, x1 + 1)
+      , rights(y1 - y0_ + 1, x0 - 1)
+    {}
+    void operator()(coord_t left, coord_t right, coord_t y)
+    {
+        size_t i = size_t(y - y0);
+        assert(i < lefts.size());
+        lefts[i] = std::min(lefts[i], left);
+        rights[i] = std::max(rights[i], right);
+    }
+    void point(coord_t x, coord_t y) { (*this)(x, x, y); }
+};
+
+// the midpoint ellipse in the box (x0, y0)-(x0 + dx, y0 + dy) with
+// dx > 1 and dy > 1, in integers scaled by 8. span(left, right, y) is
+// called for each pair of symmetric points, span.point(x, y) for a
+// point on the vertical axis.
+template<typename T_SPAN>
+inline void
+ellipse_spans(coord_t x0, coord_t y0, coord_t dx, coord_t dy, T_SPAN& span)
+{
+    const int64_t U = dx, V = dy;
+    const int64_t a4 = 4 * V * V, b8 = 8 * U * U;
+    int64_t F = -2 * U * V * V + 2 * V * V + 4 * U * U;
+    int64_t H = -4 * U * V * V + 4 * V * V + 2 * U * U;
+    coord_t X = dx, y = 0; // X is twice the x offset
+
+    // the center row (or the upper one of the two)
+    const coord_t cy = y0 + dy / 2;
+    coord_t top = 0, bottom = 0;
+    if (dy & 1) {
+        top = cy;
+        bottom = cy + 1;
+    } else if (dx < 3) {
+        span(x0, x0 + dx, cy);
+        top = cy - 1;
+        bottom = cy + 1;
+    } else {
+        top = bottom = cy;
+    }
+
+    while (X >= 0) {
+        coord_t left = x0 + (dx - X) / 2, right = x0 + (dx + X) / 2;
+        span(left, right, bottom + y);
+        span(left, right, top - y);
+        if (F >= 0) {
+            X -= 2;
+            F -= a4 * X;
+            H -= a4 * X - a4;
+        }
+        if (H < 0) {
+            y += 1;
+            F += b8 * y + 4 * U * U;
+            H += b8 * y;
+        }
+    }
+
+    // the poles
+    const coord_t cx = x0 + (dx + 1) / 2;
+    for (y += 1; y <= dy / 2; ++y) {
+        if (dy & 1) {
+            if (!(dx & 1)) {
+                span.point(cx, cy - y);
+                span.point(cx, cy + y + 1);
+            }
+        } else if (dx & 1) {
+            span(cx - 1, cx, cy - y);
+            span(cx - 1, cx, cy + y);
+        } else {
+            span.point(cx, cy - y);
+            span.point(cx, cy + y);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+// SpanBuffer
+
+inline
+SpanBuffer::SpanBuffer(const Rect& clip)
+  : m_clip(clip)
+  , m_rows(clip.empty() ? 0 : clip.height())
+  , m_count(0)
+{}
+
+inline void
+SpanBuffer::add(coord_t left, coord_t right, coord_t y)
+{
+    if (y < m_clip.y0 || m_clip.y1 < y)
+        return;
+    left = std::max(left, m_clip.x0);
+    right = std::min(right, m_clip.x1);
+    if (left > right)
+        return;
+    m_rows[y - m_clip.y0].push_back(Span(left, right));
+    ++m_count;
+}
+
+// the first cell whose center is at v or after
+inline coord_t
+span_ceil(double v)
+{
+    return coord_t(std::ceil(v - epsilon));
+}
+
+inline void
+SpanBuffer::add_convex(size_t num_points, const double* xs, const double* ys)
+{
+    if (num_points < 3)
+        return;
+
+    double ymin = ys[0], ymax = ys[0];
+    for (size_t i = 1; i < num_points; ++i) {
+        ymin = std::min(ymin, ys[i]);
+        ymax = std::max(ymax, ys[i]);
+    }
+
+    const coord_t top = std::max(span_ceil(ymin), m_clip.y0);
+    const coord_t bottom = std::min(span_ceil(ymax) - 1, m_clip.y1);
+    for (coord_t y = top; y <= bottom; ++y) {
+        // the crossings of a convex polygon are within [xmin, xmax]
+        double xmin = 0, xmax = 0;
+        bool found = false;
+        for (size_t i = 0; i < num_points; ++i) {
+            const size_t j = (i + 1) % num_points;
+            const double y0 = ys[i], y1 = ys[j];
+            if (y < std::min(y0, y1) || std::max(y0, y1) < y)
+                continue;
+            double x0 = xs[i], x1 = xs[j];
+            if (y0 != y1) {
+                x0 += (xs[j] - xs[i]) * (y - y0) / (y1 - y0);
+                x1 = x0;
+            }
+            if (!found) {
+                xmin = std::min(x0, x1);
+                xmax = std::max(x0, x1);
+                found = true;
+            } else {
+                xmin = std::min(xmin, std::min(x0, x1));
+                xmax = std::max(xmax, std::max(x0, x1));
+            }
+        }
+        if (found)
+            add(span_ceil(xmin), span_ceil(xmax) - 1, y);
+    }
+}
+
+inline void
+SpanBuffer::add_ellipse(double cx, double cy, double rx, double ry)
+{
+    add_ring(cx, cy, rx, ry, 0, 0);
+}
+
+inline void
+SpanBuffer::add_ring(double cx,
+                     double cy,
+                     double outer_rx,
+                     double outer_ry,
+                     double inner_rx,
+                     double inner_ry)
+{
+    if (outer_rx <= 0 || outer_ry <= 0)
+        return;
+
+    const coord_t top = std::max(span_ceil(cy - outer_ry), m_clip.y0);
+    const coord_t bottom = std::min(span_ceil(cy + outer_ry) - 1, m_clip.y1);
+    for (coord_t y = top; y <= bottom; ++y) {
+        const double t = y - cy;
+        const double k = 1 - (t * t) / (outer_ry * outer_ry);
+        if (k < 0)
+            continue;
+        const double ox = outer_rx * std::sqrt(k);
+        const coord_t left = span_ceil(cx - ox), right = span_ceil(cx + ox) - 1;
+
+        double ik = -1;
+        if (inner_rx > 0 && inner_ry > 0)
+            ik = 1 - (t * t) / (inner_ry * inner_ry);
+        if (ik <= 0) {
+            add(left, right, y);
+            continue;
+        }
+
+        // the hole is excluded by the same rule
+        const double ix = inner_rx * std::sqrt(ik);
+        add(left, span_ceil(cx - ix) - 1, y);
+        add(span_ceil(cx + ix), right, y);
+    }
+}
+
+template<typename T_PUTTER>
+inline void
+SpanBuffer::flush(T_PUTTER& putter)
+{
+    for (size_t i = 0; i < m_rows.size(); ++i) {
+        std::vector<Span>& row = m_rows[i];
+        if (row.empty())
+            continue;
+
+        const coord_t y = m_clip.y0 + coord_t(i);
+        std::sort(row.begin(), row.end());
+        coord_t left = row[0].first, right = row[0].second;
+        for (size_t k = 1; k <= row.size(); ++k) {
+            if (k < row.size() && row[k].first <= right + 1) {
+                right = std::max(right, row[k].second);
+                continue;
+            }
+            put_span(putter, y, left, right);
+            if (k < row.size()) {
+                left = row[k].first;
+                right = row[k].second;
+            }
+        }
+        row.clear();
+    }
+    m_count = 0;
+}
+
+inline void
+SpanBuffer::clear()
+{
+    for (size_t i = 0; i < m_rows.size(); ++i) {
+        m_rows[i].clear();
+    }
+    m_count = 0;
+}
+
+// the body of the segment p0-p1 of half width h
+inline void
+stroke_segment(SpanBuffer& spans, const Point& p0, const Point& p1, double h)
+{
+    const double dx = p1.x - p0.x, dy = p1.y - p0.y;
+    const double len = std::sqrt(dx * dx + dy * dy);
+    if (len == 0)
+        return;
+
+    const double nx = -dy / len * h, ny = dx / len * h;
+    const double xs[] = { p0.x + nx, p1.x + nx, p1.x - nx, p0.x - nx };
+    const double ys[] = { p0.y + ny, p1.y + ny, p1.y - ny, p0.y - ny };
+    spans.add_convex(4, xs, ys);
+}
+
+// the join at p1 of the segments p0-p1 and p1-p2
+inline void
+stroke_join(SpanBuffer& spans,
+            const Point& p0,
+            const Point& p1,
+            const Point& p2,
+            double h,
+            const StrokeStyle& style)
+{
+    if (style.join == JOIN_ROUND) {
+        spans.add_ellipse(p1.x, p1.y, h, h);
+        return;
+    }
+
+    double dx0 = p1.x - p0.x, dy0 = p1.y - p0.y;
+    double dx1 = p2.x - p1.x, dy1 = p2.y - p1.y;
+    const double len0 = std::sqrt(dx0 * dx0 + dy0 * dy0);
+    const double len1 = std::sqrt(dx1 * dx1 + dy1 * dy1);
+    if (len0 == 0 || len1 == 0)
+        return;
+    dx0 /= len0;
+    dy0 /= len0;
+    dx1 /= len1;
+    dy1 /= len1;
+
+    // the outer side is opposite to the turn
+    const double cross = dx0 * dy1 - dy0 * dx1;
+    const double dot = dx0 * dx1 + dy0 * dy1;
+    if (std::fabs(cross) < epsilon && dot > 0)
+        return;
+    const double side = (cross > 0) ? -h : h;
+    const double nx0 = -dy0 * side, ny0 = dx0 * side;
+    const double nx1 = -dy1 * side, ny1 = dx1 * side;
+
+    // the miter is 1 / cos(turn / 2) widths long
+    if (style.join == JOIN_MITER && 1 + dot > epsilon &&
+        2 / (1 + dot) <= style.miter_limit * style.miter_limit) {
+        const double xs[] = { double(p1.x),
+                              p1.x + nx0,
+                              p1.x + (nx0 + nx1) / (1 + dot),
+                              p1.x + nx1 };
+        const double ys[] = { double(p1.y),
+                              p1.y + ny0,
+                              p1.y + (ny0 + ny1) / (1 + dot),
+                              p1.y + ny1 };
+        spans.add_convex(4, xs, ys);
+        return;
+    }
+
+    const double xs[] = { double(p1.x), p1.x + nx0, p1.x + nx1 };
+    const double ys[] = { double(p1.y), p1.y + ny0, p1.y + ny1 };
+    spans.add_convex(3, xs, ys);
+}
+
+// the cap at p1 of the segment p0-p1
+inline void
+stroke_cap(SpanBuffer& spans,
+           const Point& p0,
+           const Point& p1,
+           double h,
+           const StrokeStyle& style)
+{
+    if (style.cap == CAP_ROUND) {
+        spans.add_ellipse(p1.x, p1.y, h, h);
+        return;
+    }
+    if (style.cap != CAP_SQUARE)
+        return;
+
+    const double dx = p1.x - p0.x, dy = p1.y - p0.y;
+    const double len = std::sqrt(dx * dx + dy * dy);
+    if (len == 0) {
+        // a lone point has the square of the width
+        const double xs[] = { p1.x - h, p1.x + h, p1.x + h, p1.x - h };
+        const double ys[] = { p1.y - h, p1.y - h, p1.y + h, p1.y + h };
+        spans.add_convex(4, xs, ys);
+        return;
+    }
+
+    const double ex = dx / len * h, ey = dy / len * h;
+    const double xs[] = { p1.x - ey, p1.x - ey + ex, p1.x + ey + ex, p1.x + ey };
+    const double ys[] = { p1.y + ex, p1.y + ex + ey, p1.y - ex + ey, p1.y - ex };
+    spans.add_convex(4, xs, ys);
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+bool
+XbmImage::in_range(coord_t x, coord_t y) const
+{
+    return 0 <= x && x < width() && 0 <= y && y < height();
+}
+
+inline bool
+XbmImage::get_dot(coord_t x, coord_t y) const
+{
+    if (!in_range(x, y))
+        return false;
+
+    value_type byte = data()[stride() * y + x / 8];
+    return (byte & (1 << (x & 7))) != 0;
+}
+inline void
+XbmImage::put_dot(coord_t x, coord_t y, bool dot)
+{
+    if (!in_range(x, y))
+        return;
+
+    value_type byte = data()[stride() * y + x / 8];
+    coord_t shift = x & 7;
+    if (dot)
+        byte |= (1 << shift);
+    else
+        byte &= ~(1 << shift);
+    data()[stride() * y + x / 8] = byte;
+}
+
+inline XbmImage&
+XbmImage::operator=(const XbmImage& image)
+{
+    if (this != &image) {
+        reset(image.width(), image.height(), NULL, image.m_alloc);
+    }
+    return *this;
+}
+
+inline void
+XbmImage::reset(coord_t width, coord_t height, const void* data, void* alloc)
+{
+    assert(width);
+    assert(height);
+    assert(sizeof(value_type) == 1);
+
+    clear();
+
+    m_width = width;
+    m_height = height;
+    m_stride = (width + 7) / 8;
+    coord_t total_size = m_stride * m_height;
+    if (total_size == 0) {
+        m_data = m_alloc = NULL;
+    } else if (!data && !alloc) {
+        m_data = m_alloc = new value_type[total_size];
+        memset(m_data, 0, total_size);
+    } else if (!data && alloc) {
+        m_data = m_alloc = new value_type[total_size];
+        memcpy(m_data, alloc, total_size);
+    } else if (data && !alloc) {
+        m_data = cast(data);
+        m_alloc = NULL;
+    } else if (data && alloc) {
+        m_data = cast(data);
+        m_alloc = cast(alloc);
+    }
+}
+
+inline std::string
+XbmImage::to_str(const char* name) const
+{
+    std::string str;
+    char buf[32];
+
+    str += "#define ";
+    str += name;
+    str += "_width ";
+    sprintf(buf, "%u", (int)width());
+    str += buf;
+    str += "\n";
+
+    str += "#define ";
+    str += name;
+    str += "_height ";
+    sprintf(buf, "%u", (int)height());
+    str += buf;
+    str += "\n";
+
+    str += "static const unsigned char ";
+    str += name;
+    str += "_bits[] = {\n";
+
+    size_t i, k = 0;
+    for (i = 0; i < stride() * height() - 1; ++i) {
+        if (k == 0)
+            str += "   ";
+        sprintf(buf, "0x%02x, ", data()[i]);
+        str += buf;
+        ++k;
+        if (k == 12) {
+            k = 0;
+            str += "\n";
+        }
+    }
+    if (k == 0)
+        str += "  ";
+    sprintf(buf, "0x%02x };\n", data()[i]);
+    str += buf;
+    return str;
+}
+
+inline void
+XbmImage::get_subimage(TextCanvas& image,
+                       coord_t x0,
+                       coord_t y0,
+                       coord_t x1,
+                       coord_t y1) const
+{
+    if (x0 > x1)
+        std::swap(x0, x1);
+    if (y0 > y1)
+        std::swap(y0, y1);
+
+    coord_t width = x1 - x0 + 1;
+    coord_t height = y1 - y0 + 1;
+    if (width != image.width() || height != image.height()) {
+        image.reset(width, height);
+    }
+
+    coord_t py = 0;
+    for (coord_t y = y0; y <= y1; ++y) {
+        coord_t px = 0;
+        for (coord_t x = x0; x <= x1; ++x) {
+            image.put_dot(px, py, get_dot(x, y));
+            ++px;
+        }
+        ++py;
+    }
+}
+inline void
+XbmImage::get_subimage(XbmImage& image,
+                       coord_t x0,
+                       coord_t y0,
+                       coord_t x1,
+                       coord_t y1) const
+{
+    if (x0 > x1)
+        std::swap(x0, x1);
+    if (y0 > y1)
+        std::swap(y0, y1);
+
+    coord_t width = x1 - x0 + 1;
+    coord_t height = y1 - y0 + 1;
+    if (width != image.width() || height != image.height()) {
+        image.reset(width, height);
+    }
+
+    coord_t py = 0;
+    for (coord_t y = y0; y <= y1; ++y) {
+        coord_t px = 0;
+        for (coord_t x = x0; x <= x1; ++x) {
+            image.put_dot(px, py, get_dot(x, y));
+            ++px;
+        }
+        ++py;
+    }
+}
+inline void
+XbmImage::put_subimage(coord_t x0, coord_t y0, const TextCanvas& image)
+{
+    for (coord_t y = 0; y < image.height(); ++y) {
+        for (coord_t x = 0; x < image.width(); ++x) {
+            put_dot(x0 + x, y0 + y, image.get_dot(x, y));
+        }
+    }
+}
+inline void
+XbmImage::put_subimage(coord_t x0, coord_t y0, const XbmImage& image)
+{
+    for (coord_t y = 0; y < image.height(); ++y) {
+        for (coord_t x = 0; x < image.width(); ++x) {
+            put_dot(x0 + x, y0 + y, image.get_dot(x, y));
+        }
+    }
+}
+
+// the byte i of a row moved rightward by dx pixels
+inline XbmImage::value_type
+xbm_shifted_byte(const XbmImage::value_type* row,
+                 coord_t stride,
+                 coord_t i,
+                 coord_t dx)
+{
+    const coord_t k = i - (dx >> 3), r = (dx & 7);
+    XbmImage::value_type lo = (0 <= k && k < stride) ? row[k] : 0;
+    if (r == 0)
+        return lo;
+    XbmImage::value_type hi = (0 < k && k <= stride) ? row[k - 1] : 0;
+    return XbmImage::value_type((lo << r) | (hi >> (8 - r)));
+}
+
+inline void
+XbmImage::or_subimage(coord_t x0, coord_t y0, const XbmImage& image)
+{
+    assert(x0 >= 0);
+    const coord_t py0 = std::max(coord_t(0), -y0);
+    const coord_t py1 = std::min(image.height(), height() - y0);
+    for (coord_t py = py0; py < py1; ++py) {
+        const value_type* src = &image.data()[py * image.stride()];
+        value_type* dest = &m_data[(y0 + py) * stride()];
+        for (coord_t i = 0; i < stride(); ++i) {
+            dest[i] |= xbm_shifted_byte(src, image.stride(), i, x0);
+        }
+    }
+}
+inline void
+XbmImage::and_not_subimage(coord_t x0, coord_t y0, const XbmImage& image)
+{
+    assert(x0 >= 0);
+    const coord_t py0 = std::max(coord_t(0), -y0);
+    const coord_t py1 = std::min(image.height(), height() - y0);
+    for (coord_t py = py0; py < py1; ++py) {
+        const value_type* src = &image.data()[py * image.stride()];
+        value_type* dest = &m_data[(y0 + py) * stride()];
+        for (coord_t i = 0; i < stride(); ++i) {
+            dest[i] &= value_type(~xbm_shifted_byte(src, image.stride(), i, x0));
+        }
+    }
+}
+
+// the rows of an XbmImage in n words of 64 pixels each, and back
+inline size_t
+xbm_word_count(coord_t width)
+{
+    return size_t(width + 63) / 64;
+}
+inline void
+xbm_get_words(const XbmImage& image, std::vector<uint64_t>& words, size_t n)
+{
+    words.assign(n * image.height(), 0);
+    for (coord_t py = 0; py < image.height(); ++py) {
+        const XbmImage::value_type* src = &image.data()[py * image.stride()];
+        uint64_t* row = &words[py * n];
+        for (coord_t i = 0; i < image.stride(); ++i) {
+            row[i >> 3] |= uint64_t(src[i]) << ((i & 7) * 8);
+        }
+    }
+}
+inline void
+xbm_set_words(XbmImage& image, const std::vector<uint64_t>& words, size_t n)
+{
+    for (coord_t py = 0; py < image.height(); ++py) {
+        XbmImage::value_type* dest = &image.data()[py * image.stride()];
+        const uint64_t* row = &words[py * n];
+        for (coord_t i = 0; i < image.stride(); ++i) {
+            dest[i] = XbmImage::value_type(row[i >> 3] >> ((i & 7) * 8));
+        }
+    }
+}
+// set the bits of a row at and after width to fill
+inline void
+xbm_pad_words(uint64_t* row, size_t n, coord_t width, bool fill)
+{
+    for (size_t i = size_t(width) / 64; i < n; ++i) {
+        const coord_t b = width - coord_t(i) * 64;
+        const uint64_t pad = (b <= 0) ? ~uint64_t(0) : ~((uint64_t(1) << b) - 1);
+        row[i] = fill ? (row[i] | pad) : (row[i] & ~pad);
+    }
+}
+
+// dest[x] = src[x + k] for the pixels of a row, with fill beyond src
+inline void
+xbm_shift_words(uint64_t* dest,
+                size_t dest_n,
+                const uint64_t* src,
+                size_t src_n,
+                coord_t k,
+                bool fill)
+{
+    const coord_t q = (k >= 0) ? k / 64 : -((-k + 63) / 64);
+    const int r = int(k - q * 64);
+    const uint64_t fill_word = fill ? ~uint64_t(0) : 0;
+    for (size_t i = 0; i < dest_n; ++i) {
+        const coord_t j = coord_t(i) + q;
+        uint64_t lo = (0 <= j && j < coord_t(src_n)) ? src[j] : fill_word;
+        if (r == 0) {
+            dest[i] = lo;
+            continue;
+        }
+        uint64_t hi = (0 <= j + 1 && j + 1 < coord_t(src_n)) ? src[j + 1]
+                                                             : fill_word;
+        dest[i] = (lo >> r) | (hi << (64 - r));
+    }
+}
+
+// the OR (dilation) or the AND (erosion) of the pixels within r of
+// each pixel in the rows, by doubling the window
+inline void
+xbm_morph_rows(std::vector<uint64_t>& words,
+               size_t n,
+               coord_t width,
+               coord_t height,
+               coord_t r,
+               bool erode)
+{
+    if (r <= 0)
+        return;
+
+    const coord_t len = 2 * r + 1;
+    const size_t m = xbm_word_count(width + 2 * r);
+    std::vector<uint64_t> f(m), t(m);
+    for (coord_t py = 0; py < height; ++py) {
+        uint64_t* row = &words[py * n];
+        xbm_pad_words(row, n, width, erode);
+
+        // f[x] is row[x - r], then the window of len from x
+        xbm_shift_words(&f[0], m, row, n, -r, erode);
+        coord_t w = 1;
+        for (; 2 * w <= len; w *= 2) {
+            xbm_shift_words(&t[0], m, &f[0], m, w, erode);
+            for (size_t i = 0; i < m; ++i) {
+                f[i] = erode ? (f[i] & t[i]) : (f[i] | t[i]);
+            }
+        }
+        if (w < len) {
+            xbm_shift_words(&t[0], m, &f[0], m, len - w, erode);
+            for (size_t i = 0; i < m; ++i) {
+                f[i] = erode ? (f[i] & t[i]) : (f[i] | t[i]);
+            }
+        }
+
+        std::copy(f.begin(), f.begin() + n, row);
+        xbm_pad_words(row, n, width, false);
+    }
+}
+
+// f[j] = f[j] OP f[j + k] for the rows of n words
+inline void
+xbm_combine_rows(std::vector<uint64_t>& f,
+                 size_t n,
+                 coord_t rows,
+                 coord_t k,
+                 bool erode)
+{
+    const uint64_t fill_word = erode ? ~uint64_t(0) : 0;
+    for (coord_t j = 0; j < rows; ++j) {
+        uint64_t* row = &f[j * n];
+        const uint64_t* other = (j + k < rows) ? &f[(j + k) * n] : NULL;
+        for (size_t i = 0; i < n; ++i) {
+            const uint64_t v = other ? other[i] : fill_word;
+            row[i] = erode ? (row[i] & v) : (row[i] | v);
+        }
+    }
+}
+
+// the same in the columns, over whole rows of words
+inline void
+xbm_morph_columns(std::vector<uint64_t>& words,
+                  size_t n,
+                  coord_t height,
+                  coord_t r,
+                  bool erode)
+{
+    if (r <= 0)
+        return;
+
+    // f[j] is the row j - r, then the window of len from j
+    const coord_t len = 2 * r + 1, rows = height + 2 * r;
+    const uint64_t fill_word = erode ? ~uint64_t(0) : 0;
+    std::vector<uint64_t> f(n * rows, fill_word);
+    std::copy(words.begin(), words.end(), f.begin() + r * n);
+    coord_t w = 1;
+    for (; 2 * w <= len; w *= 2) {
+        xbm_combine_rows(f, n, rows, w, erode);
+    }
+    if (w < len)
+        xbm_combine_rows(f, n, rows, len - w, erode);
+
+    std::copy(f.begin(), f.begin() + n * height, words.begin());
+}
+
+inline void
+xbm_morph(XbmImage& image, const MorphElement& elem, bool erode)
+{
+    const size_t n = xbm_word_count(image.width());
+    std::vector<uint64_t> words;
+    xbm_get_words(image, words, n);
+    if (elem.shape == MORPH_CROSS) {
+        std::vector<uint64_t> columns(words);
+        xbm_morph_rows(words, n, image.width(), image.height(), elem.rx, erode);
+        xbm_morph_columns(columns, n, image.height(), elem.ry, erode);
+        for (size_t i = 0; i < words.size(); ++i) {
+            words[i] = erode ? (words[i] & columns[i]) : (words[i] | columns[i]);
+        }
+    } else {
+        xbm_morph_rows(words, n, image.width(), image.height(), elem.rx, erode);
+        xbm_morph_columns(words, n, image.height(), elem.ry, erode);
+    }
+    for (coord_t py = 0; py < image.height(); ++py) {
+        xbm_pad_words(&words[py * n], n, image.width(), false);
+    }
+    xbm_set_words(image, words, n);
+}
+
+inline void
+XbmImage::dilate(const MorphElement& elem)
+{
+    xbm_morph(*this, elem, false);
+}
+inline void
+XbmImage::erode(const MorphElement& elem)
+{
+    xbm_morph(*this, elem, true);
+}
+inline void
+XbmImage::open(const MorphElement& elem)
+{
+    erode(elem);
+    dilate(elem);
+}
+inline void
+XbmImage::close(const MorphElement& elem)
+{
+    dilate(elem);
+    erode(elem);
+}
+
+// occluded fills of 64 pixels: the pixels of mask reached from fill,
+// toward the higher bits (rightward) or the lower bits (leftward)
+inline uint64_t
+xbm_fill_right(uint64_t fill, uint64_t mask)
+{
+    fill |= mask & (fill << 1);
+    mask &= mask << 1;
+    fill |= mask & (fill << 2);
+    mask &= mask << 2;
+    fill |= mask & (fill << 4);
+    mask &= mask << 4;
+    fill |= mask & (fill << 8);
+    mask &= mask << 8;
+    fill |= mask & (fill << 16);
+    mask &= mask << 16;
+    fill |= mask & (fill << 32);
+    return fill;
+}
+inline uint64_t
+xbm_fill_left(uint64_t fill, uint64_t mask)
+{
+    fill |= mask & (fill >> 1);
+    mask &= mask >> 1;
+    fill |= mask & (fill >> 2);
+    mask &= mask >> 2;
+    fill |= mask & (fill >> 4);
+    mask &= mask >> 4;
+    fill |= mask & (fill >> 8);
+    mask &= mask >> 8;
+    fill |= mask & (fill >> 16);
+    mask &= mask >> 16;
+    fill |= mask & (fill >> 32);
+    return fill;
+}
+
+// spread fill over the runs of mask in a row of n words.
+// returns true if fill has changed.
+inline bool
+xbm_fill_row(uint64_t* fill, const uint64_t* mask, size_t n)
+{
+    bool changed = false;
+    uint64_t carry = 0;
+    for (size_t i = 0; i < n; ++i) {
+        uint64_t f = xbm_fill_right(fill[i] | (carry & mask[i]), mask[i]);
+        carry = f >> 63;
+        changed |= (f != fill[i]);
+        fill[i] = f;
+    }
+    carry = 0;
+    for (size_t i = n; i-- > 0;) {
+        uint64_t f = xbm_fill_left(fill[i] | ((carry << 63) & mask[i]), mask[i]);
+        carry = f & 1;
+        changed |= (f != fill[i]);
+        fill[i] = f;
+    }
+    return changed;
+}
+
+inline void
+XbmImage::flood_fill(coord_t x, coord_t y, bool dot)
+{
+    if (!in_range(x, y) || get_dot(x, y) == dot)
+        return;
+
+    // the pixels to fill and the filled ones, 64 pixels a word
+    const size_t n = xbm_word_count(width());
+    std::vector<uint64_t> mask, fill(n * height(), 0);
+    xbm_get_words(*this, mask, n);
+    for (coord_t py = 0; py < height(); ++py) {
+        uint64_t* words = &mask[py * n];
+        if (dot) {
+            for (size_t i = 0; i < n; ++i) {
+                words[i] = ~words[i];
+            }
+        }
+        xbm_pad_words(words, n, width(), false);
+    }
+
+    // downward and upward passes until nothing changes
+    fill[y * n + (x >> 6)] = uint64_t(1) << (x & 63);
+    xbm_fill_row(&fill[y * n], &mask[y * n], n);
+    for (bool changed = true; changed;) {
+        changed = false;
+        for (coord_t py = 1; py < height(); ++py) {
+            uint64_t* f = &fill[py * n];
+            const uint64_t* m = &mask[py * n];
+            const uint64_t* above = f - n;
+            bool grown = false;
+            for (size_t i = 0; i < n; ++i) {
+                uint64_t g = f[i] | (above[i] & m[i]);
+                grown |= (g != f[i]);
+                f[i] = g;
+            }
+            if (grown) {
+                xbm_fill_row(f, m, n);
+                changed = true;
+            }
+        }
+        for (coord_t py = height() - 1; py-- > 0;) {
+            uint64_t* f = &fill[py * n];
+            const uint64_t* m = &mask[py * n];
+            const uint64_t* below = f + n;
+            bool grown = false;
+            for (size_t i = 0; i < n; ++i) {
+                uint64_t g = f[i] | (below[i] & m[i]);
+                grown |= (g != f[i]);
+                f[i] = g;
+            }
+            if (grown) {
+                xbm_fill_row(f, m, n);
+                changed = true;
+            }
+        }
+    }
+
+    for (coord_t py = 0; py < height(); ++py) {
+        value_type* dest = &m_data[py * stride()];
+        const uint64_t* words = &fill[py * n];
+        for (coord_t i = 0; i < stride(); ++i) {
+            value_type bits = value_type(words[i >> 3] >> ((i & 7) * 8));
+            dest[i] = dot ? value_type(dest[i] | bits)
+                          : value_type(dest[i] & ~bits);
+        }
+    }
+}
+
+inline size_t
+XbmFont::jis_index(uint16_t jis_code) const
+{
+    const uint16_t* end = m_jis_codes + m_jis_count;
+    const uint16_t* it = std::lower_bound(m_jis_codes, end, jis_code);
+    if (it != end && *it == jis_code)
+        return size_t(it - m_jis_codes);
+    return m_jis_count;
+}
+inline bool
+XbmFont::has_jis_char(uint16_t jis_code) const
+{
+    if (!is_subset())
+        return japanese::is_jis_code(jis_code);
+    return jis_index(jis_code) < m_jis_count;
+}
+inline Point
+XbmFont::jis_cell(uint16_t jis_code) const
+{
+    if (!is_subset()) {
+        assert(japanese::is_jis_code(jis_code));
+        return Point(uint8_t(jis_code) - 0x21, uint8_t(jis_code >> 8) - 0x21);
+    }
+    size_t index = jis_index(jis_code);
+    if (index == m_jis_count) {
+        index = jis_index(japanese::jis_geta_mark);
+        if (index == m_jis_count)
+            index = 0;
+    }
+    return Point(coord_t(index % m_columns), coord_t(index / m_columns));
+}
+
+inline void
+TextRun::push_glyph(const XbmFont& font,
+                    coord_t iColumn,
+                    coord_t iRow,
+                    uint16_t code,
+                    bool zenkaku)
+{
+    assert(0 <= iColumn && iColumn < font.columns());
+    assert(0 <= iRow && iRow < font.rows());
+    Glyph glyph;
+    glyph.font = &font;
+    glyph.column = iColumn;
+    glyph.row = iRow;
+    glyph.advance = font.cell_width();
+    glyph.code = code;
+    glyph.zenkaku = zenkaku;
+    m_glyphs.push_back(glyph);
+    m_extent.x += glyph.advance;
+    if (m_extent.y < font.cell_height())
+        m_extent.y = font.cell_height();
+}
+inline void
+TextRun::push_cell(const XbmFont& font, coord_t iColumn, coord_t iRow)
+{
+    uint16_t code = uint16_t(iRow * font.columns() + iColumn);
+    push_glyph(font, iColumn, iRow, code, false);
+}
+inline void
+TextRun::push_char(const XbmFont& font, coord_t char_code)
+{
+    push_glyph(font,
+               char_code % font.columns(),
+               char_code / font.columns(),
+               uint16_t(char_code),
+               false);
+}
+inline void
+TextRun::push_jis_char(const XbmFont& font, coord_t jis_code)
+{
+    assert(japanese::is_jis_code(jis_code));
+    Point cell = font.jis_cell(uint16_t(jis_code));
+    push_glyph(font, cell.x, cell.y, uint16_t(jis_code), true);
+}
+inline void
+TextRun::push_ascii(const XbmFont& font, const char* str, size_t len)
+{
+    if (len == 0)
+        return;
+
+    Glyph glyph;
+    glyph.font = &font;
+    glyph.advance = font.cell_width();
+    glyph.zenkaku = false;
+    for (size_t i = 0; i < len; ++i) {
+        coord_t char_code = uint8_t(str[i]);
+        glyph.column = char_code % font.columns();
+        glyph.row = char_code / font.columns();
+        glyph.code = uint16_t(char_code);
+        m_glyphs.push_back(glyph);
+    }
+    m_extent.x += glyph.advance * coord_t(len);
+    if (m_extent.y < font.cell_height())
+        m_extent.y = font.cell_height();
+}
+inline void
+TextRun::assign(const XbmFont& font, const string_type& text)
+{
+    clear();
+    m_glyphs.reserve(text.size());
+    push_ascii(font, text.c_str(), text.size());
+}
+inline void
+TextRun::assign_sjis(const XbmFont& zenkaku_font,
+                     const XbmFont& hankaku_font,
+                     const string_type& text)
+{
+    clear();
+    m_glyphs.reserve(text.size());
+
+    const char* str = text.c_str();
+    const size_t len = text.size();
+    for (size_t i = 0; i < len;) {
+        // ASCII bytes are never lead bytes
+        size_t run = japanese::ascii_run_length(str + i, len - i);
+        push_ascii(hankaku_font, str + i, run);
+        i += run;
+        if (i >= len)
+            break;
+
+        if (i + 1 < len && japanese::is_sjis_lead(str[i]) &&
+            japanese::is_sjis_trail(str[i + 1])) {
+            push_jis_char(zenkaku_font, japanese::sjis2jis(str[i], str[i + 1]));
+            i += 2;
+        } else {
+            push_char(hankaku_font, uint8_t(str[i]));
+            ++i;
+        }
+    }
+}
+inline void
+TextRun::assign_utf8(const XbmFont& zenkaku_font,
+                     const XbmFont& hankaku_font,
+                     const string_type& text)
+{
+    clear();
+    m_glyphs.reserve(text.size());
+
+    const char* str = text.c_str();
+    const size_t len = text.size();
+    for (size_t i = 0; i < len;) {
+        size_t run = japanese::ascii_run_length(str + i, len - i);
+        push_ascii(hankaku_font, str + i, run);
+        i += run;
+        if (i >= len)
+            break;
+
+        size_t used;
+        uint32_t ucs = japanese::utf8_decode(str + i, len - i, used);
+        i += used;
+
+        uint8_t ch;
+        if (japanese::unicode2hankaku(ucs, ch)) {
+            push_char(hankaku_font, ch);
+        } else {
+            uint16_t jis_code = japanese::unicode2jis(ucs);
+            if (!jis_code)
+                jis_code = japanese::jis_geta_mark;
+            push_jis_char(zenkaku_font, jis_code);
+        }
+    }
+}
+
+inline bool
+TextLayout::is_space(size_t i) const
+{
+    const TextRun::Glyph& glyph = m_run[i];
+    if (glyph.zenkaku)
+        return glyph.code == 0x2121;
+    return glyph.code == ' ';
+}
+inline bool
+TextLayout::is_newline(size_t i) const
+{
+    const TextRun::Glyph& glyph = m_run[i];
+    return !glyph.zenkaku && glyph.code == '\n';
+}
+// can we break the line just before the glyph i?
+inline bool
+TextLayout::can_break(size_t i) const
+{
+    const TextRun::Glyph& prev = m_run[i - 1];
+    const TextRun::Glyph& next = m_run[i];
+
+    // kinsoku
+    if (next.zenkaku ? japanese::is_kinsoku_head(next.code)
+                     : japanese::is_hankaku_kinsoku_head(uint8_t(next.code)))
+        return false;
+    if (prev.zenkaku ? japanese::is_kinsoku_tail(prev.code)
+                     : japanese::is_hankaku_kinsoku_tail(uint8_t(prev.code)))
+        return false;
+
+    // after spaces, or around japanese characters
+    if (is_space(i - 1))
+        return true;
+    if (prev.zenkaku || japanese::is_hankaku_kana(uint8_t(prev.code)))
+        return true;
+    if (next.zenkaku || japanese::is_hankaku_kana(uint8_t(next.code)))
+        return true;
+    return false;
+}
+
+inline void
+TextLayout::layout(const TextRun& run,
+                   coord_t max_width,
+                   TextAlign align,
+                   coord_t line_gap)
+{
+    m_run = run;
+    m_lines.clear();
+    m_extent = Size(0, 0);
+
+    // prefix sums of the advances
+    const size_t count = m_run.size();
+    std::vector<coord_t> xs(count + 1, 0);
+    for (size_t i = 0; i < count; ++i) {
+        xs[i + 1] = xs[i] + m_run[i].advance;
+    }
+
+    size_t first = 0;
+    for (;;) {
+        // take glyphs while they fit; at least one per line
+        size_t i = first;
+        while (i < count && !is_newline(i)) {
+            if (max_width > 0 && i > first && xs[i + 1] - xs[first] > max_width)
+                break;
+            ++i;
+        }
+
+        size_t last = i, next = i;
+        bool forced = (i < count && is_newline(i));
+        if (forced) {
+            next = i + 1;
+        } else if (i < count) {
+            // overflow: go back to a break opportunity if any
+            for (size_t k = i; k > first; --k) {
+                if (can_break(k)) {
+                    last = next = k;
+                    break;
+                }
+            }
+            while (next < count && !m_run[next].zenkaku && is_space(next))
+                ++next;
+        }
+
+        Line line;
+        line.first = first;
+        line.last = last;
+        while (last > first && is_space(last - 1))
+            --last;
+        line.x = 0;
+        line.y = 0;
+        line.width = xs[last] - xs[first];
+        line.height = 0;
+        for (size_t k = first; k < line.last; ++k) {
+            if (line.height < m_run[k].font->cell_height())
+                line.height = m_run[k].font->cell_height();
+        }
+        if (first == line.last) // an empty line
+            line.height = m_run.extent().y;
+        m_lines.push_back(line);
+
+        if (next >= count && !forced)
+            break;
+        first = next;
+    }
+
+    // positions and alignment
+    coord_t y = 0;
+    for (size_t i = 0; i < m_lines.size(); ++i) {
+        if (m_extent.x < m_lines[i].width)
+            m_extent.x = m_lines[i].width;
+    }
+    const coord_t box_width = (max_width > 0) ? max_width : m_extent.x;
+    for (size_t i = 0; i < m_lines.size(); ++i) {
+        Line& line = m_lines[i];
+        switch (align) {
+        case ALIGN_LEFT:
+            line.x = 0;
+            break;
+        case ALIGN_CENTER:
+            line.x = (box_width - line.width) / 2;
+            break;
+        case ALIGN_RIGHT:
+            line.x = box_width - line.width;
+            break;
+        }
+        line.y = y;
+        y += line.height;
+        if (i + 1 < m_lines.size())
+            y += line_gap;
+    }
+    m_extent.y = y;
+}
+
+///////////////////////////////////////////////////////////////////////////
+// internal methods
+
+inline TextCanvas::TextCanvas()
+  : m_width(0)
+  , m_height(0)
+  , m_text()
+  , m_fore_color(sharp)
+  , m_back_color(space)
+  , m_pos(0, 0)
+  , m_own_vertical(NULL)
+  , m_shared_vertical(NULL)
+{}
+inline TextCanvas::TextCanvas(coord_t width,
+                              coord_t height,
+                              color_t fore_color,
+                              color_t back_color)
+  : m_width(width)
+  , m_height(height)
+  , m_text(width * height, back_color)
+  , m_fore_color(fore_color)
+  , m_back_color(back_color)
+  , m_pos(0, 0)
+  , m_own_vertical(NULL)
+  , m_shared_vertical(NULL)
+{}
+inline TextCanvas::TextCanvas(const TextCanvas& tc)
+  : m_width(tc.m_width)
+  , m_height(tc.m_height)
+  , m_text(tc.m_text)
+  , m_fore_color(tc.m_fore_color)
+  , m_back_color(tc.m_back_color)
+  , m_pos(tc.m_pos)
+  , m_clips(tc.m_clips)
+  , m_own_vertical(NULL)
+  , m_shared_vertical(tc.m_shared_vertical)
+{}
+inline TextCanvas&
+TextCanvas::operator=(const TextCanvas& tc)
+{
+    m_width = tc.m_width;
+    m_height = tc.m_height;
+    m_text = tc.m_text;
+    m_fore_color = tc.m_fore_color;
+    m_back_color = tc.m_back_color;
+    m_pos = tc.m_pos;
+    m_clips = tc.m_clips;
+    m_shared_vertical = tc.m_shared_vertical;
+    return *this;
+}
+inline TextCanvas::TextCanvas(const XbmImage& binary,
+                              color_t fore_color,
+                              color_t back_color)
+  : m_width(binary.width())
+  , m_height(binary.height())
+  , m_text(binary.width() * binary.height(), 0)
+  , m_fore_color(fore_color)
+  , m_back_color(back_color)
+  , m_pos(0, 0)
+  , m_own_vertical(NULL)
+  , m_shared_vertical(NULL)
+{
+    for (coord_t y = 0; y < height(); ++y) {
+        for (coord_t x = 0; x < width(); ++x) {
+            if (binary.get_dot(x, y))
+                put_pixel(x, y, fore_color);
+            else
+                put_pixel(x, y, back_color);
+        }
+    }
+}
+inline TextCanvas::~TextCanvas()
+{
+    delete m_own_vertical;
+}
+
+inline coord_t
+TextCanvas::width() const
+{
+    return m_width;
+}
+inline coord_t
+TextCanvas::height() const
+{
+    return m_height;
+}
+inline coord_t
+TextCanvas::count() const
+{
+    return m_width * m_height;
+}
+inline Point&
+TextCanvas::pos()
+{
+    return m_pos;
+}
+inline const Point&
+TextCanvas::pos() const
+{
+    return m_pos;
+}
+inline color_t& TextCanvas::operator[](size_t index)
+{
+    return data()[index];
+}
+inline const color_t& TextCanvas::operator[](size_t index) const
+{
+    return data()[index];
+}
+inline string_type
+TextCanvas::to_str() const
+{
+    string_type ret;
+    ret.reserve((width() + 1) * height());
+    for (coord_t y = 0; y < height(); ++y) {
+        ret.append(row(y).cells, width());
+        ret += newline;
+    }
+    return ret;
+}
+
+inline buffer_type&
+TextCanvas::data()
+{
+    return m_text;
+}
+inline const buffer_type&
+TextCanvas::data() const
+{
+    return m_text;
+}
+
+inline CanvasRow<color_t>
+TextCanvas::row(coord_t y)
+{
+    assert(0 <= y && y < height());
+    return CanvasRow<color_t>(&m_text[y * stride()], width());
+}
+inline CanvasRow<const color_t>
+TextCanvas::row(coord_t y) const
+{
+    assert(0 <= y && y < height());
+    return CanvasRow<const color_t>(&m_text[y * stride()], width());
+}
+inline CanvasRows<color_t>
+TextCanvas::rows()
+{
+    color_t* cells = m_text.empty() ? NULL : &m_text[0];
+    return CanvasRows<color_t>(cells, width(), height(), stride());
+}
+inline CanvasRows<const color_t>
+TextCanvas::rows() const
+{
+    const color_t* cells = m_text.empty() ? NULL : &m_text[0];
+    return CanvasRows<const color_t>(cells, width(), height(), stride());
+}
+inline coord_t
+TextCanvas::stride() const
+{
+    return width();
+}
+inline bool
+TextCanvas::aligned_rows() const
+{
+#ifdef TEXTCANVAS_ROW_ALIGNMENT
+    return (stride() * sizeof(color_t)) % TEXTCANVAS_ROW_ALIGNMENT == 0;
+#else
+    return false;
+#endif
+}
+inline void
+TextCanvas::clear(color_t ch)
+{
+    m_text.assign(width() * height(), ch);
+}
+
+inline void
+TextCanvas::reset(coord_t width, coord_t height, color_t ch)
+{
+    m_width = width;
+    m_height = height;
+    m_text.assign(width * height, ch);
+    m_pos.x = m_pos.y = 0;
+}
+
+inline void
+TextCanvas::resize(coord_t width_, coord_t height_, color_t ch)
+{
+    const coord_t min_width = std::min(width(), width_);
+    const coord_t min_height = std::min(height(), height_);
+    buffer_type str(width_ * height_, ch);
+    for (coord_t y = 0; y < min_height; ++y) {
+        for (coord_t x = 0; x < min_width; ++x) {
+            str[y * width_ + x] = m_text[y * width() + x];
+        }
+    }
+    std::swap(str, m_text);
+    m_width = width_;
+    m_height = height_;
+}
+
+inline color_t
+TextCanvas::get_pixel(coord_t x, coord_t y) const
+{
+    if (in_range(x, y)) {
+        return m_text[y * width() + x];
+    }
+    return m_back_color;
+}
+inline color_t
+TextCanvas::get_pixel(const Point& p) const
+{
+    return get_pixel(p.x, p.y);
+}
+inline void
+TextCanvas::put_pixel(coord_t x, coord_t y, color_t ch)
+{
+    if (in_clip(x, y)) {
+        m_text[y * width() + x] = ch;
+    }
+    m_pos.x = x;
+    m_pos.y = y;
+}
+inline void
+TextCanvas::put_pixel(const Point& p, color_t ch)
+{
+    put_pixel(p.x, p.y, ch);
+}
+inline void
+TextCanvas::put_pixel(coord_t x, coord_t y)
+{
+    put_pixel(x, y, m_fore_color);
+}
+inline void
+TextCanvas::put_pixel(const Point& p)
+{
+    put_pixel(p, m_fore_color);
+}
+
+inline void
+TextCanvas::swap(TextCanvas& other)
+{
+    std::swap(m_width, other.m_width);
+    std::swap(m_height, other.m_height);
+    std::swap(m_text, other.m_text);
+    std::swap(m_fore_color, other.m_fore_color);
+    std::swap(m_back_color, other.m_back_color);
+    std::swap(m_pos, other.m_pos);
+    std::swap(m_clips, other.m_clips);
+    std::swap(m_own_vertical, other.m_own_vertical);
+    std::swap(m_shared_vertical, other.m_shared_vertical);
+}
+
+inline color_t
+TextCanvas::fore_color() const
+{
+    return m_fore_color;
+}
+inline void
+TextCanvas::fore_color(color_t ch)
+{
+    m_fore_color = ch;
+}
+
+inline color_t
+TextCanvas::back_color() const
+{
+    return m_back_color;
+}
+inline void
+TextCanvas::back_color(color_t ch)
+{
+    m_back_color = ch;
+}
+
+inline void
+TextCanvas::move_to(coord_t x, coord_t y)
+{
+    m_pos.x = x;
+    m_pos.y = y;
+}
+inline void
+TextCanvas::move_to(const Point& p)
+{
+    m_pos = p;
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+inline bool
+TextCanvas::get_dot(coord_t x, coord_t y) const
+{
+    return get_pixel(x, y) == fore_color();
+}
+inline void
+TextCanvas::put_dot(coord_t x, coord_t y, bool dot)
+{
+    if (dot)
+        put_pixel(x, y, fore_color());
+    else
+        put_pixel(x, y, back_color());
+}
+
+inline bool
+TextCanvas::in_range(coord_t x, coord_t y) const
+{
+    return (0 <= x && x < width() && 0 <= y && y < height());
+}
+inline bool
+TextCanvas::in_range(const Point& p) const
+{
+    return in_range(p.x, p.y);
+}
+
+inline void
+TextCanvas::push_clip_rect(const Rect& rect)
+{
+    ClipState clip = has_clip() ? m_clips.back() : ClipState(clip_rect());
+    clip.rect = intersect_rect(clip.rect, rect);
+    m_clips.push_back(clip);
+}
+inline void
+TextCanvas::push_clip_mask(coord_t x0, coord_t y0, const XbmImage& mask)
+{
+    ClipState clip = has_clip() ? m_clips.back() : ClipState(clip_rect());
+    clip.rect = intersect_rect(clip.rect, Rect(x0, y0, x0 + mask.width() - 1,
+                                               y0 + mask.height() - 1));
+    XbmImage combined(width(), height());
+    for (coord_t y = clip.rect.y0; y <= clip.rect.y1; ++y) {
+        for (coord_t x = clip.rect.x0; x <= clip.rect.x1; ++x) {
+            if (mask.get_dot(x - x0, y - y0) &&
+                (!clip.masked || clip.mask.get_dot(x, y))) {
+                combined.put_dot(x, y, true);
+            }
+        }
+    }
+    clip.mask = combined;
+    clip.masked = true;
+    m_clips.push_back(clip);
+}
+inline void
+TextCanvas::pop_clip()
+{
+    assert(has_clip());
+    m_clips.pop_back();
+}
+inline bool
+TextCanvas::has_clip() const
+{
+    return !m_clips.empty();
+}
+inline Rect
+TextCanvas::clip_rect() const
+{
+    const Rect canvas(0, 0, width() - 1, height() - 1);
+    return has_clip() ? intersect_rect(m_clips.back().rect, canvas) : canvas;
+}
+inline bool
+TextCanvas::in_clip(coord_t x, coord_t y) const
+{
+    if (!in_range(x, y))
+        return false;
+    if (m_clips.empty())
+        return true;
+    const ClipState& clip = m_clips.back();
+    return clip.rect.contains(x, y) && (!clip.masked || clip.mask.get_dot(x, y));
+}
+
+inline void
+TextCanvas::fill_span(coord_t y, coord_t x0, coord_t x1, color_t ch)
+{
+    const Rect rc = clip_rect();
+    if (y < rc.y0 || y > rc.y1)
+        return;
+    x0 = std::max(x0, rc.x0);
+    x1 = std::min(x1, rc.x1);
+    if (x0 > x1)
+        return;
+
+    color_t* dest = &m_text[y * width()];
+    if (!has_clip() || !m_clips.back().masked) {
+        std::memset(&dest[x0], ch, x1 - x0 + 1);
+        return;
+    }
+    const XbmImage::value_type* bits =
+        &m_clips.back().mask.data()[y * m_clips.back().mask.stride()];
+    for (coord_t x = x0; x <= x1; ++x) {
+        if ((bits[x >> 3] >> (x & 7)) & 1)
+            dest[x] = ch;
+    }
+}
+
+inline TextCanvas::BoxClip
+TextCanvas::clip_box(coord_t x0, coord_t y0, coord_t x1, coord_t y1) const
+{
+    const Rect box(std::min(x0, x1), std::min(y0, y1),
+                   std::max(x0, x1), std::max(y0, y1));
+    const Rect clip = clip_rect();
+    if (!box.intersects(clip))
+        return BOX_OUTSIDE;
+    if (clip.contains(box) && !clip_masked())
+        return BOX_INSIDE;
+    return BOX_PARTIAL;
+}
+inline Point
+TextCanvas::ellipse_center(coord_t x0, coord_t y0, coord_t x1, coord_t y1)
+{
+    if (x0 > x1)
+        std::swap(x0, x1);
+    if (y0 > y1)
+        std::swap(y0, y1);
+    const coord_t dx = x1 - x0, dy = y1 - y0;
+    if (dx <= 1 || dy <= 1)
+        return Point(x0 + (dx + 1) / 2, y0 + (dy + 1) / 2);
+    return Point(x0 + (dx + 1) / 2, y0 + dy / 2);
+}
+inline bool
+TextCanvas::clip_masked() const
+{
+    return has_clip() && m_clips.back().masked;
+}
+inline void
+TextCanvas::unclip_row(coord_t y, coord_t x0, const string_type& saved)
+{
+    const XbmImage& mask = m_clips.back().mask;
+    const XbmImage::value_type* bits = &mask.data()[y * mask.stride()];
+    color_t* dest = &m_text[y * width()];
+    for (coord_t i = 0; i < coord_t(saved.size()); ++i) {
+        const coord_t x = x0 + i;
+        if (!((bits[x >> 3] >> (x & 7)) & 1))
+            dest[x] = saved[i];
+    }
+}
+
+inline bool
+TextCanvas::same_size(const TextCanvas& tc) const
+{
+    return width() == tc.width() && height() == tc.height();
+}
+
+inline void
+TextCanvas::clear()
+{
+    clear(back_color());
+}
+inline void
+TextCanvas::reset(coord_t width, coord_t height)
+{
+    reset(width, height, back_color());
+}
+
+inline void
+TextCanvas::resize(coord_t width_, coord_t height_)
+{
+    resize(width_, height_, back_color());
+}
+
+inline TextCanvas operator!(const TextCanvas& bin)
+{
+    TextCanvas ret(bin.width(), bin.height(), zero);
+    for (coord_t i = 0; i < bin.count(); ++i) {
+        ret[i] = !bin[i];
+    }
+    return ret;
+}
+inline TextCanvas operator&(const TextCanvas& bin1, const TextCanvas& bin2)
+{
+    assert(bin1.same_size(bin2));
+    TextCanvas ret(bin1.width(), bin1.height(), zero);
+    for (coord_t i = 0; i < bin1.count(); ++i) {
+        ret[i] = bin1[i] & bin2[i];
+    }
+    return ret;
+}
+inline TextCanvas
+operator|(const TextCanvas& bin1, const TextCanvas& bin2)
+{
+    assert(bin1.same_size(bin2));
+    TextCanvas ret(bin1.width(), bin1.height(), zero);
+    for (coord_t i = 0; i < bin1.count(); ++i) {
+        ret[i] = bin1[i] | bin2[i];
+    }
+    return ret;
+}
+inline TextCanvas
+operator^(const TextCanvas& bin1, const TextCanvas& bin2)
+{
+    assert(bin1.same_size(bin2));
+    TextCanvas ret(bin1.width(), bin1.height(), zero);
+    for (coord_t i = 0; i < bin1.count(); ++i) {
+        ret[i] = bin1[i] ^ bin2[i];
+    }
+    return ret;
+}
+
+inline void
+TextCanvas::fill(const TextCanvas& bin)
+{
+    assert(same_size(bin));
+    for (coord_t i = 0; i < count(); ++i) {
+        if (bin[i]) {
+            data()[i] = fore_color();
+        }
+    }
+}
+inline void
+TextCanvas::do_mask(const TextCanvas& image, const TextCanvas& mask)
+{
+    assert(same_size(image));
+    assert(same_size(mask));
+    for (coord_t i = 0; i < count(); ++i) {
+        if (mask[i] && image[i]) {
+            data()[i] = image[i];
+        }
+    }
+}
+
+inline void
+TextCanvas::get_subimage(TextCanvas& image,
+                         coord_t x0,
+                         coord_t y0,
+                         coord_t x1,
+                         coord_t y1) const
+{
+    if (x0 > x1)
+        std::swap(x0, x1);
+    if (y0 > y1)
+        std::swap(y0, y1);
+
+    coord_t width = x1 - x0 + 1;
+    coord_t height = y1 - y0 + 1;
+    if (width != image.width() || height != image.height()) {
+        image.reset(width, height);
+    }
+
+    coord_t py = 0;
+    for (coord_t y = y0; y <= y1; ++y) {
+        coord_t px = 0;
+        for (coord_t x = x0; x <= x1; ++x) {
+            color_t ch = get_pixel(x, y);
+            image.put_pixel(px, py, ch);
+            ++px;
+        }
+        ++py;
+    }
+}
+inline void
+TextCanvas::get_subimage(XbmImage& image,
+                         coord_t x0,
+                         coord_t y0,
+                         coord_t x1,
+                         coord_t y1) const
+{
+    if (x0 > x1)
+        std::swap(x0, x1);
+    if (y0 > y1)
+        std::swap(y0, y1);
+
+    coord_t width = x1 - x0 + 1;
+    coord_t height = y1 - y0 + 1;
+    if (image.width() != width || image.height() != height) {
+        image.reset(width, height);
+    }
+
+    coord_t py = 0;
+    for (coord_t y = y0; y <= y1; ++y) {
+        coord_t px = 0;
+        for (coord_t x = x0; x <= x1; ++x) {
+            image.put_dot(px, py, get_dot(x, y));
+            ++px;
+        }
+        ++py;
+    }
+}
+
+inline void
+TextCanvas::get_subimage(TextCanvas& image, Point& p0, Point& p1) const
+{
+    get_subimage(image, p0.x, p0.y, p1.x, p1.y);
+}
+inline void
+TextCanvas::get_subimage(XbmImage& image, Point& p0, Point& p1) const
+{
+    get_subimage(image, p0.x, p0.y, p1.x, p1.y);
+}
+
+inline void
+TextCanvas::put_subimage(coord_t x0, coord_t y0, const TextCanvas& image)
+{
+    for (coord_t py = 0; py < image.height(); ++py) {
+        for (coord_t px = 0; px < image.width(); ++px) {
+            put_pixel(x0 + px, y0 + py, image.get_pixel(px, py));
+        }
+    }
+}
+inline void
+TextCanvas::put_subimage(coord_t x0, coord_t y0, const XbmImage& image)
+{
+    for (coord_t py = 0; py < image.height(); ++py) {
+        for (coord_t px = 0; px < image.width(); ++px) {
+            put_dot(x0 + px, y0 + py, image.get_dot(px, py));
+        }
+    }
+}
+
+inline void
+TextCanvas::put_sprite(coord_t x0,
+                       coord_t y0,
+                       const SpriteAtlas& atlas,
+                       coord_t index)
+{
+    put_sprite(x0, y0, atlas, index, Rect(0, 0, width() - 1, height() - 1));
+}
+inline void
+TextCanvas::put_sprite(coord_t x0,
+                       coord_t y0,
+                       const SpriteAtlas& atlas,
+                       coord_t index,
+                       const Rect& clip)
+{
+    // clip the sprite once, then each run
+    const Rect rc = intersect_rect(clip, clip_rect());
+    const coord_t py0 = std::max(coord_t(0), rc.y0 - y0);
+    const coord_t py1 = std::min(atlas.height(index), rc.y1 + 1 - y0);
+    const color_t* cells = atlas.cells();
+    const bool masked = clip_masked();
+    string_type saved;
+    for (coord_t py = py0; py < py1; ++py) {
+        color_t* dest = &m_text[(y0 + py) * width()];
+        const SpriteRun* end = atlas.row_end(index, py);
+        for (const SpriteRun* run = atlas.row_begin(index, py); run != end; ++run) {
+            const coord_t x = x0 + run->x;
+            const coord_t a = std::max(x, rc.x0);
+            const coord_t b = std::min(x + run->count, rc.x1 + 1);
+            if (a >= b)
+                continue;
+            if (masked)
+                saved.assign(&dest[a], b - a);
+            std::memcpy(&dest[a], &cells[run->offset + (a - x)], b - a);
+            if (masked)
+                unclip_row(y0 + py, a, saved);
+        }
+    }
+}
+
+template<typename T_PUTTER0, typename T_PUTTER1>
+inline void
+TextCanvas::put_subimage(coord_t x0,
+                         coord_t y0,
+                         const TextCanvas& image,
+                         T_PUTTER0& fore,
+                         T_PUTTER1& back)
+{
+    for (coord_t py = 0; py < image.height(); ++py) {
+        for (coord_t px = 0; px < image.width(); ++px) {
+            if (image.get_dot(px, py))
+                fore(x0 + px, y0 + py);
+            else
+                back(x0 + px, y0 + py);
+        }
+    }
+}
+template<typename T_PUTTER0, typename T_PUTTER1>
+inline void
+TextCanvas::put_subimage(coord_t x0,
+                         coord_t y0,
+                         const XbmImage& image,
+                         T_PUTTER0& fore,
+                         T_PUTTER1& back)
+{
+    for (coord_t py = 0; py < image.height(); ++py) {
+        for (coord_t px = 0; px < image.width(); ++px) {
+            if (image.get_dot(px, py))
+                fore(x0 + px, y0 + py);
+            else
+                back(x0 + px, y0 + py);
+        }
+    }
+}
+
+template<typename T_CONVERTER, typename T_PUTTER0, typename T_PUTTER1>
+inline Size
+TextCanvas::put_char(coord_t x0,
+                     coord_t y0,
+                     const XbmFont& font,
+                     coord_t iColumn,
+                     coord_t iRow,
+                     T_CONVERTER& conv,
+                     T_PUTTER0& fore,
+                     T_PUTTER1& back)
+{
+    assert(0 <= iColumn && iColumn < font.columns());
+    assert(0 <= iRow && iRow < font.rows());
+    coord_t qx0 = iColumn * font.cell_width();
+    coord_t qy0 = iRow * font.cell_height();
+    coord_t qx1 = qx0 + font.cell_width() - 1;
+    coord_t qy1 = qy0 + font.cell_height() - 1;
+    TextCanvas other;
+    font.get_subimage(other, qx0, qy0, qx1, qy1);
+    conv(other);
+    put_subimage(x0, y0, other, fore, back);
+    return Size(other.width(), other.height());
+}
+template<typename T_CONVERTER, typename T_PUTTER0, typename T_PUTTER1>
+inline Size
+TextCanvas::put_char(coord_t x0,
+                     coord_t y0,
+                     const XbmFont& font,
+                     coord_t char_code,
+                     T_CONVERTER& conv,
+                     T_PUTTER0& fore,
+                     T_PUTTER1& back)
+{
+    coord_t iColumn = coord_t(char_code % font.columns());
+    coord_t iRow = coord_t(char_code / font.columns());
+    return put_char(x0, y0, font, iColumn, iRow, conv, fore, back);
+}
+template<typename T_CONVERTER>
+inline Size
+TextCanvas::put_char(coord_t x0,
+                     coord_t y0,
+                     const XbmFont& font,
+                     coord_t iColumn,
+                     coord_t iRow,
+                     T_CONVERTER& conv)
+{
+    ColorPutter fore(*this, fore_color());
+    ColorPutter back(*this, back_color());
+    return put_char(x0, y0, font, iColumn, iRow, conv, fore, back);
+}
+template<typename T_CONVERTER>
+inline Size
+TextCanvas::put_char(coord_t x0,
+                     coord_t y0,
+                     const XbmFont& font,
+                     coord_t char_code,
+                     T_CONVERTER& conv)
+{
+    coord_t iColumn = coord_t(char_code % font.columns());
+    coord_t iRow = coord_t(char_code / font.columns());
+    return put_char(x0, y0, font, iColumn, iRow, conv);
+}
+inline Size
+TextCanvas::put_char(coord_t x0,
+                     coord_t y0,
+                     const XbmFont& font,
+                     coord_t iColumn,
+                     coord_t iRow)
+{
+    NoneConverter conv;
+    return put_char(x0, y0, font, iColumn, iRow, conv);
+}
+inline Size
+TextCanvas::put_char(coord_t x0,
+                     coord_t y0,
+                     const XbmFont& font,
+                     coord_t char_code)
+{
+    NoneConverter conv;
+    return put_char(x0, y0, font, char_code, conv);
+}
+
+template<typename T_CONVERTER, typename T_PUTTER0, typename T_PUTTER1>
+inline Size
+TextCanvas::jis_put_char(coord_t x0,
+                         coord_t y0,
+                         const XbmFont& font,
+                         coord_t jis_code,
+                         T_CONVERTER& conv,
+                         T_PUTTER0& fore,
+                         T_PUTTER1& back)
+{
+    assert(japanese::is_jis_code(jis_code));
+    Point cell = font.jis_cell(uint16_t(jis_code));
+    coord_t iColumn = cell.x, iRow = cell.y;
+    return jis_put_char(x0, y0, font, iColumn, iRow, conv, fore, back);
+}
+template<typename T_CONVERTER, typename T_PUTTER0, typename T_PUTTER1>
+inline Size
+TextCanvas::jis_put_char(coord_t x0,
+                         coord_t y0,
+                         const XbmFont& font,
+                         coord_t iColumn,
+                         coord_t iRow,
+                         T_CONVERTER& conv,
+                         T_PUTTER0& fore,
+                         T_PUTTER1& back)
+{
+    assert(0 <= iColumn && iColumn < font.columns());
+    assert(0 <= iRow && iRow < font.rows());
+    coord_t qx0 = iColumn * font.cell_width();
+    coord_t qy0 = iRow * font.cell_height();
+    coord_t qx1 = qx0 + font.cell_width() - 1;
+    coord_t qy1 = qy0 + font.cell_height() - 1;
+    TextCanvas other;
+    font.get_subimage(other, qx0, qy0, qx1, qy1);
+    conv(other);
+    put_subimage(x0, y0, other, fore, back);
+    return Size(other.width(), other.height());
+}
+template<typename T_CONVERTER>
+inline Size
+TextCanvas::jis_put_char(coord_t x0,
+                         coord_t y0,
+                         const XbmFont& font,
+                         coord_t iColumn,
+                         coord_t iRow,
+                         T_CONVERTER& conv)
+{
+    ColorPutter fore(*this, fore_color());
+    ColorPutter back(*this, back_color());
+    return jis_put_char(x0, y0, font, iColumn, iRow, conv, fore, back);
+}
+template<typename T_CONVERTER>
+inline Size
+TextCanvas::jis_put_char(coord_t x0,
+                         coord_t y0,
+                         const XbmFont& font,
+                         coord_t jis_code,
+                         T_CONVERTER& conv)
+{
+    assert(japanese::is_jis_code(jis_code));
+    Point cell = font.jis_cell(uint16_t(jis_code));
+    coord_t iColumn = cell.x, iRow = cell.y;
+    return jis_put_char(x0, y0, font, iColumn, iRow, conv);
+}
+inline Size
+TextCanvas::jis_put_char(coord_t x0,
+                         coord_t y0,
+                         const XbmFont& font,
+                         coord_t iColumn,
+                         coord_t iRow)
+{
+    NoneConverter conv;
+    return jis_put_char(x0, y0, font, iColumn, iRow, conv);
+}
+inline Size
+TextCanvas::jis_put_char(coord_t x0,
+                         coord_t y0,
+                         const XbmFont& font,
+                         coord_t jis_code)
+{
+    NoneConverter conv;
+    return jis_put_char(x0, y0, font, jis_code, conv);
+}
+
+template<typename T_CONVERTER>
+inline void
+TextCanvas::text_to_right(coord_t x0,
+                          coord_t y0,
+                          const XbmFont& font,
+                          const string_type& text,
+                          T_CONVERTER& conv)
+{
+    for (size_t i = 0; i < text.size(); ++i) {
+        x0 += put_char(x0, y0, font, text[i], conv).x;
+    }
+}
+template<typename T_CONVERTER>
+inline void
+TextCanvas::text_to_right(const Point& p0,
+                          const XbmFont& font,
+                          const string_type& text,
+                          T_CONVERTER& conv)
+{
+    text_to_right(p0.x, p0.y, font, text, conv);
+}
+inline void
+TextCanvas::text_to_right(coord_t x0,
+                          coord_t y0,
+                          const XbmFont& font,
+                          const string_type& text)
+{
+    for (size_t i = 0; i < text.size(); ++i) {
+        x0 += put_char(x0, y0, font, text[i]).x;
+    }
+}
+inline void
+TextCanvas::text_to_right(const Point& p0,
+                          const XbmFont& font,
+                          const string_type& text)
+{
+    text_to_right(p0.x, p0.y, font, text);
+}
+
+inline Size
+TextCanvas::put_glyph(coord_t x0,
+                      coord_t y0,
+                      const XbmFont& font,
+                      coord_t iColumn,
+                      coord_t iRow)
+{
+    return put_glyph(x0, y0, font, iColumn, iRow,
+                     Rect(0, 0, width() - 1, height() - 1));
+}
+inline Size
+TextCanvas::put_glyph(coord_t x0,
+                      coord_t y0,
+                      const XbmFont& font,
+                      coord_t iColumn,
+                      coord_t iRow,
+                      const Rect& clip)
+{
+    assert(0 <= iColumn && iColumn < font.columns());
+    assert(0 <= iRow && iRow < font.rows());
+    const coord_t cx = font.cell_width(), cy = font.cell_height();
+    const coord_t qx0 = iColumn * cx, qy0 = iRow * cy;
+
+    // clip the cell once
+    Rect rc = intersect_rect(clip, clip_rect());
+    const coord_t px0 = std::max(coord_t(0), rc.x0 - x0);
+    const coord_t py0 = std::max(coord_t(0), rc.y0 - y0);
+    const coord_t px1 = std::min(cx, rc.x1 + 1 - x0);
+    const coord_t py1 = std::min(cy, rc.y1 + 1 - y0);
+
+    const XbmImage::value_type* bits = font.data();
+    const color_t fore = fore_color(), back = back_color();
+    const bool masked = clip_masked();
+    string_type saved;
+    for (coord_t py = py0; py < py1 && px0 < px1; ++py) {
+        const XbmImage::value_type* src = &bits[(qy0 + py) * font.stride()];
+        color_t* dest = &m_text[(y0 + py) * width()];
+        if (masked)
+            saved.assign(&dest[x0 + px0], px1 - px0);
+        for (coord_t px = px0; px < px1; ++px) {
+            coord_t qx = qx0 + px;
+            dest[x0 + px] = ((src[qx >> 3] >> (qx & 7)) & 1) ? fore : back;
+        }
+        if (masked)
+            unclip_row(y0 + py, x0 + px0, saved);
+    }
+
+    m_pos.x = x0 + cx - 1;
+    m_pos.y = y0 + cy - 1;
+    return Size(cx, cy);
+}
+
+inline Size
+TextCanvas::put_image(coord_t x0, coord_t y0, const XbmImage& image)
+{
+    const coord_t cx = image.width(), cy = image.height();
+    const Rect rc = clip_rect();
+    const coord_t px0 = std::max(coord_t(0), rc.x0 - x0);
+    const coord_t py0 = std::max(coord_t(0), rc.y0 - y0);
+    const coord_t px1 = std::min(cx, rc.x1 + 1 - x0);
+    const coord_t py1 = std::min(cy, rc.y1 + 1 - y0);
+
+    const XbmImage::value_type* bits = image.data();
+    const color_t fore = fore_color(), back = back_color();
+    const bool masked = clip_masked();
+    string_type saved;
+    for (coord_t py = py0; py < py1 && px0 < px1; ++py) {
+        const XbmImage::value_type* src = &bits[py * image.stride()];
+        color_t* dest = &m_text[(y0 + py) * width()];
+        if (masked)
+            saved.assign(&dest[x0 + px0], px1 - px0);
+        for (coord_t px = px0; px < px1; ++px) {
+            dest[x0 + px] = ((src[px >> 3] >> (px & 7)) & 1) ? fore : back;
+        }
+        if (masked)
+            unclip_row(y0 + py, x0 + px0, saved);
+    }
+
+    m_pos.x = x0 + cx - 1;
+    m_pos.y = y0 + cy - 1;
+    return Size(cx, cy);
+}
+
+inline bool
+TextCanvas::clip_blit(Rect& dest_rect,
+                      Point& src_origin,
+                      coord_t src_width,
+                      coord_t src_height) const
+{
+    // clip by the source, then by the clip of this canvas
+    Rect rc(dest_rect.x0 - src_origin.x,
+            dest_rect.y0 - src_origin.y,
+            dest_rect.x0 - src_origin.x + src_width - 1,
+            dest_rect.y0 - src_origin.y + src_height - 1);
+    rc = intersect_rect(rc, dest_rect);
+    rc = intersect_rect(rc, clip_rect());
+    if (rc.x0 > rc.x1 || rc.y0 > rc.y1)
+        return false;
+
+    src_origin.x += rc.x0 - dest_rect.x0;
+    src_origin.y += rc.y0 - dest_rect.y0;
+    dest_rect = rc;
+    return true;
+}
+
+inline void
+TextCanvas::blit(const Rect& dest_rect,
+                 const TextCanvas& src,
+                 const Point& src_origin,
+                 RasterOp rop,
+                 color_t key)
+{
+    Rect rc = dest_rect;
+    Point pt = src_origin;
+    if (!clip_blit(rc, pt, src.width(), src.height()))
+        return;
+
+    if (&src == this && rop != ROP_INVERT_DEST) {
+        // the rows may overlap
+        TextCanvas copy(*this);
+        blit(rc, copy, pt, rop, key);
+        return;
+    }
+
+    const coord_t cx = rc.x1 - rc.x0 + 1;
+    const bool masked = clip_masked();
+    string_type saved;
+    for (coord_t y = rc.y0; y <= rc.y1; ++y) {
+        color_t* dest = &m_text[y * width() + rc.x0];
+        const color_t* s = &src.m_text[(pt.y + y - rc.y0) * src.width() + pt.x];
+        if (masked)
+            saved.assign(dest, cx);
+        rop_row(dest, s, cx, rop, key);
+        if (masked)
+            unclip_row(y, rc.x0, saved);
+    }
+}
+
+inline void
+TextCanvas::blit(const Rect& dest_rect,
+                 const XbmImage& src,
+                 const Point& src_origin,
+                 RasterOp rop)
+{
+    Rect rc = dest_rect;
+    Point pt = src_origin;
+    if (!clip_blit(rc, pt, src.width(), src.height()))
+        return;
+
+    // expand the bits of each row into the colors, then combine the rows
+    const coord_t cx = rc.x1 - rc.x0 + 1;
+    const color_t fore = fore_color(), back = back_color();
+    string_type row(cx, back), saved;
+    const bool masked = clip_masked();
+#ifdef TEXTCANVAS_USE_SSE2
+    const __m128i select = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128,
+                                         1, 2, 4, 8, 16, 32, 64, -128);
+    const __m128i fores = _mm_set1_epi8(char(fore));
+    const __m128i backs = _mm_set1_epi8(char(back));
+#endif
+    for (coord_t y = rc.y0; y <= rc.y1; ++y) {
+        const XbmImage::value_type* bits =
+            &src.data()[(pt.y + y - rc.y0) * src.stride()];
+        coord_t x = 0;
+#ifdef TEXTCANVAS_USE_SSE2
+        for (; x + 16 <= cx; x += 16) {
+            const coord_t px = pt.x + x, i = px >> 3, shift = px & 7;
+            unsigned on = unsigned(bits[i]) | (unsigned(bits[i + 1]) << 8);
+            if (shift)
+                on = (on | (unsigned(bits[i + 2]) << 16)) >> shift;
+            const __m128i set = sse2_expand_bits(on, select);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(&row[x]),
+                             _mm_or_si128(_mm_and_si128(set, fores),
+                                          _mm_andnot_si128(set, backs)));
+        }
+#endif
+        for (; x < cx; ++x) {
+            const coord_t px = pt.x + x;
+            row[x] = ((bits[px >> 3] >> (px & 7)) & 1) ? fore : back;
+        }
+        if (masked)
+            saved.assign(&m_text[y * width() + rc.x0], cx);
+        rop_row(&m_text[y * width() + rc.x0], &row[0], cx, rop, back);
+        if (masked)
+            unclip_row(y, rc.x0, saved);
+    }
+}
+
+template<typename T_CONVERTER>
+inline Size
+TextCanvas::put_char(coord_t x0,
+                     coord_t y0,
+                     const XbmFont& font,
+                     coord_t iColumn,
+                     coord_t iRow,
+                     GlyphCache<T_CONVERTER>& cache)
+{
+    return put_image(x0, y0, cache.get(font, iColumn, iRow));
+}
+template<typename T_CONVERTER>
+inline Size
+TextCanvas::put_char(coord_t x0,
+                     coord_t y0,
+                     const XbmFont& font,
+                     coord_t char_code,
+                     GlyphCache<T_CONVERTER>& cache)
+{
+    coord_t iColumn = coord_t(char_code % font.columns());
+    coord_t iRow = coord_t(char_code / font.columns());
+    return put_char(x0, y0, font, iColumn, iRow, cache);
+}
+template<typename T_CONVERTER>
+inline Size
+TextCanvas::jis_put_char(coord_t x0,
+                         coord_t y0,
+                         const XbmFont& font,
+                         coord_t iColumn,
+                         coord_t iRow,
+                         GlyphCache<T_CONVERTER>& cache)
+{
+    return put_image(x0, y0, cache.get(font, iColumn, iRow));
+}
+template<typename T_CONVERTER>
+inline Size
+TextCanvas::jis_put_char(coord_t x0,
+                         coord_t y0,
+                         const XbmFont& font,
+                         coord_t jis_code,
+                         GlyphCache<T_CONVERTER>& cache)
+{
+    assert(japanese::is_jis_code(jis_code));
+    Point cell = font.jis_cell(uint16_t(jis_code));
+    coord_t iColumn = cell.x, iRow = cell.y;
+    return jis_put_char(x0, y0, font, iColumn, iRow, cache);
+}
+
+inline void
+TextCanvas::text_to_right(coord_t x0, coord_t y0, const TextRun& run)
+{
+    for (size_t i = 0; i < run.size(); ++i) {
+        const TextRun::Glyph& glyph = run[i];
+        if (x0 < width() && x0 + glyph.advance > 0)
+            put_glyph(x0, y0, *glyph.font, glyph.column, glyph.row);
+        x0 += glyph.advance;
+    }
+}
+inline void
+TextCanvas::text_to_right(const Point& p0, const TextRun& run)
+{
+    text_to_right(p0.x, p0.y, run);
+}
+template<typename T_CONVERTER>
+inline void
+TextCanvas::text_to_right(coord_t x0,
+                          coord_t y0,
+                          const TextRun& run,
+                          T_CONVERTER& conv)
+{
+    for (size_t i = 0; i < run.size(); ++i) {
+        const TextRun::Glyph& glyph = run[i];
+        x0 += put_char(x0, y0, *glyph.font, glyph.column, glyph.row, conv).x;
+    }
+}
+template<typename T_CONVERTER>
+inline void
+TextCanvas::text_to_right(const Point& p0, const TextRun& run, T_CONVERTER& conv)
+{
+    text_to_right(p0.x, p0.y, run, conv);
+}
+template<typename T_CONVERTER>
+inline void
+TextCanvas::text_to_right(coord_t x0,
+                          coord_t y0,
+                          const TextRun& run,
+                          GlyphCache<T_CONVERTER>& cache)
+{
+    for (size_t i = 0; i < run.size(); ++i) {
+        const TextRun::Glyph& glyph = run[i];
+        const XbmImage& image = cache.get(*glyph.font, glyph.column, glyph.row);
+        x0 += put_image(x0, y0, image).x;
+    }
+}
+
+inline void
+TextCanvas::put_layout(coord_t x0, coord_t y0, const TextLayout& layout)
+{
+    put_layout(x0, y0, layout, Rect(0, 0, width() - 1, height() - 1));
+}
+inline void
+TextCanvas::put_layout(const Point& p0, const TextLayout& layout)
+{
+    put_layout(p0.x, p0.y, layout);
+}
+inline void
+TextCanvas::put_layout(coord_t x0,
+                       coord_t y0,
+                       const TextLayout& layout,
+                       const Rect& clip)
+{
+    Rect rc = intersect_rect(clip, clip_rect());
+    if (rc.empty())
+        return;
+
+    const TextRun& run = layout.run();
+    for (size_t i = 0; i < layout.line_count(); ++i) {
+        const TextLayout::Line& line = layout.line(i);
+        coord_t y = y0 + line.y;
+        if (y > rc.y1)
+            break;
+        if (y + line.height <= rc.y0)
+            continue;
+
+        coord_t x = x0 + line.x;
+        for (size_t k = line.first; k < line.last; ++k) {
+            const TextRun::Glyph& glyph = run[k];
+            if (x > rc.x1)
+                break;
+            if (x + glyph.advance > rc.x0)
+                put_glyph(x, y, *glyph.font, glyph.column, glyph.row, rc);
+            x += glyph.advance;
+        }
+    }
+}
+
+inline void
+TextCanvas::sjis_text_to_right(coord_t x0,
+                               coord_t y0,
+                               const XbmFont& zenkaku_font,
+                               const XbmFont& hankaku_font,
+                               const string_type& text)
+{
+    NoneConverter conv;
+    sjis_text_to_right(x0, y0, zenkaku_font, hankaku_font, text, conv);
+}
+inline void
+TextCanvas::sjis_text_to_right(const Point& p0,
+                               const XbmFont& zenkaku_font,
+                               const XbmFont& hankaku_font,
+                               const string_type& text)
+{
+    NoneConverter conv;
+    sjis_text_to_right(p0.x, p0.y, zenkaku_font, hankaku_font, text, conv);
+}
+template<typename T_CONVERTER>
+inline void
+TextCanvas::sjis_text_to_right(coord_t x0,
+                               coord_t y0,
+                               const XbmFont& zenkaku_font,
+                               const XbmFont& hankaku_font,
+                               const string_type& text,
+                               T_CONVERTER& conv)
+{
+    for (size_t i = 0; i < text.size(); ++i) {
+        if (i + 1 < text.size() && japanese::is_sjis_lead(text[i]) &&
+            japanese::is_sjis_trail(text[i + 1])) {
+            uint16_t jis_code = japanese::sjis2jis(text[i], text[i + 1]);
+            x0 += jis_put_char(x0, y0, zenkaku_font, jis_code, conv).x;
+            ++i;
+        } else {
+            x0 += put_char(x0, y0, hankaku_font, (uint8_t)text[i], conv).x;
+        }
+    }
+}
+template<typename T_CONVERTER>
+inline void
+TextCanvas::sjis_text_to_right(const Point& p0,
+                               const XbmFont& zenkaku_font,
+                               const XbmFont& hankaku_font,
+                               const string_type& text,
+                               T_CONVERTER& conv)
+{
+    sjis_text_to_right(p0.x, p0.y, zenkaku_font, hankaku_font, text, conv);
+}
+
+inline void
+TextCanvas::utf8_text_to_right(coord_t x0,
+                               coord_t y0,
+                               const XbmFont& zenkaku_font,
+                               const XbmFont& hankaku_font,
+                               const string_type& text)
+{
+    NoneConverter conv;
+    utf8_text_to_right(x0, y0, zenkaku_font, hankaku_font, text, conv);
+}
+inline void
+TextCanvas::utf8_text_to_right(const Point& p0,
+                               const XbmFont& zenkaku_font,
+                               const XbmFont& hankaku_font,
+                               const string_type& text)
+{
+    NoneConverter conv;
+    utf8_text_to_right(p0.x, p0.y, zenkaku_font, hankaku_font, text, conv);
+}
+template<typename T_CONVERTER>
+inline void
+TextCanvas::utf8_text_to_right(coord_t x0,
+                               coord_t y0,
+                               const XbmFont& zenkaku_font,
+                               const XbmFont& hankaku_font,
+                               const string_type& text,
+                               T_CONVERTER& conv)
+{
+    const char* str = text.c_str();
+    const size_t len = text.size();
+    for (size_t i = 0; i < len;) {
+        // ASCII runs need no decoding
+        size_t run = japanese::ascii_run_length(str + i, len - i);
+        for (size_t k = i; k < i + run; ++k) {
+            x0 += put_char(x0, y0, hankaku_font, (uint8_t)str[k], conv).x;
+        }
+        i += run;
+        if (i >= len)
+            break;
+
+        size_t used;
+        uint32_t ucs = japanese::utf8_decode(str + i, len - i, used);
+        i += used;
+
+        uint8_t ch;
+        if (japanese::unicode2hankaku(ucs, ch)) {
+            x0 += put_char(x0, y0, hankaku_font, ch, conv).x;
+        } else {
+            uint16_t jis_code = japanese::unicode2jis(ucs);
+            if (!jis_code)
+                jis_code = japanese::jis_geta_mark;
+            x0 += jis_put_char(x0, y0, zenkaku_font, jis_code, conv).x;
+        }
+    }
+}
+template<typename T_CONVERTER>
+inline void
+TextCanvas::utf8_text_to_right(const Point& p0,
+                               const XbmFont& zenkaku_font,
+                               const XbmFont& hankaku_font,
+                               const string_type& text,
+                               T_CONVERTER& conv)
+{
+    utf8_text_to_right(p0.x, p0.y, zenkaku_font, hankaku_font, text, conv);
+}
+
+inline VerticalGlyphCache&
+TextCanvas::vertical_cache()
+{
+    if (m_shared_vertical)
+        return *m_shared_vertical;
+    if (!m_own_vertical)
+        m_own_vertical = new VerticalGlyphCache;
+    return *m_own_vertical;
+}
+inline void
+TextCanvas::set_vertical_cache(VerticalGlyphCache* cache)
+{
+    m_shared_vertical = cache;
+}
+
+inline Size
+TextCanvas::vertical_put_char(coord_t x0,
+                              coord_t y0,
+                              const XbmFont& font,
+                              coord_t char_code)
+{
+    coord_t iColumn = coord_t(char_code % font.columns());
+    coord_t iRow = coord_t(char_code / font.columns());
+    const coord_t cx = font.cell_width(), cy = font.cell_height();
+    if (japanese::is_hankaku_vertical_upright(uint8_t(char_code))) {
+        ColorPutter back(*this, back_color());
+        fill_rectangle(x0, y0, x0 + cy - 1, y0 + cy - 1, back);
+        put_glyph(x0 + (cy - cx) / 2, y0, font, iColumn, iRow);
+        return Size(cy, cy);
+    }
+    put_image(x0, y0, vertical_cache().rotated.get(font, iColumn, iRow));
+    return Size(cy, cx);
+}
+inline Size
+TextCanvas::vertical_jis_put_char(coord_t x0,
+                                  coord_t y0,
+                                  const XbmFont& font,
+                                  coord_t jis_code)
+{
+    assert(japanese::is_jis_code(jis_code));
+    Point cell = font.jis_cell(uint16_t(jis_code));
+    coord_t iColumn = cell.x, iRow = cell.y;
+    if (japanese::is_vertical_rotated(uint16_t(jis_code))) {
+        const XbmImage& image = vertical_cache().rotated.get(font, iColumn, iRow);
+        return put_image(x0, y0, image);
+    }
+    if (japanese::is_vertical_shifted(uint16_t(jis_code))) {
+        const XbmImage& image = vertical_cache().shifted.get(font, iColumn, iRow);
+        return put_image(x0, y0, image);
+    }
+    return put_glyph(x0, y0, font, iColumn, iRow);
+}
+
+inline void
+TextCanvas::text_to_down(coord_t x0,
+                         coord_t y0,
+                         const XbmFont& font,
+                         const string_type& text)
+{
+    for (size_t i = 0; i < text.size(); ++i) {
+        y0 += vertical_put_char(x0, y0, font, (uint8_t)text[i]).y;
+    }
+}
+inline void
+TextCanvas::text_to_down(const Point& p0,
+                         const XbmFont& font,
+                         const string_type& text)
+{
+    text_to_down(p0.x, p0.y, font, text);
+}
+
+inline void
+TextCanvas::sjis_text_to_down(coord_t x0,
+                              coord_t y0,
+                              const XbmFont& zenkaku_font,
+                              const XbmFont& hankaku_font,
+                              const string_type& text)
+{
+    for (size_t i = 0; i < text.size(); ++i) {
+        if (i + 1 < text.size() && japanese::is_sjis_lead(text[i]) &&
+            japanese::is_sjis_trail(text[i + 1])) {
+            uint16_t jis_code = japanese::sjis2jis(text[i], text[i + 1]);
+            y0 += vertical_jis_put_char(x0, y0, zenkaku_font, jis_code).y;
+            ++i;
+        } else {
+            y0 += vertical_put_char(x0, y0, hankaku_font, (uint8_t)text[i]).y;
+        }
+    }
+}
+inline void
+TextCanvas::sjis_text_to_down(const Point& p0,
+                              const XbmFont& zenkaku_font,
+                              const XbmFont& hankaku_font,
+                              const string_type& text)
+{
+    sjis_text_to_down(p0.x, p0.y, zenkaku_font, hankaku_font, text);
+}
+
+inline void
+TextCanvas::utf8_text_to_down(coord_t x0,
+                              coord_t y0,
+                              const XbmFont& zenkaku_font,
+                              const XbmFont& hankaku_font,
+                              const string_type& text)
+{
+    const char* str = text.c_str();
+    const size_t len = text.size();
+    for (size_t i = 0; i < len;) {
+        size_t used;
+        uint32_t ucs = japanese::utf8_decode(str + i, len - i, used);
+        i += used;
+
+        uint8_t ch;
+        if (japanese::unicode2hankaku(ucs, ch)) {
+            y0 += vertical_put_char(x0, y0, hankaku_font, ch).y;
+        } else {
+            uint16_t jis_code = japanese::unicode2jis(ucs);
+            if (!jis_code)
+                jis_code = japanese::jis_geta_mark;
+            y0 += vertical_jis_put_char(x0, y0, zenkaku_font, jis_code).y;
+        }
+    }
+}
+inline void
+TextCanvas::utf8_text_to_down(const Point& p0,
+                              const XbmFont& zenkaku_font,
+                              const XbmFont& hankaku_font,
+                              const string_type& text)
+{
+    utf8_text_to_down(p0.x, p0.y, zenkaku_font, hankaku_font, text);
+}
+
+inline void
+TextCanvas::flood_fill(coord_t x, coord_t y, color_t ch, bool surface)
+{
+    if (surface)
+        flood_fill_surface(x, y, ch);
+    else
+        flood_fill_bordered(x, y, ch);
+}
+inline void
+TextCanvas::flood_fill(const Point& p, color_t ch, bool surface)
+{
+    flood_fill(p.x, p.y, ch, surface);
+}
+inline void
+TextCanvas::flood_fill_bordered(coord_t x, coord_t y, color_t border_ch)
+{
+    Point p(x, y);
+    if (!in_range(p))
+        return;
+
+    Points points;
+    points.push_back(p);
+
+    std::set<Point, point_less> point_set;
+    point_set.insert(p);
+    for (size_t i = 0; i < points.size(); ++i) {
+        p = points[i];
+        if (get_pixel(p) == border_ch)
+            continue;
+
+        put_pixel(p);
+
+        --p.x; // left
+        if (get_pixel(p) != border_ch && !point_set.count(p)) {
+            points.push_back(p);
+            point_set.insert(p);
+        }
+        ++p.x;
+        --p.y; // up
+        if (get_pixel(p) != border_ch && !point_set.count(p)) {
+            points.push_back(p);
+            point_set.insert(p);
+        }
+        ++p.x;
+        ++p.y; // right
+        if (get_pixel(p) != border_ch && !point_set.count(p)) {
+            points.push_back(p);
+            point_set.insert(p);
+        }
+        --p.x;
+        ++p.y; // down
+        if (get_pixel(p) != border_ch && !point_set.count(p)) {
+            points.push_back(p);
+            point_set.insert(p);
+        }
+    }
+
+    move_to(x, y);
+}
+inline void
+TextCanvas::flood_fill_surface(coord_t x, coord_t y, color_t surface_ch)
+{
+    Point p(x, y);
+    if (!in_range(p))
+        return;
+
+    Points points;
+    points.push_back(p);
+    for (size_t i = 0; i < points.size(); ++i) {
+        p = points[i];
+        if (get_pixel(p) != surface_ch || !in_clip(p.x, p.y))
+            continue;
+
+        put_pixel(p);
+
+        --p.x; // left
+        if (get_pixel(p) == surface_ch)
+            points.push_back(p);
+        ++p.x;
+        --p.y; // up
+        if (get_pixel(p) == surface_ch)
+            points.push_back(p);
+        ++p.x;
+        ++p.y; // right
+        if (get_pixel(p) == surface_ch)
+            points.push_back(p);
+        --p.x;
+        ++p.y; // down
+        if (get_pixel(p) == surface_ch)
+            points.push_back(p);
+    }
+
+    move_to(x, y);
+}
+inline void
+TextCanvas::flood_fill_bordered(const Point& p, color_t border_ch)
+{
+    flood_fill_bordered(p.x, p.y, border_ch);
+}
+inline void
+TextCanvas::flood_fill_surface(const Point& p, color_t surface_ch)
+{
+    flood_fill_surface(p.x, p.y, surface_ch);
+}
+
+inline void
+TextCanvas::get_mask(XbmImage& mask, color_t ch) const
+{
+    assert(mask.width() == width() && mask.height() == height());
+    for (coord_t y = 0; y < height(); ++y) {
+        const color_t* src = &m_text[y * width()];
+        XbmImage::value_type* dest = &mask.data()[y * mask.stride()];
+        std::memset(dest, 0, mask.stride());
+        coord_t x = 0;
+#ifdef TEXTCANVAS_USE_SSE2
+        // 16 cells to 16 bits at a time
+        const __m128i key = _mm_set1_epi8(char(ch));
+        for (; x + 16 <= width(); x += 16) {
+            __m128i cells = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(&src[x]));
+            int bits = _mm_movemask_epi8(_mm_cmpeq_epi8(cells, key));
+            dest[x >> 3] = XbmImage::value_type(bits);
+            dest[(x >> 3) + 1] = XbmImage::value_type(bits >> 8);
+        }
+#endif
+        for (; x < width(); ++x) {
+            if (src[x] == ch)
+                dest[x >> 3] |= XbmImage::value_type(1 << (x & 7));
+        }
+    }
+}
+
+inline void
+TextCanvas::put_mask_change(const XbmImage& before, const XbmImage& after)
+{
+    const color_t fore = fore_color(), back = back_color();
+#ifdef TEXTCANVAS_USE_SSE2
+    const __m128i select = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128,
+                                         1, 2, 4, 8, 16, 32, 64, -128);
+    const __m128i fores = _mm_set1_epi8(char(fore));
+    const __m128i backs = _mm_set1_epi8(char(back));
+#endif
+    for (coord_t y = 0; y < height(); ++y) {
+        const XbmImage::value_type* src0 = &before.data()[y * before.stride()];
+        const XbmImage::value_type* src1 = &after.data()[y * after.stride()];
+        color_t* dest = &m_text[y * width()];
+        coord_t i = 0;
+#ifdef TEXTCANVAS_USE_SSE2
+        // 16 bits to 16 cells at a time
+        for (; i + 2 <= width() / 8; i += 2) {
+            const unsigned diff =
+                unsigned(src0[i] ^ src1[i]) | (unsigned(src0[i + 1] ^ src1[i + 1]) << 8);
+            if (!diff)
+                continue;
+            const unsigned on = unsigned(src1[i]) | (unsigned(src1[i + 1]) << 8);
+            const __m128i changed = sse2_expand_bits(diff, select);
+            const __m128i set = sse2_expand_bits(on, select);
+            __m128i* p = reinterpret_cast<__m128i*>(&dest[i * 8]);
+            const __m128i colors = _mm_or_si128(_mm_and_si128(set, fores),
+                                                _mm_andnot_si128(set, backs));
+            _mm_storeu_si128(p, _mm_or_si128(
+                _mm_and_si128(changed, colors),
+                _mm_andnot_si128(changed, _mm_loadu_si128(p))));
+        }
+#endif
+        for (; i < before.stride(); ++i) {
+            const XbmImage::value_type diff = src0[i] ^ src1[i];
+            if (!diff)
+                continue;
+            for (coord_t k = 0; k < 8; ++k) {
+                if ((diff >> k) & 1)
+                    dest[i * 8 + k] = ((src1[i] >> k) & 1) ? fore : back;
+            }
+        }
+    }
+}
+
+inline void
+TextCanvas::morph(const MorphElement& elem,
+                  void (XbmImage::*op)(const MorphElement&))
+{
+    if (width() <= 0 || height() <= 0)
+        return;
+    XbmImage mask(width(), height());
+    get_mask(mask, fore_color());
+    XbmImage result(mask);
+    (result.*op)(elem);
+    put_mask_change(mask, result);
+}
+inline void
+TextCanvas::dilate(const MorphElement& elem)
+{
+    morph(elem, &XbmImage::dilate);
+}
+inline void
+TextCanvas::erode(const MorphElement& elem)
+{
+    morph(elem, &XbmImage::erode);
+}
+inline void
+TextCanvas::open(const MorphElement& elem)
+{
+    morph(elem, &XbmImage::open);
+}
+inline void
+TextCanvas::close(const MorphElement& elem)
+{
+    morph(elem, &XbmImage::close);
+}
+
+inline void
+TextCanvas::line_to(coord_t x, coord_t y)
+{
+    line(pos().x, pos().y, x, y);
+}
+inline void
+TextCanvas::line_to(const Point& p)
+{
+    line(pos(), p);
+}
+template<typename T_PUTTER>
+inline void
+TextCanvas::line_to(coord_t x, coord_t y, T_PUTTER& putter)
+{
+    line(pos().x, pos().y, x, y, putter);
+}
+template<typename T_PUTTER>
+inline void
+TextCanvas::line_to(const Point& p, T_PUTTER& putter)
+{
+    line_to(p.x, p.y, putter);
+}
+
+inline void
+TextCanvas::line(coord_t x0, coord_t y0, coord_t x1, coord_t y1)
+{
+    switch (clip_box(x0, y0, x1, y1)) {
+    case BOX_OUTSIDE:
+        move_to(x1, y1);
+        break;
+    case BOX_INSIDE:
+        {
+            UncheckedPutter putter(*this);
+            line(x0, y0, x1, y1, putter);
+        }
+        break;
+    default:
+        {
+            SimplePutter putter(*this);
+            line(x0, y0, x1, y1, putter);
+        }
+        break;
+    }
+}
+inline void
+TextCanvas::line(const Point& p0, const Point& p1)
+{
+    line(p0.x, p0.y, p1.x, p1.y);
+}
+template<typename T_PUTTER>
+inline void
+TextCanvas::line(coord_t x0,
+                 coord_t y0,
+                 coord_t x1,
+                 coord_t y1,
+                 T_PUTTER& putter)
+{
+    // Bresenham's line algorithm
+    const coord_t dx = std::abs(x1 - x0), dy = std::abs(y1 - y0);
+    const coord_t sx = (x0 < x1) ? 1 : -1, sy = (y0 < y1) ? 1 : -1;
+    coord_t err = dx - dy;
+    for (;;) {
+        putter(x0, y0);
+        if (x0 == x1 && y0 == y1)
+            break;
+
+        coord_t e2 = err * 2;
+        if (e2 > -dy) {
+            err -= dy;
+            x0 += sx;
+        }
+        if (e2 < dx) {
+            err += dx;
+            y0 += sy;
+        }
+    }
+
+    move_to(x1, y1);
+}
+
+inline void
+TextCanvas::rectangle(coord_t x0, coord_t y0, coord_t x1, coord_t y1)
+{
+    switch (clip_box(x0, y0, x1, y1)) {
+    case BOX_OUTSIDE:
+        move_to(x1, y1);
+        break;
+    case BOX_INSIDE:
+        {
+            UncheckedPutter putter(*this);
+            rectangle(x0, y0, x1, y1, putter);
+        }
+        break;
+    default:
+        {
+            SimplePutter putter(*this);
+            rectangle(x0, y0, x1, y1, putter);
+        }
+        break;
+    }
+}
+inline void
+TextCanvas::rectangle(const Point& p0, const Point& p1)
+{
+    rectangle(p0.x, p0.y, p1.x, p1.y);
+}
+template<typename T_PUTTER>
+inline void
+TextCanvas::rectangle(coord_t x0,
+                      coord_t y0,
+                      coord_t x1,
+                      coord_t y1,
+                      T_PUTTER& putter)
+{
+    line(x0, y0, x1, y0, putter);
+    line(x1, y0, x1, y1, putter);
+    line(x1, y1, x0, y1, putter);
+    line(x0, y1, x0, y0, putter);
+
+    move_to(x1, y1);
+}
+
+inline void
+TextCanvas::fill_rectangle(coord_t x0, coord_t y0, coord_t x1, coord_t y1)
+{
+    switch (clip_box(x0, y0, x1, y1)) {
+    case BOX_OUTSIDE:
+        move_to(x1, y1);
+        break;
+    case BOX_INSIDE:
+        {
+            UncheckedPutter putter(*this);
+            fill_rectangle(x0, y0, x1, y1, putter);
+        }
+        break;
+    default:
+        {
+            SimplePutter putter(*this);
+            fill_rectangle(x0, y0, x1, y1, putter);
+        }
+        break;
+    }
+}
+inline void
+TextCanvas::fill_rectangle(const Point& p0, const Point& p1)
+{
+    fill_rectangle(p0.x, p0.y, p1.x, p1.y);
+}
+template<typename T_PUTTER>
+inline void
+TextCanvas::fill_rectangle(coord_t x0,
+                           coord_t y0,
+                           coord_t x1,
+                           coord_t y1,
+                           T_PUTTER& putter)
+{
+    const coord_t x2 = x1, y2 = y1;
+    if (x0 > x1)
+        std::swap(x0, x1);
+    if (y0 > y1)
+        std::swap(y0, y1);
+    if (x0 < 0)
+        x0 = 0;
+    if (x1 > width())
+        x1 = width() - 1;
+    if (y0 < 0)
+        y0 = 0;
+    if (y1 > height())
+        y1 = height() - 1;
+    for (coord_t y = y0; y <= y1; ++y) {
+        put_span(putter, y, x0, x1);
+    }
+
+    move_to(x2, y2);
+}
+
+inline void
+TextCanvas::circle(coord_t x0, coord_t y0, coord_t r)
+{
+    switch (clip_box(x0 - r, y0 - r, x0 + r, y0 + r)) {
+    case BOX_OUTSIDE:
+        move_to(x0, y0);
+        break;
+    case BOX_INSIDE:
+        {
+            UncheckedPutter putter(*this);
+            circle(x0, y0, r, putter);
+        }
+        break;
+    default:
+        {
+            SimplePutter putter(*this);
+            circle(x0, y0, r, putter);
+        }
+        break;
+    }
+}
+inline void
+TextCanvas::circle(const Point& c, coord_t r)
+{
+    circle(c.x, c.y, r);
+}
+template<typename T_PUTTER>
+inline void
+TextCanvas::circle(coord_t x0, coord_t y0, coord_t r, T_PUTTER& putter)
+{
+    coord_t x = r, y = 0;
+    coord_t f = 3 - 2 * x;
+
+    while (x >= y) {
+        putter(x0 + x, y0 + y);
+        putter(x0 - x, y0 + y);
+        putter(x0 + x, y0 - y);
+        putter(x0 - x, y0 - y);
+        putter(x0 + y, y0 + x);
+        putter(x0 - y, y0 + x);
+        putter(x0 + y, y0 - x);
+        putter(x0 - y, y0 - x);
+        if (f >= 0) {
+            --x;
+            f -= 4 * x;
+        }
+        ++y;
+        f += 4 * y + 2;
+    }
+
+    move_to(x0, y0);
+}
+
+inline void
+TextCanvas::fill_circle(coord_t x0, coord_t y0, coord_t r)
+{
+    switch (clip_box(x0 - r, y0 - r, x0 + r, y0 + r)) {
+    case BOX_OUTSIDE:
+        move_to(x0, y0);
+        break;
+    case BOX_INSIDE:
+        {
+            UncheckedPutter putter(*this);
+            fill_circle(x0, y0, r, putter);
+        }
+        break;
+    default:
+        {
+            SimplePutter putter(*this);
+            fill_circle(x0, y0, r, putter);
+        }
+        break;
+    }
+}
+inline void
+TextCanvas::fill_circle(const Point& c, coord_t r)
+{
+    fill_circle(c.x, c.y, r);
+}
+template<typename T_PUTTER>
+inline void
+TextCanvas::fill_circle(coord_t x0, coord_t y0, coord_t r, T_PUTTER& putter)
+{
+    if (r < 0) {
+        move_to(x0, y0);
+        return;
+    }
+
+    // the half width of each row from the octant walk
+    std::vector<coord_t> widths(r + 1, -1);
+    coord_t x = r, y = 0;
+    coord_t f = 3 - 2 * x;
+
+    while (x >= y) {
+        widths[y] = std::max(widths[y], x);
+        widths[x] = std::max(widths[x], y);
+        if (f >= 0) {
+            --x;
+            f -= 4 * x;
+        }
+        ++y;
+        f += 4 * y + 2;
+    }
+
+    // one span a row
+    for (coord_t j = -r; j <= r; ++j) {
+        coord_t w = widths[j < 0 ? -j : j];
+        put_span(putter, y0 + j, x0 - w, x0 + w);
+    }
+
+    move_to(x0, y0);
+}
+
+template<typename T_PUTTER>
+inline void
+TextCanvas::ellipse(coord_t x0,
+                    coord_t y0,
+                    coord_t x1,
+                    coord_t y1,
+                    T_PUTTER& putter)
+{
+    if (x0 > x1)
+        std::swap(x0, x1);
+    if (y0 > y1)
+        std::swap(y0, y1);
+
+    coord_t dx = x1 - x0, dy = y1 - y0;
+    if (dx <= 1 || dy <= 1) {
+        for (coord_t y = y0; y <= y1; ++y) {
+            for (coord_t x = x0; x <= x1; ++x) {
+                putter(x, y);
+            }
+        }
+
+        move_to(ellipse_center(x0, y0, x1, y1));
+        return;
+    }
+
+    EllipseEdges<T_PUTTER> edges(putter);
+    ellipse_spans(x0, y0, dx, dy, edges);
+
+    move_to(ellipse_center(x0, y0, x1, y1));
+}
+template<typename T_PUTTER>
+inline void
+TextCanvas::fill_ellipse(coord_t x0,
+                         coord_t y0,
+                         coord_t x1,
+                         coord_t y1,
+                         T_PUTTER& putter)
+{
+    if (x0 > x1)
+        std::swap(x0, x1);
+    if (y0 > y1)
+        std::swap(y0, y1);
+
+    coord_t dx = x1 - x0, dy = y1 - y0;
+    if (dx <= 1 || dy <= 1) {
+        for (coord_t y = y0; y <= y1; ++y) {
+            for (coord_t x = x0; x <= x1; ++x) {
+                putter(x, y);
+            }
+        }
+
+        move_to(ellipse_center(x0, y0, x1, y1));
+        return;
+    }
+
+    // the widest span of each row, then one span a row
+    RowExtents extents(x0, y0, x1, y1);
+    ellipse_spans(x0, y0, dx, dy, extents);
+
+    for (coord_t y = 0; y <= dy; ++y) {
+        put_span(putter, y0 + y, extents.lefts[y], extents.rights[y]);
+    }
+
+    move_to(ellipse_center(x0, y0, x1, y1));
+}
+
+inline void
+TextCanvas::ellipse(coord_t x0, coord_t y0, coord_t x1, coord_t y1)
+{
+    switch (clip_box(x0, y0, x1, y1)) {
+    case BOX_OUTSIDE:
+        move_to(ellipse_center(x0, y0, x1, y1));
+        break;
+    case BOX_INSIDE:
+        {
+            UncheckedPutter putter(*this);
+            ellipse(x0, y0, x1, y1, putter);
+        }
+        break;
+    default:
+        {
+            SimplePutter putter(*this);
+            ellipse(x0, y0, x1, y1, putter);
+        }
+        break;
+    }
+}
+inline void
+TextCanvas::fill_ellipse(coord_t x0, coord_t y0, coord_t x1, coord_t y1)
+{
+    switch (clip_box(x0, y0, x1, y1)) {
+    case BOX_OUTSIDE:
+        move_to(ellipse_center(x0, y0, x1, y1));
+        break;
+    case BOX_INSIDE:
+        {
+            UncheckedPutter putter(*this);
+            fill_ellipse(x0, y0, x1, y1, putter);
+        }
+        break;
+    default:
+        {
+            SimplePutter putter(*this);
+            fill_ellipse(x0, y0, x1, y1, putter);
+        }
+        break;
+    }
+}
+
+template<typename T_PUTTER>
+inline void
+TextCanvas::arc(coord_t x0,
+                coord_t y0,
+                coord_t x1,
+                coord_t y1,
+                double start_radian,
+                double end_radian,
+                bool clockwise,
+                T_PUTTER& putter)
+{
+    bool whole_range = fabs(end_radian - start_radian) >= 2 * pi;
+    start_radian = normalize_radian(start_radian);
+    end_radian = normalize_radian(end_radian);
+    if (start_radian > end_radian) {
+        std::swap(start_radian, end_radian);
+        clockwise = !clockwise;
+    }
+
+    if (x0 > x1)
+        std::swap(x0, x1);
+    if (y0 > y1)
+        std::swap(y0, y1);
+
+    coord_t dx = x1 - x0, dy = y1 - y0;
+    double u = dx * 0.5, v = dy * 0.5;
+    coord_t u0 = coord_t(u), v0 = coord_t(v);
+    double px = x0 + u, py = y0 + v;
+
+    struct PUTTER
+    {
+        T_PUTTER& putter;
+        double px, py, u, v;
+        double start_radian, end_radian;
+        bool clockwise, whole_range;
+        PUTTER(T_PUTTER& putter_,
+               double px_,
+               double py_,
+               double u_,
+               double v_,
+               double start_radian_,
+               double end_radian_,
+               bool clockwise_,
+               bool whole_range_)
+          : putter(putter_)
+          , px(px_)
+          , py(py_)
+          , u(u_)
+          , v(v_)
+          , start_radian(start_radian_)
+          , end_radian(end_radian_)
+          , clockwise(clockwise_)
+          , whole_range(whole_range_)
+        {}
+        bool check(double& at, coord_t x, coord_t y) const
+        {
+            at = atan2(-u * (y - py), v * (x - px));
+            return whole_range ||
+                   check_range(at, clockwise, start_radian, end_radian);
+        }
+        void operator()(coord_t x, coord_t y)
+        {
+            double at;
+            if (check(at, x, y)) {
+                putter(x, y);
+            }
+        }
+    } another_putter(
+      putter, px, py, u, v, start_radian, end_radian, clockwise, whole_range);
+    ellipse(x0, y0, x1, y1, another_putter);
+}
+inline void
+TextCanvas::arc(coord_t x0,
+                coord_t y0,
+                coord_t x1,
+                coord_t y1,
+                double start_radian,
+                double end_radian,
+                bool clockwise)
+{
+    switch (clip_box(x0, y0, x1, y1)) {
+    case BOX_OUTSIDE:
+        move_to(ellipse_center(x0, y0, x1, y1));
+        break;
+    case BOX_INSIDE:
+        {
+            UncheckedPutter putter(*this);
+            arc(x0, y0, x1, y1, start_radian, end_radian, clockwise, putter);
+        }
+        break;
+    default:
+        {
+            SimplePutter putter(*this);
+            arc(x0, y0, x1, y1, start_radian, end_radian, clockwise, putter);
+        }
+        break;
+    }
+}
+
+template<typename T_PUTTER>
+inline void
+TextCanvas::arc_to(coord_t x0,
+                   coord_t y0,
+                   coord_t x1,
+                   coord_t y1,
+                   double start_radian,
+                   double end_radian,
+                   bool clockwise,
+                   T_PUTTER& putter)
+{
+    Point old_pos = pos();
+
+    bool whole_range = fabs(end_radian - start_radian) >= 2 * pi;
+    start_radian = normalize_radian(start_radian);
+    end_radian = normalize_radian(end_radian);
+    if (start_radian > end_radian) {
+        std::swap(start_radian, end_radian);
+        clockwise = !clockwise;
+    }
+
+    if (x0 > x1)
+        std::swap(x0, x1);
+    if (y0 > y1)
+        std::swap(y0, y1);
+
+    coord_t dx = x1 - x0, dy = y1 - y0;
+    double u = dx * 0.5, v = dy * 0.5;
+    coord_t u0 = coord_t(u), v0 = coord_t(v);
+    double px = x0 + u, py = y0 + v;
+
+    struct PUTTER
+    {
+        T_PUTTER& putter;
+        double px, py, u, v;
+        double start_radian, end_radian;
+        bool clockwise, whole_range;
+        double q_radian, qx, qy;
+        double r_radian, rx, ry;
+        PUTTER(T_PUTTER& putter_,
+               double px_,
+               double py_,
+               double u_,
+               double v_,
+               double start_radian_,
+               double end_radian_,
+               bool clockwise_,
+               bool whole_range_,
+               double q_radian_,
+               double qx_,
+               double qy_,
+               double r_radian_,
+               double rx_,
+               double ry_)
+          : putter(putter_)
+          , px(px_)
+          , py(py_)
+          , u(u_)
+          , v(v_)
+          , start_radian(start_radian_)
+          , end_radian(end_radian_)
+          , clockwise(clockwise_)
+          , whole_range(whole_range_)
+          , q_radian(q_radian_)
+          , qx(qx_)
+          , qy(qy_)
+          , r_radian(r_radian_)
+          , rx(rx_)
+          , ry(ry_)
+        {}
+        bool check(double& at, coord_t x, coord_t y) const
+        {
+            at = atan2(-u * (y - py), v * (x - px));
+            return whole_range ||
+                   check_range(at, clockwise, start_radian, end_radian);
+        }
+        void operator()(coord_t x, coord_t y)
+        {
+            double at;
+            if (check(at, x, y)) {
+                putter(x, y);
+                update(at, x, y);
+            }
+        }
+        void update(double at, coord_t x, coord_t y)
+        {
+            if (fabs(at - start_radian) < fabs(q_radian - start_radian)) {
+                q_radian = at;
+                qx = double(x);
+                qy = double(y);
+            }
+            if (fabs(at - end_radian) < fabs(r_radian - end_radian)) {
+                r_radian = at;
+                rx = double(x);
+                ry = double(y);
+            }
+        }
+    } another_putter(putter,
+                     px,
+                     py,
+                     u,
+                     v,
+                     start_radian,
+                     end_radian,
+                     clockwise,
+                     whole_range,
+                     100,
+                     px,
+                     py,
+                     -100,
+                     px,
+                     py);
+    ellipse(x0, y0, x1, y1, another_putter);
+    line(old_pos.x,
+         old_pos.y,
+         do_round(another_putter.qx),
+         do_round(another_putter.qy),
+         putter);
+}
+inline void
+TextCanvas::arc_to(coord_t x0,
+                   coord_t y0,
+                   coord_t x1,
+                   coord_t y1,
+                   double start_radian,
+                   double end_radian,
+                   bool clockwise)
+{
+    SimplePutter putter(*this);
+    arc_to(x0, y0, x1, y1, start_radian, end_radian, clockwise, putter);
+}
+
+template<typename T_PUTTER>
+inline void
+TextCanvas::pie(coord_t x0,
+                coord_t y0,
+                coord_t x1,
+                coord_t y1,
+                double start_radian,
+                double end_radian,
+                T_PUTTER& putter)
+{
+    bool clockwise = false;
+    bool whole_range = fabs(end_radian - start_radian) >= 2 * pi;
+    start_radian = normalize_radian(start_radian);
+    end_radian = normalize_radian(end_radian);
+    if (start_radian > end_radian) {
+        std::swap(start_radian, end_radian);
+        clockwise = !clockwise;
+    }
+
+    if (x0 > x1)
+        std::swap(x0, x1);
+    if (y0 > y1)
+        std::swap(y0, y1);
+
+    coord_t dx = x1 - x0, dy = y1 - y0;
+    double u = dx * 0.5, v = dy * 0.5;
+    coord_t u0 = coord_t(u), v0 = coord_t(v);
+    double px = x0 + u, py = y0 + v;
+
+    struct PUTTER
+    {
+        T_PUTTER& putter;
+        double px, py, u, v;
+        double start_radian, end_radian;
+        bool clockwise, whole_range;
+        double q_radian, qx, qy;
+        double r_radian, rx, ry;
+        PUTTER(T_PUTTER& putter_,
+               double px_,
+               double py_,
+               double u_,
+               double v_,
+               double start_radian_,
+               double end_radian_,
+               bool clockwise_,
+               bool whole_range_,
+               double q_radian_,
+               double qx_,
+               double qy_,
+               double r_radian_,
+               double rx_,
+               double ry_)
+          : putter(putter_)
+          , px(px_)
+          , py(py_)
+          , u(u_)
+          , v(v_)
+          , start_radian(start_radian_)
+          , end_radian(end_radian_)
+          , clockwise(clockwise_)
+          , whole_range(whole_range_)
+          , q_radian(q_radian_)
+          , qx(qx_)
+          , qy(qy_)
+          , r_radian(r_radian_)
+          , rx(rx_)
+          , ry(ry_)
+        {}
+        bool check(double& at, coord_t x, coord_t y) const
+        {
+            at = atan2(-u * (y - py), v * (x - px));
+            return whole_range ||
+                   check_range(at, clockwise, start_radian, end_radian);
+        }
+        void operator()(coord_t x, coord_t y)
+        {
+            double at;
+            if (check(at, x, y)) {
+                putter(x, y);
+                update(at, x, y);
+            }
+        }
+        void update(double at, coord_t x, coord_t y)
+        {
+            if (fabs(at - start_radian) < fabs(q_radian - start_radian)) {
+                q_radian = at;
+                qx = double(x);
+                qy = double(y);
+            }
+            if (fabs(at - end_radian) < fabs(r_radian - end_radian)) {
+                r_radian = at;
+                rx = double(x);
+                ry = double(y);
+            }
+        }
+    } another_putter(putter,
+                     px,
+                     py,
+                     u,
+                     v,
+                     start_radian,
+                     end_radian,
+                     clockwise,
+                     whole_range,
+                     100,
+                     px,
+                     py,
+                     -100,
+                     px,
+                     py);
+    ellipse(x0, y0, x1, y1, another_putter);
+
+    line(coord_t(px),
+         coord_t(py),
+         do_round(another_putter.qx),
+         do_round(another_putter.qy),
+         putter);
+    line(coord_t(px),
+         coord_t(py),
+         do_round(another_putter.rx),
+         do_round(another_putter.ry),
+         putter);
+}
+
+inline void
+TextCanvas::pie(coord_t x0,
+                coord_t y0,
+                coord_t x1,
+                coord_t y1,
+                double start_radian,
+                double end_radian)
+{
+    SimplePutter putter(*this);
+    pie(x0, y0, x1, y1, start_radian, end_radian, putter);
+}
+
+template<typename T_PUTTER>
+inline void
+TextCanvas::fill_pie(coord_t x0,
+                     coord_t y0,
+                     coord_t x1,
+                     coord_t y1,
+                     double start_radian,
+                     double end_radian,
+                     bool clockwise,
+                     T_PUTTER& putter)
+{
+    bool whole_range = fabs(end_radian - start_radian) >= 2 * pi;
+    start_radian = normalize_radian(start_radian);
+    end_radian = normalize_radian(end_radian);
+    if (start_radian > end_radian) {
+        std::swap(start_radian, end_radian);
+        clockwise = !clockwise;
+    }
+
+    if (x0 > x1)
+        std::swap(x0, x1);
+    if (y0 > y1)
+        std::swap(y0, y1);
+
+    coord_t dx = x1 - x0, dy = y1 - y0;
+    double u = dx * 0.5, v = dy * 0.5;
+    coord_t u0 = coord_t(u), v0 = coord_t(v);
+    double px = x0 + u, py = y0 + v;
+
+    struct PUTTER
+    {
+        T_PUTTER& putter;
+        double px, py, u, v;
+        double start_radian, end_radian;
+        bool clockwise, whole_range;
+        PUTTER(T_PUTTER& putter_,
+               double px_,
+               double py_,
+               double u_,
+               double v_,
+               double start_radian_,
+               double end_radian_,
+               bool clockwise_,
+               bool whole_range_)
+          : putter(putter_)
+          , px(px_)
+          , py(py_)
+          , u(u_)
+          , v(v_)
+          , start_radian(start_radian_)
+          , end_radian(end_radian_)
+          , clockwise(clockwise_)
+          , whole_range(whole_range_)
+        {}
+        bool check(double& at, coord_t x, coord_t y) const
+        {
+            at = atan2(-u * (y - py), v * (x - px));
+            return whole_range ||
+                   check_range(at, clockwise, start_radian, end_radian);
+        }
+        void operator()(coord_t x, coord_t y)
+        {
+            double at;
+            if (check(at, x, y)) {
+                putter(x, y);
+            }
+        }
+    } another_putter(
+      putter, px, py, u, v, start_radian, end_radian, clockwise, whole_range);
+    fill_ellipse(x0, y0, x1, y1, another_putter);
+    putter(coord_t(px), coord_t(py));
+}
+inline void
+TextCanvas::fill_pie(coord_t x0,
+                     coord_t y0,
+                     coord_t x1,
+                     coord_t y1,
+                     double start_radian,
+                     double end_radian,
+                     bool clockwise)
+{
+    SimplePutter putter(*this);
+    fill_pie(x0, y0, x1, y1, start_radian, end_radian, clockwise, putter);
+}
+
+inline void
+TextCanvas::ellipse(const Point& p0, const Point& p1)
+{
+    ellipse(p0.x, p0.y, p1.x, p1.y);
+}
+inline void
+TextCanvas::fill_ellipse(const Point& p0, const Point& p1)
+{
+    fill_ellipse(p0.x, p0.y, p1.x, p1.y);
+}
+inline void
+TextCanvas::arc(const Point& p0,
+                const Point& p1,
+                double start_radian,
+                double end_radian,
+                bool clockwise)
+{
+    arc(p0.x, p0.y, p1.x, p1.y, start_radian, end_radian, clockwise);
+}
+inline void
+TextCanvas::arc_to(const Point& p0,
+                   const Point& p1,
+                   double start_radian,
+                   double end_radian,
+                   bool clockwise)
+{
+    arc_to(p0.x, p0.y, p1.x, p1.y, start_radian, end_radian, clockwise);
+}
+inline void
+TextCanvas::pie(const Point& p0,
+                const Point& p1,
+                double start_radian,
+                double end_radian)
+{
+    pie(p0.x, p0.y, p1.x, p1.y, start_radian, end_radian);
+}
+inline void
+TextCanvas::fill_pie(const Point& p0,
+                     const Point& p1,
+                     double start_radian,
+                     double end_radian,
+                     bool clockwise)
+{
+    fill_pie(p0.x, p0.y, p1.x, p1.y, start_radian, end_radian, clockwise);
+}
+
+template<typename T_PUTTER>
+inline void
+TextCanvas::round_rect(coord_t x0,
+                       coord_t y0,
+                       coord_t x1,
+                       coord_t y1,
+                       coord_t rx,
+                       coord_t ry,
+                       T_PUTTER& putter)
+{
+    Point old_pos = pos();
+
+    if (x0 > x1)
+        std::swap(x0, x1);
+    if (y0 > y1)
+        std::swap(y0, y1);
+
+    coord_t dx = x1 - x0, dy = y1 - y0;
+    if (rx < 0)
+        rx = 0;
+    if (ry < 0)
+        ry = 0;
+    if (dx <= 2 * rx)
+        rx = dx / 2;
+    if (dy <= 2 * ry)
+        ry = dy / 2;
+
+    // one quarter ellipse, mirrored to the four corners
+    std::vector<coord_t> widths;
+    quarter_ellipse_widths(widths, rx, ry);
+
+    const coord_t cx0 = x0 + rx, cx1 = x1 - rx;
+    for (coord_t y = y0; y <= y1; ++y) {
+        coord_t j = 0;
+        if (y < y0 + ry)
+            j = y0 + ry - y;
+        else if (y > y1 - ry)
+            j = y - (y1 - ry);
+
+        // the cells between this row and the next row to the center. the
+        // next row to the edge bridges to this row in the same way.
+        coord_t inner = widths[j];
+        if (j > 0)
+            inner = std::max(inner, widths[j - 1] - 1);
+        coord_t left1 = cx0 - widths[j], right0 = cx1 + widths[j];
+        coord_t left0 = cx0 - inner, right1 = cx1 + inner;
+
+        // the top and bottom edges, with their bridges
+        if (y == y0 || y == y1 || left1 >= right0 - 1) {
+            put_span(putter, y, left0, right1);
+            continue;
+        }
+        put_span(putter, y, left0, left1);
+        put_span(putter, y, std::max(right0, left1 + 1), right1);
+    }
+
+    pos() = old_pos;
+}
+inline void
+TextCanvas::round_rect(coord_t x0,
+                       coord_t y0,
+                       coord_t x1,
+                       coord_t y1,
+                       coord_t rx,
+                       coord_t ry)
+{
+    SimplePutter putter(*this);
+    round_rect(x0, y0, x1, y1, rx, ry, putter);
+}
+inline void
+TextCanvas::round_rect(const Point& p0, const Point& p1, coord_t rx, coord_t ry)
+{
+    round_rect(p0.x, p0.y, p1.x, p1.y, rx, ry);
+}
+
+template<typename T_PUTTER>
+inline void
+TextCanvas::fill_round_rect(coord_t x0,
+                            coord_t y0,
+                            coord_t x1,
+                            coord_t y1,
+                            coord_t rx,
+                            coord_t ry,
+                            T_PUTTER& putter)
+{
+    Point old_pos = pos();
+
+    if (x0 > x1)
+        std::swap(x0, x1);
+    if (y0 > y1)
+        std::swap(y0, y1);
+
+    coord_t dx = x1 - x0, dy = y1 - y0;
+    if (rx < 0)
+        rx = 0;
+    if (ry < 0)
+        ry = 0;
+    if (dx <= 2 * rx)
+        rx = dx / 2;
+    if (dy <= 2 * ry)
+        ry = dy / 2;
+
+    // one quarter ellipse, mirrored to the four corners. one span a row.
+    std::vector<coord_t> widths;
+    quarter_ellipse_widths(widths, rx, ry);
+
+    const coord_t cx0 = x0 + rx, cx1 = x1 - rx;
+    for (coord_t y = y0; y <= y1; ++y) {
+        coord_t j = 0;
+        if (y < y0 + ry)
+            j = y0 + ry - y;
+        else if (y > y1 - ry)
+            j = y - (y1 - ry);
+        put_span(putter, y, cx0 - widths[j], cx1 + widths[j]);
+    }
+
+    pos() = old_pos;
+}
+inline void
+TextCanvas::fill_round_rect(coord_t x0,
+                            coord_t y0,
+                            coord_t x1,
+                            coord_t y1,
+                            coord_t rx,
+                            coord_t ry)
+{
+    SimplePutter putter(*this);
+    fill_round_rect(x0, y0, x1, y1, rx, ry, putter);
+}
+inline void
+TextCanvas::fill_round_rect(const Point& p0,
+                            const Point& p1,
+                            coord_t rx,
+                            coord_t ry)
+{
+    fill_round_rect(p0.x, p0.y, p1.x, p1.y, rx, ry);
+}
+
+inline void
+TextCanvas::lines(size_t num_points, const Point* points)
+{
+    for (size_t i = 0; i < num_points / 2; ++i) {
+        line(points[2 * i], points[2 * i + 1]);
+    }
+}
+inline void
+TextCanvas::lines(const Points& points)
+{
+    lines(points.size(), &points[0]);
+}
+template<typename T_PUTTER>
+inline void
+TextCanvas::lines(size_t num_points, const Point* points, T_PUTTER& putter)
+{
+    for (size_t i = 0; i < num_points / 2; ++i) {
+        line(points[2 * i], points[2 * i + 1], putter);
+    }
+}
+
+inline void
+TextCanvas::polyline(size_t num_points, const Point* points)
+{
+    if (num_points > 0) {
+        move_to(points[0]);
+        for (size_t i = 1; i < num_points; ++i) {
+            line_to(points[i]);
+        }
+    }
+}
+inline void
+TextCanvas::polyline(const Points& points)
+{
+    polyline(points.size(), &points[0]);
+}
+template<typename T_PUTTER>
+inline void
+TextCanvas::polyline(size_t num_points, const Point* points, T_PUTTER& putter)
+{
+    if (num_points > 0) {
+        move_to(points[0]);
+        for (size_t i = 1; i < num_points; ++i) {
+            line_to(points[i], putter);
+        }
+    }
+}
+
+inline void
+TextCanvas::polygon(size_t num_points, const Point* points)
+{
+    Point p0, p1;
+    if (!get_polygon_box(p0, p1, num_points, points))
+        return;
+    switch (clip_box(p0.x, p0.y, p1.x, p1.y)) {
+    case BOX_OUTSIDE:
+        move_to(points[0]);
+        break;
+    case BOX_INSIDE:
+        {
+            UncheckedPutter putter(*this);
+            polygon(num_points, points, putter);
+        }
+        break;
+    default:
+        {
+            SimplePutter putter(*this);
+            polygon(num_points, points, putter);
+        }
+        break;
+    }
+}
+inline void
+TextCanvas::polygon(const Points& points)
+{
+    polygon(points.size(), &points[0]);
+}
+template<typename T_PUTTER>
+inline void
+TextCanvas::polygon(size_t num_points, const Point* points, T_PUTTER& putter)
+{
+    if (num_points > 0) {
+        move_to(points[0]);
+        for (size_t i = 1; i < num_points; ++i) {
+            line_to(points[i], putter);
+        }
+        line_to(points[0], putter);
+    }
+}
+
+template<typename T_PUTTER>
+inline void
+TextCanvas::fill_polygon_alternate(const Points& points, T_PUTTER& putter)
+{
+    fill_polygon_alternate(points.size(), &points[0], putter);
+}
+template<typename T_PUTTER>
+inline void
+TextCanvas::fill_polygon_winding(const Points& points, T_PUTTER& putter)
+{
+    fill_polygon_winding(points.size(), &points[0], putter);
+}
+
+template<typename T_PUTTER>
+inline void
+TextCanvas::fill_polygon_alternate(size_t num_points,
+                                   const Point* points,
+                                   T_PUTTER& putter)
+{
+    Point p0, p1;
+    if (get_polygon_box(p0, p1, num_points, points)) {
+        Points new_points(&points[0], &points[num_points]);
+        new_points.push_back(points[0]);
+
+        for (coord_t y = p0.y; y <= p1.y; ++y) {
+            for (coord_t x = p0.x; x <= p1.x; ++x) {
+                if (crossing_number(Point(x, y), new_points) & 1) {
+                    putter(x, y);
+                }
+            }
+        }
+        polyline(num_points + 1, &new_points[0], putter);
+    }
+}
+template<typename T_PUTTER>
+inline void
+TextCanvas::fill_polygon_winding(size_t num_points,
+                                 const Point* points,
+                                 T_PUTTER& putter)
+{
+    Point p0, p1;
+    if (get_polygon_box(p0, p1, num_points, points)) {
+        Points new_points(&points[0], &points[num_points]);
+        new_points.push_back(points[0]);
+
+        for (coord_t y = p0.y; y <= p1.y; ++y) {
+            for (coord_t x = p0.x; x <= p1.x; ++x) {
+                if (winding_number(Point(x, y), new_points)) {
+                    putter(x, y);
+                }
+            }
+        }
+        polyline(num_points + 1, &new_points[0], putter);
+    }
+}
+
+inline void
+TextCanvas::fill_polygon(size_t num_points, const Point* points, bool alternate)
+{
+    Point p0, p1;
+    if (!get_polygon_box(p0, p1, num_points, points))
+        return;
+    switch (clip_box(p0.x, p0.y, p1.x, p1.y)) {
+    case BOX_OUTSIDE:
+        move_to(points[0]);
+        break;
+    case BOX_INSIDE:
+        {
+            UncheckedPutter putter(*this);
+            fill_polygon(num_points, points, alternate, putter);
+        }
+        break;
+    default:
+        {
+            SimplePutter putter(*this);
+            fill_polygon(num_points, points, alternate, putter);
+        }
+        break;
+    }
+}
+inline void
+TextCanvas::fill_polygon(const Points& points, bool alternate)
+{
+    fill_polygon(points.size(), &points[0], alternate);
+}
+template<typename T_PUTTER>
+inline void
+TextCanvas::fill_polygon(size_t num_points,
+                         const Point* points,
+                         bool alternate,
+                         T_PUTTER& putter)
+{
+    if (alternate)
+        fill_polygon_alternate(num_points, points, putter);
+    else
+        fill_polygon_winding(num_points, points, putter);
+}
+
+inline void
+TextCanvas::stroke_path(SpanBuffer& spans,
+                        size_t num_points,
+                        const Point* points,
+                        bool closed,
+                        const StrokeStyle& style)
+{
+    // without the repeated points
+    Points path;
+    for (size_t i = 0; i < num_points; ++i) {
+        if (path.empty() || path.back() != points[i])
+            path.push_back(points[i]);
+    }
+    if (path.size() > 1 && path.back() == path.front())
+        path.pop_back();
+    const size_t n = path.size();
+    if (n == 0)
+        return;
+    if (n < 3)
+        closed = false;
+
+    // the center line keeps the thin strokes connected
+    spans(path[0].x, path[0].y);
+    for (size_t i = 0; i + 1 < n; ++i) {
+        line(path[i].x, path[i].y, path[i + 1].x, path[i + 1].y, spans);
+    }
+    if (closed)
+        line(path[n - 1].x, path[n - 1].y, path[0].x, path[0].y, spans);
+
+    if (style.width <= 1)
+        return;
+
+    const double h = style.width / 2.0;
+    for (size_t i = 0; i + 1 < n; ++i) {
+        stroke_segment(spans, path[i], path[i + 1], h);
+    }
+    if (closed) {
+        stroke_segment(spans, path[n - 1], path[0], h);
+        for (size_t i = 0; i < n; ++i) {
+            stroke_join(spans, path[(i + n - 1) % n], path[i],
+                        path[(i + 1) % n], h, style);
+        }
+        return;
+    }
+
+    for (size_t i = 1; i + 1 < n; ++i) {
+        stroke_join(spans, path[i - 1], path[i], path[i + 1], h, style);
+    }
+    if (n == 1) {
+        stroke_cap(spans, path[0], path[0], h, style);
+    } else {
+        stroke_cap(spans, path[1], path[0], h, style);
+        stroke_cap(spans, path[n - 2], path[n - 1], h, style);
+    }
+}
+
+inline void
+TextCanvas::stroke_line(coord_t x0,
+                        coord_t y0,
+                        coord_t x1,
+                        coord_t y1,
+                        const StrokeStyle& style)
+{
+    SimplePutter putter(*this);
+    stroke_line(x0, y0, x1, y1, style, putter);
+}
+template<typename T_PUTTER>
+inline void
+TextCanvas::stroke_line(coord_t x0,
+                        coord_t y0,
+                        coord_t x1,
+                        coord_t y1,
+                        const StrokeStyle& style,
+                        T_PUTTER& putter)
+{
+    const Point points[] = { Point(x0, y0), Point(x1, y1) };
+    SpanBuffer spans(clip_rect());
+    stroke_path(spans, 2, points, false, style);
+    spans.flush(putter);
+
+    move_to(x1, y1);
+}
+
+inline void
+TextCanvas::stroke_polyline(size_t num_points,
+                            const Point* points,
+                            const StrokeStyle& style)
+{
+    SimplePutter putter(*this);
+    stroke_polyline(num_points, points, style, putter);
+}
+inline void
+TextCanvas::stroke_polyline(const Points& points, const StrokeStyle& style)
+{
+    stroke_polyline(points.size(), &points[0], style);
+}
+template<typename T_PUTTER>
+inline void
+TextCanvas::stroke_polyline(const Points& points,
+                            const StrokeStyle& style,
+                            T_PUTTER& putter)
+{
+    stroke_polyline(points.size(), &points[0], style, putter);
+}
+template<typename T_PUTTER>
+inline void
+TextCanvas::stroke_polyline(size_t num_points,
+                            const Point* points,
+                            const StrokeStyle& style,
+                            T_PUTTER& putter)
+{
+    if (num_points > 0) {
+        SpanBuffer spans(clip_rect());
+        stroke_path(spans, num_points, points, false, style);
+        spans.flush(putter);
+
+        move_to(points[num_points - 1]);
+    }
+}
+
+inline void
+TextCanvas::stroke_polygon(size_t num_points,
+                           const Point* points,
+                           const StrokeStyle& style)
+{
+    SimplePutter putter(*this);
+    stroke_polygon(num_points, points, style, putter);
+}
+inline void
+TextCanvas::stroke_polygon(const Points& points, const StrokeStyle& style)
+{
+    stroke_polygon(points.size(), &points[0], style);
+}
+template<typename T_PUTTER>
+inline void
+TextCanvas::stroke_polygon(const Points& points,
+                           const StrokeStyle& style,
+                           T_PUTTER& putter)
+{
+    stroke_polygon(points.size(), &points[0], style, putter);
+}
+template<typename T_PUTTER>
+inline void
+TextCanvas::stroke_polygon(size_t num_points,
+                           const Point* points,
+                           const StrokeStyle& style,
+                           T_PUTTER& putter)
+{
+    if (num_points > 0) {
+        SpanBuffer spans(clip_rect());
+        stroke_path(spans, num_points, points, true, style);
+        spans.flush(putter);
+
+        move_to(points[0]);
+    }
+}
+
+inline void
+TextCanvas::stroke_rectangle(coord_t x0,
+                             coord_t y0,
+                             coord_t x1,
+                             coord_t y1,
+                             const StrokeStyle& style)
+{
+    SimplePutter putter(*this);
+    stroke_rectangle(x0, y0, x1, y1, style, putter);
+}
+template<typename T_PUTTER>
+inline void
+TextCanvas::stroke_rectangle(coord_t x0,
+                             coord_t y0,
+                             coord_t x1,
+                             coord_t y1,
+                             const StrokeStyle& style,
+                             T_PUTTER& putter)
+{
+    const Point points[] = {
+        Point(x0, y0), Point(x1, y0), Point(x1, y1), Point(x0, y1)
+    };
+    SpanBuffer spans(clip_rect());
+    stroke_path(spans, 4, points, true, style);
+    spans.flush(putter);
+
+    move_to(x1, y1);
+}
+
+inline void
+TextCanvas::stroke_circle(coord_t x0,
+                          coord_t y0,
+                          coord_t r,
+                          const StrokeStyle& style)
+{
+    SimplePutter putter(*this);
+    stroke_circle(x0, y0, r, style, putter);
+}
+template<typename T_PUTTER>
+inline void
+TextCanvas::stroke_circle(coord_t x0,
+                          coord_t y0,
+                          coord_t r,
+                          const StrokeStyle& style,
+                          T_PUTTER& putter)
+{
+    SpanBuffer spans(clip_rect());
+    circle(x0, y0, r, spans);
+    if (style.width > 1) {
+        const double h = style.width / 2.0;
+        spans.add_ring(x0, y0, r + h, r + h, r - h, r - h);
+    }
+    spans.flush(putter);
+
+    move_to(x0, y0);
+}
+
+// the stroke of an ellipse is approximated by the ring between the
+// ellipses of the radii plus and minus half the width
+inline void
+TextCanvas::stroke_ellipse(coord_t x0,
+                           coord_t y0,
+                           coord_t x1,
+                           coord_t y1,
+                           const StrokeStyle& style)
+{
+    SimplePutter putter(*this);
+    stroke_ellipse(x0, y0, x1, y1, style, putter);
+}
+template<typename T_PUTTER>
+inline void
+TextCanvas::stroke_ellipse(coord_t x0,
+                           coord_t y0,
+                           coord_t x1,
+                           coord_t y1,
+                           const StrokeStyle& style,
+                           T_PUTTER& putter)
+{
+    SpanBuffer spans(clip_rect());
+    ellipse(x0, y0, x1, y1, spans);
+    if (style.width > 1) {
+        const double h = style.width / 2.0;
+        const double cx = (x0 + x1) / 2.0, cy = (y0 + y1) / 2.0;
+        const double rx = std::abs(x1 - x0) / 2.0, ry = std::abs(y1 - y0) / 2.0;
+        spans.add_ring(cx, cy, rx + h, ry + h, rx - h, ry - h);
+    }
+    spans.flush(putter); // ellipse has moved to its center
+}
+
+inline void
+TextCanvas::rotate_left(const TextCanvas& other)
+{
+    reset(other.height(), other.width());
+    for (coord_t y = 0; y < other.width(); ++y) {
+        for (coord_t x = 0; x < other.height(); ++x) {
+            color_t ch = other.get_pixel(other.width() - (y + 1), x);
+            put_pixel(x, y, ch);
+        }
+    }
+}
+inline void
+TextCanvas::rotate_right(const TextCanvas& other)
+{
+    reset(other.height(), other.width());
+    for (coord_t y = 0; y < other.width(); ++y) {
+        for (coord_t x = 0; x < other.height(); ++x) {
+            color_t ch = other.get_pixel(y, other.height() - (x + 1));
+            put_pixel(x, y, ch);
+        }
+    }
+}
+inline void
+TextCanvas::rotate_180(const TextCanvas& other)
+{
+    reset(other.width(), other.height());
+    for (coord_t y = 0; y < other.height(); ++y) {
+        for (coord_t x = 0; x < other.width(); ++x) {
+            color_t ch = other.get_pixel(other.width() - (x + 1),
+                                         other.height() - (y + 1));
+            put_pixel(x, y, ch);
+        }
+    }
+}
+
+inline void
+TextCanvas::rotate_left()
+{
+    TextCanvas other;
+    other.rotate_left(*this);
+    swap(other);
+}
+inline void
+TextCanvas::rotate_right()
+{
+    TextCanvas other;
+    other.rotate_right(*this);
+    swap(other);
+}
+inline void
+TextCanvas::rotate_180()
+{
+    TextCanvas other;
+    other.rotate_180(*this);
+    swap(other);
+}
+
+inline void
+TextCanvas::mirror_h(const TextCanvas& other)
+{
+    reset(other.width(), other.height());
+    for (coord_t y = 0; y < other.height(); ++y) {
+        for (coord_t x = 0; x < other.width(); ++x) {
+            color_t ch = other.get_pixel(other.width() - (x + 1), y);
+            put_pixel(x, y, ch);
+        }
+    }
+}
+inline void
+TextCanvas::mirror_v(const TextCanvas& other)
+{
+    reset(other.width(), other.height());
+    for (coord_t y = 0; y < other.height(); ++y) {
+        for (coord_t x = 0; x < other.width(); ++x) {
+            color_t ch = other.get_pixel(x, other.height() - (y + 1));
+            put_pixel(x, y, ch);
+        }
+    }
+}
+
+inline void
+TextCanvas::mirror_h()
+{
+    TextCanvas other;
+    other.mirror_h(*this);
+    swap(other);
+}
+inline void
+TextCanvas::mirror_v()
+{
+    TextCanvas other;
+    other.mirror_v(*this);
+    swap(other);
+}
+
+inline void
+TextCanvas::scale(const TextCanvas& other, coord_t width, coord_t height)
+{
+    reset(width, height);
+
+    for (coord_t py = 0; py < height; ++py) {
+        for (coord_t px = 0; px < width; ++px) {
+            coord_t qx = px * other.width() / width;
+            coord_t qy = py * other.height() / height;
+            color_t ch = other.get_pixel(qx, qy);
+            put_pixel(px, py, ch);
+        }
+    }
+}
+inline void
+TextCanvas::scale_cross(const TextCanvas& other,
+                        coord_t x_multi,
+                        coord_t y_multi)
+{
+    coord_t new_width = other.width() * x_multi;
+    coord_t new_height = other.height() * y_multi;
+    reset(new_width, new_height);
+
+    for (coord_t qy = 0; qy < other.height(); ++qy) {
+        for (coord_t qx = 0; qx < other.width(); ++qx) {
+            color_t ch = other.get_pixel(qx, qy);
+            for (coord_t y = 0; y < y_multi; ++y) {
+                for (coord_t x = 0; x < x_multi; ++x) {
+                    put_pixel(qx * x_multi + x, qy * y_multi + y, ch);
+                }
+            }
+        }
+    }
+}
+inline void
+TextCanvas::scale_percent(const TextCanvas& other,
+                          coord_t x_percent,
+                          coord_t y_percent)
+{
+    coord_t new_width = other.width() * x_percent / 100;
+    coord_t new_height = other.height() * y_percent / 100;
+    reset(new_width, new_height);
+
+    for (coord_t py = 0; py < new_height; ++py) {
+        for (coord_t px = 0; px < new_width; ++px) {
+            coord_t qx = px * other.width() / new_width;
+            coord_t qy = py * other.height() / new_height;
+            color_t ch = other.get_pixel(qx, qy);
+            put_pixel(px, py, ch);
+        }
+    }
+}
+
+inline void
+TextCanvas::scale(coord_t width, coord_t height)
+{
+    TextCanvas other;
+    other.scale(*this, width, height);
+    swap(other);
+}
+inline void
+TextCanvas::scale_cross(coord_t x_multi, coord_t y_multi)
+{
+    TextCanvas other;
+    other.scale_cross(*this, x_multi, y_multi);
+    swap(other);
+}
+inline void
+TextCanvas::scale_percent(coord_t x_percent, coord_t y_percent)
+{
+    TextCanvas other;
+    other.scale_percent(*this, x_percent, y_percent);
+    swap(other);
+}
+
+} // namespace textcanvas
+
+namespace std {
+template<>
+inline void
+swap(textcanvas::TextCanvas& left, textcanvas::TextCanvas& right)
+{
+    left.swap(right);
+}
+} // namespace std
+
+///////////////////////////////////////////////////////////////////////////
+
+#endif // ndef TEXT_CANVAS_HPP_
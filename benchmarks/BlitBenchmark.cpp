@@ -0,0 +1,110 @@
+// BlitBenchmark --- raster-operation blits against cell-by-cell loops
+//    ex) BlitBenchmark
+//    ex) BlitBenchmark 2048 10
+#include "TextCanvas.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+
+using namespace textcanvas;
+
+template <typename T_FUNC>
+static void report(const char *name, T_FUNC func, int repeat)
+{
+    std::clock_t start = std::clock();
+    for (int i = 0; i < repeat; ++i)
+        func();
+    double seconds = double(std::clock() - start) / CLOCKS_PER_SEC;
+    printf("%-24s %10.3f ms\n", name, seconds * 1000 / repeat);
+}
+
+struct Blit
+{
+    TextCanvas& m_dest;
+    const TextCanvas& m_src;
+    RasterOp m_rop;
+    Blit(TextCanvas& dest, const TextCanvas& src, RasterOp rop)
+        : m_dest(dest), m_src(src), m_rop(rop) {}
+    void operator()()
+    {
+        Rect rc(1, 1, m_dest.width() - 2, m_dest.height() - 2);
+        m_dest.blit(rc, m_src, Point(0, 0), m_rop, space);
+    }
+};
+struct MaskBlit
+{
+    TextCanvas& m_dest;
+    const XbmImage& m_mask;
+    MaskBlit(TextCanvas& dest, const XbmImage& mask) : m_dest(dest), m_mask(mask) {}
+    void operator()()
+    {
+        Rect rc(1, 1, m_dest.width() - 2, m_dest.height() - 2);
+        m_dest.blit(rc, m_mask, Point(0, 0), ROP_KEY);
+    }
+};
+// the blit of XOR as it was written before, one XorPutter call per cell
+struct PixelXor
+{
+    TextCanvas& m_dest;
+    const TextCanvas& m_src;
+    PixelXor(TextCanvas& dest, const TextCanvas& src) : m_dest(dest), m_src(src) {}
+    void operator()()
+    {
+        XorPutter putter(m_dest);
+        for (coord_t y = 1; y < m_dest.height() - 1; ++y)
+        {
+            for (coord_t x = 1; x < m_dest.width() - 1; ++x)
+            {
+                m_dest.fore_color(m_src.get_pixel(x - 1, y - 1));
+                putter(x, y);
+            }
+        }
+    }
+};
+// the blit of the colour key, one get_pixel and put_pixel per cell
+struct PixelKey
+{
+    TextCanvas& m_dest;
+    const TextCanvas& m_src;
+    PixelKey(TextCanvas& dest, const TextCanvas& src) : m_dest(dest), m_src(src) {}
+    void operator()()
+    {
+        for (coord_t y = 1; y < m_dest.height() - 1; ++y)
+        {
+            for (coord_t x = 1; x < m_dest.width() - 1; ++x)
+            {
+                color_t c = m_src.get_pixel(x - 1, y - 1);
+                if (c != space)
+                    m_dest.put_pixel(x, y, c);
+            }
+        }
+    }
+};
+
+int main(int argc, char **argv)
+{
+    coord_t size = (argc >= 2) ? atoi(argv[1]) : 2048;
+    int repeat = (argc >= 3) ? atoi(argv[2]) : 10;
+    printf("canvas %d x %d, %d times\n", int(size), int(size), repeat);
+
+    TextCanvas src(size, size), dest(size, size);
+    XbmImage mask(size, size);
+    uint32_t seed = 12345;
+    for (coord_t y = 0; y < size; ++y)
+    {
+        for (coord_t x = 0; x < size; ++x)
+        {
+            seed = seed * 1103515245 + 12345;
+            src.put_pixel(x, y, (seed >> 28) ? color_t('A' + (seed >> 16) % 26) : space);
+            mask.put_dot(x, y, ((seed >> 20) & 3) == 0);
+        }
+    }
+
+    report("cell loop XorPutter", PixelXor(dest, src), repeat);
+    report("blit ROP_XOR", Blit(dest, src, ROP_XOR), repeat);
+    report("cell loop colour key", PixelKey(dest, src), repeat);
+    report("blit ROP_KEY", Blit(dest, src, ROP_KEY), repeat);
+    report("blit ROP_COPY", Blit(dest, src, ROP_COPY), repeat);
+    report("blit XbmImage ROP_KEY", MaskBlit(dest, mask), repeat);
+    return 0;
+}
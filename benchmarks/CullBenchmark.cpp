@@ -0,0 +1,65 @@
+// CullBenchmark --- primitives inside and outside of the canvas
+//    ex) CullBenchmark
+//    ex) CullBenchmark 200000
+#include "TextCanvas.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+
+using namespace textcanvas;
+
+// draw the shapes through a SimplePutter as before, or by the default overloads
+static double measure(TextCanvas& canvas, const std::vector<Point>& points, bool checked)
+{
+    SimplePutter putter(canvas);
+    std::clock_t start = std::clock();
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+        const coord_t x = points[i].x, y = points[i].y;
+        if (checked)
+        {
+            canvas.line(x, y, x + 20, y + 9, putter);
+            canvas.circle(x + 8, y + 8, 6, putter);
+            canvas.fill_ellipse(x, y, x + 15, y + 7, putter);
+            canvas.rectangle(x, y, x + 12, y + 6, putter);
+        }
+        else
+        {
+            canvas.line(x, y, x + 20, y + 9);
+            canvas.circle(x + 8, y + 8, 6);
+            canvas.fill_ellipse(x, y, x + 15, y + 7);
+            canvas.rectangle(x, y, x + 12, y + 6);
+        }
+    }
+    return double(std::clock() - start) / CLOCKS_PER_SEC;
+}
+
+int main(int argc, char **argv)
+{
+    int count = (argc >= 2) ? atoi(argv[1]) : 100000;
+    printf("%d times of line, circle, fill_ellipse and rectangle\n", count);
+
+    TextCanvas canvas(320, 200);
+    std::vector<Point> inside, outside;
+    uint32_t seed = 12345;
+    for (int i = 0; i < count; ++i)
+    {
+        seed = seed * 1103515245 + 12345;
+        inside.push_back(Point(coord_t((seed >> 8) % 290), coord_t((seed >> 16) % 180)));
+        outside.push_back(Point(coord_t((seed >> 8) % 1000) + 400, coord_t((seed >> 16) % 180)));
+    }
+
+    double before = measure(canvas, inside, true);
+    std::string result = canvas.to_str();
+    canvas.clear();
+    double after = measure(canvas, inside, false);
+    printf("inside  checked putter %10.3f ms\n", before * 1000);
+    printf("inside  default        %10.3f ms (same: %s)\n", after * 1000,
+           (result == canvas.to_str()) ? "yes" : "no");
+
+    before = measure(canvas, outside, true);
+    after = measure(canvas, outside, false);
+    printf("outside checked putter %10.3f ms\n", before * 1000);
+    printf("outside default        %10.3f ms\n", after * 1000);
+    return 0;
+}
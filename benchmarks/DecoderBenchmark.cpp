@@ -0,0 +1,98 @@
+// DecoderBenchmark --- throughput of the streaming japanese decoders
+//    ex) DecoderBenchmark
+//    ex) DecoderBenchmark iso2022jp corpus.txt
+//    ex) DecoderBenchmark eucjp corpus.txt
+#include "TextCanvas.hpp"
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+
+struct CountSink
+{
+    size_t m_count;
+    uint32_t m_hash;
+    CountSink() : m_count(0), m_hash(0) {}
+    void hankaku(uint8_t ch) { ++m_count; m_hash = m_hash * 31 + ch; }
+    void zenkaku(uint16_t jis_code) { ++m_count; m_hash = m_hash * 31 + jis_code; }
+};
+
+// every JIS X 0208 cell, mixed with ASCII lines
+static void make_corpus(std::string& iso2022jp, std::string& eucjp, size_t min_size)
+{
+    while (iso2022jp.size() < min_size)
+    {
+        for (int iy = 0x21; iy <= 0x7E; ++iy)
+        {
+            iso2022jp += "\x1B$B";
+            for (int ix = 0x21; ix <= 0x7E; ++ix)
+            {
+                iso2022jp += char(iy);
+                iso2022jp += char(ix);
+                eucjp += char(iy | 0x80);
+                eucjp += char(ix | 0x80);
+            }
+            iso2022jp += "\x1B(B";
+            iso2022jp += "The quick brown fox jumps over the lazy dog.\n";
+            eucjp += "The quick brown fox jumps over the lazy dog.\n";
+        }
+    }
+}
+
+template <typename T_DECODER, typename T_SINK>
+static double measure(const std::string& corpus, size_t chunk, T_SINK& sink)
+{
+    T_DECODER decoder;
+    std::clock_t start = std::clock();
+    for (size_t i = 0; i < corpus.size(); i += chunk)
+    {
+        size_t len = std::min(chunk, corpus.size() - i);
+        decoder.feed(&corpus[i], len, sink);
+    }
+    decoder.flush(sink);
+    double seconds = double(std::clock() - start) / CLOCKS_PER_SEC;
+    return (corpus.size() / (1024.0 * 1024.0)) / (seconds > 0 ? seconds : 1e-9);
+}
+
+template <typename T_DECODER>
+static void report(const char *name, const std::string& corpus)
+{
+    using namespace textcanvas;
+    static const size_t chunks[] = { 1, 4096, 1024 * 1024 };
+    for (size_t k = 0; k < sizeof(chunks) / sizeof(chunks[0]); ++k)
+    {
+        CountSink sink;
+        double mbps = measure<T_DECODER>(corpus, chunks[k], sink);
+        printf("%-10s chunk %8u: %8.1f MB/s (%u chars)\n",
+               name, unsigned(chunks[k]), mbps, unsigned(sink.m_count));
+    }
+
+    TextRun run;
+    TextRunSink sink(run, kh_dot_zenkaku_font(), kh_dot_hankaku_font());
+    double mbps = measure<T_DECODER>(corpus, 4096, sink);
+    printf("%-10s to TextRun:     %8.1f MB/s (%u glyphs)\n",
+           name, mbps, unsigned(run.size()));
+}
+
+int main(int argc, char **argv)
+{
+    std::string iso2022jp, eucjp;
+    if (argc >= 3)
+    {
+        std::ifstream file(argv[2], std::ios::binary);
+        std::string corpus((std::istreambuf_iterator<char>(file)),
+                           std::istreambuf_iterator<char>());
+        printf("%s: %u bytes\n", argv[2], unsigned(corpus.size()));
+        if (std::string(argv[1]) == "eucjp")
+            report<japanese::EucJpDecoder>("EUC-JP", corpus);
+        else
+            report<japanese::Iso2022JpDecoder>("ISO-2022-JP", corpus);
+        return 0;
+    }
+
+    make_corpus(iso2022jp, eucjp, 16 * 1024 * 1024);
+    report<japanese::Iso2022JpDecoder>("ISO-2022-JP", iso2022jp);
+    report<japanese::EucJpDecoder>("EUC-JP", eucjp);
+    return 0;
+}
@@ -0,0 +1,141 @@
+// DisplayListBenchmark --- replaying a DisplayList against drawing immediately
+//    ex) DisplayListBenchmark
+//    ex) DisplayListBenchmark 50
+#include "TextCanvas.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <vector>
+
+using namespace textcanvas;
+
+enum ShapeType
+{
+    SHAPE_LINE,
+    SHAPE_RECTANGLE,
+    SHAPE_FILL_RECTANGLE,
+    SHAPE_FILL_CIRCLE,
+    SHAPE_CHAR
+};
+
+struct Shape
+{
+    ShapeType type;
+    coord_t x0, y0, x1, y1;
+    color_t color;
+};
+
+typedef std::vector<Shape> Scene;
+
+static void add(Scene& scene, ShapeType type, coord_t x0, coord_t y0,
+                coord_t x1, coord_t y1, color_t color)
+{
+    Shape shape = { type, x0, y0, x1, y1, color };
+    scene.push_back(shape);
+}
+
+static void draw_immediately(TextCanvas& tc, const Scene& scene)
+{
+    const XbmFont& font = kh_dot_hankaku_font();
+    for (size_t i = 0; i < scene.size(); ++i)
+    {
+        const Shape& s = scene[i];
+        tc.fore_color(s.color);
+        switch (s.type)
+        {
+        case SHAPE_LINE: tc.line(s.x0, s.y0, s.x1, s.y1); break;
+        case SHAPE_RECTANGLE: tc.rectangle(s.x0, s.y0, s.x1, s.y1); break;
+        case SHAPE_FILL_RECTANGLE: tc.fill_rectangle(s.x0, s.y0, s.x1, s.y1); break;
+        case SHAPE_FILL_CIRCLE: tc.fill_circle(s.x0, s.y0, s.x1); break;
+        case SHAPE_CHAR: tc.put_char(s.x0, s.y0, font, s.x1); break;
+        }
+    }
+}
+
+static void record(DisplayList& list, const Scene& scene)
+{
+    const XbmFont& font = kh_dot_hankaku_font();
+    list.clear();
+    for (size_t i = 0; i < scene.size(); ++i)
+    {
+        const Shape& s = scene[i];
+        switch (s.type)
+        {
+        case SHAPE_LINE: list.line(s.x0, s.y0, s.x1, s.y1, s.color); break;
+        case SHAPE_RECTANGLE: list.rectangle(s.x0, s.y0, s.x1, s.y1, s.color); break;
+        case SHAPE_FILL_RECTANGLE: list.fill_rectangle(s.x0, s.y0, s.x1, s.y1, s.color); break;
+        case SHAPE_FILL_CIRCLE: list.fill_circle(s.x0, s.y0, s.x1, s.color); break;
+        case SHAPE_CHAR: list.put_char(s.x0, s.y0, font, s.x1, s.color, ' '); break;
+        }
+    }
+}
+
+static void report(const char *name, const Scene& scene, coord_t width,
+                   coord_t height, int repeat)
+{
+    TextCanvas immediate(width, height), replayed(width, height);
+    DisplayList list;
+
+    std::clock_t start = std::clock();
+    for (int i = 0; i < repeat; ++i)
+        draw_immediately(immediate, scene);
+    double t0 = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    start = std::clock();
+    for (int i = 0; i < repeat; ++i)
+        record(list, scene);
+    double t1 = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    start = std::clock();
+    for (int i = 0; i < repeat; ++i)
+        list.replay(replayed);
+    double t2 = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    printf("%s: %u commands, %u culled, %u occluded\n", name,
+           unsigned(scene.size()), unsigned(list.culled()),
+           unsigned(list.occluded()));
+    printf("  immediate %10.3f ms\n", t0 * 1000 / repeat);
+    printf("  record    %10.3f ms\n", t1 * 1000 / repeat);
+    printf("  replay    %10.3f ms (%s)\n", t2 * 1000 / repeat,
+           immediate.to_str() == replayed.to_str() ? "same" : "DIFFERENT");
+}
+
+int main(int argc, char **argv)
+{
+    int repeat = (argc >= 2) ? atoi(argv[1]) : 20;
+    uint32_t seed = 12345;
+
+    // large filled circles and long lines, all visible
+    Scene shapes;
+    for (int i = 0; i < 20; ++i)
+    {
+        seed = seed * 1103515245 + 12345;
+        add(shapes, SHAPE_FILL_CIRCLE, coord_t(seed >> 8) % 1000,
+            coord_t(seed >> 16) % 1000, 200 + coord_t(seed >> 4) % 200, 0,
+            color_t('a' + i));
+        add(shapes, SHAPE_LINE, 0, coord_t(seed >> 12) % 1000, 999,
+            coord_t(seed >> 20) % 1000, color_t('A' + i));
+    }
+    report("20 fill_circle and 20 lines", shapes, 1000, 1000, repeat);
+
+    // windows of text stacked over each other, scrolling off the canvas
+    Scene windows;
+    for (int w = 0; w < 40; ++w)
+    {
+        seed = seed * 1103515245 + 12345;
+        const coord_t x0 = coord_t(seed >> 8) % 400 - 100;
+        const coord_t y0 = coord_t(seed >> 16) % 300 - 100;
+        const coord_t x1 = x0 + 400, y1 = y0 + 240;
+        add(windows, SHAPE_FILL_RECTANGLE, x0, y0, x1, y1, ' ');
+        add(windows, SHAPE_RECTANGLE, x0, y0, x1, y1, '#');
+        add(windows, SHAPE_FILL_CIRCLE, x0 + 200, y0 + 120, 100, 0, 'o');
+        for (coord_t y = y0 + 4; y + 16 < y1; y += 16)
+        {
+            for (coord_t x = x0 + 4; x + 8 < x1; x += 8)
+                add(windows, SHAPE_CHAR, x, y, 'A' + (x + y) % 26, 0, '@');
+            add(windows, SHAPE_LINE, x0 + 4, y + 15, x1 - 4, y + 15, '-');
+        }
+    }
+    report("40 windows of text", windows, 640, 400, repeat);
+    return 0;
+}
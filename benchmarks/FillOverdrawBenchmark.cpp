@@ -0,0 +1,134 @@
+// FillOverdrawBenchmark --- cells written versus cells covered by the fills
+//    ex) FillOverdrawBenchmark
+//    ex) FillOverdrawBenchmark 200
+#include "TextCanvas.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+
+using namespace textcanvas;
+
+struct CountPutter
+{
+    TextCanvas& m_tc;
+    size_t m_written;
+    CountPutter(TextCanvas& tc) : m_tc(tc), m_written(0) {}
+    void operator()(coord_t x, coord_t y)
+    {
+        ++m_written;
+        m_tc.put_pixel(x, y, sharp);
+    }
+};
+
+// fill_circle before the spans were merged
+static void legacy_fill_circle(coord_t x0, coord_t y0, coord_t r, CountPutter& putter)
+{
+    coord_t x = r, y = 0;
+    coord_t f = 3 - 2 * x;
+    while (x >= y)
+    {
+        for (coord_t px = x0 - x; px <= x0 + x; ++px)
+        {
+            putter(px, y0 + y);
+            putter(px, y0 - y);
+        }
+        for (coord_t px = x0 - y; px <= x0 + y; ++px)
+        {
+            putter(px, y0 + x);
+            putter(px, y0 - x);
+        }
+        if (f >= 0)
+        {
+            --x;
+            f -= 4 * x;
+        }
+        ++y;
+        f += 4 * y + 2;
+    }
+}
+
+// fill_ellipse before the spans were merged: a span for each step
+struct LegacyEllipseSpan
+{
+    CountPutter& m_putter;
+    LegacyEllipseSpan(CountPutter& putter) : m_putter(putter) {}
+    void operator()(coord_t left, coord_t right, coord_t y)
+    {
+        for (coord_t x = left; x <= right; ++x)
+            m_putter(x, y);
+    }
+    void point(coord_t x, coord_t y) { m_putter(x, y); }
+};
+
+static size_t covered(const TextCanvas& tc)
+{
+    size_t count = 0;
+    for (coord_t y = 0; y < tc.height(); ++y)
+    {
+        for (coord_t x = 0; x < tc.width(); ++x)
+        {
+            if (tc.get_pixel(x, y) == sharp)
+                ++count;
+        }
+    }
+    return count;
+}
+
+template <typename T_FILL>
+static void report(const char *name, coord_t size, int repeat, T_FILL fill)
+{
+    TextCanvas tc(size + 1, size + 1, sharp, space);
+    CountPutter putter(tc);
+    std::clock_t start = std::clock();
+    for (int i = 0; i < repeat; ++i)
+        fill(tc, size, putter);
+    double seconds = double(std::clock() - start) / CLOCKS_PER_SEC;
+    size_t written = putter.m_written / repeat;
+    size_t cells = covered(tc);
+    printf("%-22s written %9u, covered %9u (%.2fx), %8.3f ms\n",
+           name, unsigned(written), unsigned(cells),
+           double(written) / (cells ? cells : 1),
+           seconds * 1000 / repeat);
+}
+
+struct LegacyCircle
+{
+    void operator()(TextCanvas&, coord_t size, CountPutter& putter) const
+    {
+        legacy_fill_circle(size / 2, size / 2, size / 2, putter);
+    }
+};
+struct Circle
+{
+    void operator()(TextCanvas& tc, coord_t size, CountPutter& putter) const
+    {
+        tc.fill_circle(size / 2, size / 2, size / 2, putter);
+    }
+};
+struct LegacyEllipse
+{
+    void operator()(TextCanvas&, coord_t size, CountPutter& putter) const
+    {
+        LegacyEllipseSpan span(putter);
+        ellipse_spans(0, size / 4, size, size / 2, span);
+    }
+};
+struct Ellipse
+{
+    void operator()(TextCanvas& tc, coord_t size, CountPutter& putter) const
+    {
+        tc.fill_ellipse(0, size / 4, size, size / 4 + size / 2, putter);
+    }
+};
+
+int main(int argc, char **argv)
+{
+    coord_t size = (argc >= 2) ? atoi(argv[1]) : 500;
+    int repeat = 20;
+    printf("box %d x %d, %d times\n", int(size + 1), int(size + 1), repeat);
+    report("fill_circle (before)", size, repeat, LegacyCircle());
+    report("fill_circle (after)", size, repeat, Circle());
+    report("fill_ellipse (before)", size, repeat, LegacyEllipse());
+    report("fill_ellipse (after)", size, repeat, Ellipse());
+    return 0;
+}
@@ -0,0 +1,75 @@
+// MorphologyBenchmark --- dilation and erosion of a large mask
+//    ex) MorphologyBenchmark
+//    ex) MorphologyBenchmark 4096 3
+#include "TextCanvas.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+
+using namespace textcanvas;
+
+template <typename T_FUNC>
+static void report(const char *name, T_FUNC func)
+{
+    std::clock_t start = std::clock();
+    func();
+    double seconds = double(std::clock() - start) / CLOCKS_PER_SEC;
+    printf("%-24s %10.3f ms\n", name, seconds * 1000);
+}
+
+struct Dilate
+{
+    XbmImage& m_image;
+    MorphElement m_elem;
+    Dilate(XbmImage& image, const MorphElement& elem) : m_image(image), m_elem(elem) {}
+    void operator()() { m_image.dilate(m_elem); }
+};
+struct Erode
+{
+    XbmImage& m_image;
+    MorphElement m_elem;
+    Erode(XbmImage& image, const MorphElement& elem) : m_image(image), m_elem(elem) {}
+    void operator()() { m_image.erode(m_elem); }
+};
+struct CanvasDilate
+{
+    TextCanvas& m_tc;
+    MorphElement m_elem;
+    CanvasDilate(TextCanvas& tc, const MorphElement& elem) : m_tc(tc), m_elem(elem) {}
+    void operator()() { m_tc.dilate(m_elem); }
+};
+struct GetMask
+{
+    const TextCanvas& m_tc;
+    XbmImage& m_mask;
+    GetMask(const TextCanvas& tc, XbmImage& mask) : m_tc(tc), m_mask(mask) {}
+    void operator()() { m_tc.get_mask(m_mask, m_tc.fore_color()); }
+};
+
+int main(int argc, char **argv)
+{
+    coord_t size = (argc >= 2) ? atoi(argv[1]) : 4096;
+    coord_t r = (argc >= 3) ? atoi(argv[2]) : 1;
+    printf("mask %d x %d, radius %d\n", int(size), int(size), int(r));
+
+    XbmImage image(size, size);
+    uint32_t seed = 12345;
+    for (coord_t i = 0; i < image.size(); ++i)
+    {
+        seed = seed * 1103515245 + 12345;
+        image.data()[i] = uint8_t(seed >> 16) & uint8_t(seed >> 24);
+    }
+
+    XbmImage work = image;
+    report("XbmImage dilate rect", Dilate(work, MorphElement(r, r)));
+    work = image;
+    report("XbmImage erode rect", Erode(work, MorphElement(r, r)));
+    work = image;
+    report("XbmImage dilate cross", Dilate(work, MorphElement(r, r, MORPH_CROSS)));
+
+    TextCanvas canvas(image);
+    XbmImage mask(size, size);
+    report("TextCanvas get_mask", GetMask(canvas, mask));
+    report("TextCanvas dilate rect", CanvasDilate(canvas, MorphElement(r, r)));
+    return 0;
+}
@@ -0,0 +1,83 @@
+// RowBenchmark --- a custom kernel on the raw rows against put_pixel
+//    ex) RowBenchmark
+//    ex) RowBenchmark 2048 1024 20
+#include "TextCanvas.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+
+using namespace textcanvas;
+
+template <typename T_FUNC>
+static void report(const char *name, T_FUNC func, int repeat)
+{
+    std::clock_t start = std::clock();
+    for (int i = 0; i < repeat; ++i)
+        func();
+    double seconds = double(std::clock() - start) / CLOCKS_PER_SEC;
+    printf("%-24s %10.3f ms\n", name, seconds * 1000 / repeat);
+}
+
+// a threshold kernel: the cells brighter than '5' become '#'
+struct ByPixel
+{
+    TextCanvas& m_tc;
+    ByPixel(TextCanvas& tc) : m_tc(tc) {}
+    void operator()()
+    {
+        m_tc.fore_color('#');
+        for (coord_t y = 0; y < m_tc.height(); ++y)
+        {
+            for (coord_t x = 0; x < m_tc.width(); ++x)
+            {
+                if (m_tc.get_pixel(x, y) > '5')
+                    m_tc.put_pixel(x, y);
+            }
+        }
+    }
+};
+struct ByRow
+{
+    TextCanvas& m_tc;
+    ByRow(TextCanvas& tc) : m_tc(tc) {}
+    void operator()()
+    {
+        CanvasRows<color_t> rows = m_tc.rows();
+        CanvasRows<color_t>::iterator it, end = rows.end();
+        for (it = rows.begin(); it != end; ++it)
+        {
+            CanvasRow<color_t> row = *it;
+            for (color_t *p = row.begin(); p != row.end(); ++p)
+                *p = (*p > '5') ? '#' : *p;
+        }
+    }
+};
+
+static void fill_noise(TextCanvas& tc)
+{
+    uint32_t seed = 12345;
+    for (coord_t y = 0; y < tc.height(); ++y)
+    {
+        CanvasRow<color_t> row = tc.row(y);
+        for (coord_t x = 0; x < row.width; ++x)
+        {
+            seed = seed * 1103515245 + 12345;
+            row[x] = color_t('0' + (seed >> 16) % 10);
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    coord_t width = (argc >= 2) ? atoi(argv[1]) : 2048;
+    coord_t height = (argc >= 3) ? atoi(argv[2]) : 1024;
+    int repeat = (argc >= 4) ? atoi(argv[3]) : 20;
+    printf("canvas %d x %d, %d times\n", int(width), int(height), repeat);
+
+    TextCanvas tc(width, height);
+    fill_noise(tc);
+    report("put_pixel", ByPixel(tc), repeat);
+    fill_noise(tc);
+    report("rows", ByRow(tc), repeat);
+    return 0;
+}
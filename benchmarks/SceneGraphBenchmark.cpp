@@ -0,0 +1,56 @@
+// SceneGraphBenchmark --- redrawing the damage of a moving node
+//    ex) SceneGraphBenchmark
+//    ex) SceneGraphBenchmark 1000
+#include "TextCanvas.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+
+using namespace textcanvas;
+
+int main(int argc, char **argv)
+{
+    int frames = (argc >= 2) ? atoi(argv[1]) : 500;
+    const coord_t width = 2000, height = 1000;
+    printf("canvas %d x %d, %d frames\n", int(width), int(height), frames);
+
+    // a filled background and a filled ellipse, and a small moving node
+    SceneGraph scene(width, height);
+    scene.add_rect(Rect(0, 0, width - 1, height - 1), '.', true);
+    scene.add_ellipse(Rect(100, 50, width - 101, height - 51), 'o', true);
+    scene.add_ellipse(Rect(300, 200, width - 301, height - 201), '*');
+    const coord_t id = scene.add_rect(Rect(10, 10, 12, 12), '#', true);
+
+    TextCanvas tc(width, height);
+    scene.render(tc);
+
+    std::clock_t start = std::clock();
+    for (int i = 0; i < frames; ++i)
+    {
+        scene.move_by(id, 3, 1);
+        scene.render(tc);
+    }
+    double damaged = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    // the same frames drawn in full
+    TextCanvas full(width, height);
+    start = std::clock();
+    for (int i = 0; i < frames; ++i)
+    {
+        full.fore_color('.');
+        full.fill_rectangle(0, 0, width - 1, height - 1);
+        full.fore_color('o');
+        full.fill_ellipse(100, 50, width - 101, height - 51);
+        full.fore_color('*');
+        full.ellipse(300, 200, width - 301, height - 201);
+        full.fore_color('#');
+        full.fill_rectangle(10 + 3 * (i + 1), 10 + (i + 1), 12 + 3 * (i + 1), 12 + (i + 1));
+    }
+    double redrawn = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    printf("damaged regions %10.3f ms a frame (%d cells)\n",
+           damaged * 1000 / frames, int(scene.redrawn()));
+    printf("full redraw     %10.3f ms a frame\n", redrawn * 1000 / frames);
+    printf("same: %s\n", tc.to_str() == full.to_str() ? "yes" : "no");
+    return 0;
+}
@@ -0,0 +1,84 @@
+// SpriteBenchmark --- many colour-keyed sprites per frame
+//    ex) SpriteBenchmark
+//    ex) SpriteBenchmark 500 100
+#include "TextCanvas.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+
+using namespace textcanvas;
+
+// the keyed copy as it was written before, with a putter pair
+struct KeyPutter
+{
+    TextCanvas& m_tc;
+    const TextCanvas& m_image;
+    coord_t m_x0, m_y0;
+    KeyPutter(TextCanvas& tc, const TextCanvas& image, coord_t x0, coord_t y0)
+        : m_tc(tc), m_image(image), m_x0(x0), m_y0(y0) {}
+    void operator()(coord_t x, coord_t y)
+    {
+        color_t ch = m_image.get_pixel(x - m_x0, y - m_y0);
+        if (ch != space)
+            m_tc.put_pixel(x, y, ch);
+    }
+};
+
+int main(int argc, char **argv)
+{
+    int count = (argc >= 2) ? atoi(argv[1]) : 500;
+    int frames = (argc >= 3) ? atoi(argv[2]) : 100;
+    printf("%d sprites of 16 x 8, %d frames\n", count, frames);
+
+    // eight sprites of rings and crosses
+    std::vector<TextCanvas> images;
+    SpriteAtlas atlas;
+    for (int i = 0; i < 8; ++i)
+    {
+        TextCanvas image(16, 8, color_t('A' + i), space);
+        image.clear();
+        image.ellipse(7, 3, 6 - i % 3, 3);
+        image.line(0, i % 8, 15, 7 - i % 8);
+        images.push_back(image);
+        atlas.add(image);
+    }
+    printf("atlas: %u runs, %u cells\n", unsigned(atlas.run_count()),
+           unsigned(atlas.cell_count()));
+
+    TextCanvas canvas(320, 200);
+    std::vector<Point> points;
+    uint32_t seed = 12345;
+    for (int i = 0; i < count; ++i)
+    {
+        seed = seed * 1103515245 + 12345;
+        points.push_back(Point(coord_t((seed >> 8) % 340) - 10,
+                               coord_t((seed >> 20) % 210) - 5));
+    }
+
+    std::clock_t start = std::clock();
+    for (int f = 0; f < frames; ++f)
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            const TextCanvas& image = images[i % 8];
+            KeyPutter putter(canvas, image, points[i].x, points[i].y);
+            canvas.put_subimage(points[i].x, points[i].y, image, putter, putter);
+        }
+    }
+    double before = double(std::clock() - start) / CLOCKS_PER_SEC;
+    std::string result = canvas.to_str();
+
+    canvas.clear();
+    start = std::clock();
+    for (int f = 0; f < frames; ++f)
+    {
+        for (int i = 0; i < count; ++i)
+            canvas.put_sprite(points[i].x, points[i].y, atlas, i % 8);
+    }
+    double after = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    printf("put_subimage with putters %10.3f ms/frame\n", before * 1000 / frames);
+    printf("put_sprite                %10.3f ms/frame\n", after * 1000 / frames);
+    printf("same: %s\n", (result == canvas.to_str()) ? "yes" : "no");
+    return 0;
+}
@@ -0,0 +1,86 @@
+// XbmFloodFillBenchmark --- XbmImage::flood_fill versus a pixel queue
+//    ex) XbmFloodFillBenchmark
+//    ex) XbmFloodFillBenchmark 10000
+#include "TextCanvas.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+
+using namespace textcanvas;
+
+// one pixel at a time, as flood_fill_surface does
+static void pixel_fill(XbmImage& image, coord_t x, coord_t y, bool dot)
+{
+    const bool target = image.get_dot(x, y);
+    if (target == dot)
+        return;
+    Points points;
+    points.push_back(Point(x, y));
+    image.put_dot(x, y, dot);
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+        static const coord_t dx[] = { -1, 1, 0, 0 }, dy[] = { 0, 0, -1, 1 };
+        for (int k = 0; k < 4; ++k)
+        {
+            Point p(points[i].x + dx[k], points[i].y + dy[k]);
+            if (image.in_range(p.x, p.y) && image.get_dot(p.x, p.y) == target)
+            {
+                image.put_dot(p.x, p.y, dot);
+                points.push_back(p);
+            }
+        }
+    }
+}
+
+// sparse noise with a few walls
+static void make_mask(XbmImage& image)
+{
+    uint32_t seed = 12345;
+    for (coord_t y = 0; y < image.height(); ++y)
+    {
+        for (coord_t x = 0; x < image.width(); ++x)
+        {
+            seed = seed * 1103515245 + 12345;
+            image.put_dot(x, y, ((seed >> 16) % 100) < 20);
+        }
+    }
+    for (coord_t x = image.width() / 8; x < image.width(); x += image.width() / 4)
+    {
+        for (coord_t y = 0; y < image.height() * 7 / 8; ++y)
+            image.put_dot(x, y, true);
+    }
+}
+
+static size_t count_dots(const XbmImage& image)
+{
+    size_t count = 0;
+    for (coord_t i = 0; i < image.size(); ++i)
+    {
+        for (int k = 0; k < 8; ++k)
+            count += (image.data()[i] >> k) & 1;
+    }
+    return count;
+}
+
+int main(int argc, char **argv)
+{
+    coord_t size = (argc >= 2) ? atoi(argv[1]) : 4096;
+    XbmImage mask(size, size);
+    make_mask(mask);
+    printf("mask %d x %d, %u dots\n", int(size), int(size), unsigned(count_dots(mask)));
+
+    XbmImage image = mask;
+    std::clock_t start = std::clock();
+    image.flood_fill(0, size - 1, true);
+    double seconds = double(std::clock() - start) / CLOCKS_PER_SEC;
+    printf("%-12s %10.3f ms, %u dots\n", "flood_fill", seconds * 1000,
+           unsigned(count_dots(image)));
+
+    image = mask;
+    start = std::clock();
+    pixel_fill(image, 0, size - 1, true);
+    seconds = double(std::clock() - start) / CLOCKS_PER_SEC;
+    printf("%-12s %10.3f ms, %u dots\n", "pixel queue", seconds * 1000,
+           unsigned(count_dots(image)));
+    return 0;
+}
@@ -1,15 +1,58 @@
-.\build\ArcTest > TestResults\ArcTest.txt
-.\build\CircleTest > TestResults\CircleTest.txt
-.\build\EllipseTest > TestResults\EllipseTest.txt
-.\build\FillEllipseTest > TestResults\FillEllipseTest.txt
-.\build\FillPieTest > TestResults\FillPieTest.txt
-.\build\FillRoundRectTest > TestResults\FillRoundRectTest.txt
-.\build\FloodFillTest > TestResults\FloodFillTest.txt
-.\build\LineTest > TestResults\LineTest.txt
-.\build\NormalizeRadianTest > TestResults\NormalizeRadianTest.txt
-.\build\PieTest > TestResults\PieTest.txt
-.\build\PolygonTest > TestResults\PolygonTest.txt
-.\build\RotateTest > TestResults\RotateTest.txt
-.\build\RoundRectTest > TestResults\RoundRectTest.txt
-.\build\SubImageTest > TestResults\SubImage.txt
-.\build\TextOutTest > TestResults\TextOutTest.txt
+.\build\ArcTest > TestResults\ArcTest.txt
+.\build\CircleTest > TestResults\CircleTest.txt
+.\build\EllipseTest > TestResults\EllipseTest.txt
+.\build\FillEllipseTest > TestResults\FillEllipseTest.txt
+.\build\FillPieTest > TestResults\FillPieTest.txt
+.\build\FillRoundRectTest > TestResults\FillRoundRectTest.txt
+.\build\FloodFillTest > TestResults\FloodFillTest.txt
+.\build\LineTest > TestResults\LineTest.txt
+.\build\NormalizeRadianTest > TestResults\NormalizeRadianTest.txt
+.\build\PieTest > TestResults\PieTest.txt
+.\build\PolygonTest > TestResults\PolygonTest.txt
+.\build\RotateTest > TestResults\RotateTest.txt
+.\build\RoundRectTest > TestResults\RoundRectTest.txt
+.\build\SubImageTest > TestResults\SubImage.txt
+.\build\TextOutTest > TestResults\TextOutTest.txt
+.\build\Utf8TextOutTest > TestResults\Utf8TextOutTest.txt
+
+.\build\TextRunTest > TestResults\TextRunTest.txt
+
+.\build\DecoderTest > TestResults\DecoderTest.txt
+
+.\build\LayoutTest > TestResults\LayoutTest.txt
+
+.\build\GlyphCacheTest > TestResults\GlyphCacheTest.txt
+
+.\build\VerticalTextTest > TestResults\VerticalTextTest.txt
+
+.\build\GlyphEffectTest > TestResults\GlyphEffectTest.txt
+
+.\build\BannerCacheTest > TestResults\BannerCacheTest.txt
+
+.\build\StaticBannerTest > TestResults\StaticBannerTest.txt
+
+.\build\SubsetFontTest > TestResults\SubsetFontTest.txt
+
+.\build\StrokeTest > TestResults\StrokeTest.txt
+
+.\build\DisplayListTest > TestResults\DisplayListTest.txt
+
+.\build\ComponentTest > TestResults\ComponentTest.txt
+
+.\build\XbmFloodFillTest > TestResults\XbmFloodFillTest.txt
+
+.\build\MorphologyTest > TestResults\MorphologyTest.txt
+
+.\build\BlitTest > TestResults\BlitTest.txt
+
+.\build\SpriteTest > TestResults\SpriteTest.txt
+
+.\build\LayerTest > TestResults\LayerTest.txt
+
+.\build\SceneGraphTest > TestResults\SceneGraphTest.txt
+
+.\build\ClipTest > TestResults\ClipTest.txt
+
+.\build\CullTest > TestResults\CullTest.txt
+
+.\build\RowTest > TestResults\RowTest.txt
@@ -1,16 +1,38 @@
-#!/bin/bash
-./build/ArcTest.exe > TestResults/ArcTest.txt
-./build/CircleTest.exe > TestResults/CircleTest.txt
-./build/EllipseTest.exe > TestResults/EllipseTest.txt
-./build/FillEllipseTest.exe > TestResults/FillEllipseTest.txt
-./build/FillPieTest.exe > TestResults/FillPieTest.txt
-./build/FillRoundRectTest.exe > TestResults/FillRoundRectTest.txt
-./build/FloodFillTest.exe > TestResults/FloodFillTest.txt
-./build/LineTest.exe > TestResults/LineTest.txt
-./build/NormalizeRadianTest.exe > TestResults/NormalizeRadianTest.txt
-./build/PieTest.exe > TestResults/PieTest.txt
-./build/PolygonTest.exe > TestResults/PolygonTest.txt
-./build/RotateTest.exe > TestResults/RotateTest.txt
-./build/RoundRectTest.exe > TestResults/RoundRectTest.txt
-./build/SubImageTest.exe > TestResults/SubImageTest.txt
-./build/TextOutTest.exe > TestResults/TextOutTest.txt
+#!/bin/bash
+./build/ArcTest.exe > TestResults/ArcTest.txt
+./build/BannerCacheTest.exe > TestResults/BannerCacheTest.txt
+./build/BlitTest.exe > TestResults/BlitTest.txt
+./build/CircleTest.exe > TestResults/CircleTest.txt
+./build/ClipTest.exe > TestResults/ClipTest.txt
+./build/ComponentTest.exe > TestResults/ComponentTest.txt
+./build/CullTest.exe > TestResults/CullTest.txt
+./build/DecoderTest.exe > TestResults/DecoderTest.txt
+./build/DisplayListTest.exe > TestResults/DisplayListTest.txt
+./build/EllipseTest.exe > TestResults/EllipseTest.txt
+./build/FillEllipseTest.exe > TestResults/FillEllipseTest.txt
+./build/FillPieTest.exe > TestResults/FillPieTest.txt
+./build/FillRoundRectTest.exe > TestResults/FillRoundRectTest.txt
+./build/FloodFillTest.exe > TestResults/FloodFillTest.txt
+./build/GlyphCacheTest.exe > TestResults/GlyphCacheTest.txt
+./build/GlyphEffectTest.exe > TestResults/GlyphEffectTest.txt
+./build/LayerTest.exe > TestResults/LayerTest.txt
+./build/LayoutTest.exe > TestResults/LayoutTest.txt
+./build/LineTest.exe > TestResults/LineTest.txt
+./build/MorphologyTest.exe > TestResults/MorphologyTest.txt
+./build/NormalizeRadianTest.exe > TestResults/NormalizeRadianTest.txt
+./build/PieTest.exe > TestResults/PieTest.txt
+./build/PolygonTest.exe > TestResults/PolygonTest.txt
+./build/RotateTest.exe > TestResults/RotateTest.txt
+./build/RoundRectTest.exe > TestResults/RoundRectTest.txt
+./build/RowTest.exe > TestResults/RowTest.txt
+./build/SceneGraphTest.exe > TestResults/SceneGraphTest.txt
+./build/SpriteTest.exe > TestResults/SpriteTest.txt
+./build/StaticBannerTest.exe > TestResults/StaticBannerTest.txt
+./build/StrokeTest.exe > TestResults/StrokeTest.txt
+./build/SubImageTest.exe > TestResults/SubImageTest.txt
+./build/SubsetFontTest.exe > TestResults/SubsetFontTest.txt
+./build/TextOutTest.exe > TestResults/TextOutTest.txt
+./build/TextRunTest.exe > TestResults/TextRunTest.txt
+./build/Utf8TextOutTest.exe > TestResults/Utf8TextOutTest.txt
+./build/VerticalTextTest.exe > TestResults/VerticalTextTest.txt
+./build/XbmFloodFillTest.exe > TestResults/XbmFloodFillTest.txt
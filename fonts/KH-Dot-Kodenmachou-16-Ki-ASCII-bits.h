@@ -0,0 +1,352 @@
+/* Copyright (c) Keitarou Hiraki, Font Silo. 1990-2015
+   Copyright (C) Katayama Hirofumi MZ <katayama.hirofumi.mz@gmail.com>
+   License: SIL Open Font License 1.1 */
+/* The hankaku font bits, for a constexpr array.
+   Generated from KH-Dot-Kodenmachou-16-Ki-ASCII.xbm by make_ascii_bits.cpp.
+   DO NOT EDIT. */
+static const int kh_dot_hankaku_width = 128;
+static const int kh_dot_hankaku_height = 256;
+static TEXTCANVAS_FONT_CONSTEXPR unsigned char kh_dot_hankaku_bits[] = {
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x0f, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x0f,
+   0x00, 0x00, 0x0f, 0x0f, 0x00, 0x09, 0x00, 0x09, 0x09, 0x09, 0x09, 0x09,
+   0x09, 0x00, 0x00, 0x09, 0x00, 0x00, 0x09, 0x09, 0x00, 0x09, 0x00, 0x09,
+   0x09, 0x09, 0x09, 0x09, 0x09, 0x00, 0x00, 0x09, 0x00, 0x00, 0x09, 0x09,
+   0x00, 0x09, 0x00, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x00, 0x00, 0x09,
+   0x00, 0x00, 0x09, 0x09, 0x00, 0x09, 0x00, 0x09, 0x09, 0x09, 0x09, 0x09,
+   0x09, 0x00, 0x00, 0x09, 0x18, 0x00, 0x09, 0x09, 0x00, 0x09, 0x00, 0x09,
+   0x09, 0x09, 0x09, 0x09, 0x09, 0x00, 0x00, 0x09, 0x18, 0x00, 0x09, 0x09,
+   0x00, 0x09, 0x00, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x00, 0x00, 0x09,
+   0x00, 0x00, 0x09, 0x09, 0x00, 0x09, 0x00, 0x09, 0x09, 0x09, 0x09, 0x09,
+   0x09, 0x00, 0x00, 0x09, 0x00, 0x00, 0x09, 0x09, 0x00, 0x09, 0x00, 0x09,
+   0x09, 0x09, 0x09, 0x09, 0x09, 0x00, 0x00, 0x09, 0x00, 0x00, 0x09, 0x09,
+   0x00, 0x0f, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x0f,
+   0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+   0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x09, 0x09,
+   0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x00, 0x00, 0x00, 0x00,
+   0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+   0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+   0x09, 0x09, 0x09, 0x09, 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x09, 0x09,
+   0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x00, 0x00, 0x00, 0x00,
+   0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+   0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+   0x09, 0x09, 0x09, 0x09, 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x09, 0x09,
+   0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x00, 0x00, 0x00, 0x00,
+   0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+   0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+   0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x08, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+   0x00, 0x00, 0x36, 0x00, 0x08, 0x00, 0x00, 0x0c, 0x20, 0x04, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x40, 0x00, 0x08, 0x36, 0x22, 0x1c, 0x06, 0x0e, 0x0c,
+   0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x08, 0x24, 0x22,
+   0x2a, 0x49, 0x11, 0x08, 0x10, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20,
+   0x00, 0x08, 0x24, 0x22, 0x49, 0x49, 0x11, 0x08, 0x08, 0x10, 0x08, 0x08,
+   0x00, 0x00, 0x00, 0x10, 0x00, 0x08, 0x12, 0x7f, 0x09, 0x29, 0x09, 0x04,
+   0x08, 0x10, 0x49, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x08, 0x00, 0x22,
+   0x0a, 0x16, 0x0a, 0x00, 0x08, 0x10, 0x2a, 0x08, 0x00, 0x00, 0x00, 0x10,
+   0x00, 0x08, 0x00, 0x22, 0x1c, 0x08, 0x26, 0x00, 0x08, 0x10, 0x1c, 0x7f,
+   0x00, 0x7f, 0x00, 0x08, 0x00, 0x08, 0x00, 0x22, 0x28, 0x34, 0x2a, 0x00,
+   0x08, 0x10, 0x1c, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x7f,
+   0x48, 0x4a, 0x29, 0x00, 0x08, 0x10, 0x2a, 0x08, 0x00, 0x00, 0x00, 0x04,
+   0x00, 0x00, 0x00, 0x22, 0x49, 0x49, 0x11, 0x00, 0x08, 0x10, 0x49, 0x08,
+   0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x00, 0x22, 0x49, 0x49, 0x11, 0x00,
+   0x10, 0x08, 0x08, 0x08, 0x18, 0x00, 0x18, 0x04, 0x00, 0x08, 0x00, 0x22,
+   0x2a, 0x30, 0x11, 0x00, 0x10, 0x08, 0x00, 0x00, 0x18, 0x00, 0x18, 0x02,
+   0x00, 0x08, 0x00, 0x00, 0x1c, 0x00, 0x6e, 0x00, 0x20, 0x04, 0x00, 0x00,
+   0x10, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+   0x40, 0x02, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+   0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x01,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x01, 0x00, 0x18, 0x10, 0x3c, 0x1c,
+   0x20, 0x3e, 0x38, 0x7e, 0x18, 0x18, 0x00, 0x00, 0x20, 0x00, 0x02, 0x1c,
+   0x24, 0x10, 0x42, 0x22, 0x30, 0x02, 0x44, 0x40, 0x24, 0x24, 0x00, 0x00,
+   0x10, 0x00, 0x04, 0x22, 0x42, 0x1c, 0x42, 0x42, 0x30, 0x02, 0x42, 0x40,
+   0x42, 0x42, 0x00, 0x00, 0x08, 0x00, 0x08, 0x41, 0x42, 0x10, 0x40, 0x40,
+   0x28, 0x02, 0x02, 0x20, 0x42, 0x42, 0x18, 0x18, 0x04, 0x00, 0x10, 0x41,
+   0x42, 0x10, 0x20, 0x20, 0x28, 0x1a, 0x1a, 0x20, 0x24, 0x42, 0x18, 0x18,
+   0x02, 0x7f, 0x20, 0x20, 0x42, 0x10, 0x10, 0x1c, 0x24, 0x26, 0x26, 0x10,
+   0x18, 0x42, 0x00, 0x00, 0x01, 0x00, 0x40, 0x10, 0x42, 0x10, 0x10, 0x20,
+   0x24, 0x42, 0x42, 0x10, 0x24, 0x64, 0x00, 0x00, 0x02, 0x00, 0x20, 0x08,
+   0x42, 0x10, 0x08, 0x40, 0x22, 0x40, 0x42, 0x10, 0x42, 0x58, 0x00, 0x00,
+   0x04, 0x7f, 0x10, 0x08, 0x42, 0x10, 0x04, 0x40, 0x7e, 0x40, 0x42, 0x08,
+   0x42, 0x40, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x42, 0x10, 0x04, 0x42,
+   0x20, 0x42, 0x42, 0x08, 0x42, 0x42, 0x18, 0x18, 0x10, 0x00, 0x04, 0x08,
+   0x24, 0x10, 0x02, 0x22, 0x20, 0x22, 0x24, 0x08, 0x24, 0x22, 0x18, 0x18,
+   0x20, 0x00, 0x02, 0x08, 0x18, 0x10, 0x7e, 0x1c, 0x20, 0x1c, 0x18, 0x08,
+   0x18, 0x1c, 0x00, 0x10, 0x40, 0x00, 0x01, 0x08, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x1c, 0x08, 0x1f, 0x3c, 0x0f, 0x7f, 0x7f, 0x3c, 0x41, 0x08, 0x20, 0x21,
+   0x01, 0x41, 0x41, 0x1c, 0x22, 0x08, 0x21, 0x42, 0x11, 0x01, 0x01, 0x42,
+   0x41, 0x08, 0x20, 0x21, 0x01, 0x63, 0x43, 0x22, 0x41, 0x08, 0x21, 0x42,
+   0x21, 0x01, 0x01, 0x42, 0x41, 0x08, 0x20, 0x11, 0x01, 0x63, 0x45, 0x22,
+   0x59, 0x14, 0x21, 0x01, 0x21, 0x01, 0x01, 0x01, 0x41, 0x08, 0x20, 0x11,
+   0x01, 0x55, 0x45, 0x41, 0x55, 0x14, 0x11, 0x01, 0x41, 0x01, 0x01, 0x01,
+   0x41, 0x08, 0x20, 0x0b, 0x01, 0x55, 0x49, 0x41, 0x55, 0x14, 0x1f, 0x01,
+   0x41, 0x3f, 0x3f, 0x01, 0x7f, 0x08, 0x20, 0x05, 0x01, 0x49, 0x49, 0x41,
+   0x55, 0x22, 0x21, 0x01, 0x41, 0x01, 0x01, 0x79, 0x41, 0x08, 0x20, 0x09,
+   0x01, 0x49, 0x51, 0x41, 0x55, 0x22, 0x41, 0x01, 0x41, 0x01, 0x01, 0x41,
+   0x41, 0x08, 0x20, 0x11, 0x01, 0x41, 0x51, 0x41, 0x39, 0x3e, 0x41, 0x41,
+   0x21, 0x01, 0x01, 0x41, 0x41, 0x08, 0x20, 0x11, 0x01, 0x41, 0x61, 0x41,
+   0x02, 0x41, 0x41, 0x42, 0x21, 0x01, 0x01, 0x42, 0x41, 0x08, 0x20, 0x21,
+   0x01, 0x41, 0x61, 0x22, 0x42, 0x41, 0x21, 0x42, 0x11, 0x01, 0x01, 0x62,
+   0x41, 0x08, 0x20, 0x41, 0x01, 0x41, 0x41, 0x22, 0x3c, 0x41, 0x1f, 0x3c,
+   0x0f, 0x7f, 0x01, 0x5c, 0x41, 0x08, 0x22, 0x41, 0x7f, 0x41, 0x41, 0x1c,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x3e, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+   0x00, 0x20, 0x08, 0x00, 0x1f, 0x1c, 0x1f, 0x1e, 0x7f, 0x41, 0x41, 0x41,
+   0x41, 0x41, 0x7f, 0x04, 0x41, 0x20, 0x14, 0x00, 0x21, 0x22, 0x21, 0x21,
+   0x08, 0x41, 0x41, 0x41, 0x41, 0x41, 0x20, 0x04, 0x41, 0x20, 0x22, 0x00,
+   0x41, 0x22, 0x41, 0x21, 0x08, 0x41, 0x41, 0x41, 0x22, 0x22, 0x20, 0x04,
+   0x22, 0x20, 0x41, 0x00, 0x41, 0x41, 0x41, 0x01, 0x08, 0x41, 0x22, 0x41,
+   0x22, 0x22, 0x10, 0x04, 0x22, 0x20, 0x00, 0x00, 0x41, 0x41, 0x21, 0x06,
+   0x08, 0x41, 0x22, 0x49, 0x14, 0x14, 0x10, 0x04, 0x14, 0x20, 0x00, 0x00,
+   0x21, 0x41, 0x1f, 0x18, 0x08, 0x41, 0x22, 0x49, 0x08, 0x14, 0x08, 0x04,
+   0x7f, 0x20, 0x00, 0x00, 0x1f, 0x41, 0x21, 0x20, 0x08, 0x41, 0x14, 0x55,
+   0x14, 0x08, 0x04, 0x04, 0x08, 0x20, 0x00, 0x00, 0x01, 0x4d, 0x21, 0x40,
+   0x08, 0x41, 0x14, 0x55, 0x14, 0x08, 0x04, 0x04, 0x7f, 0x20, 0x00, 0x00,
+   0x01, 0x51, 0x41, 0x41, 0x08, 0x41, 0x14, 0x22, 0x22, 0x08, 0x02, 0x04,
+   0x08, 0x20, 0x00, 0x00, 0x01, 0x22, 0x41, 0x41, 0x08, 0x41, 0x08, 0x22,
+   0x22, 0x08, 0x02, 0x04, 0x08, 0x20, 0x00, 0x00, 0x01, 0x22, 0x41, 0x21,
+   0x08, 0x22, 0x08, 0x22, 0x41, 0x08, 0x01, 0x04, 0x08, 0x20, 0x00, 0x00,
+   0x01, 0x5c, 0x41, 0x1e, 0x08, 0x1c, 0x08, 0x22, 0x41, 0x08, 0x7f, 0x7c,
+   0x08, 0x3e, 0x00, 0x7f, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x01, 0x00, 0x40, 0x00, 0x70, 0x00, 0x01, 0x08, 0x20, 0x01,
+   0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0x40, 0x00, 0x08, 0x00,
+   0x01, 0x08, 0x20, 0x01, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x01, 0x00,
+   0x40, 0x00, 0x08, 0x00, 0x01, 0x08, 0x20, 0x01, 0x08, 0x00, 0x00, 0x00,
+   0x08, 0x00, 0x01, 0x00, 0x40, 0x00, 0x08, 0x00, 0x01, 0x00, 0x00, 0x01,
+   0x08, 0x00, 0x00, 0x00, 0x18, 0x00, 0x01, 0x00, 0x40, 0x00, 0x08, 0x00,
+   0x01, 0x00, 0x00, 0x01, 0x08, 0x00, 0x00, 0x00, 0x18, 0x3e, 0x1d, 0x1c,
+   0x5c, 0x1c, 0x3e, 0x5c, 0x3d, 0x08, 0x20, 0x21, 0x08, 0x37, 0x3d, 0x1c,
+   0x00, 0x40, 0x23, 0x22, 0x62, 0x22, 0x08, 0x62, 0x43, 0x08, 0x20, 0x21,
+   0x08, 0x49, 0x43, 0x22, 0x00, 0x40, 0x41, 0x41, 0x41, 0x41, 0x08, 0x41,
+   0x41, 0x08, 0x20, 0x11, 0x08, 0x49, 0x41, 0x41, 0x00, 0x40, 0x41, 0x01,
+   0x41, 0x41, 0x08, 0x41, 0x41, 0x08, 0x20, 0x0b, 0x08, 0x49, 0x41, 0x41,
+   0x00, 0x7e, 0x41, 0x01, 0x41, 0x7f, 0x08, 0x41, 0x41, 0x08, 0x20, 0x05,
+   0x08, 0x49, 0x41, 0x41, 0x00, 0x41, 0x41, 0x41, 0x41, 0x01, 0x08, 0x41,
+   0x41, 0x08, 0x20, 0x09, 0x08, 0x49, 0x41, 0x41, 0x00, 0x41, 0x41, 0x41,
+   0x41, 0x01, 0x08, 0x41, 0x41, 0x08, 0x20, 0x11, 0x08, 0x49, 0x41, 0x41,
+   0x00, 0x61, 0x23, 0x22, 0x62, 0x42, 0x08, 0x72, 0x41, 0x08, 0x20, 0x21,
+   0x08, 0x49, 0x41, 0x22, 0x00, 0x5e, 0x1d, 0x1c, 0x5c, 0x3c, 0x08, 0x4c,
+   0x41, 0x08, 0x22, 0x41, 0x08, 0x49, 0x41, 0x1c, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x1c, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x40, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x04, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+   0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x08, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x10, 0x00, 0x07,
+   0x1d, 0x5c, 0x3d, 0x1e, 0x3e, 0x41, 0x41, 0x41, 0x41, 0x41, 0x7f, 0x08,
+   0x08, 0x10, 0x00, 0x01, 0x23, 0x62, 0x43, 0x21, 0x08, 0x41, 0x41, 0x41,
+   0x22, 0x41, 0x20, 0x08, 0x08, 0x10, 0x00, 0x01, 0x41, 0x41, 0x01, 0x21,
+   0x08, 0x41, 0x41, 0x49, 0x22, 0x22, 0x10, 0x06, 0x08, 0x60, 0x18, 0x01,
+   0x41, 0x41, 0x01, 0x02, 0x08, 0x41, 0x22, 0x49, 0x14, 0x22, 0x08, 0x08,
+   0x08, 0x10, 0x18, 0x01, 0x41, 0x41, 0x01, 0x1c, 0x08, 0x41, 0x22, 0x55,
+   0x08, 0x14, 0x04, 0x08, 0x08, 0x10, 0x00, 0x01, 0x41, 0x41, 0x01, 0x20,
+   0x08, 0x41, 0x14, 0x22, 0x14, 0x14, 0x04, 0x08, 0x08, 0x10, 0x00, 0x01,
+   0x41, 0x41, 0x01, 0x41, 0x08, 0x41, 0x14, 0x22, 0x22, 0x08, 0x02, 0x08,
+   0x08, 0x10, 0x00, 0x01, 0x23, 0x62, 0x01, 0x41, 0x08, 0x61, 0x08, 0x22,
+   0x22, 0x08, 0x01, 0x10, 0x08, 0x08, 0x00, 0x07, 0x1d, 0x5c, 0x01, 0x3e,
+   0x30, 0x5e, 0x08, 0x22, 0x41, 0x04, 0x7f, 0x20, 0x08, 0x04, 0x00, 0x00,
+   0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40,
+   0x08, 0x02, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80,
+   0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+   0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+   0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+   0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+   0x80, 0x80, 0x80, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+   0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x80, 0x80, 0x80,
+   0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x7f, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+   0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00,
+   0x20, 0x08, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
+   0x00, 0x18, 0x7f, 0x7f, 0x20, 0x08, 0x00, 0x10, 0x04, 0x00, 0x3e, 0x44,
+   0x80, 0x00, 0x00, 0x20, 0x00, 0x18, 0x20, 0x40, 0x10, 0x7e, 0x3e, 0x7f,
+   0x74, 0x1e, 0x20, 0x49, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x28,
+   0x08, 0x42, 0x08, 0x10, 0x4f, 0x10, 0x20, 0x4a, 0x00, 0x00, 0x00, 0x20,
+   0x02, 0x00, 0x20, 0x18, 0x0c, 0x42, 0x08, 0x18, 0x24, 0x10, 0x3e, 0x22,
+   0x00, 0x0c, 0x00, 0x20, 0x04, 0x00, 0x10, 0x08, 0x0b, 0x42, 0x08, 0x14,
+   0x04, 0x10, 0x20, 0x20, 0x00, 0x12, 0x00, 0x20, 0x08, 0x00, 0x10, 0x08,
+   0x08, 0x20, 0x08, 0x14, 0x08, 0x10, 0x20, 0x10, 0x00, 0x12, 0x00, 0x20,
+   0x18, 0x00, 0x08, 0x08, 0x08, 0x20, 0x7f, 0x12, 0x08, 0x7f, 0x20, 0x08,
+   0x00, 0x0c, 0x00, 0x3e, 0x10, 0x00, 0x06, 0x04, 0x08, 0x10, 0x00, 0x11,
+   0x08, 0x00, 0x3e, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+   0x08, 0x0c, 0x00, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x20, 0x08, 0x00, 0x10, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x10, 0x08, 0x08,
+   0x08, 0x04, 0x00, 0x10, 0x02, 0x00, 0x04, 0x40, 0x00, 0x7f, 0x20, 0x08,
+   0x00, 0x10, 0x08, 0x08, 0x08, 0x04, 0x00, 0x12, 0x0c, 0x3e, 0x04, 0x41,
+   0x00, 0x40, 0x10, 0x7f, 0x3e, 0x10, 0x08, 0x38, 0x7c, 0x04, 0x7f, 0x12,
+   0x00, 0x20, 0x04, 0x42, 0x00, 0x40, 0x10, 0x41, 0x08, 0x7f, 0x7f, 0x0f,
+   0x44, 0x02, 0x40, 0x12, 0x00, 0x10, 0x74, 0x42, 0x00, 0x28, 0x08, 0x41,
+   0x08, 0x10, 0x48, 0x08, 0x22, 0x7e, 0x40, 0x7f, 0x41, 0x10, 0x4f, 0x22,
+   0x00, 0x18, 0x0c, 0x21, 0x08, 0x18, 0x44, 0x08, 0x22, 0x12, 0x40, 0x12,
+   0x46, 0x08, 0x24, 0x20, 0x7f, 0x08, 0x0b, 0x21, 0x08, 0x18, 0x44, 0x78,
+   0x21, 0x11, 0x40, 0x12, 0x20, 0x08, 0x14, 0x20, 0x00, 0x08, 0x08, 0x20,
+   0x08, 0x14, 0x44, 0x0f, 0x10, 0x10, 0x40, 0x12, 0x20, 0x14, 0x04, 0x10,
+   0x00, 0x08, 0x08, 0x10, 0x08, 0x14, 0x22, 0x10, 0x10, 0x10, 0x40, 0x10,
+   0x10, 0x24, 0x04, 0x10, 0x00, 0x04, 0x08, 0x10, 0x08, 0x12, 0x22, 0x10,
+   0x08, 0x08, 0x40, 0x08, 0x08, 0x22, 0x04, 0x08, 0x00, 0x04, 0x08, 0x08,
+   0x7f, 0x11, 0x21, 0x10, 0x08, 0x08, 0x7f, 0x08, 0x04, 0x42, 0x78, 0x08,
+   0x00, 0x02, 0x08, 0x04, 0x00, 0x10, 0x19, 0x10, 0x04, 0x04, 0x40, 0x04,
+   0x03, 0x41, 0x00, 0x04, 0x00, 0x01, 0x08, 0x02, 0x00, 0x10, 0x00, 0x10,
+   0x02, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00,
+   0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x20, 0x00, 0x00,
+   0x04, 0x08, 0x00, 0x00, 0x08, 0x40, 0x00, 0x02, 0x00, 0x00, 0x08, 0x00,
+   0x08, 0x18, 0x44, 0x3e, 0x04, 0x08, 0x00, 0x7e, 0x00, 0x40, 0x10, 0x02,
+   0x7e, 0x00, 0x08, 0x00, 0x7c, 0x0e, 0x45, 0x00, 0x04, 0x08, 0x3e, 0x40,
+   0x3e, 0x40, 0x14, 0x02, 0x40, 0x0c, 0x08, 0x7f, 0x44, 0x08, 0x49, 0x00,
+   0x04, 0x08, 0x00, 0x20, 0x20, 0x40, 0x24, 0x32, 0x40, 0x14, 0x7f, 0x40,
+   0x42, 0x08, 0x4a, 0x00, 0x1c, 0x7f, 0x00, 0x26, 0x10, 0x20, 0x24, 0x0e,
+   0x20, 0x14, 0x08, 0x40, 0x2e, 0x7f, 0x42, 0x7f, 0x24, 0x08, 0x00, 0x18,
+   0x10, 0x20, 0x24, 0x02, 0x20, 0x22, 0x08, 0x22, 0x31, 0x08, 0x20, 0x08,
+   0x44, 0x08, 0x00, 0x10, 0x18, 0x10, 0x44, 0x02, 0x10, 0x22, 0x28, 0x14,
+   0x20, 0x08, 0x20, 0x08, 0x04, 0x08, 0x00, 0x10, 0x2c, 0x10, 0x42, 0x02,
+   0x10, 0x42, 0x2a, 0x08, 0x10, 0x08, 0x10, 0x08, 0x04, 0x08, 0x00, 0x28,
+   0x4b, 0x08, 0x42, 0x02, 0x08, 0x41, 0x4a, 0x08, 0x10, 0x04, 0x10, 0x08,
+   0x04, 0x08, 0x7f, 0x44, 0x48, 0x04, 0x42, 0x02, 0x08, 0x40, 0x49, 0x10,
+   0x08, 0x04, 0x08, 0x04, 0x04, 0x04, 0x00, 0x42, 0x08, 0x02, 0x41, 0x7c,
+   0x04, 0x00, 0x49, 0x10, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x01,
+   0x08, 0x01, 0x00, 0x00, 0x02, 0x00, 0x08, 0x00, 0x02, 0x02, 0x02, 0x02,
+   0x04, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x06,
+   0x06, 0x08, 0x20, 0x00, 0x04, 0x00, 0x00, 0x3e, 0x22, 0x08, 0x02, 0x00,
+   0x00, 0x00, 0x05, 0x09, 0x18, 0x08, 0x20, 0x3f, 0x04, 0x00, 0x3f, 0x00,
+   0x22, 0x0a, 0x02, 0x00, 0x7f, 0x01, 0x09, 0x09, 0x20, 0x08, 0x20, 0x04,
+   0x74, 0x1e, 0x20, 0x00, 0x22, 0x0a, 0x02, 0x7e, 0x41, 0x02, 0x0a, 0x06,
+   0x00, 0x08, 0x22, 0x04, 0x4c, 0x10, 0x20, 0x00, 0x22, 0x0a, 0x02, 0x42,
+   0x41, 0x44, 0x02, 0x00, 0x06, 0x04, 0x14, 0x04, 0x2b, 0x10, 0x20, 0x7f,
+   0x22, 0x0a, 0x02, 0x42, 0x41, 0x40, 0x00, 0x00, 0x08, 0x14, 0x18, 0x7f,
+   0x18, 0x10, 0x3e, 0x40, 0x22, 0x4a, 0x42, 0x42, 0x21, 0x40, 0x00, 0x00,
+   0x10, 0x14, 0x10, 0x04, 0x08, 0x10, 0x20, 0x20, 0x22, 0x4a, 0x42, 0x42,
+   0x20, 0x20, 0x00, 0x00, 0x00, 0x24, 0x28, 0x04, 0x08, 0x10, 0x20, 0x20,
+   0x22, 0x4a, 0x22, 0x42, 0x20, 0x20, 0x00, 0x00, 0x03, 0x32, 0x28, 0x04,
+   0x08, 0x10, 0x20, 0x10, 0x20, 0x2a, 0x12, 0x42, 0x10, 0x10, 0x00, 0x00,
+   0x0c, 0x4e, 0x44, 0x04, 0x10, 0x10, 0x20, 0x10, 0x10, 0x29, 0x0a, 0x42,
+   0x10, 0x08, 0x00, 0x00, 0x10, 0x43, 0x42, 0x78, 0x10, 0x7f, 0x3f, 0x08,
+   0x10, 0x19, 0x06, 0x7e, 0x08, 0x04, 0x00, 0x00, 0x20, 0x00, 0x01, 0x00,
+   0x10, 0x00, 0x20, 0x04, 0x08, 0x09, 0x00, 0x42, 0x04, 0x03, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+   0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80,
+   0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+   0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+   0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+   0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+   0x80, 0x80, 0x80, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+   0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x80, 0x80, 0x80,
+   0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00
+};
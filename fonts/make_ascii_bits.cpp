@@ -0,0 +1,73 @@
+// make_ascii_bits.cpp --- make the hankaku font bits from the XBM file
+//    ex) g++ make_ascii_bits.cpp -o make_ascii_bits
+//        ./make_ascii_bits KH-Dot-Kodenmachou-16-Ki-ASCII.xbm > KH-Dot-Kodenmachou-16-Ki-ASCII-bits.h
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+int main(int argc, char **argv)
+{
+    if (argc != 2)
+    {
+        fprintf(stderr, "usage: make_ascii_bits file.xbm\n");
+        return 1;
+    }
+    FILE *fp = fopen(argv[1], "r");
+    if (!fp)
+    {
+        fprintf(stderr, "cannot open %s\n", argv[1]);
+        return 1;
+    }
+
+    // the sizes from "#define ..._width" and "#define ..._height",
+    // the bytes from the initializer
+    int width = 0, height = 0;
+    std::vector<int> bytes;
+    char line[256];
+    bool in_bits = false;
+    while (fgets(line, sizeof(line), fp))
+    {
+        if (!in_bits)
+        {
+            const char *p = strstr(line, "_width ");
+            if (strncmp(line, "#define", 7) == 0 && p)
+                width = atoi(p + 7);
+            p = strstr(line, "_height ");
+            if (strncmp(line, "#define", 7) == 0 && p)
+                height = atoi(p + 8);
+            if (strchr(line, '{'))
+                in_bits = true;
+            continue;
+        }
+        for (char *p = strstr(line, "0x"); p; p = strstr(p + 2, "0x"))
+            bytes.push_back(int(strtol(p, NULL, 16)));
+    }
+    fclose(fp);
+    if (width <= 0 || height <= 0 ||
+        bytes.size() != size_t((width + 7) / 8 * height))
+    {
+        fprintf(stderr, "invalid XBM file\n");
+        return 1;
+    }
+
+    printf("/* Copyright (c) Keitarou Hiraki, Font Silo. 1990-2015\n");
+    printf("   Copyright (C) Katayama Hirofumi MZ <katayama.hirofumi.mz@gmail.com>\n");
+    printf("   License: SIL Open Font License 1.1 */\n");
+    printf("/* The hankaku font bits, for a constexpr array.\n");
+    printf("   Generated from KH-Dot-Kodenmachou-16-Ki-ASCII.xbm by make_ascii_bits.cpp.\n");
+    printf("   DO NOT EDIT. */\n");
+    printf("static const int kh_dot_hankaku_width = %d;\n", width);
+    printf("static const int kh_dot_hankaku_height = %d;\n", height);
+    printf("static TEXTCANVAS_FONT_CONSTEXPR unsigned char kh_dot_hankaku_bits[] = {\n");
+    for (size_t i = 0; i < bytes.size(); ++i)
+    {
+        if (i % 12 == 0)
+            printf("  ");
+        printf(" 0x%02x%s", bytes[i], i + 1 < bytes.size() ? "," : "");
+        if (i % 12 == 11 || i + 1 == bytes.size())
+            printf("\n");
+    }
+    printf("};\n");
+    return 0;
+}
@@ -0,0 +1,231 @@
+// make_subset_font.cpp --- make a subset of the JIS X 0208 font
+//    ex) g++ -I.. make_subset_font.cpp -o make_subset_font
+//        ./make_subset_font -n my_font corpus.txt > my_font.h
+//
+// It collects the zenkaku characters of the input text (UTF-8, Shift_JIS
+// or EUC-JP) and writes an atlas of only those cells with a sorted table
+// of their JIS codes. Use it after TextCanvas.hpp as:
+//
+//    #include "my_font.h"
+//    static const textcanvas::XbmFont font(
+//        my_font_width, my_font_height, my_font_bits,
+//        my_font_columns, my_font_rows, my_font_cell_width,
+//        my_font_cell_height, my_font_codes, my_font_count);
+#include "TextCanvas.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <set>
+#include <string>
+
+enum Encoding
+{
+    ENCODING_UTF8,
+    ENCODING_SJIS,
+    ENCODING_EUCJP
+};
+
+struct CodeSink
+{
+    std::set<uint16_t>& m_codes;
+    CodeSink(std::set<uint16_t>& codes) : m_codes(codes)
+    {
+    }
+    void hankaku(uint8_t)
+    {
+    }
+    void zenkaku(uint16_t jis_code)
+    {
+        m_codes.insert(jis_code);
+    }
+};
+
+static bool ReadFile(FILE *fp, std::string& data)
+{
+    char buf[4096];
+    size_t len;
+    while ((len = fread(buf, 1, sizeof(buf), fp)) > 0)
+        data.append(buf, len);
+    return !ferror(fp);
+}
+
+static void CollectCodes(const std::string& data, Encoding encoding,
+                         std::set<uint16_t>& codes)
+{
+    const char *str = data.c_str();
+    const size_t len = data.size();
+    switch (encoding)
+    {
+    case ENCODING_UTF8:
+        for (size_t i = 0; i < len;)
+        {
+            size_t used;
+            uint32_t ucs = japanese::utf8_decode(str + i, len - i, used);
+            i += used;
+            uint8_t ch;
+            if (japanese::unicode2hankaku(ucs, ch))
+                continue;
+            uint16_t jis_code = japanese::unicode2jis(ucs);
+            if (jis_code)
+                codes.insert(jis_code);
+        }
+        break;
+    case ENCODING_SJIS:
+        for (size_t i = 0; i + 1 < len; ++i)
+        {
+            if (japanese::is_sjis_lead(str[i]) &&
+                japanese::is_sjis_trail(str[i + 1]))
+            {
+                codes.insert(japanese::sjis2jis(str[i], str[i + 1]));
+                ++i;
+            }
+        }
+        break;
+    case ENCODING_EUCJP:
+        {
+            CodeSink sink(codes);
+            japanese::EucJpDecoder decoder;
+            decoder.feed(str, len, sink);
+            decoder.flush(sink);
+        }
+        break;
+    }
+}
+
+static void Usage(void)
+{
+    fprintf(stderr,
+        "Usage: make_subset_font [OPTIONS] [FILE ...]\n"
+        "Options:\n"
+        "  -n NAME     the prefix of the names (default: subset_font)\n"
+        "  -c COLUMNS  the columns of the atlas (default: 16)\n"
+        "  -s          the input is Shift_JIS\n"
+        "  -e          the input is EUC-JP\n"
+        "  -u          the input is UTF-8 (default)\n"
+        "The standard input is read if no FILE is given.\n");
+}
+
+int main(int argc, char **argv)
+{
+    std::string name = "subset_font";
+    textcanvas::coord_t columns = 16;
+    Encoding encoding = ENCODING_UTF8;
+    std::set<uint16_t> codes;
+    bool has_file = false;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+            name = argv[++i];
+        else if (strcmp(argv[i], "-c") == 0 && i + 1 < argc)
+            columns = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-s") == 0)
+            encoding = ENCODING_SJIS;
+        else if (strcmp(argv[i], "-e") == 0)
+            encoding = ENCODING_EUCJP;
+        else if (strcmp(argv[i], "-u") == 0)
+            encoding = ENCODING_UTF8;
+        else if (argv[i][0] == '-')
+        {
+            Usage();
+            return 1;
+        }
+        else
+        {
+            FILE *fp = fopen(argv[i], "rb");
+            std::string data;
+            if (!fp || !ReadFile(fp, data))
+            {
+                fprintf(stderr, "cannot read '%s'\n", argv[i]);
+                if (fp)
+                    fclose(fp);
+                return 1;
+            }
+            fclose(fp);
+            CollectCodes(data, encoding, codes);
+            has_file = true;
+        }
+    }
+    if (columns <= 0)
+    {
+        Usage();
+        return 1;
+    }
+    if (!has_file)
+    {
+        std::string data;
+        if (!ReadFile(stdin, data))
+        {
+            fprintf(stderr, "cannot read the standard input\n");
+            return 1;
+        }
+        CollectCodes(data, encoding, codes);
+    }
+
+    // the geta mark stands for the missing characters
+    codes.insert(japanese::jis_geta_mark);
+
+    const textcanvas::XbmFont& font = textcanvas::kh_dot_zenkaku_font();
+    const textcanvas::coord_t cx = font.cell_width(), cy = font.cell_height();
+    const textcanvas::coord_t count = textcanvas::coord_t(codes.size());
+    const textcanvas::coord_t rows = (count + columns - 1) / columns;
+    textcanvas::XbmImage atlas(columns * cx, rows * cy);
+
+    textcanvas::coord_t index = 0;
+    std::set<uint16_t>::const_iterator it, end = codes.end();
+    for (it = codes.begin(); it != end; ++it, ++index)
+    {
+        textcanvas::Point cell = font.jis_cell(*it);
+        textcanvas::coord_t x0 = (index % columns) * cx;
+        textcanvas::coord_t y0 = (index / columns) * cy;
+        for (textcanvas::coord_t y = 0; y < cy; ++y)
+        {
+            for (textcanvas::coord_t x = 0; x < cx; ++x)
+            {
+                if (font.get_dot(cell.x * cx + x, cell.y * cy + y))
+                    atlas.put_dot(x0 + x, y0 + y, true);
+            }
+        }
+    }
+
+    const char *n = name.c_str();
+    printf("/* Copyright (c) Keitarou Hiraki, Font Silo. 1990-2015\n");
+    printf("   Copyright (C) Katayama Hirofumi MZ <katayama.hirofumi.mz@gmail.com>\n");
+    printf("   License: SIL Open Font License 1.1 */\n");
+    printf("/* A subset of \"KH Dot Kodenmachou 16 Ki\" (%d characters).\n",
+           int(count));
+    printf("   Generated by make_subset_font.cpp. DO NOT EDIT. */\n");
+    printf("#define %s_width %d\n", n, int(atlas.width()));
+    printf("#define %s_height %d\n", n, int(atlas.height()));
+    printf("#define %s_columns %d\n", n, int(columns));
+    printf("#define %s_rows %d\n", n, int(rows));
+    printf("#define %s_cell_width %d\n", n, int(cx));
+    printf("#define %s_cell_height %d\n", n, int(cy));
+    printf("#define %s_count %d\n", n, int(count));
+    printf("static unsigned char %s_bits[] = {\n", n);
+    for (textcanvas::coord_t i = 0; i < atlas.size(); ++i)
+    {
+        if (i % 12 == 0)
+            printf("  ");
+        printf(" 0x%02X", atlas.data()[i]);
+        if (i + 1 < atlas.size())
+            printf(",");
+        if (i % 12 == 11 || i + 1 == atlas.size())
+            printf("\n");
+    }
+    printf("};\n");
+    printf("static const uint16_t %s_codes[] = {\n", n);
+    index = 0;
+    for (it = codes.begin(); it != end; ++it, ++index)
+    {
+        if (index % 12 == 0)
+            printf("  ");
+        printf(" 0x%04X", *it);
+        if (index + 1 < count)
+            printf(",");
+        if (index % 12 == 11 || index + 1 == count)
+            printf("\n");
+    }
+    printf("};\n");
+    return 0;
+}
@@ -0,0 +1,121 @@
+// make_unicode_table.cpp --- make Unicode to JIS X 0208 table by iconv
+//    ex) g++ -I.. make_unicode_table.cpp -o make_unicode_table
+//        ./make_unicode_table > unicode_jis_table.h
+#include <iconv.h>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "japanese.hpp"
+
+typedef std::vector<uint16_t> Page;
+
+static uint32_t ConvertToUnicode(iconv_t cd, const char *src, size_t src_len)
+{
+    unsigned char buf[8];
+    char *in = const_cast<char *>(src);
+    char *out = reinterpret_cast<char *>(buf);
+    size_t in_left = src_len, out_left = sizeof(buf);
+    iconv(cd, NULL, NULL, NULL, NULL);
+    if (iconv(cd, &in, &in_left, &out, &out_left) == (size_t)-1)
+        return 0;
+    if (in_left != 0 || sizeof(buf) - out_left != 4)
+        return 0;
+    return buf[0] | (buf[1] << 8) | (buf[2] << 16) | (uint32_t(buf[3]) << 24);
+}
+
+int main(void)
+{
+    // pages[high byte of codepoint][low byte] = JIS code (or zero)
+    std::vector<Page> pages(256, Page(256, 0));
+
+    iconv_t euc = iconv_open("UTF-32LE", "EUC-JP");
+    iconv_t cp932 = iconv_open("UTF-32LE", "CP932");
+    if (euc == (iconv_t)-1 || cp932 == (iconv_t)-1)
+    {
+        fprintf(stderr, "iconv_open failed\n");
+        return 1;
+    }
+
+    // EUC-JP gives the standard JIS X 0208 mapping;
+    // CP932 adds the Windows variants (U+FF5E, U+2225, ...)
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        for (int iy = 0x21; iy <= 0x7E; ++iy)
+        {
+            for (int ix = 0x21; ix <= 0x7E; ++ix)
+            {
+                uint16_t jis = uint16_t((iy << 8) | ix);
+                uint32_t ucs;
+                if (pass == 0)
+                {
+                    char buf[2] = { char(iy | 0x80), char(ix | 0x80) };
+                    ucs = ConvertToUnicode(euc, buf, 2);
+                }
+                else
+                {
+                    uint16_t sjis = japanese::jis2sjis(jis);
+                    char buf[2] = { char(sjis >> 8), char(sjis) };
+                    ucs = ConvertToUnicode(cp932, buf, 2);
+                }
+                if (ucs < 0x80 || ucs > 0xFFFF)
+                    continue;
+                uint16_t& entry = pages[ucs >> 8][ucs & 0xFF];
+                if (entry == 0)
+                    entry = jis;
+            }
+        }
+    }
+    iconv_close(euc);
+    iconv_close(cp932);
+
+    // page zero is the shared empty page
+    std::vector<int> index(256, 0);
+    std::vector<int> used;
+    for (int hi = 0; hi < 256; ++hi)
+    {
+        for (int lo = 0; lo < 256; ++lo)
+        {
+            if (pages[hi][lo])
+            {
+                used.push_back(hi);
+                index[hi] = int(used.size());
+                break;
+            }
+        }
+    }
+
+    printf("/* Unicode (BMP) to JIS X 0208 two-level page table.\n");
+    printf("   Generated by make_unicode_table.cpp. DO NOT EDIT. */\n");
+    printf("static const int unicode_jis_page_count = %d;\n",
+           int(used.size()) + 1);
+    printf("static const unsigned char unicode_jis_index[256] = {\n");
+    for (int hi = 0; hi < 256; ++hi)
+    {
+        if (hi % 16 == 0)
+            printf("   ");
+        printf(" %3d,", index[hi]);
+        if (hi % 16 == 15)
+            printf("\n");
+    }
+    printf("};\n");
+    printf("static const unsigned short "
+           "unicode_jis_pages[unicode_jis_page_count][256] = {\n");
+    for (size_t k = 0; k <= used.size(); ++k)
+    {
+        if (k == 0)
+            printf("  { /* empty */\n");
+        else
+            printf("  { /* U+%02Xxx */\n", used[k - 1]);
+        for (int lo = 0; lo < 256; ++lo)
+        {
+            if (lo % 12 == 0)
+                printf("   ");
+            printf(" 0x%04X,", k ? pages[used[k - 1]][lo] : 0);
+            if (lo % 12 == 11 || lo == 255)
+                printf("\n");
+        }
+        printf("  },\n");
+    }
+    printf("};\n");
+    return 0;
+}
@@ -0,0 +1,2399 @@
+/* Unicode (BMP) to JIS X 0208 two-level page table.
+   Generated by make_unicode_table.cpp. DO NOT EDIT. */
+static const int unicode_jis_page_count = 99;
+static const unsigned char unicode_jis_index[256] = {
+      1,   0,   0,   2,   3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      4,   5,   6,   7,   8,   9,  10,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+     11,   0,  12,  13,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  29,  30,  31,
+     32,  33,  34,  35,  36,  37,  38,  39,  40,  41,  42,  43,  44,  45,  46,  47,
+     48,  49,  50,  51,  52,  53,  54,  55,  56,  57,  58,  59,  60,  61,  62,  63,
+     64,  65,  66,  67,  68,  69,  70,  71,  72,  73,  74,  75,  76,  77,  78,  79,
+     80,  81,  82,  83,  84,  85,  86,  87,  88,  89,  90,  91,  92,  93,  94,  95,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,  96,  97,   0,   0,   0,   0,  98,
+};
+static const unsigned short unicode_jis_pages[unicode_jis_page_count][256] = {
+  { /* empty */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+00xx */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2171, 0x2172, 0x0000, 0x0000, 0x0000, 0x2178,
+    0x212F, 0x0000, 0x0000, 0x0000, 0x224C, 0x0000, 0x0000, 0x0000, 0x216B, 0x215E, 0x0000, 0x0000,
+    0x212D, 0x0000, 0x2279, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x215F,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2160, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+03xx */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x2621, 0x2622, 0x2623, 0x2624, 0x2625, 0x2626, 0x2627, 0x2628, 0x2629, 0x262A, 0x262B,
+    0x262C, 0x262D, 0x262E, 0x262F, 0x2630, 0x2631, 0x0000, 0x2632, 0x2633, 0x2634, 0x2635, 0x2636,
+    0x2637, 0x2638, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2641, 0x2642, 0x2643,
+    0x2644, 0x2645, 0x2646, 0x2647, 0x2648, 0x2649, 0x264A, 0x264B, 0x264C, 0x264D, 0x264E, 0x264F,
+    0x2650, 0x2651, 0x0000, 0x2652, 0x2653, 0x2654, 0x2655, 0x2656, 0x2657, 0x2658, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+04xx */
+    0x0000, 0x2727, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x2721, 0x2722, 0x2723, 0x2724, 0x2725, 0x2726, 0x2728, 0x2729,
+    0x272A, 0x272B, 0x272C, 0x272D, 0x272E, 0x272F, 0x2730, 0x2731, 0x2732, 0x2733, 0x2734, 0x2735,
+    0x2736, 0x2737, 0x2738, 0x2739, 0x273A, 0x273B, 0x273C, 0x273D, 0x273E, 0x273F, 0x2740, 0x2741,
+    0x2751, 0x2752, 0x2753, 0x2754, 0x2755, 0x2756, 0x2758, 0x2759, 0x275A, 0x275B, 0x275C, 0x275D,
+    0x275E, 0x275F, 0x2760, 0x2761, 0x2762, 0x2763, 0x2764, 0x2765, 0x2766, 0x2767, 0x2768, 0x2769,
+    0x276A, 0x276B, 0x276C, 0x276D, 0x276E, 0x276F, 0x2770, 0x2771, 0x0000, 0x2757, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+20xx */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x213E, 0x0000, 0x0000, 0x0000, 0x0000, 0x213D, 0x2142, 0x0000,
+    0x2146, 0x2147, 0x0000, 0x0000, 0x2148, 0x2149, 0x0000, 0x0000, 0x2277, 0x2278, 0x0000, 0x0000,
+    0x0000, 0x2145, 0x2144, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x2273, 0x0000, 0x216C, 0x216D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2228,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+21xx */
+    0x0000, 0x0000, 0x0000, 0x216E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2D62, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2D64, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2272, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x2D35, 0x2D36, 0x2D37, 0x2D38, 0x2D39, 0x2D3A, 0x2D3B, 0x2D3C, 0x2D3D, 0x2D3E, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x7C71, 0x7C72, 0x7C73, 0x7C74, 0x7C75, 0x7C76, 0x7C77, 0x7C78,
+    0x7C79, 0x7C7A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x222B, 0x222C, 0x222A, 0x222D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x224D, 0x0000, 0x224E, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+22xx */
+    0x224F, 0x0000, 0x225F, 0x2250, 0x0000, 0x0000, 0x0000, 0x2260, 0x223A, 0x0000, 0x0000, 0x223B,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2D74, 0x215D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x2265, 0x0000, 0x0000, 0x2267, 0x2167, 0x2D78, 0x225C, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x2142, 0x0000, 0x224A, 0x224B, 0x2241, 0x2240, 0x2269, 0x226A, 0x0000, 0x2D73, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x2168, 0x2268, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x2266, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2262, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x2162, 0x2261, 0x0000, 0x0000, 0x0000, 0x0000, 0x2165, 0x2166, 0x0000, 0x0000, 0x2263, 0x2264,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x223E, 0x223F,
+    0x0000, 0x0000, 0x223C, 0x223D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x225D, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2D79,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+23xx */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x225E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+24xx */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x2D21, 0x2D22, 0x2D23, 0x2D24, 0x2D25, 0x2D26, 0x2D27, 0x2D28, 0x2D29, 0x2D2A, 0x2D2B, 0x2D2C,
+    0x2D2D, 0x2D2E, 0x2D2F, 0x2D30, 0x2D31, 0x2D32, 0x2D33, 0x2D34, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+25xx */
+    0x2821, 0x282C, 0x2822, 0x282D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x2823, 0x0000, 0x0000, 0x282E, 0x2824, 0x0000, 0x0000, 0x282F, 0x2826, 0x0000, 0x0000, 0x2831,
+    0x2825, 0x0000, 0x0000, 0x2830, 0x2827, 0x283C, 0x0000, 0x0000, 0x2837, 0x0000, 0x0000, 0x2832,
+    0x2829, 0x283E, 0x0000, 0x0000, 0x2839, 0x0000, 0x0000, 0x2834, 0x2828, 0x0000, 0x0000, 0x2838,
+    0x283D, 0x0000, 0x0000, 0x2833, 0x282A, 0x0000, 0x0000, 0x283A, 0x283F, 0x0000, 0x0000, 0x2835,
+    0x282B, 0x0000, 0x0000, 0x283B, 0x0000, 0x0000, 0x2840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x2836, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x2223, 0x2222, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2225, 0x2224,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2227, 0x2226, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2221, 0x217E, 0x0000, 0x0000, 0x0000, 0x217B,
+    0x0000, 0x0000, 0x217D, 0x217C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x227E,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+26xx */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x217A, 0x2179, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x216A, 0x0000, 0x2169, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2276, 0x0000,
+    0x0000, 0x2275, 0x0000, 0x2274, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+30xx */
+    0x2121, 0x2122, 0x2123, 0x2137, 0x0000, 0x2139, 0x213A, 0x213B, 0x2152, 0x2153, 0x2154, 0x2155,
+    0x2156, 0x2157, 0x2158, 0x2159, 0x215A, 0x215B, 0x2229, 0x222E, 0x214C, 0x214D, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x2141, 0x2D60, 0x0000, 0x2D61, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2421, 0x2422, 0x2423, 0x2424, 0x2425, 0x2426, 0x2427,
+    0x2428, 0x2429, 0x242A, 0x242B, 0x242C, 0x242D, 0x242E, 0x242F, 0x2430, 0x2431, 0x2432, 0x2433,
+    0x2434, 0x2435, 0x2436, 0x2437, 0x2438, 0x2439, 0x243A, 0x243B, 0x243C, 0x243D, 0x243E, 0x243F,
+    0x2440, 0x2441, 0x2442, 0x2443, 0x2444, 0x2445, 0x2446, 0x2447, 0x2448, 0x2449, 0x244A, 0x244B,
+    0x244C, 0x244D, 0x244E, 0x244F, 0x2450, 0x2451, 0x2452, 0x2453, 0x2454, 0x2455, 0x2456, 0x2457,
+    0x2458, 0x2459, 0x245A, 0x245B, 0x245C, 0x245D, 0x245E, 0x245F, 0x2460, 0x2461, 0x2462, 0x2463,
+    0x2464, 0x2465, 0x2466, 0x2467, 0x2468, 0x2469, 0x246A, 0x246B, 0x246C, 0x246D, 0x246E, 0x246F,
+    0x2470, 0x2471, 0x2472, 0x2473, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x212B,
+    0x212C, 0x2135, 0x2136, 0x0000, 0x0000, 0x2521, 0x2522, 0x2523, 0x2524, 0x2525, 0x2526, 0x2527,
+    0x2528, 0x2529, 0x252A, 0x252B, 0x252C, 0x252D, 0x252E, 0x252F, 0x2530, 0x2531, 0x2532, 0x2533,
+    0x2534, 0x2535, 0x2536, 0x2537, 0x2538, 0x2539, 0x253A, 0x253B, 0x253C, 0x253D, 0x253E, 0x253F,
+    0x2540, 0x2541, 0x2542, 0x2543, 0x2544, 0x2545, 0x2546, 0x2547, 0x2548, 0x2549, 0x254A, 0x254B,
+    0x254C, 0x254D, 0x254E, 0x254F, 0x2550, 0x2551, 0x2552, 0x2553, 0x2554, 0x2555, 0x2556, 0x2557,
+    0x2558, 0x2559, 0x255A, 0x255B, 0x255C, 0x255D, 0x255E, 0x255F, 0x2560, 0x2561, 0x2562, 0x2563,
+    0x2564, 0x2565, 0x2566, 0x2567, 0x2568, 0x2569, 0x256A, 0x256B, 0x256C, 0x256D, 0x256E, 0x256F,
+    0x2570, 0x2571, 0x2572, 0x2573, 0x2574, 0x2575, 0x2576, 0x0000, 0x0000, 0x0000, 0x0000, 0x2126,
+    0x213C, 0x2133, 0x2134, 0x0000,
+  },
+  { /* U+32xx */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x2D6A, 0x2D6B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2D6C, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2D65, 0x2D66, 0x2D67, 0x2D68,
+    0x2D69, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+33xx */
+    0x0000, 0x0000, 0x0000, 0x2D46, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x2D4A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2D41, 0x0000, 0x0000, 0x0000,
+    0x2D44, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2D42, 0x2D4C,
+    0x0000, 0x0000, 0x2D4B, 0x2D45, 0x0000, 0x0000, 0x0000, 0x2D4D, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2D47, 0x0000, 0x0000, 0x0000, 0x0000, 0x2D4F,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x2D40, 0x2D4E, 0x0000, 0x0000, 0x2D43, 0x0000, 0x0000, 0x0000, 0x2D48, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x2D49, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x2D5F, 0x2D6F, 0x2D6E, 0x2D6D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2D53, 0x2D54,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x2D50, 0x2D51, 0x2D52, 0x0000, 0x0000, 0x2D56, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x2D55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x2D63, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+4Exx */
+    0x306C, 0x437A, 0x0000, 0x3C37, 0x0000, 0x0000, 0x0000, 0x4B7C, 0x3E66, 0x3B30, 0x3E65, 0x323C,
+    0x0000, 0x4954, 0x4D3F, 0x0000, 0x5022, 0x312F, 0x0000, 0x0000, 0x336E, 0x5023, 0x4024, 0x5242,
+    0x3556, 0x4A3A, 0x0000, 0x0000, 0x0000, 0x0000, 0x3E67, 0x0000, 0x0000, 0x4E3E, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x4A42, 0x0000, 0x792D, 0x0000, 0x5024, 0x0000, 0x0000, 0x4366, 0x0000, 0x0000,
+    0x0000, 0x5025, 0x367A, 0x0000, 0x0000, 0x0000, 0x5026, 0x0000, 0x345D, 0x4330, 0x0000, 0x3C67,
+    0x5027, 0x0000, 0x0000, 0x5028, 0x0000, 0x0000, 0x5029, 0x4735, 0x0000, 0x3557, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x4737, 0x0000, 0x4663, 0x3843, 0x4B33, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x6949, 0x502A, 0x3E68, 0x502B, 0x3235, 0x0000, 0x0000, 0x0000, 0x3665, 0x3870, 0x4C69,
+    0x0000, 0x0000, 0x5626, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4D70, 0x0000, 0x467D, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3425, 0x0000, 0x3535, 0x0000, 0x502C, 0x0000,
+    0x0000, 0x502D, 0x4E3B, 0x0000, 0x4D3D, 0x4168, 0x502F, 0x3B76, 0x4673, 0x0000, 0x5032, 0x0000,
+    0x0000, 0x313E, 0x385F, 0x0000, 0x385E, 0x3066, 0x0000, 0x0000, 0x4F4B, 0x4F4A, 0x0000, 0x3A33,
+    0x3021, 0x0000, 0x5033, 0x5034, 0x5035, 0x4B34, 0x5036, 0x0000, 0x3872, 0x3067, 0x4B72, 0x0000,
+    0x357C, 0x0000, 0x0000, 0x357D, 0x357E, 0x4462, 0x4E3C, 0x0000, 0x5037, 0x0000, 0x0000, 0x5038,
+    0x0000, 0x0000, 0x5039, 0x0000, 0x0000, 0x0000, 0x3F4D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x3D3A, 0x3F4E, 0x503E, 0x0000, 0x503C, 0x0000, 0x503D, 0x3558, 0x0000, 0x0000, 0x3A23, 0x3270,
+    0x0000, 0x503B, 0x503A, 0x4A29, 0x0000, 0x0000, 0x0000, 0x0000, 0x3B46, 0x3B45, 0x423E, 0x503F,
+    0x4955, 0x4067, 0x0000, 0x0000, 0x0000, 0x2138, 0x5040, 0x5042, 0x0000, 0x792E, 0x0000, 0x4265,
+    0x4E61, 0x304A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5041, 0x323E, 0x0000,
+    0x3644, 0x0000, 0x4367, 0x0000, 0x0000, 0x0000, 0x376F, 0x5043, 0x0000, 0x0000, 0x0000, 0x4724,
+    0x792F, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+4Fxx */
+    0x7930, 0x346B, 0x0000, 0x7931, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5044, 0x304B, 0x0000,
+    0x0000, 0x3860, 0x346C, 0x497A, 0x4832, 0x3559, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x3271, 0x0000, 0x5067, 0x4541, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x476C,
+    0x5046, 0x0000, 0x0000, 0x0000, 0x483C, 0x0000, 0x4E62, 0x0000, 0x3F2D, 0x7932, 0x3B47, 0x0000,
+    0x3B77, 0x3240, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4451, 0x0000, 0x0000, 0x4322, 0x504A,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x304C, 0x4463, 0x3D3B, 0x3A34, 0x4D24, 0x0000, 0x424E,
+    0x0000, 0x323F, 0x7933, 0x5049, 0x0000, 0x4D3E, 0x5045, 0x5047, 0x3A6E, 0x5048, 0x5524, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5050, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x5053, 0x5051, 0x0000, 0x0000, 0x3242, 0x0000, 0x4A3B, 0x504B, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x504F, 0x3873, 0x0000, 0x0000, 0x3B48, 0x0000, 0x0000, 0x0000, 0x3426,
+    0x0000, 0x0000, 0x5054, 0x0000, 0x504C, 0x0000, 0x7935, 0x4E63, 0x0000, 0x3B78, 0x0000, 0x504D,
+    0x0000, 0x5052, 0x7934, 0x0000, 0x7937, 0x0000, 0x5055, 0x0000, 0x504E, 0x0000, 0x7936, 0x3621,
+    0x0000, 0x304D, 0x0000, 0x0000, 0x3622, 0x3241, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x5525, 0x0000, 0x4B79, 0x496E, 0x3874, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x3F2F, 0x4E37, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A58,
+    0x0000, 0x0000, 0x3738, 0x4225, 0x3264, 0x0000, 0x0000, 0x0000, 0x0000, 0x7926, 0x3D53, 0x0000,
+    0x0000, 0x7938, 0x5059, 0x0000, 0x505E, 0x505C, 0x0000, 0x0000, 0x5057, 0x0000, 0x0000, 0x422F,
+    0x505A, 0x0000, 0x505D, 0x505B, 0x0000, 0x4A5D, 0x0000, 0x5058, 0x0000, 0x3F2E, 0x0000, 0x4B73,
+    0x505F, 0x5060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3D24, 0x506D,
+    0x0000, 0x0000, 0x0000, 0x4750, 0x0000, 0x4936, 0x5068, 0x0000, 0x4A70, 0x0000, 0x3236, 0x0000,
+    0x0000, 0x0000, 0x506C, 0x793B,
+  },
+  { /* U+50xx */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5066, 0x506F, 0x0000, 0x0000, 0x4152, 0x0000, 0x3844,
+    0x0000, 0x475C, 0x0000, 0x6047, 0x0000, 0x506E, 0x455D, 0x0000, 0x5063, 0x0000, 0x3876, 0x0000,
+    0x0000, 0x3875, 0x5061, 0x0000, 0x0000, 0x0000, 0x793C, 0x3C5A, 0x0000, 0x5069, 0x793A, 0x4A6F,
+    0x434D, 0x5065, 0x3771, 0x0000, 0x5062, 0x506A, 0x5064, 0x4E51, 0x506B, 0x4F41, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3666, 0x0000, 0x0000, 0x3770, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x7939, 0x0000, 0x793F, 0x5070, 0x0000, 0x0000, 0x793D, 0x5071,
+    0x5075, 0x304E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A50, 0x5074, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x5073, 0x5077, 0x0000, 0x0000, 0x0000, 0x5076, 0x0000, 0x4464, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3772, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x5078, 0x0000, 0x0000, 0x0000, 0x793E, 0x0000, 0x3C45, 0x0000, 0x4226, 0x4465, 0x3676, 0x0000,
+    0x5079, 0x0000, 0x0000, 0x0000, 0x0000, 0x3536, 0x0000, 0x0000, 0x507A, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x507C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4B35, 0x0000, 0x0000,
+    0x0000, 0x3766, 0x0000, 0x0000, 0x7940, 0x0000, 0x0000, 0x0000, 0x3B31, 0x4877, 0x507B, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x3A45, 0x4D43, 0x0000, 0x0000, 0x0000, 0x0000, 0x507E, 0x5123,
+    0x507D, 0x3A44, 0x0000, 0x3D7D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3739, 0x0000,
+    0x0000, 0x0000, 0x5124, 0x0000, 0x0000, 0x364F, 0x0000, 0x0000, 0x0000, 0x5121, 0x5122, 0x0000,
+    0x0000, 0x462F, 0x0000, 0x417C, 0x0000, 0x3623, 0x0000, 0x0000, 0x0000, 0x4B4D, 0x5125, 0x0000,
+    0x7942, 0x0000, 0x4E3D, 0x0000, 0x0000, 0x0000, 0x5126, 0x0000, 0x0000, 0x0000, 0x0000, 0x5129,
+    0x0000, 0x5127, 0x0000, 0x414E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5128, 0x512A, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x7941, 0x512C, 0x0000, 0x0000, 0x0000, 0x512B, 0x0000, 0x4A48,
+    0x0000, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+51xx */
+    0x3537, 0x512E, 0x512F, 0x0000, 0x322F, 0x0000, 0x0000, 0x0000, 0x0000, 0x512D, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3C74, 0x0000, 0x5132, 0x5131, 0x5130, 0x0000,
+    0x5056, 0x0000, 0x5133, 0x0000, 0x0000, 0x0000, 0x0000, 0x3D7E, 0x0000, 0x5134, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4D25, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x4C59, 0x0000, 0x0000, 0x0000, 0x0000, 0x5136, 0x0000, 0x0000, 0x5135, 0x5138,
+    0x5137, 0x0000, 0x0000, 0x5139, 0x513A, 0x3074, 0x0000, 0x3835, 0x373B, 0x3D3C, 0x437B, 0x3624,
+    0x4068, 0x3877, 0x7943, 0x396E, 0x513C, 0x4C48, 0x4546, 0x0000, 0x3B79, 0x0000, 0x513B, 0x0000,
+    0x513D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x455E, 0x0000, 0x3375, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x513E, 0x0000, 0x7944, 0x467E, 0x0000, 0x0000, 0x4134, 0x5140, 0x5141, 0x482C,
+    0x3878, 0x4F3B, 0x5142, 0x0000, 0x0000, 0x3626, 0x0000, 0x0000, 0x0000, 0x4A3C, 0x4236, 0x3671,
+    0x4535, 0x0000, 0x0000, 0x0000, 0x3773, 0x0000, 0x0000, 0x0000, 0x5143, 0x0000, 0x5144, 0x0000,
+    0x0000, 0x4662, 0x315F, 0x0000, 0x0000, 0x5147, 0x3A7D, 0x0000, 0x5146, 0x3A46, 0x0000, 0x5148,
+    0x666E, 0x5149, 0x4B41, 0x514A, 0x0000, 0x514B, 0x514C, 0x3E69, 0x0000, 0x3C4C, 0x0000, 0x0000,
+    0x0000, 0x7945, 0x0000, 0x0000, 0x3427, 0x0000, 0x514F, 0x0000, 0x514D, 0x4C3D, 0x514E, 0x0000,
+    0x495A, 0x5150, 0x5151, 0x5152, 0x455F, 0x0000, 0x0000, 0x0000, 0x5156, 0x5154, 0x5155, 0x5153,
+    0x3A63, 0x5157, 0x4C6A, 0x4E64, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5158, 0x7946, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x4028, 0x5159, 0x3D5A, 0x0000, 0x0000, 0x515A, 0x0000, 0x437C,
+    0x4E3F, 0x4560, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5245, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x515B, 0x7425, 0x3645, 0x0000, 0x0000, 0x515C, 0x4B5E, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x3D68, 0x427C, 0x0000, 0x515E, 0x4664, 0x0000, 0x7947, 0x515F, 0x0000, 0x0000,
+    0x5160, 0x332E, 0x0000, 0x0000, 0x0000, 0x5161, 0x3627, 0x0000, 0x464C, 0x317A, 0x3D50, 0x0000,
+    0x0000, 0x4821, 0x5162, 0x0000,
+  },
+  { /* U+52xx */
+    0x4561, 0x0000, 0x0000, 0x3F4F, 0x5163, 0x0000, 0x4A2C, 0x405A, 0x3422, 0x0000, 0x3429, 0x5164,
+    0x0000, 0x0000, 0x5166, 0x0000, 0x0000, 0x373A, 0x0000, 0x0000, 0x5165, 0x7948, 0x0000, 0x4E73,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3D69, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x483D, 0x4A4C, 0x0000, 0x5167, 0x0000, 0x4D78, 0x5168, 0x0000, 0x0000, 0x0000, 0x5169, 0x0000,
+    0x457E, 0x0000, 0x0000, 0x516A, 0x0000, 0x0000, 0x4029, 0x3A7E, 0x3774, 0x516B, 0x3B49, 0x396F,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4466, 0x516D, 0x0000, 0x0000, 0x4227,
+    0x0000, 0x0000, 0x3A6F, 0x516E, 0x516F, 0x4130, 0x0000, 0x516C, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x5171, 0x0000, 0x4B36, 0x0000, 0x0000, 0x0000, 0x0000, 0x3964, 0x0000, 0x0000, 0x5170, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x3775, 0x3A5E, 0x476D, 0x0000, 0x0000, 0x0000, 0x5174, 0x5172, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x497B, 0x3E6A, 0x517B, 0x3364, 0x5175, 0x5173, 0x414F, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5177, 0x0000, 0x5176, 0x0000, 0x0000, 0x0000, 0x3344,
+    0x0000, 0x0000, 0x0000, 0x3760, 0x517C, 0x4E2D, 0x0000, 0x0000, 0x0000, 0x5178, 0x0000, 0x0000,
+    0x0000, 0x517D, 0x517A, 0x0000, 0x5179, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4E4F,
+    0x7949, 0x0000, 0x0000, 0x3879, 0x3243, 0x0000, 0x0000, 0x4E74, 0x0000, 0x0000, 0x794A, 0x0000,
+    0x0000, 0x3D75, 0x4558, 0x3965, 0x5222, 0x5223, 0x0000, 0x7B3C, 0x0000, 0x4E65, 0x0000, 0x0000,
+    0x4F2B, 0x5225, 0x0000, 0x0000, 0x0000, 0x387A, 0x0000, 0x0000, 0x5224, 0x0000, 0x332F, 0x0000,
+    0x794B, 0x5226, 0x0000, 0x4B56, 0x0000, 0x443C, 0x0000, 0x4D26, 0x0000, 0x4A59, 0x0000, 0x0000,
+    0x0000, 0x5227, 0x0000, 0x0000, 0x0000, 0x0000, 0x7055, 0x0000, 0x0000, 0x4630, 0x0000, 0x5228,
+    0x342A, 0x4C33, 0x0000, 0x794C, 0x0000, 0x3E21, 0x5229, 0x4A67, 0x522D, 0x0000, 0x402A, 0x522A,
+    0x3650, 0x0000, 0x522B, 0x342B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x372E, 0x522E, 0x0000, 0x522F, 0x0000, 0x0000, 0x5230, 0x5231, 0x3C5B, 0x0000,
+    0x0000, 0x0000, 0x387B, 0x4C5E,
+  },
+  { /* U+53xx */
+    0x794D, 0x4C68, 0x4677, 0x0000, 0x0000, 0x4A71, 0x5232, 0x794E, 0x5233, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x5235, 0x0000, 0x5237, 0x5236, 0x0000, 0x0000, 0x0000, 0x0000, 0x5238, 0x323D, 0x4B4C,
+    0x0000, 0x3A7C, 0x5239, 0x0000, 0x0000, 0x4159, 0x0000, 0x0000, 0x3E22, 0x3629, 0x0000, 0x523A,
+    0x794F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x485B, 0x0000, 0x0000, 0x0000, 0x0000, 0x523B,
+    0x0000, 0x523C, 0x0000, 0x523D, 0x0000, 0x0000, 0x0000, 0x0000, 0x523E, 0x4924, 0x3668, 0x3065,
+    0x0000, 0x0000, 0x0000, 0x463F, 0x523F, 0x3D3D, 0x0000, 0x4069, 0x0000, 0x5241, 0x5240, 0x3E23,
+    0x3861, 0x5243, 0x483E, 0x0000, 0x0000, 0x5244, 0x0000, 0x0000, 0x0000, 0x485C, 0x4234, 0x426E,
+    0x3628, 0x0000, 0x0000, 0x466E, 0x4331, 0x0000, 0x476E, 0x0000, 0x4B4E, 0x0000, 0x5246, 0x0000,
+    0x406A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3735, 0x0000, 0x0000, 0x5247, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5248, 0x312C, 0x3075, 0x346D, 0x7950, 0x4228, 0x3551, 0x4D71, 0x0000, 0x524B,
+    0x3237, 0x0000, 0x0000, 0x524A, 0x0000, 0x0000, 0x0000, 0x362A, 0x0000, 0x0000, 0x524C, 0x0000,
+    0x4C71, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x7951, 0x0000, 0x0000, 0x524D, 0x0000, 0x4E52, 0x0000, 0x387C, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x3836, 0x524E, 0x0000, 0x0000, 0x0000, 0x0000, 0x5250, 0x524F, 0x0000,
+    0x3F5F, 0x3139, 0x0000, 0x0000, 0x0000, 0x315E, 0x5251, 0x0000, 0x5252, 0x0000, 0x7952, 0x3837,
+    0x0000, 0x0000, 0x5253, 0x0000, 0x0000, 0x0000, 0x0000, 0x356E, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x3B32, 0x5254, 0x0000, 0x0000, 0x0000, 0x0000, 0x4B74, 0x3A35, 0x355A, 0x4D27,
+    0x4150, 0x483F, 0x3C7D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3D47, 0x0000, 0x3C68, 0x3C75,
+    0x0000, 0x3D76, 0x0000, 0x4840, 0x0000, 0x7953, 0x0000, 0x5257, 0x0000, 0x3143, 0x4151, 0x387D,
+    0x3845, 0x3667, 0x0000, 0x0000, 0x525B, 0x4321, 0x427E, 0x362B, 0x3E24, 0x525C, 0x525A, 0x3244,
+    0x4266, 0x3C38, 0x3B4B, 0x3126, 0x0000, 0x0000, 0x3370, 0x3966, 0x3B4A, 0x0000, 0x525D, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+54xx */
+    0x0000, 0x525E, 0x0000, 0x3549, 0x3346, 0x0000, 0x0000, 0x0000, 0x3967, 0x3548, 0x445F, 0x3125,
+    0x4631, 0x4C3E, 0x3921, 0x4D79, 0x4547, 0x387E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x372F, 0x0000, 0x5267, 0x0000, 0x3663, 0x4B4A, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x485D, 0x0000, 0x0000, 0x5266, 0x0000, 0x345E, 0x5261, 0x5262, 0x5264, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5265, 0x0000, 0x355B, 0x3F61, 0x0000, 0x4A2D,
+    0x5263, 0x525F, 0x3863, 0x0000, 0x5260, 0x0000, 0x4F24, 0x0000, 0x0000, 0x0000, 0x4A72, 0x0000,
+    0x4468, 0x3862, 0x3970, 0x0000, 0x0000, 0x0000, 0x5268, 0x0000, 0x0000, 0x465D, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x526C,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3C7E, 0x0000, 0x3C76, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x526F, 0x526D, 0x0000, 0x4C23, 0x0000, 0x526A, 0x5273, 0x526E,
+    0x0000, 0x0000, 0x0000, 0x5271, 0x3846, 0x4C3F, 0x0000, 0x0000, 0x5272, 0x0000, 0x0000, 0x0000,
+    0x5274, 0x0000, 0x5276, 0x0000, 0x0000, 0x0000, 0x7956, 0x3A70, 0x4F42, 0x0000, 0x526B, 0x5269,
+    0x5275, 0x0000, 0x5270, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x7955, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5278, 0x0000, 0x5323, 0x527A, 0x0000, 0x0000,
+    0x527E, 0x7957, 0x0000, 0x5321, 0x527B, 0x0000, 0x0000, 0x533E, 0x0000, 0x0000, 0x3A69, 0x3331,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5279, 0x0000, 0x0000, 0x0000, 0x5325, 0x3076, 0x5324, 0x0000,
+    0x3025, 0x494A, 0x5322, 0x0000, 0x527C, 0x0000, 0x0000, 0x5277, 0x527D, 0x3A48, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x5326, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3077, 0x532F, 0x0000,
+    0x0000, 0x5327, 0x5328, 0x0000, 0x3E25, 0x4B69, 0x0000, 0x0000, 0x0000, 0x532D, 0x532C, 0x0000,
+    0x0000, 0x0000, 0x452F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x532E, 0x0000,
+    0x0000, 0x532B, 0x0000, 0x7958,
+  },
+  { /* U+55xx */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x3134, 0x0000, 0x3A36, 0x3F30, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x5329, 0x4562, 0x0000, 0x0000, 0x0000, 0x532A, 0x0000, 0x3022, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5334, 0x4D23,
+    0x0000, 0x3E27, 0x0000, 0x533A, 0x0000, 0x0000, 0x0000, 0x0000, 0x5339, 0x5330, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x4243, 0x0000, 0x5331, 0x0000, 0x0000, 0x0000, 0x426F, 0x5336, 0x3E26, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5333, 0x0000, 0x0000, 0x4C64, 0x0000, 0x0000, 0x0000, 0x373C,
+    0x0000, 0x0000, 0x5337, 0x5338, 0x0000, 0x0000, 0x0000, 0x0000, 0x5335, 0x533B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x5332, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x5341, 0x5346, 0x0000, 0x5342, 0x0000, 0x533D, 0x0000, 0x0000, 0x5347,
+    0x4131, 0x0000, 0x7959, 0x5349, 0x0000, 0x3922, 0x533F, 0x437D, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5343, 0x533C, 0x342D, 0x0000,
+    0x346E, 0x3365, 0x5344, 0x5340, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3776,
+    0x534A, 0x5348, 0x4153, 0x354A, 0x362C, 0x0000, 0x5345, 0x0000, 0x3674, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x3144, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x534E, 0x534C, 0x0000, 0x5427, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5351, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x534B, 0x0000, 0x534F, 0x0000, 0x0000, 0x534D, 0x0000, 0x0000, 0x0000, 0x3B4C,
+    0x5350, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5353, 0x0000, 0x5358, 0x0000, 0x0000,
+    0x0000, 0x5356, 0x5355, 0x0000,
+  },
+  { /* U+56xx */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4332, 0x0000, 0x0000, 0x3245, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5352, 0x0000, 0x5354, 0x3E28,
+    0x3133, 0x0000, 0x0000, 0x5357, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x325E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5362,
+    0x0000, 0x3E7C, 0x535E, 0x0000, 0x535C, 0x0000, 0x535D, 0x0000, 0x535F, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x313D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x4139, 0x0000, 0x5359, 0x0000, 0x535A, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x337A, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5361, 0x0000, 0x0000, 0x0000, 0x346F, 0x0000, 0x5364, 0x5360,
+    0x5363, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A2E, 0x0000, 0x0000, 0x0000,
+    0x4655, 0x0000, 0x4838, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5366, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5365, 0x3345, 0x0000, 0x0000, 0x5367, 0x0000, 0x0000, 0x0000, 0x0000, 0x536A,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5369, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5368, 0x0000, 0x4739, 0x0000, 0x0000, 0x536B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x536C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x536E, 0x0000, 0x536D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5370, 0x0000, 0x0000, 0x0000,
+    0x5373, 0x5371, 0x536F, 0x5372, 0x0000, 0x0000, 0x0000, 0x0000, 0x5374, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5375, 0x0000, 0x0000, 0x5376, 0x0000, 0x5377, 0x0000, 0x0000, 0x0000, 0x5378,
+    0x5145, 0x0000, 0x3C7C, 0x3B4D, 0x0000, 0x0000, 0x3273, 0x0000, 0x3078, 0x0000, 0x0000, 0x4344,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5379, 0x0000,
+    0x3A24, 0x0000, 0x304F, 0x3F5E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x537A, 0x3847, 0x0000,
+    0x0000, 0x3971, 0x0000, 0x537C,
+  },
+  { /* U+57xx */
+    0x537B, 0x0000, 0x0000, 0x4A60, 0x537D, 0x0000, 0x0000, 0x0000, 0x5421, 0x537E, 0x0000, 0x5422,
+    0x0000, 0x5423, 0x0000, 0x3777, 0x0000, 0x0000, 0x3160, 0x5424, 0x0000, 0x0000, 0x5426, 0x0000,
+    0x5425, 0x0000, 0x0000, 0x0000, 0x5428, 0x0000, 0x0000, 0x455A, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5429, 0x3035, 0x3A5F, 0x0000, 0x0000, 0x0000, 0x0000, 0x373D, 0x0000, 0x0000,
+    0x434F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x542A, 0x542B, 0x0000, 0x0000, 0x542D,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x542E, 0x0000, 0x3A64, 0x0000, 0x0000, 0x0000, 0x0000, 0x3651,
+    0x0000, 0x0000, 0x4B37, 0x0000, 0x0000, 0x0000, 0x542C, 0x542F, 0x3A41, 0x3923, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x795A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x5433, 0x0000, 0x0000, 0x3A25, 0x795B, 0x4333, 0x0000, 0x0000, 0x5430, 0x445A, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5434, 0x0000, 0x0000, 0x3F62, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5432, 0x5435, 0x0000, 0x373F, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x5436, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5437, 0x0000, 0x3924, 0x3340, 0x5439, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x543A, 0x0000, 0x795C, 0x0000, 0x0000, 0x0000, 0x543B, 0x0000, 0x0000, 0x5438,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x5431, 0x0000, 0x0000, 0x543C, 0x0000, 0x0000, 0x543D, 0x795E, 0x795D, 0x0000, 0x0000, 0x4B64,
+    0x0000, 0x0000, 0x3E6B, 0x0000, 0x0000, 0x0000, 0x543F, 0x5440, 0x543E, 0x0000, 0x5442, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x4738, 0x0000, 0x0000, 0x3068, 0x4956, 0x0000, 0x0000, 0x5443,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x3E7D, 0x0000, 0x0000, 0x3C39, 0x0000, 0x475D, 0x3470, 0x0000,
+    0x3A6B, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+58xx */
+    0x4B59, 0x0000, 0x4632, 0x0000, 0x0000, 0x3778, 0x424F, 0x0000, 0x0000, 0x0000, 0x5441, 0x5444,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4244, 0x0000, 0x0000,
+    0x0000, 0x5445, 0x0000, 0x0000, 0x0000, 0x5446, 0x0000, 0x0000, 0x0000, 0x5448, 0x0000, 0x0000,
+    0x4469, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x342E, 0x0000, 0x0000, 0x0000, 0x0000, 0x7421,
+    0x3161, 0x4A73, 0x0000, 0x0000, 0x3E6C, 0x4548, 0x0000, 0x0000, 0x0000, 0x0000, 0x3A66, 0x0000,
+    0x0000, 0x544E, 0x0000, 0x0000, 0x4A3D, 0x4E5D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x3274, 0x544A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x413A, 0x544D, 0x0000,
+    0x4563, 0x0000, 0x0000, 0x4549, 0x4564, 0x4839, 0x444D, 0x0000, 0x0000, 0x0000, 0x3A49, 0x0000,
+    0x0000, 0x0000, 0x5449, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3176, 0x0000, 0x4536,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x544B, 0x0000, 0x5447, 0x0000, 0x0000, 0x3F50, 0x0000, 0x0000,
+    0x0000, 0x544F, 0x0000, 0x0000, 0x0000, 0x0000, 0x3D4E, 0x0000, 0x0000, 0x0000, 0x0000, 0x362D,
+    0x0000, 0x5450, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x4A68, 0x0000, 0x0000, 0x0000, 0x417D, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x4446, 0x0000, 0x7961, 0x5452, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x4B4F, 0x0000, 0x0000, 0x5453, 0x0000, 0x0000, 0x5458, 0x0000, 0x0000, 0x0000, 0x7962, 0x4A2F,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5457, 0x5451, 0x5454, 0x5456, 0x0000, 0x0000, 0x3A26, 0x0000,
+    0x0000, 0x4A49, 0x0000, 0x0000, 0x0000, 0x5459, 0x0000, 0x4345, 0x0000, 0x0000, 0x3275, 0x0000,
+    0x3E6D, 0x0000, 0x0000, 0x0000, 0x0000, 0x545B, 0x0000, 0x545A, 0x0000, 0x3968, 0x0000, 0x545C,
+    0x545E, 0x545D, 0x0000, 0x0000, 0x5460, 0x0000, 0x5455, 0x5462, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x5461, 0x545F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3B4E, 0x3F51, 0x0000, 0x4154, 0x5463,
+    0x403C, 0x306D, 0x4764, 0x0000, 0x0000, 0x0000, 0x0000, 0x445B, 0x0000, 0x5465, 0x5464, 0x5466,
+    0x5467, 0x5468, 0x0000, 0x0000,
+  },
+  { /* U+59xx */
+    0x0000, 0x0000, 0x5469, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A51, 0x546A, 0x7963,
+    0x0000, 0x0000, 0x0000, 0x3246, 0x546B, 0x0000, 0x0000, 0x0000, 0x0000, 0x4D3C, 0x3330, 0x0000,
+    0x5249, 0x3D48, 0x423F, 0x546C, 0x4C6B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4C34, 0x0000,
+    0x0000, 0x546E, 0x0000, 0x4267, 0x0000, 0x4537, 0x4240, 0x4957, 0x546F, 0x5470, 0x317B, 0x0000,
+    0x0000, 0x3C3A, 0x5471, 0x0000, 0x0000, 0x0000, 0x0000, 0x3050, 0x5472, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5473, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3162, 0x0000, 0x0000, 0x3471,
+    0x4660, 0x4A74, 0x0000, 0x0000, 0x0000, 0x0000, 0x5477, 0x4155, 0x5476, 0x3740, 0x0000, 0x7964,
+    0x4B5B, 0x5475, 0x0000, 0x4565, 0x5479, 0x0000, 0x5478, 0x7965, 0x0000, 0x7966, 0x0000, 0x0000,
+    0x547B, 0x0000, 0x547A, 0x7967, 0x0000, 0x317C, 0x0000, 0x547C, 0x3E29, 0x547E, 0x4325, 0x0000,
+    0x547D, 0x0000, 0x4A33, 0x0000, 0x0000, 0x0000, 0x0000, 0x3D77, 0x455B, 0x0000, 0x0000, 0x0000,
+    0x5521, 0x0000, 0x0000, 0x0000, 0x0000, 0x3925, 0x0000, 0x0000, 0x0000, 0x5522, 0x4721, 0x485E,
+    0x4C51, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4725, 0x0000, 0x0000, 0x552B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x3538, 0x0000, 0x0000, 0x4D45, 0x0000, 0x0000, 0x4C2F, 0x0000, 0x562C,
+    0x0000, 0x5523, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5526, 0x7968, 0x4245, 0x0000, 0x0000,
+    0x4B38, 0x0000, 0x0000, 0x0000, 0x454A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5527, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4B65, 0x7969, 0x3A4A, 0x0000, 0x0000, 0x3E2A, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5528, 0x0000, 0x0000, 0x3B50, 0x0000, 0x3B4F,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x3039, 0x3848, 0x0000, 0x402B, 0x3051, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x552C, 0x552D, 0x0000, 0x552A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x3138, 0x342F, 0x0000, 0x5529, 0x0000, 0x4C45, 0x4931, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3028, 0x0000, 0x0000, 0x0000, 0x0000, 0x3079,
+    0x0000, 0x0000, 0x0000, 0x3B51,
+  },
+  { /* U+5Axx */
+    0x0000, 0x3052, 0x0000, 0x3023, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5532, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5530, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x4C3C, 0x0000, 0x5533, 0x0000, 0x5531, 0x0000, 0x0000, 0x552F, 0x3F31, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x552E, 0x0000, 0x0000, 0x0000, 0x4A5A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3864,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5537, 0x5538, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x3E2B, 0x0000, 0x0000, 0x0000, 0x5534, 0x4F2C, 0x0000, 0x0000, 0x0000, 0x0000, 0x474C, 0x0000,
+    0x0000, 0x5536, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3A27, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5539, 0x0000, 0x0000, 0x0000, 0x4958, 0x0000, 0x0000, 0x0000, 0x553A, 0x0000,
+    0x5535, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4C3B, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x475E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x553B, 0x4932,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x553C, 0x5540, 0x553D, 0x0000,
+    0x0000, 0x3247, 0x553F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3C3B, 0x0000, 0x553E,
+    0x3779, 0x0000, 0x0000, 0x0000, 0x554C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5545, 0x5542,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4364, 0x0000, 0x5541,
+    0x0000, 0x0000, 0x5543, 0x0000, 0x0000, 0x5544, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5546, 0x5547,
+    0x0000, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+5Bxx */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3472, 0x0000, 0x5549,
+    0x5548, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x554A, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3E6E, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x554D, 0x0000, 0x445C, 0x0000, 0x0000, 0x0000,
+    0x3145, 0x0000, 0x554B, 0x0000, 0x0000, 0x0000, 0x554E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x554F, 0x0000, 0x5552, 0x0000, 0x0000, 0x5550, 0x0000, 0x5551, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3B52, 0x5553, 0x0000, 0x0000,
+    0x3926, 0x5554, 0x796A, 0x3B7A, 0x4238, 0x0000, 0x5555, 0x5556, 0x3B5A, 0x3927, 0x0000, 0x4C52,
+    0x0000, 0x0000, 0x0000, 0x3528, 0x3849, 0x5557, 0x3358, 0x0000, 0x0000, 0x5558, 0x0000, 0x4239,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5559, 0x5623, 0x0000, 0x555A, 0x0000, 0x555B, 0x0000, 0x0000,
+    0x555C, 0x0000, 0x555E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x555F, 0x0000, 0x0000, 0x5560,
+    0x0000, 0x4270, 0x0000, 0x3127, 0x3C69, 0x3042, 0x0000, 0x4157, 0x3430, 0x3C35, 0x0000, 0x3928,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4566, 0x0000, 0x3D21, 0x3431, 0x4368, 0x446A, 0x3038,
+    0x3539, 0x4A75, 0x0000, 0x3C42, 0x0000, 0x0000, 0x3552, 0x406B, 0x3C3C, 0x4D28, 0x5561, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x355C, 0x0000, 0x3A4B, 0x0000, 0x0000, 0x3332,
+    0x3163, 0x3E2C, 0x3248, 0x0000, 0x5562, 0x4D46, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3D49,
+    0x796B, 0x0000, 0x3C64, 0x5563, 0x3473, 0x4652, 0x4C29, 0x5564, 0x0000, 0x5565, 0x0000, 0x0000,
+    0x4959, 0x0000, 0x0000, 0x0000, 0x5567, 0x0000, 0x3428, 0x3677, 0x5566, 0x0000, 0x0000, 0x0000,
+    0x796D, 0x0000, 0x0000, 0x3432, 0x0000, 0x3F32, 0x556B, 0x3B21, 0x0000, 0x3249, 0x556A, 0x0000,
+    0x5568, 0x556C, 0x5569, 0x472B, 0x5C4D, 0x3F33, 0x0000, 0x556D, 0x796E, 0x0000, 0x4E40, 0x0000,
+    0x556E, 0x0000, 0x0000, 0x5570, 0x0000, 0x437E, 0x556F, 0x0000, 0x4023, 0x0000, 0x3B7B, 0x0000,
+    0x0000, 0x0000, 0x4250, 0x3C77,
+  },
+  { /* U+5Cxx */
+    0x0000, 0x4975, 0x406C, 0x0000, 0x3C4D, 0x5571, 0x3E2D, 0x5572, 0x5573, 0x3053, 0x423A, 0x3F52,
+    0x0000, 0x5574, 0x4633, 0x3E2E, 0x0000, 0x3E2F, 0x0000, 0x5575, 0x0000, 0x0000, 0x406D, 0x0000,
+    0x0000, 0x0000, 0x3E30, 0x0000, 0x0000, 0x0000, 0x796F, 0x0000, 0x5576, 0x0000, 0x5577, 0x0000,
+    0x4C60, 0x0000, 0x0000, 0x0000, 0x5578, 0x0000, 0x0000, 0x0000, 0x0000, 0x3646, 0x0000, 0x0000,
+    0x0000, 0x3D22, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5579, 0x557A, 0x3C5C, 0x3F2C,
+    0x4674, 0x3F54, 0x4878, 0x4722, 0x3649, 0x557B, 0x0000, 0x0000, 0x0000, 0x356F, 0x557C, 0x0000,
+    0x367E, 0x0000, 0x464F, 0x3230, 0x0000, 0x3B53, 0x557D, 0x5622, 0x5621, 0x367D, 0x0000, 0x557E,
+    0x0000, 0x4538, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4230, 0x0000,
+    0x454B, 0x3C48, 0x0000, 0x0000, 0x4158, 0x4D7A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x5624, 0x0000, 0x5625, 0x4656, 0x0000, 0x3B33, 0x0000, 0x0000, 0x0000, 0x0000, 0x5627, 0x0000,
+    0x0000, 0x5628, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5629, 0x0000, 0x0000, 0x0000,
+    0x3474, 0x562A, 0x0000, 0x0000, 0x562B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x322C, 0x0000, 0x0000, 0x0000, 0x0000, 0x7970, 0x0000,
+    0x413B, 0x3464, 0x0000, 0x562D, 0x4C28, 0x0000, 0x0000, 0x0000, 0x0000, 0x4252, 0x0000, 0x3359,
+    0x0000, 0x0000, 0x562F, 0x5631, 0x345F, 0x0000, 0x7971, 0x562E, 0x5630, 0x0000, 0x5633, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5632, 0x0000, 0x5634, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x5635, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x463D, 0x362E, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x3265, 0x5636, 0x563B, 0x0000, 0x0000, 0x5639, 0x0000, 0x4A77,
+    0x4A76, 0x0000, 0x0000, 0x0000, 0x0000, 0x7972, 0x4567, 0x0000, 0x0000, 0x0000, 0x5638, 0x3D54,
+    0x0000, 0x5637, 0x0000, 0x0000,
+  },
+  { /* U+5Dxx */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3F72, 0x0000, 0x0000, 0x0000, 0x563C,
+    0x0000, 0x0000, 0x3A6A, 0x0000, 0x0000, 0x5642, 0x0000, 0x0000, 0x5643, 0x563D, 0x3333, 0x563E,
+    0x5647, 0x5646, 0x5645, 0x5641, 0x0000, 0x0000, 0x0000, 0x5640, 0x0000, 0x0000, 0x5644, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x7973, 0x0000, 0x4A78, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7976, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x564B, 0x5648, 0x0000, 0x564A, 0x0000, 0x4D72, 0x0000, 0x5649, 0x7974,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x563F, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3F73, 0x0000, 0x0000,
+    0x564C, 0x7977, 0x0000, 0x3A37, 0x0000, 0x0000, 0x0000, 0x564D, 0x0000, 0x0000, 0x564E, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5651, 0x0000,
+    0x5650, 0x0000, 0x0000, 0x564F, 0x0000, 0x0000, 0x0000, 0x4568, 0x563A, 0x0000, 0x0000, 0x0000,
+    0x5657, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x5653, 0x0000, 0x0000, 0x0000, 0x0000, 0x5652, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5654, 0x0000, 0x5655, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x5658, 0x7978, 0x7979, 0x4E66, 0x0000, 0x5659, 0x5656, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x565A, 0x0000, 0x0000,
+    0x3460, 0x565B, 0x0000, 0x0000, 0x797A, 0x0000, 0x565D, 0x565C, 0x0000, 0x0000, 0x565E, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x565F, 0x0000, 0x406E, 0x3D23, 0x0000, 0x0000, 0x3D64, 0x0000, 0x4163,
+    0x0000, 0x3929, 0x3A38, 0x392A, 0x3570, 0x0000, 0x0000, 0x5660, 0x0000, 0x0000, 0x3A39, 0x0000,
+    0x0000, 0x384A, 0x5661, 0x4C26, 0x4743, 0x5662, 0x0000, 0x392B, 0x0000, 0x0000, 0x0000, 0x342C,
+    0x0000, 0x4327, 0x3652, 0x0000,
+  },
+  { /* U+5Exx */
+    0x0000, 0x0000, 0x3B54, 0x495B, 0x0000, 0x0000, 0x4841, 0x0000, 0x0000, 0x0000, 0x0000, 0x5663,
+    0x3475, 0x0000, 0x0000, 0x0000, 0x0000, 0x5666, 0x0000, 0x0000, 0x0000, 0x0000, 0x4421, 0x0000,
+    0x0000, 0x5665, 0x5664, 0x5667, 0x0000, 0x446B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x3F63, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3B55, 0x0000, 0x404A, 0x0000, 0x4253,
+    0x3522, 0x0000, 0x0000, 0x4422, 0x0000, 0x0000, 0x5668, 0x5669, 0x3E6F, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x4B39, 0x0000, 0x0000, 0x566C, 0x0000, 0x0000, 0x566B, 0x566A, 0x497D, 0x0000, 0x5673,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x4B5A, 0x0000, 0x566D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x566F, 0x4B6B, 0x0000, 0x566E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5670,
+    0x0000, 0x4828, 0x5671, 0x4A3E, 0x5672, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3433, 0x4A3F, 0x472F, 0x5674, 0x5675, 0x0000,
+    0x392C, 0x3434, 0x5676, 0x3838, 0x4D44, 0x4D29, 0x3476, 0x5678, 0x0000, 0x4423, 0x0000, 0x392D,
+    0x3E31, 0x0000, 0x0000, 0x485F, 0x0000, 0x0000, 0x3E32, 0x0000, 0x0000, 0x0000, 0x0000, 0x3D78,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x446C, 0x4A79, 0x4539, 0x0000, 0x0000, 0x392E, 0x0000,
+    0x495C, 0x0000, 0x0000, 0x0000, 0x5679, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4559, 0x3A42,
+    0x0000, 0x0000, 0x0000, 0x384B, 0x0000, 0x446D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x3043, 0x3D6E, 0x392F, 0x4D47, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x567A, 0x567B, 0x4751, 0x0000, 0x0000, 0x0000, 0x0000, 0x567C, 0x4E77, 0x4F2D, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x567E, 0x567D, 0x0000, 0x0000, 0x3347, 0x0000, 0x0000, 0x5721, 0x0000,
+    0x0000, 0x0000, 0x5724, 0x5725, 0x0000, 0x5723, 0x0000, 0x4940, 0x3E33, 0x5727, 0x5726, 0x5722,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5728, 0x5729, 0x0000, 0x0000, 0x572A, 0x0000, 0x0000, 0x0000,
+    0x572D, 0x572B, 0x0000, 0x572C, 0x572E, 0x0000, 0x3164, 0x446E, 0x572F, 0x0000, 0x377A, 0x3276,
+    0x4736, 0x0000, 0x5730, 0x467B,
+  },
+  { /* U+5Fxx */
+    0x0000, 0x4A5B, 0x0000, 0x5731, 0x4F2E, 0x0000, 0x0000, 0x0000, 0x0000, 0x5732, 0x4A40, 0x5735,
+    0x5021, 0x5031, 0x0000, 0x3C30, 0x4675, 0x5736, 0x0000, 0x355D, 0x4424, 0x307A, 0x5737, 0x4A26,
+    0x3930, 0x0000, 0x0000, 0x4350, 0x0000, 0x0000, 0x0000, 0x446F, 0x0000, 0x797B, 0x0000, 0x0000,
+    0x0000, 0x4C6F, 0x3839, 0x384C, 0x0000, 0x5738, 0x0000, 0x0000, 0x0000, 0x5739, 0x0000, 0x573F,
+    0x0000, 0x3C65, 0x0000, 0x0000, 0x797C, 0x4425, 0x0000, 0x362F, 0x573A, 0x0000, 0x0000, 0x0000,
+    0x492B, 0x0000, 0x4346, 0x0000, 0x0000, 0x573B, 0x0000, 0x0000, 0x0000, 0x792C, 0x0000, 0x0000,
+    0x573C, 0x0000, 0x3630, 0x0000, 0x573D, 0x0000, 0x573E, 0x0000, 0x0000, 0x5740, 0x0000, 0x4576,
+    0x0000, 0x0000, 0x5741, 0x5742, 0x0000, 0x5743, 0x0000, 0x0000, 0x5734, 0x5733, 0x0000, 0x0000,
+    0x0000, 0x5744, 0x3741, 0x0000, 0x0000, 0x0000, 0x4927, 0x797D, 0x0000, 0x3A4C, 0x4937, 0x4426,
+    0x494B, 0x5745, 0x0000, 0x0000, 0x3E34, 0x3146, 0x0000, 0x5746, 0x0000, 0x0000, 0x0000, 0x5747,
+    0x0000, 0x4C72, 0x0000, 0x0000, 0x4860, 0x0000, 0x0000, 0x574A, 0x317D, 0x402C, 0x5749, 0x5748,
+    0x3742, 0x4254, 0x0000, 0x574E, 0x574C, 0x0000, 0x574B, 0x4E27, 0x3865, 0x0000, 0x0000, 0x0000,
+    0x3D79, 0x574D, 0x454C, 0x3D3E, 0x0000, 0x0000, 0x0000, 0x4640, 0x5751, 0x5750, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x574F, 0x0000, 0x5752, 0x3866, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x5753, 0x497C, 0x3D5B, 0x0000, 0x0000, 0x5754, 0x4879, 0x0000, 0x0000, 0x0000, 0x0000, 0x4641,
+    0x4427, 0x0000, 0x0000, 0x797E, 0x0000, 0x4530, 0x0000, 0x0000, 0x5755, 0x352B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x3F34, 0x0000, 0x492C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x3477, 0x4726, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5756, 0x3B56,
+    0x4B3A, 0x4B3B, 0x0000, 0x0000, 0x317E, 0x575B, 0x7A21, 0x0000, 0x4369, 0x0000, 0x0000, 0x0000,
+    0x5758, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3277, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x582D, 0x575A, 0x0000, 0x0000, 0x0000, 0x4730, 0x0000, 0x0000, 0x5759, 0x0000, 0x0000, 0x5757,
+    0x0000, 0x397A, 0x0000, 0x575D,
+  },
+  { /* U+60xx */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5763, 0x5769, 0x5761, 0x0000, 0x455C, 0x0000, 0x0000, 0x5766, 0x495D, 0x0000,
+    0x0000, 0x5760, 0x0000, 0x5765, 0x4E67, 0x3B57, 0x0000, 0x0000, 0x4255, 0x575E, 0x0000, 0x0000,
+    0x0000, 0x355E, 0x5768, 0x402D, 0x3165, 0x5762, 0x3278, 0x5767, 0x0000, 0x0000, 0x0000, 0x3631,
+    0x0000, 0x5764, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x576A, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x576C, 0x5776, 0x5774, 0x0000, 0x0000, 0x5771, 0x0000,
+    0x0000, 0x0000, 0x5770, 0x4E78, 0x0000, 0x5772, 0x0000, 0x0000, 0x3632, 0x0000, 0x3931, 0x0000,
+    0x0000, 0x3D7A, 0x0000, 0x0000, 0x0000, 0x5779, 0x576B, 0x0000, 0x0000, 0x7A22, 0x0000, 0x576F,
+    0x575F, 0x0000, 0x327A, 0x5773, 0x5775, 0x4351, 0x0000, 0x0000, 0x3A28, 0x3238, 0x576D, 0x5778,
+    0x5777, 0x3633, 0x0000, 0x4229, 0x3366, 0x0000, 0x0000, 0x0000, 0x0000, 0x3743, 0x0000, 0x576E,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x577A, 0x0000, 0x577D,
+    0x5821, 0x7A23, 0x0000, 0x0000, 0x0000, 0x3C3D, 0x7A24, 0x5827, 0x4470, 0x577B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5825, 0x0000, 0x3279, 0x0000, 0x5823, 0x5824, 0x0000, 0x0000, 0x577E, 0x5822,
+    0x0000, 0x0000, 0x0000, 0x3867, 0x4D2A, 0x0000, 0x0000, 0x3435, 0x0000, 0x0000, 0x3159, 0x5826,
+    0x0000, 0x473A, 0x302D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4861, 0x575C,
+    0x582C, 0x5830, 0x4C65, 0x0000, 0x5829, 0x0000, 0x0000, 0x0000, 0x4569, 0x582E, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3E70, 0x582F, 0x4657, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4F47, 0x0000, 0x582B, 0x0000, 0x7A26, 0x0000, 0x0000,
+    0x5831, 0x0000, 0x397B, 0x0000, 0x404B, 0x0000, 0x7A25, 0x3054, 0x582A, 0x5828, 0x0000, 0x415A,
+    0x0000, 0x0000, 0x0000, 0x577C, 0x3B34, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x4246, 0x583D, 0x7A28, 0x415B, 0x5838, 0x0000, 0x5835, 0x5836, 0x0000, 0x3C66, 0x5839, 0x583C,
+    0x0000, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+61xx */
+    0x5837, 0x3D25, 0x0000, 0x583A, 0x0000, 0x0000, 0x5834, 0x0000, 0x4C7C, 0x4C7B, 0x0000, 0x0000,
+    0x0000, 0x583E, 0x583F, 0x3055, 0x0000, 0x7A29, 0x0000, 0x0000, 0x0000, 0x5833, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x3672, 0x3026, 0x0000, 0x0000, 0x0000, 0x3436, 0x7A27, 0x583B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x5843, 0x5842, 0x0000, 0x0000, 0x0000, 0x5847, 0x0000, 0x0000, 0x0000,
+    0x7A2B, 0x0000, 0x0000, 0x0000, 0x5848, 0x0000, 0x0000, 0x7A2A, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x5846, 0x5849, 0x5841, 0x5845, 0x0000, 0x0000, 0x584A, 0x0000, 0x584B, 0x0000, 0x0000, 0x5840,
+    0x3B7C, 0x0000, 0x5844, 0x4256, 0x3932, 0x5832, 0x3F35, 0x0000, 0x0000, 0x0000, 0x0000, 0x5858,
+    0x0000, 0x4A69, 0x0000, 0x0000, 0x584E, 0x584F, 0x5850, 0x0000, 0x0000, 0x5857, 0x0000, 0x5856,
+    0x0000, 0x0000, 0x4B7D, 0x3437, 0x0000, 0x5854, 0x0000, 0x3745, 0x3334, 0x0000, 0x0000, 0x5851,
+    0x0000, 0x0000, 0x4E38, 0x5853, 0x3056, 0x5855, 0x0000, 0x584C, 0x5852, 0x5859, 0x3744, 0x584D,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4D5D, 0x0000, 0x0000, 0x0000, 0x4D2B, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x585C, 0x0000, 0x0000, 0x5860, 0x0000, 0x0000, 0x0000, 0x417E, 0x0000,
+    0x4E79, 0x5861, 0x0000, 0x0000, 0x585E, 0x0000, 0x585B, 0x0000, 0x7A2C, 0x585A, 0x585F, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A30, 0x0000, 0x0000, 0x4634,
+    0x0000, 0x3746, 0x0000, 0x5862, 0x585D, 0x0000, 0x5863, 0x0000, 0x0000, 0x0000, 0x377B, 0x0000,
+    0x0000, 0x0000, 0x3231, 0x0000, 0x0000, 0x0000, 0x586B, 0x0000, 0x0000, 0x0000, 0x3438, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x5869, 0x0000, 0x0000, 0x586A, 0x3A29, 0x5868, 0x5866, 0x5865, 0x586C,
+    0x5864, 0x586E, 0x0000, 0x0000, 0x327B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5870,
+    0x0000, 0x0000, 0x586F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x4428, 0x0000, 0x5873, 0x0000, 0x5871, 0x5867, 0x377C, 0x0000, 0x5872, 0x0000,
+    0x5876, 0x5875, 0x5877, 0x5874,
+  },
+  { /* U+62xx */
+    0x5878, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5879, 0x587A, 0x4A6A, 0x0000,
+    0x587C, 0x587B, 0x3D3F, 0x0000, 0x402E, 0x3266, 0x327C, 0x7A2D, 0x587D, 0x0000, 0x303F, 0x0000,
+    0x0000, 0x0000, 0x404C, 0x587E, 0x0000, 0x6C43, 0x5921, 0x3761, 0x0000, 0x5922, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x406F, 0x0000, 0x0000, 0x0000, 0x5923, 0x0000, 0x0000, 0x0000, 0x5924, 0x353A,
+    0x5925, 0x0000, 0x5926, 0x5927, 0x4257, 0x0000, 0x0000, 0x0000, 0x384D, 0x0000, 0x0000, 0x4C61,
+    0x0000, 0x0000, 0x0000, 0x4B3C, 0x3D6A, 0x5928, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4070,
+    0x6E3D, 0x4862, 0x0000, 0x3C6A, 0x0000, 0x3A4D, 0x5929, 0x0000, 0x0000, 0x0000, 0x0000, 0x4247,
+    0x0000, 0x4A27, 0x0000, 0x0000, 0x4271, 0x0000, 0x0000, 0x592C, 0x0000, 0x0000, 0x592A, 0x0000,
+    0x592D, 0x0000, 0x0000, 0x592B, 0x0000, 0x0000, 0x0000, 0x0000, 0x592E, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x4A31, 0x0000, 0x0000, 0x3037, 0x0000, 0x0000, 0x0000, 0x0000, 0x495E, 0x0000,
+    0x0000, 0x4863, 0x0000, 0x0000, 0x592F, 0x0000, 0x5932, 0x3E35, 0x353B, 0x0000, 0x5930, 0x5937,
+    0x3E36, 0x0000, 0x0000, 0x0000, 0x0000, 0x5931, 0x4744, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x4D5E, 0x5933, 0x5934, 0x5938, 0x456A, 0x5935, 0x3933, 0x405E, 0x0000, 0x0000, 0x5946,
+    0x4834, 0x0000, 0x4272, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7A2E, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x4864, 0x5A2D, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A7A, 0x0000, 0x0000,
+    0x0000, 0x4471, 0x0000, 0x0000, 0x0000, 0x4B75, 0x0000, 0x593B, 0x3221, 0x436A, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5944, 0x0000, 0x0000, 0x4334, 0x593E, 0x5945, 0x5940, 0x5947, 0x5943, 0x0000,
+    0x5942, 0x476F, 0x0000, 0x593C, 0x327D, 0x593A, 0x3571, 0x4273, 0x5936, 0x0000, 0x0000, 0x5939,
+    0x3934, 0x405B, 0x0000, 0x3E37, 0x5941, 0x4752, 0x0000, 0x0000, 0x3572, 0x3348, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3367, 0x3F21, 0x5949, 0x594E,
+    0x0000, 0x594A, 0x0000, 0x377D, 0x0000, 0x594F, 0x3B22, 0x3969, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x3D26, 0x593D,
+  },
+  { /* U+63xx */
+    0x0000, 0x3B7D, 0x594C, 0x0000, 0x0000, 0x0000, 0x0000, 0x3B58, 0x594D, 0x3044, 0x0000, 0x0000,
+    0x5948, 0x0000, 0x0000, 0x0000, 0x0000, 0x4429, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x3573, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3634, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x594B, 0x3027, 0x0000, 0x0000, 0x3A43, 0x0000, 0x0000, 0x0000, 0x3F36,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4472, 0x0000,
+    0x0000, 0x4854, 0x5951, 0x415E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x422A, 0x0000, 0x0000, 0x3B2B, 0x5952, 0x0000, 0x5954, 0x5950, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x4A61, 0x0000, 0x443D, 0x0000, 0x0000, 0x0000, 0x0000, 0x415C, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A7B, 0x3C4E, 0x5960, 0x0000, 0x595F,
+    0x0000, 0x0000, 0x3F78, 0x0000, 0x0000, 0x0000, 0x377E, 0x0000, 0x0000, 0x0000, 0x5959, 0x3E39,
+    0x0000, 0x0000, 0x4668, 0x4731, 0x0000, 0x0000, 0x0000, 0x0000, 0x5957, 0x0000, 0x0000, 0x415D,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x3C78, 0x595C, 0x0000, 0x0000, 0x3E38, 0x0000, 0x5956, 0x595B,
+    0x0000, 0x0000, 0x4753, 0x0000, 0x0000, 0x0000, 0x5955, 0x0000, 0x3721, 0x0000, 0x0000, 0x335D,
+    0x0000, 0x0000, 0x0000, 0x595D, 0x4E2B, 0x3A4E, 0x4335, 0x595A, 0x0000, 0x405C, 0x0000, 0x3935,
+    0x3F64, 0x3166, 0x413C, 0x5958, 0x3545, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3747, 0x0000,
+    0x444F, 0x595E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x415F, 0x0000, 0x0000, 0x5961, 0x0000,
+    0x5963, 0x0000, 0x0000, 0x4237, 0x5969, 0x0000, 0x5964, 0x0000, 0x0000, 0x5966, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x4941, 0x4473, 0x0000, 0x5967, 0x0000, 0x0000, 0x0000, 0x4D2C, 0x0000,
+    0x0000, 0x0000, 0x4D48, 0x3439, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x302E, 0x0000, 0x5965,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5962, 0x0000, 0x0000, 0x0000, 0x0000, 0x3478, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x3167, 0x7A2F, 0x5968, 0x0000, 0x0000, 0x0000, 0x4D49, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+64xx */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x596C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x423B, 0x0000, 0x5973, 0x0000, 0x0000, 0x0000, 0x596D, 0x0000, 0x0000, 0x596A, 0x5971,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5953, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x596E, 0x0000, 0x5972, 0x0000, 0x0000, 0x0000, 0x4842, 0x456B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x596B, 0x0000, 0x596F, 0x0000, 0x0000, 0x0000, 0x3748, 0x0000,
+    0x0000, 0x0000, 0x3A71, 0x0000, 0x0000, 0x0000, 0x405D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5977, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x4526, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x7A30, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5974, 0x0000, 0x4B60, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x5975, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5976, 0x0000,
+    0x4C4E, 0x0000, 0x4022, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3762,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x597D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x3B35, 0x597A, 0x0000, 0x5979, 0x0000, 0x0000, 0x0000, 0x0000, 0x4732, 0x0000,
+    0x0000, 0x7A31, 0x4635, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4531, 0x597B, 0x0000, 0x0000,
+    0x0000, 0x597C, 0x0000, 0x496F, 0x0000, 0x4745, 0x3B23, 0x0000, 0x4071, 0x0000, 0x4B50, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3349, 0x0000, 0x5A25, 0x597E, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x4D4A, 0x5A27, 0x0000, 0x0000, 0x5A23, 0x0000, 0x5A24, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x4160, 0x7A32, 0x0000, 0x0000, 0x0000, 0x5A22, 0x0000, 0x593F, 0x0000, 0x0000, 0x0000,
+    0x5A26, 0x0000, 0x5A21, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5A2B, 0x5A2C, 0x4527, 0x5A2E,
+    0x0000, 0x0000, 0x3B24, 0x5A29, 0x0000, 0x0000, 0x0000, 0x0000, 0x353C, 0x0000, 0x0000, 0x5A2F,
+    0x0000, 0x5A28, 0x5A33, 0x0000, 0x5A32, 0x0000, 0x5A31, 0x0000, 0x0000, 0x0000, 0x5A34, 0x0000,
+    0x0000, 0x5A36, 0x3E71, 0x0000,
+  },
+  { /* U+65xx */
+    0x5A35, 0x0000, 0x0000, 0x0000, 0x0000, 0x5A39, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x5A37, 0x0000, 0x0000, 0x0000, 0x5A38, 0x5970, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5A3B,
+    0x5A3A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5978, 0x5A3C, 0x5A30, 0x0000, 0x0000, 0x3B59,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5A3D, 0x5A3E, 0x5A40, 0x5A3F, 0x5A41, 0x327E, 0x0000, 0x3936,
+    0x0000, 0x0000, 0x4A7C, 0x402F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x384E, 0x0000, 0x0000,
+    0x5A43, 0x0000, 0x0000, 0x0000, 0x0000, 0x5A46, 0x7A33, 0x4952, 0x0000, 0x355F, 0x0000, 0x0000,
+    0x0000, 0x5A45, 0x5A44, 0x4754, 0x5A47, 0x3635, 0x0000, 0x0000, 0x0000, 0x5A49, 0x5A48, 0x0000,
+    0x0000, 0x0000, 0x343A, 0x3B36, 0x0000, 0x0000, 0x4658, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x3749, 0x0000, 0x0000, 0x0000, 0x3F74, 0x0000, 0x5A4A, 0x0000, 0x4030, 0x4528, 0x0000, 0x495F,
+    0x5A4B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5A4C, 0x5A4D,
+    0x0000, 0x0000, 0x0000, 0x4A38, 0x555D, 0x4046, 0x0000, 0x0000, 0x494C, 0x0000, 0x3A58, 0x0000,
+    0x4865, 0x4843, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x454D, 0x0000, 0x4E41, 0x0000, 0x5A4F,
+    0x3C50, 0x0000, 0x0000, 0x5A50, 0x0000, 0x3036, 0x0000, 0x0000, 0x3654, 0x404D, 0x0000, 0x4960,
+    0x0000, 0x0000, 0x0000, 0x5A51, 0x3B42, 0x4347, 0x0000, 0x3B5B, 0x3F37, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x5A52, 0x0000, 0x4A7D, 0x0000, 0x0000, 0x3177, 0x3B5C, 0x0000, 0x0000,
+    0x0000, 0x5A55, 0x0000, 0x5A53, 0x5A56, 0x4E39, 0x5A54, 0x0000, 0x0000, 0x0000, 0x0000, 0x407B,
+    0x5A57, 0x0000, 0x0000, 0x4232, 0x0000, 0x0000, 0x5A58, 0x0000, 0x0000, 0x0000, 0x0000, 0x347A,
+    0x0000, 0x5A5A, 0x0000, 0x5A59, 0x0000, 0x0000, 0x0000, 0x0000, 0x5A5B, 0x5A5C, 0x347B, 0x0000,
+    0x0000, 0x467C, 0x4336, 0x356C, 0x3B5D, 0x4161, 0x0000, 0x0000, 0x3D5C, 0x3030, 0x0000, 0x0000,
+    0x0000, 0x5A5D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3222, 0x5A61,
+    0x0000, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+66xx */
+    0x7A34, 0x0000, 0x3937, 0x5A60, 0x0000, 0x0000, 0x3A2B, 0x3E3A, 0x0000, 0x7A37, 0x5A5F, 0x0000,
+    0x3E3B, 0x0000, 0x4C40, 0x3A2A, 0x0000, 0x0000, 0x0000, 0x3057, 0x404E, 0x7A35, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5A66, 0x0000, 0x7A39, 0x4031, 0x3147, 0x0000, 0x0000, 0x0000,
+    0x7A3A, 0x3D55, 0x0000, 0x4B66, 0x3A72, 0x0000, 0x0000, 0x0000, 0x0000, 0x3E3C, 0x7A38, 0x4027,
+    0x0000, 0x7928, 0x0000, 0x0000, 0x5A65, 0x5A63, 0x5A64, 0x0000, 0x0000, 0x0000, 0x0000, 0x7A36,
+    0x436B, 0x0000, 0x0000, 0x5B26, 0x0000, 0x5A6A, 0x3B7E, 0x3938, 0x5A68, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x5A69, 0x0000, 0x3F38, 0x0000, 0x0000, 0x0000, 0x5A67, 0x0000, 0x0000, 0x3B2F, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x7A3C, 0x0000, 0x7A3D, 0x0000, 0x0000, 0x0000, 0x5A6C, 0x5A6B, 0x5A70,
+    0x0000, 0x0000, 0x5A71, 0x0000, 0x5A6D, 0x7A3B, 0x3322, 0x5A6E, 0x5A6F, 0x4855, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x4961, 0x374A, 0x5A72, 0x0000, 0x0000, 0x7A3F, 0x4032, 0x0000, 0x3E3D, 0x0000,
+    0x0000, 0x0000, 0x4352, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3647, 0x0000, 0x5A73,
+    0x5A77, 0x0000, 0x0000, 0x324B, 0x5A74, 0x5A76, 0x0000, 0x0000, 0x0000, 0x0000, 0x5A75, 0x0000,
+    0x0000, 0x3D6B, 0x0000, 0x0000, 0x0000, 0x0000, 0x4348, 0x3045, 0x5A78, 0x7A40, 0x0000, 0x0000,
+    0x0000, 0x5A79, 0x0000, 0x0000, 0x7A41, 0x0000, 0x442A, 0x0000, 0x0000, 0x0000, 0x4E71, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x3B43, 0x0000, 0x0000, 0x4A6B, 0x0000, 0x0000, 0x0000, 0x7A42, 0x0000,
+    0x4B3D, 0x0000, 0x0000, 0x0000, 0x5B22, 0x5A7B, 0x0000, 0x0000, 0x5A7E, 0x0000, 0x5A7D, 0x7A43,
+    0x0000, 0x5A7A, 0x0000, 0x0000, 0x5B21, 0x0000, 0x0000, 0x465E, 0x0000, 0x5A7C, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5B23, 0x0000,
+    0x0000, 0x3D6C, 0x5B24, 0x0000, 0x4D4B, 0x4778, 0x0000, 0x0000, 0x5B25, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5B27, 0x0000, 0x0000, 0x5B28, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x5B29, 0x0000, 0x364A, 0x3148, 0x3939, 0x5B2A, 0x0000, 0x5B2B, 0x3D71, 0x4162, 0x7A44, 0x792B,
+    0x5258, 0x413E, 0x413D, 0x4258,
+  },
+  { /* U+67xx */
+    0x3A47, 0x0000, 0x0000, 0x5072, 0x0000, 0x0000, 0x0000, 0x0000, 0x376E, 0x4D2D, 0x0000, 0x4A7E,
+    0x0000, 0x497E, 0x7A45, 0x5B2C, 0x0000, 0x0000, 0x0000, 0x0000, 0x3A73, 0x443F, 0x5B2D, 0x4F2F,
+    0x0000, 0x0000, 0x0000, 0x4B3E, 0x0000, 0x442B, 0x5B2E, 0x347C, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5B2F, 0x5B30, 0x4C5A, 0x0000, 0x4C24, 0x4B76, 0x4B5C, 0x3B25, 0x5B32, 0x0000,
+    0x0000, 0x3C6B, 0x0000, 0x0000, 0x4B51, 0x0000, 0x5B34, 0x5B37, 0x5B36, 0x0000, 0x3479, 0x0000,
+    0x0000, 0x3560, 0x0000, 0x5B33, 0x0000, 0x5B35, 0x0000, 0x0000, 0x0000, 0x0000, 0x5B38, 0x0000,
+    0x0000, 0x3F79, 0x0000, 0x0000, 0x0000, 0x0000, 0x4D7B, 0x3049, 0x3A60, 0x423C, 0x0000, 0x3C5D,
+    0x0000, 0x0000, 0x3E73, 0x0000, 0x0000, 0x5B3B, 0x0000, 0x0000, 0x454E, 0x0000, 0x5B39, 0x422B,
+    0x5B3A, 0x3E72, 0x4C5D, 0x5B3C, 0x5B3D, 0x4D68, 0x7A47, 0x0000, 0x0000, 0x0000, 0x5B42, 0x0000,
+    0x0000, 0x393A, 0x0000, 0x4755, 0x5B3F, 0x456C, 0x5A5E, 0x5A62, 0x0000, 0x354F, 0x0000, 0x4747,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5B41, 0x0000, 0x3E3E, 0x4844, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x5B47, 0x0000, 0x487A, 0x0000, 0x5B3E, 0x0000, 0x5B44, 0x5B43, 0x0000, 0x0000, 0x0000,
+    0x404F, 0x0000, 0x0000, 0x0000, 0x0000, 0x4B6D, 0x0000, 0x4E53, 0x0000, 0x0000, 0x4B67, 0x0000,
+    0x324C, 0x3B5E, 0x0000, 0x0000, 0x4F48, 0x5B46, 0x3F75, 0x0000, 0x0000, 0x0000, 0x5B45, 0x0000,
+    0x0000, 0x5B40, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x384F, 0x0000, 0x0000, 0x0000, 0x5B4C,
+    0x5B4A, 0x0000, 0x324D, 0x5B48, 0x5B4E, 0x5B54, 0x0000, 0x7A48, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x7A4A, 0x4248, 0x0000, 0x0000, 0x4A41, 0x0000, 0x5B56, 0x0000, 0x0000, 0x0000, 0x4922, 0x0000,
+    0x0000, 0x0000, 0x5B55, 0x4770, 0x4B3F, 0x343B, 0x0000, 0x4077, 0x3D40, 0x0000, 0x0000, 0x0000,
+    0x4453, 0x0000, 0x4D2E, 0x0000, 0x0000, 0x5B51, 0x5B50, 0x0000, 0x0000, 0x0000, 0x5B52, 0x0000,
+    0x5B4F, 0x0000, 0x0000, 0x5B57, 0x0000, 0x5B4D, 0x0000, 0x0000, 0x5B4B, 0x0000, 0x5B53, 0x5B49,
+    0x0000, 0x436C, 0x0000, 0x4C78, 0x3C46, 0x3A74, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3A3A,
+    0x0000, 0x0000, 0x4B6F, 0x3341,
+  },
+  { /* U+68xx */
+    0x0000, 0x7A4B, 0x444E, 0x464A, 0x3149, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4072, 0x0000, 0x0000, 0x4034, 0x372A,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5B59, 0x0000, 0x0000, 0x393B, 0x337C, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5B5B, 0x3374, 0x5B61, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5B5E, 0x0000, 0x4073, 0x0000, 0x0000, 0x0000, 0x334B, 0x3A2C, 0x0000, 0x0000,
+    0x334A, 0x3A4F, 0x0000, 0x0000, 0x5B5C, 0x3765, 0x374B, 0x456D, 0x7A4C, 0x0000, 0x5B5A, 0x0000,
+    0x3046, 0x0000, 0x0000, 0x0000, 0x0000, 0x5B5D, 0x5B5F, 0x0000, 0x364D, 0x372C, 0x7A49, 0x343C,
+    0x354B, 0x0000, 0x0000, 0x0000, 0x0000, 0x5B62, 0x0000, 0x0000, 0x3A79, 0x4B71, 0x0000, 0x3B37,
+    0x0000, 0x0000, 0x0000, 0x5B63, 0x0000, 0x0000, 0x0000, 0x4930, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5B6F, 0x0000, 0x3233, 0x5B64,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5B75, 0x5B65, 0x0000, 0x4E42, 0x0000, 0x5B6C,
+    0x0000, 0x475F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5B74, 0x0000, 0x5B67,
+    0x0000, 0x0000, 0x0000, 0x3034, 0x5B69, 0x0000, 0x0000, 0x393C, 0x0000, 0x0000, 0x0000, 0x5B6B,
+    0x0000, 0x5B6A, 0x0000, 0x5B66, 0x5B71, 0x0000, 0x3E3F, 0x0000, 0x0000, 0x0000, 0x546D, 0x3868,
+    0x4D7C, 0x0000, 0x0000, 0x0000, 0x0000, 0x5B68, 0x0000, 0x4474, 0x3323, 0x3A2D, 0x0000, 0x5B60,
+    0x0000, 0x5B70, 0x3361, 0x0000, 0x0000, 0x5B6E, 0x5B72, 0x0000, 0x456E, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x347E, 0x0000, 0x5C32, 0x0000, 0x7929, 0x4C49, 0x5B77, 0x347D,
+    0x0000, 0x5B7E, 0x0000, 0x7A4D, 0x0000, 0x0000, 0x4B40, 0x0000, 0x5C21, 0x5C23, 0x0000, 0x5C27,
+    0x5B79, 0x0000, 0x432A, 0x0000, 0x0000, 0x0000, 0x0000, 0x456F, 0x5C2B, 0x5B7C, 0x0000, 0x5C28,
+    0x0000, 0x0000, 0x0000, 0x5C22, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3F39, 0x5C2C,
+    0x0000, 0x0000, 0x4033, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5C2A, 0x343D, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+69xx */
+    0x4F50, 0x5B76, 0x0000, 0x0000, 0x5C26, 0x3058, 0x0000, 0x0000, 0x5B78, 0x0000, 0x0000, 0x4C3A,
+    0x5B7D, 0x3F22, 0x4447, 0x5B73, 0x0000, 0x0000, 0x5C25, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x3F7A, 0x5C2F, 0x3371, 0x3821, 0x0000, 0x0000, 0x0000, 0x0000, 0x5C31, 0x5B7A, 0x5C30,
+    0x0000, 0x5C29, 0x5B7B, 0x0000, 0x5C2D, 0x0000, 0x5C2E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x5C3F, 0x0000, 0x0000, 0x0000, 0x464E, 0x0000, 0x5C24, 0x0000, 0x0000, 0x5C3B, 0x0000, 0x0000,
+    0x0000, 0x5C3D, 0x0000, 0x4458, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x4D4C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4976,
+    0x5C38, 0x424A, 0x0000, 0x0000, 0x0000, 0x5C3E, 0x413F, 0x0000, 0x5C35, 0x5C42, 0x5C41, 0x0000,
+    0x466F, 0x5C40, 0x466A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7A4F, 0x0000, 0x5C44, 0x5C37,
+    0x0000, 0x3648, 0x5C3A, 0x3D5D, 0x0000, 0x0000, 0x0000, 0x4760, 0x5C3C, 0x364B, 0x0000, 0x5C34,
+    0x5C36, 0x5C33, 0x0000, 0x0000, 0x4F30, 0x335A, 0x5C39, 0x0000, 0x0000, 0x5C43, 0x3335, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3A67, 0x0000, 0x0000, 0x0000, 0x315D, 0x0000,
+    0x0000, 0x5C54, 0x0000, 0x0000, 0x4F31, 0x5C57, 0x0000, 0x0000, 0x7A51, 0x0000, 0x0000, 0x3F3A,
+    0x5C56, 0x0000, 0x0000, 0x0000, 0x5C55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5C52,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5C46, 0x0000, 0x0000, 0x5C63, 0x5C45, 0x0000,
+    0x5C58, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5C50, 0x0000, 0x0000, 0x5C4B, 0x5C48,
+    0x0000, 0x5C49, 0x0000, 0x5C51, 0x0000, 0x0000, 0x0000, 0x7422, 0x0000, 0x0000, 0x5C4E, 0x393D,
+    0x4448, 0x4164, 0x5C4C, 0x0000, 0x5C47, 0x0000, 0x0000, 0x5C4A, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x4D4D, 0x4B6A, 0x0000, 0x0000, 0x0000, 0x5C4F, 0x5C59, 0x0000, 0x0000, 0x0000, 0x7A52, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x5C61, 0x5C5A, 0x0000, 0x0000, 0x5C67, 0x0000, 0x5C65, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5C60, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5C5F, 0x0000, 0x4450,
+    0x0000, 0x4165, 0x0000, 0x5C5D,
+  },
+  { /* U+6Axx */
+    0x0000, 0x0000, 0x5C5B, 0x0000, 0x0000, 0x5C62, 0x0000, 0x0000, 0x0000, 0x0000, 0x5C68, 0x4875,
+    0x5C6E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5C69, 0x5C6C, 0x5C66, 0x0000, 0x0000, 0x4374,
+    0x0000, 0x4938, 0x0000, 0x5C5C, 0x0000, 0x0000, 0x5C64, 0x3E40, 0x0000, 0x4C4F, 0x5C78, 0x5C6B,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3822, 0x3223, 0x335F, 0x0000, 0x0000, 0x5C53, 0x0000,
+    0x7A53, 0x0000, 0x0000, 0x0000, 0x0000, 0x3E41, 0x5C70, 0x0000, 0x5C77, 0x3C79, 0x3372, 0x0000,
+    0x0000, 0x432E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5C6D, 0x0000, 0x7A55, 0x5C72,
+    0x5C76, 0x0000, 0x0000, 0x3636, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x354C, 0x5C74, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3521,
+    0x0000, 0x464B, 0x5C73, 0x0000, 0x0000, 0x0000, 0x5C75, 0x0000, 0x0000, 0x0000, 0x0000, 0x7A54,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5C6F, 0x7A56, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x5C71, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7A57, 0x3360, 0x4349, 0x0000, 0x0000, 0x0000,
+    0x5C7C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5C7A, 0x3869, 0x0000,
+    0x5C79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5D21, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x5B58, 0x0000, 0x0000, 0x0000, 0x5C7B, 0x0000, 0x5C7D, 0x5C7E, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5D2C, 0x0000, 0x5D28, 0x0000, 0x5B6D, 0x0000, 0x0000, 0x0000, 0x0000, 0x5D27,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5D26, 0x0000, 0x0000, 0x5D23, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x5C6A, 0x5D25, 0x5D24, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5D2A, 0x0000, 0x4F26, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5D2D, 0x367B, 0x0000, 0x0000, 0x5D29, 0x5D2B, 0x0000, 0x0000, 0x7A58, 0x0000,
+    0x7A59, 0x0000, 0x0000, 0x0000, 0x4827, 0x0000, 0x5D2E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5D32, 0x5D2F,
+    0x0000, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+6Bxx */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x4D73, 0x5D30, 0x0000, 0x0000, 0x0000, 0x0000, 0x5C5E, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5D33, 0x0000, 0x0000, 0x0000, 0x5D34, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3135, 0x0000, 0x5D36, 0x3767, 0x3C21, 0x0000, 0x3655,
+    0x0000, 0x0000, 0x0000, 0x3224, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x4D5F, 0x0000, 0x0000, 0x0000, 0x0000, 0x5D38, 0x5D37, 0x5D3A, 0x353D, 0x0000,
+    0x0000, 0x3656, 0x343E, 0x0000, 0x0000, 0x0000, 0x0000, 0x5D3D, 0x0000, 0x0000, 0x0000, 0x5D3C,
+    0x0000, 0x5D3E, 0x0000, 0x0000, 0x324E, 0x0000, 0x4337, 0x0000, 0x5D3F, 0x0000, 0x0000, 0x343F,
+    0x5D41, 0x0000, 0x0000, 0x0000, 0x0000, 0x5D40, 0x0000, 0x5D42, 0x0000, 0x0000, 0x0000, 0x5D43,
+    0x0000, 0x5D44, 0x3B5F, 0x4035, 0x3A21, 0x0000, 0x4970, 0x0000, 0x0000, 0x4A62, 0x4F44, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x3B75, 0x0000, 0x0000, 0x0000, 0x3A50, 0x4E72, 0x0000, 0x0000, 0x0000,
+    0x5D45, 0x5D46, 0x0000, 0x3B60, 0x0000, 0x0000, 0x0000, 0x5D47, 0x5D48, 0x0000, 0x0000, 0x5D4A,
+    0x5D49, 0x0000, 0x4B58, 0x0000, 0x0000, 0x3D5E, 0x3C6C, 0x3B44, 0x0000, 0x5D4B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5D4D, 0x3F23, 0x0000, 0x5D4C, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5D4E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5D4F, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5D50, 0x5D51, 0x0000, 0x0000, 0x0000, 0x5D52, 0x0000, 0x5D54, 0x5D53, 0x5D55,
+    0x3225, 0x434A, 0x0000, 0x5D56, 0x0000, 0x0000, 0x3B26, 0x334C, 0x5D57, 0x0000, 0x0000, 0x4542,
+    0x544C, 0x0000, 0x0000, 0x0000, 0x0000, 0x3523, 0x5D58, 0x0000, 0x0000, 0x0000, 0x0000, 0x5D59,
+    0x0000, 0x4A6C, 0x4B68, 0x0000, 0x0000, 0x0000, 0x4647, 0x5D5A, 0x4866, 0x0000, 0x7A5A, 0x0000,
+    0x487B, 0x0000, 0x0000, 0x4C53, 0x0000, 0x0000, 0x0000, 0x5D5B, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5D5D, 0x5D5C, 0x0000, 0x0000, 0x5D5F,
+    0x0000, 0x0000, 0x0000, 0x5D5E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+6Cxx */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5D61, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x3B61, 0x0000, 0x4C31, 0x0000, 0x5D62, 0x5D63, 0x0000, 0x0000, 0x3524,
+    0x0000, 0x0000, 0x0000, 0x5D64, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5D66,
+    0x5D65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x3F65, 0x0000, 0x0000, 0x4939, 0x314A, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x4845, 0x7A5B, 0x4475, 0x3D41, 0x3561, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4846, 0x0000, 0x3C2E, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x5D68, 0x0000, 0x3440, 0x0000, 0x0000, 0x3178, 0x0000, 0x7A5C, 0x4672, 0x5D67, 0x393E,
+    0x4353, 0x0000, 0x5D69, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5D71, 0x0000, 0x5D6A, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x7A5E, 0x4241, 0x0000, 0x3562, 0x5D72, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x3768, 0x0000, 0x0000, 0x3525, 0x5D70, 0x0000, 0x0000, 0x5D6E, 0x5D6B, 0x4D60,
+    0x0000, 0x0000, 0x7A5D, 0x0000, 0x4440, 0x0000, 0x0000, 0x0000, 0x4659, 0x5D6C, 0x0000, 0x0000,
+    0x5D74, 0x0000, 0x5D73, 0x3723, 0x0000, 0x0000, 0x322D, 0x0000, 0x0000, 0x3A3B, 0x5D6D, 0x5D6F,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4B57, 0x4274, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x4B77, 0x0000, 0x0000, 0x5D7C, 0x0000, 0x0000, 0x5D7D, 0x0000, 0x324F,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x4A28, 0x4C7D, 0x5E21, 0x3C23, 0x3E42, 0x5D78, 0x5D7E, 0x3168,
+    0x0000, 0x3637, 0x0000, 0x0000, 0x5D75, 0x5D7A, 0x0000, 0x0000, 0x0000, 0x4074, 0x4771, 0x0000,
+    0x4867, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5D77, 0x0000, 0x4B21, 0x0000, 0x5D79,
+    0x0000, 0x5E24, 0x7A5F, 0x5E22, 0x0000, 0x5D7B, 0x0000, 0x0000, 0x0000, 0x4B22, 0x4748, 0x3563,
+    0x0000, 0x4525, 0x0000, 0x0000, 0x436D, 0x0000, 0x5E25, 0x0000, 0x0000, 0x0000, 0x0000, 0x5E23,
+    0x4259, 0x5D76, 0x0000, 0x314B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+6Dxx */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x7A60, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4D4E,
+    0x5E30, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5E2F, 0x0000, 0x0000, 0x0000, 0x0000, 0x4076,
+    0x0000, 0x5E2C, 0x0000, 0x4D6C, 0x0000, 0x0000, 0x4636, 0x5E26, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x4445, 0x0000, 0x0000, 0x0000, 0x314C, 0x393F, 0x5E29, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x3D27, 0x5E2E, 0x0000, 0x5E2D, 0x5E28, 0x0000, 0x5E2B, 0x0000, 0x0000, 0x3368,
+    0x0000, 0x5E2A, 0x4749, 0x0000, 0x0000, 0x4E2E, 0x0000, 0x0000, 0x3E74, 0x4075, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5E36, 0x5E34, 0x0000, 0x494D, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x5E31, 0x5E33, 0x0000, 0x313A, 0x0000, 0x0000, 0x3940, 0x4F32, 0x0000,
+    0x333D, 0x0000, 0x4962, 0x7A62, 0x0000, 0x0000, 0x0000, 0x0000, 0x4D61, 0x0000, 0x0000, 0x3324,
+    0x3F3B, 0x5E35, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x5E3A, 0x0000, 0x7A61, 0x3E43, 0x0000, 0x0000, 0x0000, 0x4D30, 0x0000, 0x5E37, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x5E32, 0x0000, 0x5E38, 0x7A63, 0x0000, 0x0000, 0x4E5E, 0x0000, 0x4573,
+    0x4642, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x7A64, 0x0000, 0x0000, 0x3336, 0x0000, 0x0000, 0x3155, 0x0000,
+    0x0000, 0x5E3E, 0x0000, 0x0000, 0x5E41, 0x0000, 0x0000, 0x0000, 0x4E43, 0x0000, 0x0000, 0x0000,
+    0x4D64, 0x0000, 0x0000, 0x0000, 0x0000, 0x5E48, 0x5E42, 0x5E3F, 0x0000, 0x0000, 0x0000, 0x4E54,
+    0x5E45, 0x0000, 0x0000, 0x7A65, 0x0000, 0x3D4A, 0x5E47, 0x0000, 0x0000, 0x5E4C, 0x0000, 0x0000,
+    0x4571, 0x5E4A, 0x0000, 0x0000, 0x0000, 0x0000, 0x5E44, 0x0000, 0x0000, 0x4338, 0x0000, 0x0000,
+    0x5E4B, 0x0000, 0x5E40, 0x0000, 0x5E46, 0x0000, 0x5E4D, 0x307C, 0x5E43, 0x0000, 0x5E4E, 0x0000,
+    0x0000, 0x3F3C, 0x7A67, 0x3D5F, 0x0000, 0x4A25, 0x0000, 0x3A2E, 0x7A66, 0x5E3B, 0x5E49, 0x453A,
+    0x7A68, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+6Exx */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4036, 0x0000, 0x3369, 0x3A51, 0x3E44, 0x5E3D, 0x3D42,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x374C, 0x0000, 0x5E3C, 0x0000, 0x0000,
+    0x0000, 0x5E52, 0x3D6D, 0x383A, 0x0000, 0x5E61, 0x0000, 0x5E5B, 0x3574, 0x454F, 0x0000, 0x5E56,
+    0x5E5F, 0x302F, 0x3132, 0x7A6B, 0x0000, 0x3239, 0x0000, 0x5E58, 0x422C, 0x5E4F, 0x5E51, 0x3941,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5E62, 0x7A69, 0x5E5D, 0x0000,
+    0x7A6C, 0x0000, 0x5E55, 0x0000, 0x0000, 0x0000, 0x0000, 0x5E5C, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x4C2B, 0x0000, 0x0000, 0x5E5A, 0x5E5E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x3850, 0x0000, 0x3E45, 0x0000, 0x0000, 0x4339, 0x7A6A, 0x0000, 0x0000, 0x5E54,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4D2F, 0x0000, 0x0000, 0x0000, 0x5E57,
+    0x0000, 0x0000, 0x5E50, 0x4572, 0x0000, 0x0000, 0x5E53, 0x0000, 0x0000, 0x0000, 0x5E59, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4F51, 0x3C3E, 0x4B7E, 0x0000, 0x5E63, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x482E, 0x0000, 0x0000, 0x5E6F,
+    0x383B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3D60, 0x0000, 0x5E65, 0x0000, 0x0000, 0x0000,
+    0x4E2F, 0x3942, 0x0000, 0x5E72, 0x0000, 0x0000, 0x306E, 0x0000, 0x0000, 0x5E70, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5E64, 0x0000, 0x0000, 0x0000, 0x0000, 0x5E6A, 0x0000, 0x0000, 0x5E6C, 0x0000,
+    0x0000, 0x0000, 0x4D4F, 0x5E67, 0x0000, 0x0000, 0x452E, 0x0000, 0x0000, 0x5E69, 0x0000, 0x7A6D,
+    0x0000, 0x0000, 0x5E71, 0x0000, 0x5E6B, 0x4C47, 0x0000, 0x0000, 0x0000, 0x5E66, 0x0000, 0x3C22,
+    0x5E7E, 0x0000, 0x0000, 0x0000, 0x0000, 0x336A, 0x0000, 0x5E68, 0x5E6D, 0x5E6E, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x426C, 0x425A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5E76, 0x0000, 0x0000, 0x5E7C,
+    0x0000, 0x0000, 0x5E7A, 0x0000, 0x4529, 0x0000, 0x0000, 0x5F23, 0x5E77, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5E78, 0x5E60,
+  },
+  { /* U+6Fxx */
+    0x0000, 0x3579, 0x493A, 0x0000, 0x0000, 0x0000, 0x3C3F, 0x0000, 0x0000, 0x3977, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x4F33, 0x0000, 0x5E74, 0x0000, 0x5F22, 0x3169, 0x4166, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4779, 0x0000, 0x3441, 0x4E7A,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4C21, 0x4452, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x5E7B, 0x5E7D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4132, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5F21, 0x5E79, 0x0000, 0x5E73, 0x0000, 0x0000, 0x0000, 0x3443, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x3769, 0x0000, 0x0000, 0x0000, 0x5F2F, 0x0000, 0x0000, 0x5F2A, 0x4078, 0x0000, 0x0000, 0x3363,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x3D61, 0x0000, 0x5F33, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x5F2C, 0x442C, 0x5F29, 0x4459, 0x0000, 0x0000, 0x0000, 0x5F4C, 0x0000, 0x0000, 0x0000,
+    0x5F26, 0x0000, 0x5F25, 0x0000, 0x5F2E, 0x0000, 0x0000, 0x0000, 0x5F28, 0x5F27, 0x5F2D, 0x0000,
+    0x4021, 0x0000, 0x5F24, 0x0000, 0x7A6E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5F30, 0x0000,
+    0x0000, 0x5F31, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3442, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5F36, 0x0000, 0x5F35, 0x5F37, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5F3A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4543, 0x0000, 0x5F34,
+    0x0000, 0x7A6F, 0x0000, 0x0000, 0x0000, 0x5F38, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x3763, 0x4279, 0x5F32, 0x473B, 0x0000, 0x0000, 0x5F39, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5F3E, 0x5F3C, 0x0000, 0x0000,
+    0x5F3F, 0x0000, 0x0000, 0x5F42, 0x0000, 0x0000, 0x0000, 0x5F3B, 0x396A, 0x4728, 0x0000, 0x0000,
+    0x5E39, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4D74, 0x5F3D, 0x0000, 0x5F41, 0x4275,
+    0x0000, 0x5F40, 0x0000, 0x5F2B, 0x0000, 0x7A70, 0x6F69, 0x0000, 0x0000, 0x0000, 0x5F45, 0x0000,
+    0x0000, 0x0000, 0x5F49, 0x0000,
+  },
+  { /* U+70xx */
+    0x0000, 0x5F47, 0x0000, 0x0000, 0x0000, 0x7A71, 0x0000, 0x7A72, 0x0000, 0x5F43, 0x0000, 0x5F44,
+    0x0000, 0x0000, 0x0000, 0x5F48, 0x0000, 0x5F46, 0x0000, 0x0000, 0x0000, 0x494E, 0x0000, 0x0000,
+    0x5F4E, 0x0000, 0x5F4B, 0x5F4A, 0x0000, 0x5F4D, 0x4654, 0x5F4F, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x4375, 0x426D, 0x7A73, 0x0000, 0x0000, 0x0000, 0x4025, 0x0000, 0x0000, 0x0000,
+    0x5F50, 0x0000, 0x5F52, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5F51, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5E75, 0x0000, 0x0000, 0x0000, 0x0000, 0x5F53, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x4667, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x5F54, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3250,
+    0x0000, 0x0000, 0x0000, 0x4574, 0x3325, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x3564, 0x0000, 0x0000, 0x0000, 0x3C5E, 0x3A52, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x7A74, 0x0000, 0x0000, 0x0000, 0x4F27, 0x3F66, 0x0000, 0x0000, 0x0000, 0x316A, 0x0000,
+    0x0000, 0x0000, 0x5F56, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5F55, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x7A75, 0x5F59, 0x433A, 0x5F5C, 0x5F57, 0x0000, 0x0000, 0x0000, 0x5F5B,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x5F5A, 0x4540, 0x3059, 0x7927, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4E75, 0x0000, 0x0000, 0x5F5E,
+    0x0000, 0x0000, 0x0000, 0x3128, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x5F60, 0x0000, 0x0000, 0x0000, 0x5F5F, 0x0000, 0x5F5D, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x5F58, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4B23, 0x0000, 0x0000,
+    0x0000, 0x5F62, 0x0000, 0x0000,
+  },
+  { /* U+71xx */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x7A77, 0x0000, 0x0000, 0x0000, 0x0000, 0x5F61, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x7A76, 0x0000, 0x0000, 0x0000, 0x0000, 0x316B, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x5F64, 0x4A32, 0x0000, 0x5F63, 0x0000, 0x0000, 0x0000, 0x0000, 0x4C35, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x3E47, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4133, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x3E46, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7A79, 0x7A7A,
+    0x0000, 0x4E7B, 0x0000, 0x0000, 0x5F6A, 0x0000, 0x4079, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x5F66, 0x5F6B, 0x0000, 0x0000, 0x316C, 0x0000, 0x0000, 0x7A78, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5F69, 0x0000, 0x4761, 0x5F65, 0x5F68, 0x3E48, 0x0000, 0x4851, 0x0000, 0x0000,
+    0x5F6C, 0x0000, 0x3C51, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x407A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x5F6F, 0x0000, 0x0000, 0x0000, 0x5F67, 0x0000, 0x3727, 0x0000, 0x0000, 0x0000, 0x0000, 0x5F6D,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x4D50, 0x5F70, 0x0000, 0x0000, 0x0000, 0x7426, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x3D4F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x5F71, 0x0000, 0x0000, 0x0000, 0x5F72, 0x0000, 0x0000, 0x0000, 0x0000, 0x472E, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5F74, 0x0000, 0x0000, 0x0000, 0x0000, 0x5F75, 0x0000,
+    0x0000, 0x7A7C, 0x0000, 0x4733, 0x0000, 0x0000, 0x0000, 0x0000, 0x4575, 0x5F77, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x5F79, 0x0000, 0x4E55, 0x0000, 0x5F76, 0x0000, 0x5F78, 0x316D, 0x0000, 0x5F73,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x535B, 0x5F7A, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x4167, 0x3B38, 0x5F7C, 0x0000, 0x0000, 0x0000, 0x0000, 0x5F7B, 0x3F24, 0x5259, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5F7D, 0x0000, 0x0000, 0x0000, 0x6021, 0x0000, 0x5F6E,
+    0x5F7E, 0x0000, 0x7A7D, 0x6022,
+  },
+  { /* U+72xx */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x477A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x6023, 0x0000, 0x0000, 0x6024, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x6025, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x6026, 0x0000, 0x445E, 0x0000, 0x6028, 0x6027, 0x0000, 0x0000,
+    0x6029, 0x0000, 0x602A, 0x0000, 0x0000, 0x3C5F, 0x4963, 0x0000, 0x0000, 0x0000, 0x4C6C, 0x602B,
+    0x602C, 0x4156, 0x3C24, 0x602D, 0x602E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x602F, 0x4A52,
+    0x4847, 0x0000, 0x0000, 0x6030, 0x4757, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x442D, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x6031, 0x3267, 0x0000, 0x356D, 0x0000, 0x4C46, 0x0000, 0x4C36,
+    0x0000, 0x3234, 0x4F34, 0x0000, 0x0000, 0x0000, 0x0000, 0x4B52, 0x0000, 0x4A2A, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4037, 0x0000, 0x6032, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x4643, 0x0000, 0x0000, 0x0000, 0x3823, 0x6033, 0x0000, 0x3A54, 0x6035, 0x6034, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x6036, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x6037, 0x0000, 0x0000, 0x0000, 0x6038, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x353E, 0x0000, 0x6039, 0x0000, 0x0000, 0x0000, 0x0000, 0x603A,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x3824, 0x0000, 0x0000, 0x4848, 0x0000, 0x7A7E, 0x603C, 0x0000,
+    0x0000, 0x0000, 0x3E75, 0x0000, 0x0000, 0x603B, 0x0000, 0x0000, 0x0000, 0x0000, 0x7B21, 0x0000,
+    0x0000, 0x0000, 0x3638, 0x603D, 0x603F, 0x0000, 0x603E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x6040, 0x0000, 0x3851, 0x0000, 0x6041, 0x0000, 0x0000, 0x0000, 0x0000, 0x3669,
+    0x0000, 0x4140, 0x0000, 0x397D, 0x0000, 0x0000, 0x0000, 0x0000, 0x6043, 0x6044, 0x6042, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3C6D, 0x0000, 0x0000, 0x4648, 0x3639, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6046, 0x432C, 0x6045, 0x0000, 0x0000,
+    0x4F35, 0x4762, 0x0000, 0x0000,
+  },
+  { /* U+73xx */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6049, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x604B, 0x6048,
+    0x0000, 0x0000, 0x0000, 0x4C54, 0x604A, 0x604C, 0x0000, 0x4E44, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x7B22, 0x6050, 0x0000, 0x0000, 0x0000, 0x604F, 0x4376, 0x472D, 0x0000, 0x0000, 0x3825, 0x604E,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x604D, 0x0000, 0x4D31, 0x4D32, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x6051, 0x316E, 0x0000, 0x0000, 0x0000, 0x0000, 0x3976, 0x3B62, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6052, 0x6053, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x6055, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x3D43, 0x0000, 0x0000, 0x0000, 0x0000, 0x6057, 0x0000, 0x6056, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x6058, 0x0000, 0x334D, 0x0000, 0x0000, 0x605A, 0x0000, 0x7B24,
+    0x6059, 0x0000, 0x605C, 0x605B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x383C, 0x0000, 0x0000, 0x4E28, 0x0000, 0x364C, 0x0000, 0x3226, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x366A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x3461, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4E68, 0x605E,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6060, 0x0000, 0x7B25, 0x0000, 0x0000,
+    0x6061, 0x0000, 0x3251, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x605D, 0x7B26, 0x3B39, 0x0000,
+    0x0000, 0x4441, 0x605F, 0x0000, 0x0000, 0x0000, 0x7B29, 0x0000, 0x0000, 0x0000, 0x7B27, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6064, 0x0000, 0x3C6E, 0x0000, 0x0000, 0x7B28,
+    0x0000, 0x6062, 0x0000, 0x0000, 0x0000, 0x0000, 0x373E, 0x0000, 0x0000, 0x4849, 0x6063, 0x0000,
+    0x0000, 0x607E, 0x0000, 0x0000, 0x0000, 0x7B2B, 0x0000, 0x0000, 0x6069, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x383D, 0x0000,
+  },
+  { /* U+74xx */
+    0x0000, 0x0000, 0x0000, 0x3565, 0x0000, 0x6066, 0x4D7D, 0x7B2A, 0x0000, 0x4E30, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4276, 0x0000,
+    0x0000, 0x6068, 0x7B2C, 0x0000, 0x0000, 0x7B2E, 0x7B2D, 0x0000, 0x0000, 0x0000, 0x7B2F, 0x0000,
+    0x0000, 0x0000, 0x606A, 0x4E56, 0x3657, 0x487C, 0x474A, 0x0000, 0x0000, 0x0000, 0x606B, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x606D, 0x0000, 0x6070, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x606C, 0x0000, 0x0000, 0x0000, 0x606F, 0x386A, 0x314D, 0x6071, 0x0000, 0x3F70, 0x606E,
+    0x4E5C, 0x0000, 0x7B30, 0x6074, 0x7424, 0x0000, 0x0000, 0x0000, 0x0000, 0x6072, 0x6075, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x6067, 0x6073, 0x0000, 0x0000, 0x3A3C, 0x0000, 0x0000, 0x6076, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6077, 0x0000, 0x0000, 0x0000, 0x0000, 0x4D7E,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7B31, 0x0000, 0x6078, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x6079, 0x7B32, 0x0000, 0x0000, 0x6065, 0x0000, 0x0000, 0x0000, 0x0000, 0x607A,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3444, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3C25, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x607B, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x607C, 0x0000, 0x0000, 0x0000, 0x0000, 0x607D, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x313B, 0x0000, 0x0000, 0x0000, 0x6121, 0x0000, 0x493B, 0x6122,
+    0x0000, 0x0000, 0x3424, 0x6123, 0x0000, 0x6124, 0x0000, 0x0000, 0x0000, 0x0000, 0x6125, 0x0000,
+    0x6127, 0x6128, 0x6126, 0x0000, 0x0000, 0x0000, 0x4953, 0x612A, 0x6129, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+75xx */
+    0x0000, 0x7B33, 0x0000, 0x612C, 0x612B, 0x612D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x612E, 0x6130, 0x612F, 0x0000, 0x0000, 0x3979, 0x0000, 0x6132, 0x0000, 0x6131, 0x0000, 0x0000,
+    0x3445, 0x0000, 0x3F53, 0x0000, 0x453C, 0x0000, 0x6133, 0x4038, 0x0000, 0x0000, 0x0000, 0x3B3A,
+    0x0000, 0x3179, 0x6134, 0x0000, 0x4D51, 0x0000, 0x0000, 0x4A63, 0x6135, 0x0000, 0x0000, 0x796C,
+    0x4544, 0x4D33, 0x3943, 0x3F3D, 0x0000, 0x0000, 0x0000, 0x434B, 0x5234, 0x0000, 0x442E, 0x3268,
+    0x6136, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6137, 0x0000, 0x613C, 0x0000,
+    0x0000, 0x613A, 0x6139, 0x5A42, 0x3326, 0x6138, 0x0000, 0x305A, 0x0000, 0x482A, 0x0000, 0x0000,
+    0x484A, 0x0000, 0x0000, 0x0000, 0x0000, 0x4E31, 0x613D, 0x613B, 0x435C, 0x4026, 0x0000, 0x0000,
+    0x482B, 0x0000, 0x492D, 0x0000, 0x613F, 0x4E2C, 0x374D, 0x6140, 0x0000, 0x613E, 0x4856, 0x6141,
+    0x0000, 0x6142, 0x0000, 0x7B34, 0x305B, 0x0000, 0x0000, 0x3E76, 0x6147, 0x0000, 0x6144, 0x466D,
+    0x6143, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3526, 0x0000, 0x0000, 0x614A, 0x0000,
+    0x0000, 0x0000, 0x6145, 0x6146, 0x0000, 0x6149, 0x6148, 0x4925, 0x0000, 0x0000, 0x4142, 0x4141,
+    0x0000, 0x353F, 0x0000, 0x0000, 0x614B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x614C, 0x0000,
+    0x0000, 0x614D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x614F, 0x0000, 0x614E, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x3156, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6157, 0x4868, 0x6151,
+    0x0000, 0x6153, 0x0000, 0x0000, 0x6155, 0x3F3E, 0x0000, 0x0000, 0x6156, 0x6154, 0x3C40, 0x0000,
+    0x0000, 0x0000, 0x6150, 0x6152, 0x0000, 0x4942, 0x0000, 0x3E49, 0x0000, 0x0000, 0x6159, 0x0000,
+    0x0000, 0x6158, 0x0000, 0x0000, 0x0000, 0x0000, 0x615A, 0x0000, 0x3C26, 0x3A2F, 0x0000, 0x0000,
+    0x4577, 0x615B, 0x0000, 0x444B, 0x0000, 0x0000, 0x615D, 0x0000, 0x0000, 0x0000, 0x4E21, 0x615C,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4169, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x6162, 0x0000, 0x6164, 0x6165, 0x4354, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6163, 0x0000,
+    0x6160, 0x0000, 0x615E, 0x615F,
+  },
+  { /* U+76xx */
+    0x0000, 0x6161, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6168, 0x0000, 0x6166,
+    0x0000, 0x6167, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6169, 0x616B, 0x616C, 0x616D, 0x0000,
+    0x616E, 0x0000, 0x0000, 0x616A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x6170, 0x0000, 0x0000, 0x0000, 0x616F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6171,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4E45, 0x0000, 0x0000, 0x0000, 0x6174, 0x6172,
+    0x6173, 0x0000, 0x0000, 0x0000, 0x3462, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4C7E, 0x0000,
+    0x0000, 0x0000, 0x4A4A, 0x0000, 0x6176, 0x0000, 0x0000, 0x0000, 0x6175, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x6177, 0x6178, 0x0000, 0x0000, 0x0000, 0x0000, 0x617C, 0x6179, 0x617A, 0x617B, 0x0000,
+    0x617D, 0x0000, 0x0000, 0x0000, 0x617E, 0x0000, 0x6221, 0x0000, 0x0000, 0x0000, 0x6222, 0x0000,
+    0x6223, 0x0000, 0x482F, 0x4550, 0x6224, 0x4772, 0x4934, 0x0000, 0x6225, 0x0000, 0x7B35, 0x6226,
+    0x452A, 0x0000, 0x3327, 0x3944, 0x6227, 0x0000, 0x0000, 0x6228, 0x0000, 0x0000, 0x6229, 0x0000,
+    0x3B29, 0x0000, 0x0000, 0x622B, 0x0000, 0x0000, 0x622A, 0x0000, 0x0000, 0x622C, 0x622D, 0x7B38,
+    0x7B36, 0x0000, 0x7B37, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7B39, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4869, 0x0000, 0x622E, 0x0000, 0x0000, 0x0000,
+    0x622F, 0x0000, 0x0000, 0x7369, 0x6230, 0x6231, 0x6232, 0x0000, 0x0000, 0x0000, 0x0000, 0x3B2E,
+    0x0000, 0x0000, 0x6233, 0x4756, 0x0000, 0x0000, 0x4B5F, 0x0000, 0x314E, 0x0000, 0x3157, 0x0000,
+    0x0000, 0x6234, 0x0000, 0x0000, 0x0000, 0x0000, 0x6236, 0x0000, 0x0000, 0x0000, 0x6235, 0x4570,
+    0x0000, 0x0000, 0x0000, 0x4039, 0x5D39, 0x0000, 0x6237, 0x4C41, 0x0000, 0x6238, 0x0000, 0x3446,
+    0x4857, 0x6239, 0x0000, 0x623A, 0x0000, 0x0000, 0x623B, 0x0000, 0x0000, 0x0000, 0x4C5C, 0x0000,
+    0x0000, 0x0000, 0x4C55, 0x0000, 0x443E, 0x0000, 0x0000, 0x0000, 0x416A, 0x0000, 0x0000, 0x623D,
+    0x0000, 0x0000, 0x3D62, 0x0000,
+  },
+  { /* U+77xx */
+    0x0000, 0x3E4A, 0x0000, 0x0000, 0x6240, 0x0000, 0x0000, 0x623F, 0x623E, 0x487D, 0x0000, 0x3447,
+    0x3829, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x6246, 0x0000, 0x0000, 0x6243, 0x3F3F, 0x4C32, 0x0000, 0x0000, 0x0000,
+    0x6242, 0x6244, 0x6245, 0x0000, 0x0000, 0x6241, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6247, 0x6248, 0x0000, 0x442F, 0x0000,
+    0x3463, 0x0000, 0x0000, 0x0000, 0x4365, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7B3B, 0x6249,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x624A, 0x624D, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x3F67, 0x0000, 0x4644, 0x0000, 0x624E, 0x4B53, 0x0000, 0x624B, 0x0000, 0x0000, 0x624C,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x6251, 0x0000, 0x0000, 0x0000, 0x0000, 0x6250, 0x624F, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6253, 0x0000, 0x0000, 0x6252, 0x0000,
+    0x0000, 0x6254, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x6256, 0x0000, 0x6255, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A4D, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x3D56, 0x4E46, 0x0000, 0x0000, 0x6257, 0x0000, 0x0000, 0x4637,
+    0x0000, 0x0000, 0x6258, 0x0000, 0x0000, 0x6259, 0x0000, 0x625D, 0x625B, 0x625C, 0x0000, 0x625A,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x625E, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x625F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6260,
+    0x0000, 0x0000, 0x6261, 0x4C37, 0x6262, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4C70, 0x6263,
+    0x0000, 0x434E, 0x0000, 0x476A, 0x0000, 0x366B, 0x0000, 0x0000, 0x0000, 0x433B, 0x6264, 0x363A,
+    0x0000, 0x0000, 0x0000, 0x4050, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x6265, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+78xx */
+    0x0000, 0x0000, 0x3A3D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x6266, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6267, 0x0000, 0x3826, 0x3A55, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6269, 0x7B3D, 0x0000, 0x0000,
+    0x0000, 0x4556, 0x3A56, 0x354E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x4B24, 0x0000, 0x474B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4557, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x395C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x626B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7B3E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3E4B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x7B3F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4E32,
+    0x3945, 0x0000, 0x0000, 0x3827, 0x0000, 0x0000, 0x4823, 0x0000, 0x626D, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x7B40, 0x0000, 0x626F, 0x0000, 0x0000, 0x0000, 0x0000, 0x386B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x626E, 0x4476, 0x0000, 0x0000, 0x0000, 0x0000, 0x6271, 0x3337, 0x626C, 0x0000,
+    0x0000, 0x486A, 0x0000, 0x3130, 0x0000, 0x3A6C, 0x0000, 0x4F52, 0x0000, 0x0000, 0x6270, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6272, 0x0000, 0x0000, 0x0000, 0x4A4B,
+    0x0000, 0x4059, 0x6274, 0x0000, 0x0000, 0x0000, 0x0000, 0x6275, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x6273, 0x0000, 0x0000, 0x0000, 0x0000, 0x334E, 0x0000, 0x627B, 0x0000, 0x627A, 0x0000,
+    0x0000, 0x3C27, 0x0000, 0x0000, 0x0000, 0x627C, 0x6277, 0x0000, 0x0000, 0x0000, 0x627D, 0x6278,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x4858, 0x6276, 0x0000, 0x0000, 0x6279, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x6322, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x6321, 0x4B61, 0x0000, 0x0000, 0x0000, 0x627E, 0x0000, 0x0000, 0x306B,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x6324, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x6323, 0x0000, 0x0000,
+  },
+  { /* U+79xx */
+    0x0000, 0x3E4C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6325, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x4143, 0x0000, 0x0000, 0x6327, 0x6326, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x6328, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x6268, 0x0000, 0x0000, 0x0000, 0x626A, 0x632A, 0x6329, 0x0000, 0x0000, 0x0000,
+    0x7B41, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3C28, 0x0000,
+    0x4E69, 0x0000, 0x3C52, 0x0000, 0x632B, 0x3737, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3540,
+    0x3527, 0x3B63, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4D34, 0x0000, 0x0000, 0x6331,
+    0x0000, 0x6330, 0x4144, 0x632D, 0x0000, 0x0000, 0x632F, 0x0000, 0x0000, 0x3D4B, 0x3F40, 0x632E,
+    0x632C, 0x0000, 0x472A, 0x0000, 0x0000, 0x3E4D, 0x0000, 0x0000, 0x493C, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x3A57, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4578,
+    0x0000, 0x0000, 0x6332, 0x0000, 0x0000, 0x0000, 0x0000, 0x6333, 0x6349, 0x3658, 0x0000, 0x0000,
+    0x4F3D, 0x4135, 0x0000, 0x0000, 0x0000, 0x0000, 0x6334, 0x0000, 0x0000, 0x3252, 0x4477, 0x4A21,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x7B45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7B47,
+    0x0000, 0x6335, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x357A, 0x6336,
+    0x0000, 0x0000, 0x6338, 0x0000, 0x0000, 0x0000, 0x6339, 0x0000, 0x4729, 0x0000, 0x0000, 0x633A,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x633B, 0x633C, 0x0000, 0x0000, 0x3659, 0x3253, 0x4645,
+    0x3D28, 0x3B64, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x633D, 0x0000, 0x3D29,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x324A, 0x4943, 0x0000, 0x0000, 0x633E, 0x0000, 0x0000,
+    0x486B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4145, 0x0000, 0x6341, 0x0000, 0x6342,
+    0x4769, 0x0000, 0x3F41, 0x633F, 0x0000, 0x4361, 0x0000, 0x0000, 0x6340, 0x0000, 0x0000, 0x0000,
+    0x3E4E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x305C,
+    0x0000, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+7Axx */
+    0x3529, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6343, 0x0000, 0x0000, 0x4478,
+    0x0000, 0x6344, 0x4047, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4C2D, 0x0000, 0x0000, 0x4923,
+    0x6345, 0x6346, 0x4355, 0x0000, 0x4E47, 0x0000, 0x0000, 0x6348, 0x6347, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3C6F, 0x0000,
+    0x0000, 0x634A, 0x3070, 0x0000, 0x0000, 0x0000, 0x0000, 0x634D, 0x0000, 0x0000, 0x0000, 0x634B,
+    0x3254, 0x374E, 0x634C, 0x3946, 0x3972, 0x0000, 0x4A66, 0x634E, 0x0000, 0x0000, 0x4B54, 0x0000,
+    0x0000, 0x6350, 0x0000, 0x0000, 0x0000, 0x4051, 0x314F, 0x323A, 0x302C, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x634F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x6351, 0x6352, 0x3E77, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6353, 0x0000, 0x334F,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x6355, 0x0000, 0x0000, 0x0000, 0x376A, 0x0000, 0x3566, 0x0000,
+    0x0000, 0x6356, 0x3675, 0x0000, 0x0000, 0x6357, 0x0000, 0x407C, 0x0000, 0x464D, 0x0000, 0x4060,
+    0x3A75, 0x0000, 0x0000, 0x0000, 0x6358, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x4362, 0x416B, 0x0000, 0x635A, 0x635C, 0x6359, 0x635B, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x3722, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x635D, 0x3726, 0x0000, 0x0000, 0x0000, 0x3567, 0x4D52, 0x635F, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x6360, 0x0000, 0x0000, 0x0000, 0x312E, 0x0000, 0x0000, 0x0000, 0x0000, 0x6363,
+    0x0000, 0x0000, 0x0000, 0x3376, 0x6362, 0x6361, 0x0000, 0x6365, 0x635E, 0x0000, 0x6366, 0x4E29,
+    0x0000, 0x6367, 0x0000, 0x6368, 0x0000, 0x7B48, 0x5474, 0x636A, 0x0000, 0x6369, 0x0000, 0x0000,
+    0x0000, 0x636B, 0x636C, 0x0000, 0x4E35, 0x636D, 0x0000, 0x706F, 0x3E4F, 0x636E, 0x636F, 0x3D57,
+    0x0000, 0x4638, 0x6370, 0x7B49, 0x0000, 0x0000, 0x4328, 0x7B4B, 0x0000, 0x6371, 0x0000, 0x433C,
+    0x6372, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3625, 0x0000, 0x513F, 0x435D, 0x3C33, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x3448,
+  },
+  { /* U+7Bxx */
+    0x0000, 0x0000, 0x6373, 0x0000, 0x6422, 0x0000, 0x6376, 0x0000, 0x3568, 0x0000, 0x6375, 0x6424,
+    0x0000, 0x0000, 0x0000, 0x6374, 0x0000, 0x3E50, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x6378, 0x6379, 0x0000, 0x452B, 0x0000, 0x0000, 0x637A, 0x0000, 0x335E, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x3F5A, 0x4964, 0x0000, 0x637C, 0x0000, 0x0000, 0x0000, 0x4268, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x6377, 0x0000, 0x637B, 0x637D, 0x0000, 0x0000, 0x3A7B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6426, 0x492E, 0x0000,
+    0x4826, 0x4579, 0x0000, 0x365A, 0x6425, 0x6423, 0x0000, 0x4835, 0x637E, 0x435E, 0x457B, 0x0000,
+    0x457A, 0x0000, 0x3A76, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6438, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6428, 0x0000, 0x642A, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x642D, 0x0000, 0x642E, 0x0000, 0x642B, 0x642C, 0x0000, 0x0000, 0x6429, 0x6427, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x6421, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x4A4F, 0x3255, 0x0000, 0x0000, 0x0000, 0x6435, 0x0000, 0x6432, 0x0000, 0x6437,
+    0x0000, 0x0000, 0x6436, 0x0000, 0x4773, 0x4C27, 0x0000, 0x3B3B, 0x6430, 0x6439, 0x6434, 0x0000,
+    0x6433, 0x642F, 0x7B4C, 0x6431, 0x0000, 0x3449, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x433D, 0x0000, 0x0000, 0x407D, 0x0000, 0x0000, 0x0000, 0x4822, 0x0000, 0x0000,
+    0x643E, 0x0000, 0x0000, 0x0000, 0x4824, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x4061, 0x643B, 0x0000, 0x0000, 0x484F, 0x0000, 0x643F, 0x4A53, 0x0000, 0x435B, 0x0000, 0x643A,
+    0x643C, 0x0000, 0x0000, 0x643D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6440, 0x0000, 0x0000, 0x3C44, 0x0000, 0x0000, 0x0000,
+    0x4646, 0x6445, 0x6444, 0x0000, 0x0000, 0x6441, 0x0000, 0x0000, 0x0000, 0x4F36, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x644A, 0x0000, 0x0000, 0x644E, 0x644B, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+7Cxx */
+    0x6447, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6448, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x644D, 0x0000, 0x0000, 0x0000, 0x6442, 0x5255, 0x6449, 0x6443, 0x0000, 0x0000, 0x644C,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6452, 0x0000, 0x344A, 0x0000, 0x644F,
+    0x0000, 0x0000, 0x0000, 0x6450, 0x0000, 0x0000, 0x6451, 0x6454, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6453, 0x4876, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x6455, 0x4E7C, 0x4A6D, 0x645A, 0x0000, 0x0000, 0x6457, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x6456, 0x4052, 0x0000, 0x6459, 0x645B, 0x0000, 0x0000, 0x0000,
+    0x6458, 0x0000, 0x645F, 0x0000, 0x645C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x645D,
+    0x6446, 0x0000, 0x0000, 0x0000, 0x645E, 0x6460, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x6461, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A46, 0x0000, 0x6462, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4C62, 0x0000, 0x0000, 0x364E, 0x3729, 0x6463,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A34, 0x0000, 0x3F68, 0x0000, 0x4C30, 0x0000, 0x0000,
+    0x6464, 0x0000, 0x4E33, 0x0000, 0x0000, 0x4774, 0x0000, 0x4146, 0x4734, 0x0000, 0x0000, 0x3D4D,
+    0x0000, 0x0000, 0x0000, 0x3040, 0x0000, 0x6469, 0x6467, 0x0000, 0x6465, 0x3421, 0x0000, 0x3E51,
+    0x646A, 0x0000, 0x0000, 0x6468, 0x0000, 0x6466, 0x646E, 0x0000, 0x0000, 0x646D, 0x646C, 0x646B,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x646F, 0x0000, 0x0000, 0x0000, 0x6470, 0x403A, 0x0000,
+    0x6471, 0x0000, 0x6473, 0x0000, 0x0000, 0x6472, 0x0000, 0x0000, 0x0000, 0x0000, 0x3852, 0x0000,
+    0x0000, 0x0000, 0x4138, 0x0000, 0x0000, 0x0000, 0x6475, 0x0000, 0x0000, 0x0000, 0x457C, 0x0000,
+    0x6474, 0x0000, 0x0000, 0x0000, 0x6476, 0x0000, 0x4A35, 0x416C, 0x3947, 0x0000, 0x6477, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x4E48, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6479,
+    0x0000, 0x0000, 0x647A, 0x0000, 0x647B, 0x0000, 0x647C, 0x0000, 0x3B65, 0x0000, 0x647D, 0x374F,
+    0x0000, 0x0000, 0x356A, 0x0000,
+  },
+  { /* U+7Dxx */
+    0x352A, 0x0000, 0x6521, 0x0000, 0x4C73, 0x3948, 0x647E, 0x0000, 0x0000, 0x0000, 0x6524, 0x4C66,
+    0x0000, 0x473C, 0x0000, 0x0000, 0x4933, 0x0000, 0x0000, 0x0000, 0x3D63, 0x6523, 0x0000, 0x3C53,
+    0x3949, 0x3B66, 0x3569, 0x4A36, 0x6522, 0x0000, 0x0000, 0x0000, 0x4147, 0x4B42, 0x3A77, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3B67, 0x445D, 0x0000, 0x6527, 0x4E5F,
+    0x3A59, 0x0000, 0x6528, 0x3F42, 0x0000, 0x652A, 0x0000, 0x0000, 0x0000, 0x3E52, 0x3A30, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x6529, 0x0000, 0x0000, 0x3D2A, 0x383E, 0x4148, 0x6525, 0x652B, 0x0000,
+    0x7B4E, 0x0000, 0x0000, 0x6526, 0x3750, 0x0000, 0x652E, 0x6532, 0x376B, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x652D, 0x0000, 0x0000, 0x0000, 0x0000, 0x6536, 0x7B4F, 0x0000, 0x394A, 0x0000,
+    0x0000, 0x4D6D, 0x303C, 0x6533, 0x0000, 0x0000, 0x356B, 0x0000, 0x6530, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x6531, 0x0000, 0x0000, 0x457D, 0x652F, 0x652C, 0x0000, 0x3328, 0x4064, 0x0000,
+    0x0000, 0x3828, 0x0000, 0x0000, 0x0000, 0x6538, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6535, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6537,
+    0x0000, 0x0000, 0x0000, 0x6534, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3751, 0x4233, 0x6539,
+    0x416E, 0x0000, 0x0000, 0x6546, 0x7B51, 0x0000, 0x6542, 0x653C, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x6540, 0x3C7A, 0x305D, 0x653B, 0x6543, 0x6547, 0x394B, 0x4C56, 0x0000,
+    0x4456, 0x653D, 0x0000, 0x7B50, 0x6545, 0x0000, 0x653A, 0x433E, 0x0000, 0x653F, 0x303D, 0x4C4A,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x653E, 0x0000, 0x0000, 0x365B, 0x486C,
+    0x0000, 0x0000, 0x0000, 0x416D, 0x0000, 0x4E50, 0x3D6F, 0x0000, 0x0000, 0x656E, 0x7B52, 0x0000,
+    0x6548, 0x0000, 0x407E, 0x0000, 0x6544, 0x6549, 0x654B, 0x0000, 0x4479, 0x654E, 0x0000, 0x0000,
+    0x654A, 0x0000, 0x0000, 0x0000, 0x4A54, 0x344B, 0x0000, 0x0000, 0x4C4B, 0x0000, 0x0000, 0x305E,
+    0x0000, 0x0000, 0x654D, 0x0000, 0x4E7D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x654C,
+    0x0000, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+7Exx */
+    0x0000, 0x316F, 0x0000, 0x0000, 0x466C, 0x654F, 0x0000, 0x0000, 0x0000, 0x6556, 0x6550, 0x6557,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6553, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x477B, 0x0000, 0x0000, 0x3C4A, 0x6555, 0x0000, 0x6552, 0x6558, 0x6551,
+    0x0000, 0x0000, 0x3D44, 0x0000, 0x0000, 0x0000, 0x0000, 0x4B25, 0x0000, 0x0000, 0x3D4C, 0x0000,
+    0x0000, 0x6554, 0x6560, 0x0000, 0x0000, 0x655C, 0x0000, 0x655F, 0x0000, 0x655D, 0x6561, 0x655B,
+    0x0000, 0x6541, 0x4053, 0x0000, 0x0000, 0x484B, 0x0000, 0x655E, 0x0000, 0x0000, 0x6559, 0x0000,
+    0x0000, 0x0000, 0x4121, 0x3752, 0x0000, 0x3D2B, 0x0000, 0x0000, 0x0000, 0x0000, 0x7B53, 0x0000,
+    0x3F25, 0x4136, 0x6564, 0x0000, 0x0000, 0x6566, 0x6567, 0x0000, 0x0000, 0x6563, 0x6565, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x655A, 0x6562, 0x0000, 0x656A, 0x6569, 0x0000,
+    0x0000, 0x4B7A, 0x0000, 0x0000, 0x372B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x6568, 0x0000, 0x656C, 0x656B, 0x656F, 0x0000, 0x6571, 0x0000, 0x0000, 0x3B3C, 0x656D,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x6572, 0x6573, 0x7921, 0x0000, 0x6574, 0x0000, 0x657A, 0x453B,
+    0x6576, 0x0000, 0x6575, 0x6577, 0x6578, 0x0000, 0x6579, 0x0000, 0x0000, 0x0000, 0x0000, 0x657B,
+    0x657C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+7Fxx */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x344C, 0x0000, 0x657D, 0x0000, 0x657E, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6621, 0x0000, 0x7B54,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x6622, 0x6623, 0x6624, 0x0000, 0x6625, 0x6626, 0x0000, 0x0000,
+    0x6628, 0x6627, 0x0000, 0x0000, 0x6629, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x662A,
+    0x662B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x662E, 0x662C, 0x662D, 0x3A61, 0x3753,
+    0x0000, 0x0000, 0x4356, 0x0000, 0x4833, 0x0000, 0x3D70, 0x0000, 0x0000, 0x474D, 0x0000, 0x486D,
+    0x662F, 0x586D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6630, 0x6632,
+    0x0000, 0x4D65, 0x6631, 0x6634, 0x6633, 0x0000, 0x4D53, 0x0000, 0x6635, 0x0000, 0x487E, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x6636, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6639, 0x0000,
+    0x0000, 0x6638, 0x6637, 0x0000, 0x0000, 0x7B55, 0x0000, 0x663A, 0x3732, 0x0000, 0x0000, 0x0000,
+    0x4122, 0x3541, 0x0000, 0x0000, 0x0000, 0x0000, 0x663E, 0x663B, 0x0000, 0x0000, 0x663C, 0x0000,
+    0x0000, 0x0000, 0x663F, 0x0000, 0x6640, 0x663D, 0x0000, 0x0000, 0x0000, 0x3129, 0x0000, 0x0000,
+    0x0000, 0x3227, 0x0000, 0x0000, 0x0000, 0x6642, 0x6643, 0x0000, 0x0000, 0x0000, 0x6644, 0x0000,
+    0x4D62, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3D2C, 0x0000, 0x6646, 0x6645, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3F69, 0x6647, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x6648, 0x0000, 0x0000, 0x6649, 0x0000, 0x3465, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x344D, 0x0000, 0x0000, 0x664A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x664B, 0x0000, 0x4B5D,
+    0x4D63, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+80xx */
+    0x4D54, 0x4F37, 0x0000, 0x394D, 0x664E, 0x3C54, 0x664D, 0x0000, 0x0000, 0x0000, 0x0000, 0x664F,
+    0x3C29, 0x0000, 0x0000, 0x0000, 0x4251, 0x0000, 0x6650, 0x0000, 0x0000, 0x394C, 0x0000, 0x4C57,
+    0x6651, 0x6652, 0x0000, 0x0000, 0x6653, 0x0000, 0x0000, 0x0000, 0x0000, 0x6654, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x6655, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x3C2A, 0x0000, 0x0000, 0x4C6D, 0x0000, 0x0000, 0x0000, 0x0000, 0x6657,
+    0x0000, 0x433F, 0x0000, 0x6656, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6659, 0x0000,
+    0x0000, 0x0000, 0x6658, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x665A, 0x0000,
+    0x0000, 0x0000, 0x403B, 0x0000, 0x665B, 0x0000, 0x665C, 0x0000, 0x0000, 0x0000, 0x4A39, 0x665D,
+    0x0000, 0x416F, 0x665E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x665F, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x4E7E, 0x6662, 0x0000, 0x6661, 0x6660, 0x4430, 0x0000, 0x6663, 0x3F26,
+    0x0000, 0x6664, 0x0000, 0x0000, 0x0000, 0x6665, 0x4F38, 0x6666, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x6667, 0x6669, 0x6668, 0x4825, 0x0000, 0x4679, 0x0000, 0x4F3E, 0x4829, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x666B, 0x0000, 0x0000, 0x3E53, 0x0000, 0x492A, 0x0000, 0x666C, 0x666A,
+    0x0000, 0x344E, 0x0000, 0x0000, 0x0000, 0x3854, 0x3B68, 0x0000, 0x0000, 0x486E, 0x0000, 0x0000,
+    0x0000, 0x382A, 0x4B43, 0x0000, 0x666F, 0x666D, 0x0000, 0x394E, 0x0000, 0x394F, 0x3069, 0x0000,
+    0x3A68, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4759, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x305F, 0x6674, 0x0000, 0x4340, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x4758, 0x0000, 0x425B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6676, 0x0000,
+    0x0000, 0x6672, 0x6675, 0x6670, 0x0000, 0x6673, 0x4B26, 0x0000, 0x0000, 0x3855, 0x0000, 0x0000,
+    0x307D, 0x6671, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6678,
+    0x0000, 0x6679, 0x0000, 0x0000, 0x4639, 0x0000, 0x0000, 0x0000, 0x363B, 0x0000, 0x0000, 0x0000,
+    0x6726, 0x473D, 0x0000, 0x0000,
+  },
+  { /* U+81xx */
+    0x0000, 0x0000, 0x3B69, 0x0000, 0x0000, 0x363C, 0x4048, 0x4F46, 0x4C2E, 0x6677, 0x4054, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x3553, 0x667A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x667C,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x667B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x667D,
+    0x0000, 0x4326, 0x0000, 0x473E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4431, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x6723, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6722, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x667E, 0x0000, 0x0000, 0x3F55, 0x0000, 0x4965, 0x6725, 0x0000, 0x6724,
+    0x3950, 0x4F53, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6735,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6729, 0x672A, 0x0000, 0x0000, 0x0000, 0x0000, 0x3C70,
+    0x0000, 0x0000, 0x6728, 0x0000, 0x3978, 0x6727, 0x0000, 0x0000, 0x672B, 0x0000, 0x0000, 0x0000,
+    0x4432, 0x4A22, 0x4123, 0x0000, 0x0000, 0x0000, 0x0000, 0x425C, 0x672F, 0x0000, 0x6730, 0x672C,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x672D, 0x0000, 0x672E, 0x0000, 0x0000, 0x0000, 0x0000, 0x3951,
+    0x0000, 0x0000, 0x0000, 0x6736, 0x0000, 0x6732, 0x0000, 0x0000, 0x0000, 0x0000, 0x4966, 0x0000,
+    0x4B6C, 0x4928, 0x0000, 0x0000, 0x6731, 0x0000, 0x0000, 0x6734, 0x6733, 0x0000, 0x0000, 0x0000,
+    0x4B44, 0x6737, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6738, 0x0000, 0x0000, 0x4137,
+    0x0000, 0x6739, 0x0000, 0x0000, 0x673B, 0x0000, 0x673F, 0x0000, 0x0000, 0x673C, 0x673A, 0x473F,
+    0x673D, 0x0000, 0x673E, 0x0000, 0x0000, 0x0000, 0x3232, 0x0000, 0x6745, 0x6740, 0x0000, 0x0000,
+    0x0000, 0x6741, 0x0000, 0x0000, 0x0000, 0x6742, 0x0000, 0x4221, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x6744, 0x6743, 0x6746, 0x0000, 0x0000, 0x0000, 0x0000, 0x6747, 0x6748, 0x0000, 0x0000, 0x3F43,
+    0x0000, 0x3269, 0x0000, 0x6749, 0x4E57, 0x0000, 0x3C2B, 0x0000, 0x0000, 0x3D2D, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x3B6A, 0x4357, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x674A, 0x674B,
+    0x3131, 0x0000, 0x674C, 0x0000,
+  },
+  { /* U+82xx */
+    0x0000, 0x674D, 0x674E, 0x0000, 0x0000, 0x674F, 0x0000, 0x6750, 0x363D, 0x5A2A, 0x6751, 0x0000,
+    0x4065, 0x6752, 0x3C4B, 0x0000, 0x6753, 0x0000, 0x5030, 0x0000, 0x0000, 0x0000, 0x6754, 0x4A5E,
+    0x345C, 0x0000, 0x0000, 0x4124, 0x3D58, 0x0000, 0x4971, 0x3D2E, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6755, 0x3952, 0x6756, 0x484C, 0x0000, 0x6764, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x6758, 0x0000, 0x4249, 0x4775, 0x383F, 0x6757, 0x4125, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x6759, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x447A,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x675B, 0x675A, 0x675D, 0x0000, 0x0000, 0x675C, 0x0000, 0x675E,
+    0x0000, 0x0000, 0x6760, 0x0000, 0x675F, 0x0000, 0x344F, 0x0000, 0x6761, 0x0000, 0x6762, 0x6763,
+    0x0000, 0x0000, 0x3A31, 0x4E49, 0x0000, 0x6765, 0x3F27, 0x0000, 0x0000, 0x0000, 0x3170, 0x6766,
+    0x6767, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6768, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3072, 0x0000, 0x6769, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x676A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4967, 0x0000, 0x0000,
+    0x0000, 0x3C47, 0x0000, 0x676C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3329, 0x3032, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x676B, 0x676E, 0x474E, 0x0000, 0x3F44, 0x0000, 0x3256, 0x0000, 0x4B27,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x375D, 0x365C, 0x0000, 0x676D, 0x0000, 0x326A, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3423, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3171, 0x6772, 0x4E6A, 0x425D, 0x0000, 0x0000, 0x4944,
+    0x0000, 0x677E, 0x0000, 0x3257, 0x677C, 0x0000, 0x677A, 0x6771, 0x0000, 0x676F, 0x0000, 0x6770,
+    0x0000, 0x3C63, 0x366C, 0x4377, 0x0000, 0x0000, 0x0000, 0x4651, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x3151, 0x0000, 0x6774, 0x6773, 0x0000, 0x0000, 0x0000, 0x0000, 0x6779, 0x6775, 0x6778,
+    0x0000, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+83xx */
+    0x0000, 0x7B57, 0x4C50, 0x6777, 0x3258, 0x337D, 0x677B, 0x0000, 0x0000, 0x677D, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x3754, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6823, 0x682C,
+    0x682D, 0x0000, 0x0000, 0x0000, 0x302B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6834,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x3071, 0x0000, 0x0000, 0x682B, 0x0000, 0x0000, 0x0000, 0x682A,
+    0x0000, 0x6825, 0x6824, 0x0000, 0x6822, 0x6821, 0x4363, 0x0000, 0x427B, 0x6827, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x6826, 0x0000, 0x0000, 0x0000, 0x0000, 0x6829, 0x0000, 0x0000,
+    0x0000, 0x4170, 0x3755, 0x0000, 0x0000, 0x0000, 0x0000, 0x3141, 0x6828, 0x0000, 0x3953, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x4171, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x7B58, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x683A, 0x0000, 0x683B, 0x0000, 0x3259,
+    0x0000, 0x0000, 0x0000, 0x322E, 0x6838, 0x0000, 0x0000, 0x7B59, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x682E, 0x0000, 0x6836, 0x0000, 0x683D, 0x6837, 0x0000, 0x0000, 0x0000, 0x6835, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x6776, 0x0000, 0x0000, 0x6833, 0x0000, 0x0000, 0x0000, 0x682F, 0x0000,
+    0x0000, 0x0000, 0x3450, 0x6831, 0x683C, 0x0000, 0x6832, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x683E, 0x0000, 0x6830, 0x477C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4D69, 0x0000, 0x0000,
+    0x0000, 0x6839, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x684F, 0x0000, 0x0000,
+    0x0000, 0x6847, 0x0000, 0x0000, 0x0000, 0x3F7B, 0x0000, 0x7B5A, 0x0000, 0x0000, 0x3546, 0x0000,
+    0x365D, 0x0000, 0x6842, 0x0000, 0x0000, 0x0000, 0x0000, 0x325B, 0x0000, 0x0000, 0x3E54, 0x0000,
+    0x6845, 0x0000, 0x0000, 0x0000, 0x3A5A, 0x0000, 0x0000, 0x4551, 0x684A, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A6E, 0x0000, 0x6841, 0x0000, 0x0000, 0x0000, 0x325A,
+    0x3856, 0x4929, 0x684B, 0x0000, 0x683F, 0x0000, 0x7B5B, 0x6848, 0x0000, 0x0000, 0x0000, 0x6852,
+    0x0000, 0x6843, 0x0000, 0x0000,
+  },
+  { /* U+84xx */
+    0x0000, 0x0000, 0x0000, 0x6844, 0x463A, 0x0000, 0x0000, 0x6849, 0x0000, 0x0000, 0x0000, 0x6846,
+    0x4B28, 0x684C, 0x3060, 0x0000, 0x0000, 0x0000, 0x0000, 0x6840, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x684E, 0x0000, 0x684D, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x476B, 0x6854, 0x0000, 0x685F, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x337E, 0x0000, 0x0000, 0x0000, 0x6862, 0x0000, 0x0000, 0x6850, 0x0000, 0x0000, 0x0000,
+    0x6855, 0x4D6E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x685E, 0x0000,
+    0x7B5C, 0x4D55, 0x0000, 0x0000, 0x0000, 0x0000, 0x4E2A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x4378, 0x0000, 0x0000, 0x0000, 0x336B, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x4972, 0x6864, 0x4621, 0x0000, 0x0000, 0x3031, 0x0000, 0x0000, 0x685D, 0x0000, 0x6859,
+    0x4172, 0x6853, 0x685B, 0x6860, 0x0000, 0x472C, 0x0000, 0x0000, 0x0000, 0x302A, 0x0000, 0x6858,
+    0x0000, 0x6861, 0x4978, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x685C, 0x0000,
+    0x6857, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3E55, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x3D2F, 0x0000, 0x0000, 0x0000, 0x3C2C, 0x0000, 0x0000, 0x0000, 0x0000, 0x4C58, 0x0000, 0x0000,
+    0x4947, 0x0000, 0x0000, 0x6867, 0x0000, 0x6870, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x685A, 0x0000, 0x0000, 0x0000, 0x0000, 0x3377, 0x0000,
+    0x7B5D, 0x0000, 0x0000, 0x0000, 0x3E78, 0x6865, 0x0000, 0x686A, 0x4173, 0x0000, 0x0000, 0x6866,
+    0x0000, 0x686D, 0x0000, 0x0000, 0x435F, 0x0000, 0x686E, 0x0000, 0x0000, 0x4D56, 0x6863, 0x3338,
+    0x0000, 0x6869, 0x0000, 0x0000, 0x686C, 0x4C2C, 0x0000, 0x0000, 0x0000, 0x0000, 0x686F, 0x0000,
+    0x0000, 0x6868, 0x686B, 0x0000, 0x7925, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4B29, 0x0000, 0x4F21, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x6873, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x687A, 0x0000, 0x0000, 0x6872,
+  },
+  { /* U+85xx */
+    0x3C43, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6851, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A4E, 0x0000, 0x4C22, 0x6879, 0x6878, 0x0000, 0x6874,
+    0x6875, 0x0000, 0x3136, 0x0000, 0x0000, 0x0000, 0x0000, 0x6877, 0x0000, 0x6871, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x4455, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6876, 0x307E, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4222, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x4A43, 0x0000, 0x0000, 0x687B, 0x6921, 0x0000, 0x4859, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x687E, 0x3E56, 0x3C49, 0x6923, 0x0000, 0x0000, 0x363E, 0x0000, 0x0000, 0x0000, 0x0000, 0x7B5E,
+    0x0000, 0x6924, 0x0000, 0x4979, 0x687D, 0x7B5F, 0x6856, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x687C, 0x0000, 0x0000, 0x0000, 0x0000, 0x4F4F, 0x4622, 0x4973, 0x7B60,
+    0x0000, 0x692B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6931,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6932, 0x0000, 0x6925, 0x0000, 0x0000, 0x0000,
+    0x4776, 0x0000, 0x0000, 0x692F, 0x6927, 0x0000, 0x6929, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x6933, 0x6928, 0x0000, 0x0000, 0x692C, 0x0000, 0x0000, 0x3172, 0x0000, 0x4665, 0x0000, 0x692D,
+    0x6930, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6926, 0x0000, 0x4126, 0x0000,
+    0x692A, 0x3B27, 0x3F45, 0x3730, 0x4C74, 0x0000, 0x4C79, 0x3D72, 0x7B62, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6937, 0x6935, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x4F4E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6934, 0x0000, 0x0000,
+    0x0000, 0x4D75, 0x0000, 0x6936, 0x6938, 0x0000, 0x0000, 0x0000, 0x0000, 0x6939, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x693C, 0x693A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x4623, 0x693B, 0x0000, 0x0000, 0x0000, 0x484D, 0x692E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3D73, 0x0000, 0x693D, 0x6942, 0x4174,
+    0x0000, 0x0000, 0x6941, 0x0000,
+  },
+  { /* U+86xx */
+    0x0000, 0x0000, 0x6922, 0x0000, 0x0000, 0x0000, 0x6943, 0x4149, 0x0000, 0x0000, 0x693E, 0x6940,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x693F, 0x0000, 0x0000, 0x5D31, 0x5D22,
+    0x0000, 0x0000, 0x6945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6944, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4D76, 0x0000, 0x623C,
+    0x6946, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x6947, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6948, 0x3857, 0x0000, 0x3554, 0x0000, 0x0000, 0x0000,
+    0x694A, 0x515D, 0x0000, 0x0000, 0x0000, 0x0000, 0x3575, 0x0000, 0x4E3A, 0x0000, 0x3673, 0x694B,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x694C, 0x0000, 0x0000, 0x0000, 0x436E,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x694D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x467A, 0x0000, 0x303A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3263, 0x6952, 0x6953, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x694E, 0x0000, 0x3B3D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x694F, 0x4742, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x6950, 0x6951, 0x695B, 0x0000, 0x0000, 0x0000, 0x6955, 0x6958, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x6954, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x6956, 0x0000, 0x6957, 0x3C58, 0x0000, 0x6959, 0x0000, 0x4341,
+    0x0000, 0x3756, 0x3342, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x695C, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x333F, 0x0000, 0x6961, 0x0000, 0x0000, 0x695D, 0x6960, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x483A, 0x0000, 0x0000, 0x0000, 0x0000, 0x695E, 0x0000, 0x0000, 0x695F, 0x4948, 0x485A, 0x6962,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x427D, 0x696C, 0x0000, 0x6968,
+    0x0000, 0x0000, 0x326B, 0x0000,
+  },
+  { /* U+87xx */
+    0x6966, 0x0000, 0x4B2A, 0x6967, 0x0000, 0x0000, 0x6964, 0x0000, 0x6965, 0x696A, 0x696D, 0x0000,
+    0x0000, 0x696B, 0x0000, 0x0000, 0x0000, 0x6969, 0x6963, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x4358, 0x0000, 0x6974, 0x0000, 0x4C2A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x6972, 0x0000, 0x0000, 0x0000, 0x6973, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x696E, 0x0000, 0x0000, 0x6970, 0x0000, 0x0000, 0x0000, 0x6971,
+    0x0000, 0x0000, 0x0000, 0x696F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x4066, 0x0000, 0x4F39, 0x6978, 0x0000, 0x6979, 0x0000, 0x0000, 0x0000, 0x0000, 0x6A21,
+    0x0000, 0x3F2A, 0x0000, 0x697B, 0x0000, 0x697E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6976,
+    0x6975, 0x0000, 0x0000, 0x6A22, 0x0000, 0x0000, 0x325C, 0x0000, 0x697C, 0x0000, 0x6A23, 0x0000,
+    0x0000, 0x0000, 0x697D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x697A, 0x0000, 0x4433, 0x0000,
+    0x6977, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4768, 0x0000, 0x0000, 0x6A27, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4D3B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x6A26, 0x0000, 0x0000, 0x6A25, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x6A2E, 0x0000, 0x0000, 0x0000, 0x6A28, 0x0000, 0x0000, 0x0000, 0x6A30,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4D66, 0x6A33, 0x0000, 0x6A2A, 0x0000, 0x0000,
+    0x6A2B, 0x0000, 0x0000, 0x0000, 0x6A2F, 0x0000, 0x6A32, 0x6A31, 0x0000, 0x0000, 0x0000, 0x6A29,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x6A2C, 0x0000, 0x6A3D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6A36, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6A34,
+    0x0000, 0x0000, 0x6A35, 0x0000, 0x0000, 0x0000, 0x6A3A, 0x6A3B, 0x0000, 0x332A, 0x0000, 0x3542,
+    0x0000, 0x0000, 0x6A39, 0x0000,
+  },
+  { /* U+88xx */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6A24, 0x0000, 0x7B65, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x6A38, 0x6A3C, 0x6A37, 0x0000, 0x6A3E, 0x0000, 0x0000, 0x0000, 0x6A40, 0x6A3F, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6A42, 0x6A41, 0x695A,
+    0x0000, 0x0000, 0x0000, 0x6A46, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x6A43, 0x0000, 0x0000, 0x0000, 0x0000, 0x6A44, 0x0000, 0x0000, 0x6A45, 0x0000, 0x6A47,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x376C, 0x0000, 0x6A49, 0x0000, 0x6A48, 0x0000, 0x3D30, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x3954, 0x5E27, 0x0000, 0x0000, 0x0000, 0x0000, 0x6A4A, 0x3D51,
+    0x0000, 0x0000, 0x0000, 0x3339, 0x0000, 0x6A4B, 0x0000, 0x3152, 0x0000, 0x3E57, 0x6A4C, 0x0000,
+    0x0000, 0x3955, 0x6A4D, 0x3061, 0x0000, 0x0000, 0x0000, 0x0000, 0x493D, 0x0000, 0x0000, 0x6A4E,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x3F6A, 0x0000, 0x6A55, 0x0000, 0x0000, 0x6A52, 0x0000, 0x436F,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6A53, 0x6A50, 0x365E, 0x0000, 0x6A4F, 0x6A56, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x3736, 0x0000, 0x0000, 0x425E, 0x0000, 0x6A5C, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x6A58, 0x0000, 0x0000, 0x0000, 0x4235, 0x6A57, 0x0000, 0x6A5A, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x6A51, 0x0000, 0x0000, 0x0000, 0x6A5B, 0x0000, 0x6A5D, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x486F, 0x0000, 0x0000, 0x6A59, 0x0000, 0x6A5E, 0x6A60, 0x0000, 0x0000,
+    0x3853, 0x6A54, 0x0000, 0x3041, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6A5F,
+    0x0000, 0x3A5B, 0x4E76, 0x6A61, 0x6A62, 0x4175, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x4E22, 0x0000, 0x0000, 0x0000, 0x0000, 0x6A63, 0x4D35, 0x0000, 0x0000,
+    0x6A64, 0x6A65, 0x0000, 0x0000, 0x4A64, 0x6A66, 0x0000, 0x3A40, 0x0000, 0x4E23, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x6A6B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x6A6C, 0x3E58, 0x6A6A, 0x7B66, 0x0000, 0x0000, 0x4D67, 0x6A67, 0x0000, 0x0000,
+    0x6A69, 0x403D, 0x3F7E, 0x0000,
+  },
+  { /* U+89xx */
+    0x0000, 0x0000, 0x6A68, 0x0000, 0x6A6D, 0x0000, 0x0000, 0x4A23, 0x0000, 0x0000, 0x6A6F, 0x0000,
+    0x6A6E, 0x0000, 0x0000, 0x0000, 0x336C, 0x0000, 0x4B2B, 0x6A70, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x7922, 0x6A7C, 0x6A72, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x6A73, 0x0000, 0x0000, 0x0000, 0x0000, 0x6A74, 0x6A75, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6A79, 0x0000, 0x6A7A, 0x0000, 0x0000, 0x6A78,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6A76, 0x0000, 0x6A71, 0x6A77, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x6A7B, 0x7037, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x3228, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6A7E, 0x365F,
+    0x6A7D, 0x0000, 0x0000, 0x0000, 0x6B22, 0x0000, 0x6B21, 0x0000, 0x0000, 0x0000, 0x6B24, 0x0000,
+    0x0000, 0x6B23, 0x0000, 0x6B25, 0x0000, 0x0000, 0x3D31, 0x0000, 0x6B26, 0x0000, 0x0000, 0x6B27,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6B28, 0x403E, 0x0000, 0x4D57, 0x0000, 0x6B29,
+    0x0000, 0x0000, 0x4A24, 0x4746, 0x6B2A, 0x0000, 0x6B2B, 0x382B, 0x0000, 0x0000, 0x0000, 0x352C,
+    0x0000, 0x0000, 0x0000, 0x6B2C, 0x0000, 0x0000, 0x3B6B, 0x4741, 0x6B2D, 0x0000, 0x3350, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6B2E, 0x0000, 0x0000, 0x0000, 0x0000, 0x6B30, 0x4D77,
+    0x0000, 0x6B2F, 0x3F46, 0x0000, 0x6B31, 0x0000, 0x0000, 0x6B32, 0x0000, 0x0000, 0x6B33, 0x3451,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6B34, 0x0000, 0x0000, 0x6B35, 0x0000, 0x6B36,
+    0x6B37, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3351, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x6B38, 0x0000, 0x6B39, 0x6B3A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3272,
+    0x0000, 0x0000, 0x3F28, 0x6B3B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x6B3C, 0x0000, 0x0000, 0x0000, 0x6B3D, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+8Axx */
+    0x3840, 0x0000, 0x447B, 0x6B3E, 0x0000, 0x0000, 0x0000, 0x0000, 0x3757, 0x0000, 0x3F56, 0x0000,
+    0x6B41, 0x0000, 0x4624, 0x0000, 0x6B40, 0x0000, 0x7B67, 0x3731, 0x0000, 0x0000, 0x6B3F, 0x4277,
+    0x352D, 0x0000, 0x0000, 0x6B42, 0x0000, 0x6B43, 0x0000, 0x3E59, 0x0000, 0x0000, 0x0000, 0x376D,
+    0x0000, 0x6B44, 0x0000, 0x0000, 0x0000, 0x0000, 0x4B2C, 0x0000, 0x0000, 0x405F, 0x0000, 0x0000,
+    0x0000, 0x3576, 0x0000, 0x4C75, 0x414A, 0x0000, 0x6B45, 0x7B68, 0x0000, 0x0000, 0x3F47, 0x4370,
+    0x3E5A, 0x0000, 0x0000, 0x0000, 0x0000, 0x6B46, 0x0000, 0x0000, 0x0000, 0x0000, 0x6B49, 0x0000,
+    0x6B4A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3A3E, 0x4242, 0x6B48, 0x0000,
+    0x3E5B, 0x493E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6B47, 0x0000, 0x0000, 0x3B6C, 0x0000,
+    0x3153, 0x0000, 0x6B4E, 0x3758, 0x0000, 0x0000, 0x3B6E, 0x0000, 0x0000, 0x3B6D, 0x0000, 0x4F4D,
+    0x6B4D, 0x6B4C, 0x4127, 0x0000, 0x354D, 0x4F43, 0x333A, 0x3E5C, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x7B69, 0x0000, 0x0000, 0x6B4B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6B50, 0x0000,
+    0x6B51, 0x6B4F, 0x0000, 0x3858, 0x0000, 0x4D40, 0x0000, 0x0000, 0x3B6F, 0x4727, 0x0000, 0x0000,
+    0x0000, 0x6B54, 0x0000, 0x4040, 0x0000, 0x4342, 0x0000, 0x0000, 0x4D36, 0x0000, 0x6B57, 0x0000,
+    0x0000, 0x0000, 0x386C, 0x0000, 0x403F, 0x6B53, 0x0000, 0x6B58, 0x386D, 0x6B55, 0x6B56, 0x7B6A,
+    0x6B52, 0x0000, 0x0000, 0x0000, 0x4062, 0x4649, 0x0000, 0x0000, 0x432F, 0x0000, 0x325D, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4870, 0x0000, 0x0000, 0x3543, 0x0000, 0x7B6B, 0x4434,
+    0x0000, 0x0000, 0x6B5B, 0x0000, 0x6B59, 0x0000, 0x0000, 0x434C, 0x0000, 0x0000, 0x0000, 0x4041,
+    0x3452, 0x6B5A, 0x0000, 0x3F5B, 0x0000, 0x0000, 0x4E4A, 0x0000, 0x0000, 0x0000, 0x4F40, 0x0000,
+    0x0000, 0x0000, 0x6B5C, 0x6B67, 0x4435, 0x0000, 0x6B66, 0x7B6C, 0x6B63, 0x6B6B, 0x6B64, 0x0000,
+    0x6B60, 0x0000, 0x447C, 0x6B5F, 0x0000, 0x0000, 0x0000, 0x6B5D, 0x0000, 0x4D21, 0x3B70, 0x0000,
+    0x0000, 0x6B61, 0x0000, 0x6B5E, 0x0000, 0x0000, 0x7B6E, 0x6B65, 0x3D74, 0x0000, 0x3841, 0x0000,
+    0x0000, 0x0000, 0x427A, 0x0000,
+  },
+  { /* U+8Bxx */
+    0x4B45, 0x315A, 0x3062, 0x0000, 0x4625, 0x0000, 0x0000, 0x6B69, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x6B68, 0x0000, 0x4666, 0x0000, 0x6B6D, 0x0000, 0x0000, 0x0000, 0x6B62, 0x0000, 0x6B6C, 0x6B6E,
+    0x0000, 0x382C, 0x6B6A, 0x3956, 0x0000, 0x3C55, 0x0000, 0x0000, 0x6B6F, 0x4D58, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x6B72, 0x0000, 0x6B75, 0x0000, 0x0000, 0x6B73, 0x4935, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x6B70, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3660, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x6B74, 0x0000, 0x0000, 0x6B76, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x6B7A, 0x0000, 0x0000, 0x6B77, 0x0000, 0x6B79, 0x6B78, 0x0000, 0x0000, 0x0000, 0x7B6F,
+    0x0000, 0x0000, 0x6B7B, 0x0000, 0x3C31, 0x0000, 0x6B7D, 0x6B7C, 0x4968, 0x0000, 0x0000, 0x6C21,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3759, 0x0000, 0x0000, 0x0000, 0x0000, 0x6B7E,
+    0x6C22, 0x0000, 0x0000, 0x6C23, 0x3544, 0x6641, 0x3E79, 0x0000, 0x6C24, 0x0000, 0x0000, 0x386E,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6C25, 0x0000, 0x7B70, 0x6C26, 0x0000, 0x0000, 0x3B3E,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5A4E, 0x0000, 0x6C27, 0x0000, 0x6C28, 0x0000,
+    0x3D32, 0x0000, 0x6C29, 0x6C2A, 0x0000, 0x0000, 0x6C2B, 0x0000, 0x0000, 0x6C2C, 0x6C2D, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+8Cxx */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x432B, 0x0000, 0x0000, 0x6C2E, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x6C30, 0x0000, 0x6C2F, 0x0000, 0x0000, 0x0000, 0x0000, 0x4626, 0x0000,
+    0x6C31, 0x0000, 0x4B2D, 0x0000, 0x6C32, 0x0000, 0x6C33, 0x0000, 0x6C34, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x6C35, 0x0000, 0x0000, 0x0000, 0x0000, 0x465A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x3E5D, 0x6C36, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x396B, 0x502E,
+    0x6C37, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x6C38, 0x493F, 0x6C39, 0x0000, 0x6C41, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6C3A, 0x0000,
+    0x0000, 0x6C3C, 0x0000, 0x0000, 0x0000, 0x6C3B, 0x6C3D, 0x0000, 0x4B46, 0x6C3E, 0x6C3F, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x6C40, 0x0000, 0x0000, 0x0000, 0x6C42, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x332D, 0x4467, 0x0000, 0x4969, 0x3A62, 0x3957, 0x0000, 0x0000, 0x0000, 0x0000, 0x494F,
+    0x325F, 0x484E, 0x6C45, 0x3453, 0x4055, 0x6C44, 0x6C49, 0x4379, 0x4C63, 0x0000, 0x6C47, 0x6C48,
+    0x352E, 0x0000, 0x6C4A, 0x4763, 0x425F, 0x0000, 0x0000, 0x4871, 0x453D, 0x6C46, 0x0000, 0x4B47,
+    0x326C, 0x6C4C, 0x4F28, 0x4442, 0x4F45, 0x0000, 0x0000, 0x3B71, 0x6C4B, 0x0000, 0x4231, 0x0000,
+    0x0000, 0x6C5C, 0x4128, 0x0000, 0x0000, 0x4678, 0x0000, 0x4950, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x6C4F, 0x3B3F, 0x3B72, 0x0000, 0x3E5E, 0x0000, 0x4765, 0x0000, 0x382D, 0x6C4E,
+    0x6C4D, 0x0000, 0x496A, 0x0000, 0x0000, 0x0000, 0x3C41, 0x0000, 0x0000, 0x4552, 0x0000, 0x0000,
+    0x7B71, 0x0000, 0x0000, 0x0000, 0x7B72, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6C51, 0x6C52,
+    0x3958, 0x6C50, 0x0000, 0x0000,
+  },
+  { /* U+8Dxx */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x6C53, 0x6C54, 0x0000, 0x6C56, 0x4223, 0x0000, 0x6C55, 0x3466,
+    0x0000, 0x6C58, 0x0000, 0x6C57, 0x6C59, 0x0000, 0x7B73, 0x6C5B, 0x6C5D, 0x0000, 0x6C5E, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x4056, 0x0000, 0x3C4F, 0x6C5F, 0x0000, 0x0000, 0x0000, 0x3352,
+    0x0000, 0x6C60, 0x0000, 0x0000, 0x4176, 0x6C61, 0x0000, 0x6C62, 0x496B, 0x0000, 0x7B74, 0x352F,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6C63, 0x0000, 0x0000,
+    0x0000, 0x4436, 0x0000, 0x0000, 0x0000, 0x0000, 0x315B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6C64, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3C71, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x3F76, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x422D,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6C67, 0x0000, 0x0000, 0x0000, 0x6C66, 0x0000,
+    0x0000, 0x0000, 0x6C65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6C6D,
+    0x6C6B, 0x0000, 0x0000, 0x6C68, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6C6A, 0x0000,
+    0x0000, 0x0000, 0x6C69, 0x6C6C, 0x0000, 0x3577, 0x0000, 0x6C70, 0x0000, 0x4057, 0x0000, 0x6C71,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x3859, 0x0000, 0x6C6E, 0x6C6F, 0x0000, 0x0000, 0x0000, 0x4F29,
+    0x0000, 0x0000, 0x0000, 0x4437, 0x0000, 0x4129, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x6C72, 0x0000, 0x0000, 0x6C75,
+  },
+  { /* U+8Exx */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6C73, 0x6C74, 0x4D59, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x4627, 0x6C78, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6C76, 0x6C77, 0x6C79, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6D29, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x6C7C, 0x0000, 0x0000, 0x0000, 0x6C7D, 0x6C7B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6C7A, 0x0000, 0x447D, 0x0000, 0x0000, 0x6D21,
+    0x6D25, 0x6D22, 0x6C7E, 0x0000, 0x6D23, 0x0000, 0x0000, 0x0000, 0x6D24, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x6D2B, 0x0000, 0x0000, 0x0000, 0x6D26, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4058,
+    0x6D28, 0x0000, 0x0000, 0x6D2A, 0x6D27, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6D2D, 0x0000, 0x3D33, 0x0000, 0x6D2C, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x6D2E, 0x0000, 0x0000, 0x0000, 0x0000, 0x6D2F, 0x0000, 0x0000,
+    0x6D32, 0x6D31, 0x0000, 0x6D30, 0x0000, 0x0000, 0x6D34, 0x6D33, 0x0000, 0x4C76, 0x0000, 0x0000,
+    0x0000, 0x6D36, 0x0000, 0x6D35, 0x6D37, 0x0000, 0x0000, 0x0000, 0x0000, 0x6D38, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6D3A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x6D39, 0x3F48, 0x6D3B, 0x0000, 0x0000, 0x366D, 0x6D3C, 0x6D3E, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6D3F, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6D40, 0x6D3D, 0x0000, 0x6D41, 0x0000, 0x3C56, 0x6D42,
+    0x3530, 0x3733, 0x0000, 0x7B76, 0x0000, 0x0000, 0x382E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x6D43, 0x0000, 0x0000, 0x0000, 0x4670, 0x0000, 0x0000, 0x453E, 0x6D44,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6D47, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3C34, 0x0000, 0x0000, 0x6D46,
+    0x6D45, 0x375A, 0x6D48, 0x0000,
+  },
+  { /* U+8Fxx */
+    0x0000, 0x0000, 0x0000, 0x3353, 0x0000, 0x6D4A, 0x0000, 0x0000, 0x0000, 0x3A5C, 0x6D49, 0x0000,
+    0x6D52, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6D4C, 0x6D4E, 0x4A65, 0x6D4B, 0x0000, 0x0000,
+    0x0000, 0x6D4D, 0x0000, 0x6D51, 0x6D4F, 0x3531, 0x0000, 0x6D50, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x6D53, 0x0000, 0x0000, 0x475A, 0x4E58, 0x0000, 0x0000, 0x0000, 0x0000, 0x3D34,
+    0x0000, 0x0000, 0x0000, 0x6D54, 0x0000, 0x0000, 0x0000, 0x0000, 0x4D22, 0x6D56, 0x0000, 0x6D55,
+    0x0000, 0x0000, 0x6D59, 0x4D41, 0x0000, 0x0000, 0x6D58, 0x0000, 0x336D, 0x6D57, 0x6D5C, 0x0000,
+    0x0000, 0x6D5B, 0x0000, 0x0000, 0x6D5A, 0x4532, 0x6D5D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x6D5E, 0x0000, 0x0000, 0x0000, 0x0000, 0x6D5F, 0x0000, 0x0000, 0x396C,
+    0x0000, 0x3725, 0x6D60, 0x6D61, 0x6D62, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3F49,
+    0x6D63, 0x0000, 0x3C2D, 0x6D64, 0x0000, 0x0000, 0x0000, 0x6D65, 0x0000, 0x0000, 0x0000, 0x5221,
+    0x517E, 0x0000, 0x0000, 0x0000, 0x0000, 0x6D66, 0x6570, 0x6D67, 0x4324, 0x3F2B, 0x4740, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x6D68, 0x0000, 0x0000, 0x4A55, 0x4454, 0x397E, 0x0000, 0x0000, 0x4329,
+    0x0000, 0x0000, 0x312A, 0x0000, 0x4B78, 0x3F57, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x375E, 0x0000, 0x0000, 0x3661, 0x0000, 0x0000, 0x4A56, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x6D69, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6D6B, 0x0000,
+    0x0000, 0x6D6A, 0x3260, 0x0000, 0x0000, 0x4676, 0x6D6C, 0x4777, 0x0000, 0x4533, 0x0000, 0x6D6D,
+    0x3D52, 0x0000, 0x0000, 0x0000, 0x6D6F, 0x0000, 0x0000, 0x4C42, 0x6D7E, 0x6D71, 0x6D72, 0x0000,
+    0x0000, 0x4449, 0x0000, 0x0000,
+  },
+  { /* U+90xx */
+    0x4260, 0x4177, 0x0000, 0x4628, 0x0000, 0x6D70, 0x3555, 0x0000, 0x0000, 0x0000, 0x0000, 0x6D79,
+    0x0000, 0x6D76, 0x6E25, 0x4629, 0x4360, 0x6D73, 0x0000, 0x447E, 0x4553, 0x6D74, 0x6D78, 0x3F60,
+    0x0000, 0x4767, 0x444C, 0x0000, 0x0000, 0x4042, 0x6D77, 0x422E, 0x4224, 0x6D75, 0x3029, 0x4F22,
+    0x0000, 0x0000, 0x0000, 0x6D7A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4261, 0x0000,
+    0x0000, 0x3D35, 0x3F4A, 0x0000, 0x0000, 0x6D7C, 0x6D7B, 0x0000, 0x306F, 0x6D7D, 0x0000, 0x0000,
+    0x492F, 0x0000, 0x6E27, 0x0000, 0x0000, 0x465B, 0x3F6B, 0x0000, 0x0000, 0x4359, 0x0000, 0x3678,
+    0x0000, 0x6E26, 0x4D37, 0x313F, 0x0000, 0x4A57, 0x3261, 0x6E21, 0x6E22, 0x6E23, 0x6E24, 0x463B,
+    0x4323, 0x3063, 0x6E28, 0x0000, 0x6E29, 0x7423, 0x0000, 0x0000, 0x423D, 0x0000, 0x6E2A, 0x0000,
+    0x3173, 0x414C, 0x0000, 0x382F, 0x0000, 0x4D5A, 0x0000, 0x7B79, 0x6E2B, 0x452C, 0x0000, 0x0000,
+    0x0000, 0x4178, 0x3C57, 0x6E2C, 0x0000, 0x0000, 0x6E2F, 0x0000, 0x0000, 0x3D65, 0x6E2D, 0x412B,
+    0x412A, 0x0000, 0x3064, 0x0000, 0x4E4B, 0x6E31, 0x0000, 0x4872, 0x6E33, 0x6E32, 0x6E30, 0x6364,
+    0x3454, 0x0000, 0x0000, 0x6D6E, 0x0000, 0x6E35, 0x6E34, 0x0000, 0x0000, 0x0000, 0x0000, 0x6E36,
+    0x0000, 0x4D38, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4661, 0x0000, 0x0000, 0x4B2E, 0x0000,
+    0x6E37, 0x0000, 0x3C59, 0x0000, 0x0000, 0x0000, 0x0000, 0x6E38, 0x0000, 0x6E39, 0x0000, 0x0000,
+    0x0000, 0x6E3A, 0x0000, 0x0000, 0x4521, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x306A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3959, 0x0000,
+    0x0000, 0x0000, 0x4F3A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x6E3E, 0x0000, 0x0000, 0x7B7A, 0x0000, 0x0000, 0x3734, 0x6E3B, 0x0000,
+    0x6E3C, 0x0000, 0x0000, 0x0000, 0x4974, 0x0000, 0x0000, 0x0000, 0x0000, 0x3354, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4D39, 0x0000, 0x363F, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x4554, 0x0000, 0x0000,
+  },
+  { /* U+91xx */
+    0x0000, 0x0000, 0x6E3F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6E40, 0x0000, 0x0000, 0x7B7C, 0x0000, 0x0000,
+    0x0000, 0x6E41, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x7B7D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4522, 0x0000, 0x0000,
+    0x6E43, 0x0000, 0x6E42, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x4653, 0x6E44, 0x3D36, 0x3C60, 0x475B, 0x4371, 0x0000, 0x0000, 0x0000, 0x3C72, 0x0000,
+    0x3F6C, 0x0000, 0x6E45, 0x0000, 0x6E46, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x3F5D, 0x6E47, 0x0000, 0x6E48, 0x0000, 0x0000, 0x0000, 0x6E49, 0x4D6F, 0x0000,
+    0x3D37, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6E4B, 0x6E4A, 0x0000, 0x395A, 0x0000, 0x3973,
+    0x3B40, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6E4E, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x3D66, 0x0000, 0x6E4D, 0x0000, 0x6E4C, 0x0000, 0x4269, 0x0000, 0x0000,
+    0x386F, 0x0000, 0x4043, 0x0000, 0x0000, 0x0000, 0x0000, 0x4830, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x3D39, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6E4F, 0x0000, 0x3E5F, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x6E52, 0x6E50, 0x0000, 0x0000, 0x0000, 0x6E51, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x6E54, 0x6E53, 0x0000, 0x0000, 0x3E7A, 0x0000, 0x6E55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x6E56, 0x6E57, 0x0000, 0x0000, 0x0000, 0x0000, 0x4850, 0x3A53, 0x3C61, 0x6E58, 0x0000, 0x6E59,
+    0x4E24, 0x3D45, 0x4C6E, 0x4E4C, 0x6E5A, 0x3662, 0x0000, 0x0000, 0x0000, 0x0000, 0x6E5B, 0x7C21,
+    0x4523, 0x0000, 0x7B7E, 0x6E5E, 0x3378, 0x3F4B, 0x7C22, 0x6E5C, 0x0000, 0x6E5D, 0x0000, 0x4460,
+    0x7C25, 0x7C26, 0x4B55, 0x367C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7C23, 0x7C24, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6E60, 0x6E61, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x6E5F, 0x0000, 0x0000, 0x6E63,
+  },
+  { /* U+92xx */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7C27, 0x0000, 0x0000, 0x0000, 0x7C29, 0x0000,
+    0x0000, 0x465F, 0x3343, 0x0000, 0x7C28, 0x6E67, 0x0000, 0x0000, 0x6E64, 0x6E66, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6E62, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6F4F, 0x0000, 0x0000, 0x6E65, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x4E6B, 0x0000, 0x0000, 0x385A, 0x0000, 0x7C30, 0x7C2A, 0x0000,
+    0x7C2C, 0x0000, 0x0000, 0x6E6F, 0x7C2B, 0x0000, 0x0000, 0x0000, 0x4534, 0x6E6A, 0x0000, 0x0000,
+    0x6E6D, 0x6E6B, 0x0000, 0x6E70, 0x0000, 0x0000, 0x7C2D, 0x0000, 0x6E71, 0x7C2F, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x6E69, 0x0000, 0x7C2E, 0x6E76, 0x3174, 0x0000, 0x0000, 0x6E68, 0x0000,
+    0x0000, 0x0000, 0x482D, 0x0000, 0x6E6C, 0x0000, 0x3E60, 0x7C31, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x395B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7C33,
+    0x7C34, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4B48, 0x0000, 0x3664, 0x0000, 0x0000, 0x3D46,
+    0x0000, 0x463C, 0x0000, 0x0000, 0x7924, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x412D, 0x0000, 0x6E74, 0x0000, 0x6E6E, 0x6E73, 0x0000, 0x4C43, 0x0000, 0x4438, 0x6E75,
+    0x6E72, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7C32,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x412C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x6E79, 0x0000, 0x6E78, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x6E77, 0x7C38, 0x0000, 0x4B2F, 0x7C3C, 0x0000, 0x7C3A, 0x0000, 0x7C36,
+    0x0000, 0x7C37, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7C3B, 0x0000, 0x0000, 0x0000,
+    0x3D7B, 0x0000, 0x0000, 0x7C35, 0x0000, 0x6E7A, 0x4A5F, 0x0000, 0x0000, 0x3154, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x4946, 0x4372, 0x0000, 0x0000, 0x0000, 0x0000, 0x3578, 0x792A, 0x6E7C, 0x7C3F,
+    0x395D, 0x0000, 0x0000, 0x7C42,
+  },
+  { /* U+93xx */
+    0x0000, 0x0000, 0x7C44, 0x0000, 0x0000, 0x0000, 0x3B2C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x6E7B, 0x3F6D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x3F6E, 0x6F21, 0x6F23, 0x0000, 0x0000, 0x7C43, 0x7C41, 0x0000, 0x3E7B, 0x7C3E, 0x6F22, 0x6F24,
+    0x0000, 0x7C3D, 0x3653, 0x0000, 0x4945, 0x0000, 0x0000, 0x3C62, 0x4F23, 0x0000, 0x6E7E, 0x3A78,
+    0x0000, 0x0000, 0x4F3F, 0x0000, 0x0000, 0x6F26, 0x0000, 0x0000, 0x0000, 0x0000, 0x6F25, 0x6F27,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6E7D, 0x0000, 0x0000, 0x0000,
+    0x7923, 0x0000, 0x0000, 0x4669, 0x0000, 0x4555, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x4457, 0x0000, 0x6F2C, 0x7C46, 0x0000, 0x0000, 0x0000, 0x4343, 0x6F28, 0x0000, 0x0000, 0x0000,
+    0x6F29, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x372D, 0x0000, 0x6F2B, 0x0000, 0x7C45, 0x0000, 0x0000, 0x0000, 0x0000, 0x3830, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x6F2A, 0x0000, 0x3E61, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3379, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x6F30, 0x0000, 0x3A3F, 0x4179, 0x0000, 0x0000, 0x444A, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7C47, 0x0000, 0x0000, 0x333B,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x6F2E, 0x6F2F, 0x4443, 0x0000, 0x6F2D, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6F31, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x6F37, 0x0000, 0x0000, 0x7C48, 0x0000, 0x6F3A, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x6F39, 0x452D, 0x0000, 0x0000, 0x0000, 0x0000, 0x6F32, 0x6F33,
+    0x6F36, 0x0000, 0x0000, 0x0000, 0x0000, 0x6F38, 0x7C49, 0x0000, 0x0000, 0x3640, 0x0000, 0x0000,
+    0x6F3B, 0x6F35, 0x0000, 0x0000, 0x6F34, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7C4A, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+94xx */
+    0x0000, 0x0000, 0x0000, 0x6F3F, 0x0000, 0x0000, 0x0000, 0x6F40, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x6F41, 0x0000, 0x0000, 0x6F3E, 0x6F3D, 0x0000, 0x0000, 0x0000,
+    0x3E62, 0x462A, 0x6F3C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6F45, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6F43, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x7C4B, 0x0000, 0x0000, 0x0000, 0x6F44, 0x6F42, 0x0000, 0x4278, 0x0000, 0x6F46, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6F47, 0x0000, 0x0000, 0x6F49, 0x7C4C, 0x0000, 0x0000,
+    0x7C4D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3455, 0x6F48, 0x4C7A,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6F54, 0x6F4A, 0x0000, 0x0000, 0x6F4D, 0x0000,
+    0x6F4B, 0x0000, 0x6F4C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6F4E, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x6F50, 0x0000, 0x0000, 0x0000, 0x0000, 0x6F51, 0x0000, 0x6F52,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x6F55, 0x6F53, 0x6F56, 0x6F58, 0x0000, 0x6F57, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+95xx */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4439,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4C67, 0x0000, 0x6F59, 0x412E,
+    0x0000, 0x0000, 0x0000, 0x6F5A, 0x0000, 0x4A44, 0x6F5B, 0x332B, 0x0000, 0x0000, 0x0000, 0x313C,
+    0x0000, 0x3457, 0x7C4E, 0x3456, 0x6F5C, 0x0000, 0x6F5D, 0x0000, 0x6F5E, 0x6F5F, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x6F60, 0x0000, 0x3458, 0x3355, 0x395E, 0x4836, 0x0000, 0x6F62,
+    0x6F61, 0x0000, 0x0000, 0x0000, 0x0000, 0x6F63, 0x0000, 0x0000, 0x0000, 0x0000, 0x315C, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6F66, 0x0000, 0x6F65, 0x6F64, 0x0000, 0x6F67, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x6F6A, 0x0000, 0x0000, 0x0000, 0x3047, 0x0000, 0x0000, 0x6F68, 0x0000,
+    0x6F6C, 0x6F6B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6F6E, 0x6F6D, 0x6F6F, 0x0000,
+    0x462E, 0x0000, 0x0000, 0x0000, 0x6F70, 0x0000, 0x0000, 0x0000, 0x0000, 0x6F71, 0x6F73, 0x0000,
+    0x0000, 0x6F72, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+96xx */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x496C, 0x0000, 0x0000, 0x0000, 0x0000, 0x6F74, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x6F75, 0x0000, 0x3A65, 0x0000, 0x0000, 0x0000, 0x6F76, 0x6F77,
+    0x0000, 0x0000, 0x4B49, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x414B,
+    0x0000, 0x0000, 0x0000, 0x3024, 0x424B, 0x0000, 0x6F78, 0x0000, 0x496D, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x6F7B, 0x6F79, 0x395F, 0x0000, 0x6F7A, 0x3842, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A45, 0x6F7D, 0x7021, 0x6F7E, 0x7022,
+    0x0000, 0x0000, 0x3121, 0x3F58, 0x3D7C, 0x3459, 0x7023, 0x0000, 0x0000, 0x0000, 0x4766, 0x0000,
+    0x7025, 0x0000, 0x0000, 0x0000, 0x3122, 0x0000, 0x7024, 0x4444, 0x0000, 0x4E4D, 0x462B, 0x6F7C,
+    0x4E26, 0x0000, 0x3831, 0x0000, 0x0000, 0x4D5B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x3679, 0x4E34, 0x0000, 0x3728, 0x0000, 0x4262, 0x6721, 0x0000, 0x7026, 0x332C, 0x3F6F,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x3356, 0x7028, 0x0000, 0x7029, 0x7027, 0x3764, 0x0000, 0x3A5D,
+    0x3E63, 0x7C51, 0x0000, 0x0000, 0x3123, 0x0000, 0x0000, 0x4E59, 0x0000, 0x0000, 0x0000, 0x702B,
+    0x6E2E, 0x0000, 0x702A, 0x0000, 0x0000, 0x0000, 0x0000, 0x7C52, 0x702E, 0x702C, 0x702D, 0x0000,
+    0x702F, 0x0000, 0x7030, 0x4E6C, 0x7031, 0x7032, 0x0000, 0x4049, 0x483B, 0x0000, 0x0000, 0x0000,
+    0x3F7D, 0x3467, 0x0000, 0x0000, 0x4D3A, 0x326D, 0x3D38, 0x385B, 0x0000, 0x7035, 0x0000, 0x7034,
+    0x3B73, 0x7036, 0x7033, 0x0000, 0x0000, 0x3B28, 0x0000, 0x0000, 0x0000, 0x703A, 0x6A2D, 0x0000,
+    0x0000, 0x5256, 0x0000, 0x3F77, 0x7038, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4E25, 0x4671,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x312B, 0x0000, 0x4063, 0x3C36, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x4A37, 0x0000, 0x3140, 0x0000, 0x0000, 0x0000, 0x4E6D, 0x4D6B, 0x0000, 0x703B, 0x0000, 0x4545,
+    0x0000, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+97xx */
+    0x3C7B, 0x0000, 0x0000, 0x0000, 0x703C, 0x0000, 0x703D, 0x3F4C, 0x703E, 0x0000, 0x4E6E, 0x0000,
+    0x0000, 0x7039, 0x7040, 0x7042, 0x0000, 0x7041, 0x0000, 0x703F, 0x0000, 0x0000, 0x7043, 0x0000,
+    0x0000, 0x7044, 0x0000, 0x0000, 0x417A, 0x0000, 0x3262, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x7045, 0x0000, 0x0000, 0x4C38, 0x0000, 0x0000, 0x7046, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x7047, 0x0000, 0x4F2A, 0x7C53, 0x0000, 0x0000, 0x0000, 0x0000, 0x5B31, 0x7048, 0x0000, 0x7C54,
+    0x0000, 0x7049, 0x704A, 0x0000, 0x0000, 0x0000, 0x704E, 0x7C55, 0x704B, 0x0000, 0x704C, 0x0000,
+    0x704D, 0x704F, 0x0000, 0x0000, 0x0000, 0x7C56, 0x0000, 0x7C57, 0x0000, 0x7C58, 0x4044, 0x0000,
+    0x0000, 0x7C59, 0x4C77, 0x0000, 0x0000, 0x4045, 0x0000, 0x0000, 0x7050, 0x0000, 0x4873, 0x0000,
+    0x7051, 0x7353, 0x4C4C, 0x0000, 0x7052, 0x0000, 0x7053, 0x0000, 0x7054, 0x3357, 0x0000, 0x7056,
+    0x0000, 0x3F59, 0x0000, 0x0000, 0x0000, 0x7057, 0x0000, 0x0000, 0x3724, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x7058, 0x705C, 0x0000, 0x705A, 0x0000, 0x0000, 0x0000, 0x0000, 0x705B, 0x0000, 0x0000,
+    0x3373, 0x7059, 0x705D, 0x0000, 0x0000, 0x0000, 0x0000, 0x705E, 0x0000, 0x3048, 0x0000, 0x705F,
+    0x7060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3E64, 0x0000, 0x0000, 0x0000,
+    0x7061, 0x0000, 0x0000, 0x0000, 0x3547, 0x0000, 0x0000, 0x7064, 0x0000, 0x0000, 0x7063, 0x0000,
+    0x7062, 0x0000, 0x0000, 0x6B71, 0x0000, 0x4A5C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7065,
+    0x7066, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x7067, 0x0000, 0x0000, 0x7068, 0x0000, 0x7069, 0x0000, 0x0000, 0x706A,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x345A, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x706B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x706C, 0x4723, 0x0000,
+    0x0000, 0x0000, 0x706E, 0x323B, 0x0000, 0x7071, 0x7070, 0x0000, 0x0000, 0x0000, 0x0000, 0x3124,
+    0x0000, 0x0000, 0x0000, 0x3641,
+  },
+  { /* U+98xx */
+    0x0000, 0x4A47, 0x443A, 0x3A22, 0x0000, 0x3960, 0x3D67, 0x0000, 0x3F5C, 0x0000, 0x0000, 0x0000,
+    0x7073, 0x0000, 0x0000, 0x7072, 0x4D42, 0x3468, 0x4852, 0x465C, 0x0000, 0x0000, 0x0000, 0x3F7C,
+    0x4E4E, 0x0000, 0x375B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7076, 0x0000, 0x0000,
+    0x7075, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4B4B, 0x462C, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x3150, 0x0000, 0x0000, 0x7077, 0x7074, 0x0000, 0x0000, 0x4951,
+    0x4D6A, 0x7078, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7079, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x707B, 0x426A, 0x335B, 0x335C, 0x707A, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x3469, 0x3832, 0x0000, 0x7C5A, 0x346A, 0x0000, 0x0000, 0x453F, 0x0000, 0x0000, 0x4E60, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7C5B, 0x0000, 0x385C, 0x0000, 0x0000, 0x0000, 0x707C,
+    0x0000, 0x0000, 0x0000, 0x707D, 0x707E, 0x7121, 0x0000, 0x7123, 0x7122, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x4977, 0x0000, 0x7124, 0x0000, 0x0000, 0x0000, 0x0000, 0x7125, 0x0000, 0x7126, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x7127, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x7129, 0x7128, 0x0000, 0x712A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x4874, 0x664C, 0x0000, 0x0000, 0x3F29, 0x0000, 0x0000, 0x3532, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x712B, 0x0000, 0x712C, 0x0000, 0x522C, 0x5D3B, 0x4853,
+    0x0000, 0x0000, 0x307B, 0x0000, 0x303B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x3B74, 0x4B30, 0x3E7E, 0x0000,
+  },
+  { /* U+99xx */
+    0x0000, 0x0000, 0x0000, 0x712D, 0x0000, 0x4C5F, 0x0000, 0x0000, 0x0000, 0x712E, 0x4D5C, 0x0000,
+    0x3142, 0x0000, 0x0000, 0x0000, 0x3B41, 0x0000, 0x712F, 0x326E, 0x7130, 0x0000, 0x0000, 0x0000,
+    0x7131, 0x0000, 0x0000, 0x0000, 0x0000, 0x7133, 0x7134, 0x0000, 0x7136, 0x7132, 0x0000, 0x0000,
+    0x7135, 0x0000, 0x0000, 0x7C5E, 0x345B, 0x0000, 0x0000, 0x0000, 0x7137, 0x0000, 0x7138, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x7139, 0x713A, 0x0000, 0x0000, 0x0000, 0x713B, 0x0000, 0x0000, 0x713D, 0x0000, 0x0000,
+    0x0000, 0x713C, 0x0000, 0x713F, 0x7142, 0x0000, 0x0000, 0x0000, 0x713E, 0x7140, 0x7141, 0x0000,
+    0x0000, 0x7143, 0x0000, 0x3642, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3C73, 0x7144, 0x7145, 0x3961, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x7C60, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7146, 0x0000, 0x0000,
+    0x333E, 0x0000, 0x0000, 0x0000, 0x474F, 0x7147, 0x7148, 0x0000, 0x0000, 0x0000, 0x0000, 0x435A,
+    0x466B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7149, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x477D, 0x0000, 0x0000, 0x424C, 0x3158, 0x366E, 0x0000, 0x366F, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x4373, 0x714E, 0x3670, 0x0000, 0x0000, 0x326F, 0x0000, 0x0000,
+    0x714D, 0x0000, 0x0000, 0x714B, 0x0000, 0x714C, 0x0000, 0x714A, 0x0000, 0x0000, 0x7158, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x714F, 0x7150, 0x0000,
+    0x0000, 0x7151, 0x7152, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7154, 0x0000, 0x0000, 0x7153,
+    0x0000, 0x0000, 0x0000, 0x3D59,
+  },
+  { /* U+9Axx */
+    0x0000, 0x7155, 0x0000, 0x0000, 0x0000, 0x7157, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x3533, 0x7156, 0x0000, 0x0000, 0x417B, 0x3833, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x7159, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x424D, 0x0000, 0x0000, 0x715A, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x462D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x715B, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x7160, 0x0000, 0x715E, 0x0000, 0x715D, 0x715F, 0x0000, 0x715C, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7162, 0x7C61, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x7161, 0x0000, 0x7164, 0x0000, 0x0000, 0x3643, 0x7163, 0x0000, 0x0000, 0x0000, 0x7165,
+    0x0000, 0x0000, 0x7166, 0x0000, 0x7168, 0x7167, 0x0000, 0x0000, 0x0000, 0x7169, 0x716B, 0x716A,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x397C, 0x0000, 0x0000, 0x0000, 0x0000, 0x716C, 0x0000, 0x0000, 0x716D, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x333C, 0x0000, 0x0000, 0x0000, 0x716E, 0x0000, 0x0000, 0x0000,
+    0x716F, 0x0000, 0x0000, 0x0000, 0x3F71, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x7170, 0x0000, 0x7171, 0x0000, 0x7172, 0x7173, 0x0000, 0x0000, 0x0000,
+    0x3962, 0x7C62, 0x0000, 0x0000, 0x7C63, 0x0000, 0x7174, 0x7175, 0x0000, 0x0000, 0x7176, 0x7177,
+    0x0000, 0x0000, 0x7178, 0x0000, 0x0000, 0x0000, 0x4831, 0x717A, 0x0000, 0x4926, 0x717B, 0x7179,
+    0x0000, 0x717D, 0x0000, 0x0000, 0x717C, 0x0000, 0x0000, 0x717E, 0x0000, 0x0000, 0x0000, 0x7221,
+    0x0000, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+9Bxx */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7222, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x7223, 0x0000, 0x7224, 0x0000, 0x0000, 0x0000, 0x0000, 0x7225, 0x0000, 0x0000, 0x7226, 0x7227,
+    0x0000, 0x7228, 0x0000, 0x7229, 0x722A, 0x722B, 0x722C, 0x0000, 0x0000, 0x0000, 0x722D, 0x722E,
+    0x0000, 0x5D35, 0x722F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6478,
+    0x3534, 0x0000, 0x0000, 0x0000, 0x0000, 0x3321, 0x3A32, 0x7231, 0x7230, 0x4C25, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7233, 0x7234, 0x7232, 0x0000, 0x7235, 0x0000, 0x0000,
+    0x4B62, 0x0000, 0x0000, 0x0000, 0x7236, 0x0000, 0x357B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x4F25, 0x0000, 0x0000, 0x7C65, 0x0000, 0x7237, 0x7C64, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7239,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x303E, 0x7C66,
+    0x0000, 0x723A, 0x4A2B, 0x7238, 0x0000, 0x0000, 0x723B, 0x723C, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x723D, 0x723E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x723F, 0x0000, 0x4B6E, 0x3B2D, 0x0000, 0x3A7A, 0x412F, 0x0000, 0x0000, 0x7C67, 0x0000, 0x0000,
+    0x7240, 0x0000, 0x0000, 0x0000, 0x0000, 0x7243, 0x0000, 0x7C68, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x7241, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7244, 0x0000, 0x0000, 0x3871, 0x7242, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x7245, 0x0000, 0x7246, 0x7247, 0x0000, 0x724B, 0x0000, 0x3B2A, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x4264, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x724C, 0x7249, 0x7248,
+    0x724A, 0x0000, 0x0000, 0x0000, 0x375F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x7250, 0x724F, 0x724E, 0x0000, 0x0000, 0x3033, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+9Cxx */
+    0x7C69, 0x0000, 0x0000, 0x0000, 0x725A, 0x0000, 0x7256, 0x0000, 0x7257, 0x7253, 0x7259, 0x0000,
+    0x7255, 0x3362, 0x0000, 0x0000, 0x4F4C, 0x0000, 0x7258, 0x7254, 0x7252, 0x7251, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x725C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x725F, 0x0000, 0x0000,
+    0x725E, 0x725D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4949, 0x725B, 0x3073,
+    0x7260, 0x0000, 0x7262, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x336F, 0x724D, 0x3137,
+    0x0000, 0x0000, 0x7264, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7263, 0x7261,
+    0x432D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4B70, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x4E5A, 0x0000, 0x0000, 0x7265, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x7266, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7267, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7268, 0x0000,
+    0x7269, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x443B, 0x0000, 0x726A, 0x0000, 0x4837, 0x0000, 0x726F, 0x726B, 0x0000, 0x0000, 0x0000,
+    0x726C, 0x0000, 0x0000, 0x4B31, 0x4C44, 0x0000, 0x4650, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+9Dxx */
+    0x0000, 0x0000, 0x0000, 0x7270, 0x0000, 0x0000, 0x7271, 0x463E, 0x726E, 0x726D, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x322A, 0x0000, 0x0000, 0x0000, 0x7279, 0x0000, 0x0000, 0x7278, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x3175, 0x0000, 0x0000, 0x0000, 0x7276, 0x0000, 0x0000, 0x0000, 0x7275,
+    0x0000, 0x0000, 0x7273, 0x0000, 0x337B, 0x0000, 0x7272, 0x3C32, 0x3229, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3963,
+    0x0000, 0x0000, 0x727C, 0x727B, 0x0000, 0x727A, 0x0000, 0x0000, 0x7277, 0x0000, 0x727D, 0x0000,
+    0x727E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7325, 0x7324, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7326, 0x0000, 0x0000, 0x312D, 0x7321, 0x7322, 0x0000,
+    0x3974, 0x4C39, 0x0000, 0x0000, 0x7323, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7C6B,
+    0x4B32, 0x0000, 0x0000, 0x732B, 0x7C6A, 0x0000, 0x7327, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x732C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x7329, 0x0000, 0x7328, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x375C,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x732D, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x732E, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x732F, 0x0000, 0x732A, 0x0000, 0x0000, 0x0000, 0x7274, 0x0000, 0x0000, 0x7330, 0x0000,
+    0x4461, 0x0000, 0x0000, 0x0000, 0x7334, 0x0000, 0x7335, 0x7333, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x7332, 0x7338, 0x0000, 0x7331, 0x0000, 0x7336, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x7337, 0x0000, 0x0000, 0x0000, 0x733A, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x7339, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x733C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x733D, 0x0000, 0x733E,
+    0x0000, 0x0000, 0x4F49, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x733B, 0x426B, 0x3A6D, 0x0000,
+    0x0000, 0x733F, 0x0000, 0x0000,
+  },
+  { /* U+9Exx */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x7C6D, 0x7340, 0x7341, 0x0000, 0x0000, 0x7342, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7343, 0x0000, 0x0000,
+    0x3834, 0x7344, 0x0000, 0x0000, 0x0000, 0x7345, 0x0000, 0x3C2F, 0x0000, 0x7346, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x7347, 0x0000, 0x0000, 0x7348, 0x7349, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x734C, 0x734A, 0x4F3C, 0x0000, 0x734B, 0x0000, 0x4E6F, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x734D, 0x0000, 0x4E5B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x734E, 0x477E, 0x0000,
+    0x0000, 0x734F, 0x7351, 0x0000, 0x0000, 0x7352, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x7350, 0x396D, 0x4C4D, 0x4B63, 0x5677, 0x0000, 0x5D60, 0x4B7B,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x322B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x7354, 0x3550, 0x7355, 0x7356, 0x7357, 0x7C6E, 0x3975, 0x0000, 0x7358, 0x0000, 0x0000, 0x0000,
+    0x6054, 0x4C5B, 0x0000, 0x4263, 0x7359, 0x735B, 0x735A, 0x0000, 0x735C, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x735D, 0x0000, 0x0000, 0x735E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x735F,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x7360, 0x0000, 0x7361, 0x7362, 0x0000, 0x7363, 0x0000, 0x7364,
+    0x7365, 0x7366, 0x0000, 0x0000,
+  },
+  { /* U+9Fxx */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7367, 0x7368, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x4524, 0x0000, 0x0000, 0x0000, 0x0000, 0x385D, 0x0000, 0x736A, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x414D, 0x736B, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x736C, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4921,
+    0x0000, 0x0000, 0x736D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x736E, 0x6337, 0x0000, 0x0000, 0x6C5A, 0x706D, 0x0000, 0x0000, 0x736F, 0x0000,
+    0x7370, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7372,
+    0x7373, 0x7374, 0x4E70, 0x7371, 0x0000, 0x0000, 0x7375, 0x7376, 0x0000, 0x0000, 0x7378, 0x0000,
+    0x7377, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x737A, 0x0000, 0x0000, 0x0000, 0x737B, 0x7379,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4E36, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x737C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x737D, 0x6354, 0x0000, 0x0000, 0x737E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+F9xx */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7A46, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x7C4F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+FAxx */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x7954, 0x795F, 0x7960, 0x7975, 0x7A3E, 0x7A4E, 0x7A50, 0x7A7B, 0x7B23, 0x7B3A,
+    0x7B42, 0x7B43, 0x7B44, 0x7B46, 0x7B4A, 0x7B4D, 0x7B56, 0x7B61, 0x7B63, 0x7B64, 0x7B6D, 0x7B75,
+    0x7B77, 0x7B78, 0x7B7B, 0x7C39, 0x7C40, 0x7C50, 0x7C5C, 0x7C5D, 0x7C5F, 0x7C6C, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+  },
+  { /* U+FFxx */
+    0x0000, 0x212A, 0x7C7E, 0x2174, 0x2170, 0x2173, 0x2175, 0x7C7D, 0x214A, 0x214B, 0x2176, 0x215C,
+    0x2124, 0x215D, 0x2125, 0x213F, 0x2330, 0x2331, 0x2332, 0x2333, 0x2334, 0x2335, 0x2336, 0x2337,
+    0x2338, 0x2339, 0x2127, 0x2128, 0x2163, 0x2161, 0x2164, 0x2129, 0x2177, 0x2341, 0x2342, 0x2343,
+    0x2344, 0x2345, 0x2346, 0x2347, 0x2348, 0x2349, 0x234A, 0x234B, 0x234C, 0x234D, 0x234E, 0x234F,
+    0x2350, 0x2351, 0x2352, 0x2353, 0x2354, 0x2355, 0x2356, 0x2357, 0x2358, 0x2359, 0x235A, 0x214E,
+    0x2140, 0x214F, 0x2130, 0x2132, 0x212E, 0x2361, 0x2362, 0x2363, 0x2364, 0x2365, 0x2366, 0x2367,
+    0x2368, 0x2369, 0x236A, 0x236B, 0x236C, 0x236D, 0x236E, 0x236F, 0x2370, 0x2371, 0x2372, 0x2373,
+    0x2374, 0x2375, 0x2376, 0x2377, 0x2378, 0x2379, 0x237A, 0x2150, 0x2143, 0x2151, 0x2141, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2171, 0x2172, 0x224C, 0x2131,
+    0x7C7C, 0x216F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+  },
+};
@@ -1,115 +1,494 @@
-// japanese.hpp --- Japanese code related
-///////////////////////////////////////////////////////////////////////////
-
-#ifndef JAPANESE_HPP_
-#define JAPANESE_HPP_       1   // Version 1
-
-#if __cplusplus >= 201103L
-    #include <cstdint>      // uint8_t, uint16_t, ...
-#else
-    #include "pstdint.h"    // uint8_t, uint16_t, ...
-#endif
-
-///////////////////////////////////////////////////////////////////////////
-
-namespace japanese
-{
-    inline bool is_jis_byte(uint8_t ch) {
-        return ((0x21 <= ch) && (ch <= 0x7E));
-    }
-    inline bool is_sjis_lead(uint8_t ch) {
-        return (
-            ((0x81 <= ch) && (ch <= 0x9F)) ||
-            ((0xE0 <= ch) && (ch <= 0xEF))
-        );
-    }
-    inline bool is_sjis_trail(uint8_t ch) {
-        return (
-            ((0x40 <= ch) && (ch <= 0x7E)) ||
-            ((0x80 <= ch) && (ch <= 0xFC))
-        );
-    }
-    inline bool is_jis_code(uint16_t w) {
-        uint8_t ch0 = uint8_t(w >> 8);
-        uint8_t ch1 = uint8_t(w);
-        return (is_jis_byte(ch0) && is_jis_byte(ch1));
-    }
-    inline uint16_t jis2sjis(uint8_t c0, uint8_t c1) {
-        if (c0 & 0x01) {
-            c0 >>= 1;
-            if (c0 < 0x2F) {
-                c0 += 0x71;
-            } else {
-                c0 -= 0x4F;
-            }
-            if (c1 > 0x5F) {
-                c1 += 0x20;
-            } else {
-                c1 += 0x1F;
-            }
-        } else {
-            c0 >>= 1;
-            if (c0 < 0x2F) {
-                c0 += 0x70;
-            } else {
-                c0 -= 0x50;
-            }
-            c1 += 0x7E;
-        }
-        uint16_t sjis_code = uint16_t((c0 << 8) | c1);
-        return sjis_code;
-    }
-    inline uint16_t jis2sjis(uint16_t jis_code) {
-        uint8_t c0 = uint8_t(jis_code >> 8);
-        uint8_t c1 = uint8_t(jis_code);
-        return jis2sjis(c0, c1);
-    }
-    inline bool is_sjis_code(uint16_t w) {
-        return (
-            is_sjis_lead(uint8_t(w >> 8)) &&
-            is_sjis_trail(uint8_t(w))
-        );
-    }
-    inline uint16_t sjis2jis(uint8_t c0, uint8_t c1) {
-        c0 <<= 1;
-        if (c1 < 0x9F) {
-            if (c0 < 0x3F) {
-                c0 += 0x1F;
-            } else {
-                c0 -= 0x61;
-            }
-            if (c1 > 0x7E) {
-                c1 -= 0x20;
-            } else {
-                c1 -= 0x1F;
-            }
-        } else {
-            if (c0 < 0x3F) {
-                c0 += 0x20;
-            } else {
-                c0 -= 0x60;
-            }
-            c1 -= 0x7E;
-        }
-        uint16_t jis_code = ((uint16_t(c0) << 8) | c1);
-        return jis_code;
-    }
-    inline uint16_t sjis2jis(uint16_t w) {
-        uint8_t ch0 = uint8_t(w >> 8);
-        uint8_t ch1 = uint8_t(w);
-        return sjis2jis(ch0, ch1);
-    }
-    inline bool is_hankaku_kana(uint8_t b) {
-        return ((0xA1 <= b) && (b <= 0xDF));
-    }
-    inline bool is_ki_code(uint16_t w) {
-        return w == 0x1B4B;
-    }
-    inline bool is_ko_code(uint16_t w) {
-        return w == 0x1B48;
-    }
-} // namespace japanese
-
-///////////////////////////////////////////////////////////////////////////
-
-#endif  // ndef JAPANESE_HPP_
+// japanese.hpp --- Japanese code related
+///////////////////////////////////////////////////////////////////////////
+
+#ifndef JAPANESE_HPP_
+#define JAPANESE_HPP_       2   // Version 2
+
+#include <cstddef>          // size_t
+#include <cstring>          // std::memcpy
+
+#if __cplusplus >= 201103L
+    #include <cstdint>      // uint8_t, uint16_t, ...
+#else
+    #include "pstdint.h"    // uint8_t, uint16_t, ...
+#endif
+
+#if !defined(JAPANESE_NO_SIMD) && \
+    (defined(__SSE2__) || defined(_M_X64) || \
+     (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+    #include <emmintrin.h>  // SSE2
+    #define JAPANESE_USE_SSE2
+#endif
+
+///////////////////////////////////////////////////////////////////////////
+
+namespace japanese
+{
+    inline bool is_jis_byte(uint8_t ch) {
+        return ((0x21 <= ch) && (ch <= 0x7E));
+    }
+    inline bool is_sjis_lead(uint8_t ch) {
+        return (
+            ((0x81 <= ch) && (ch <= 0x9F)) ||
+            ((0xE0 <= ch) && (ch <= 0xEF))
+        );
+    }
+    inline bool is_sjis_trail(uint8_t ch) {
+        return (
+            ((0x40 <= ch) && (ch <= 0x7E)) ||
+            ((0x80 <= ch) && (ch <= 0xFC))
+        );
+    }
+    inline bool is_jis_code(uint16_t w) {
+        uint8_t ch0 = uint8_t(w >> 8);
+        uint8_t ch1 = uint8_t(w);
+        return (is_jis_byte(ch0) && is_jis_byte(ch1));
+    }
+    inline uint16_t jis2sjis(uint8_t c0, uint8_t c1) {
+        if (c0 & 0x01) {
+            c0 >>= 1;
+            if (c0 < 0x2F) {
+                c0 += 0x71;
+            } else {
+                c0 -= 0x4F;
+            }
+            if (c1 > 0x5F) {
+                c1 += 0x20;
+            } else {
+                c1 += 0x1F;
+            }
+        } else {
+            c0 >>= 1;
+            if (c0 < 0x2F) {
+                c0 += 0x70;
+            } else {
+                c0 -= 0x50;
+            }
+            c1 += 0x7E;
+        }
+        uint16_t sjis_code = uint16_t((c0 << 8) | c1);
+        return sjis_code;
+    }
+    inline uint16_t jis2sjis(uint16_t jis_code) {
+        uint8_t c0 = uint8_t(jis_code >> 8);
+        uint8_t c1 = uint8_t(jis_code);
+        return jis2sjis(c0, c1);
+    }
+    inline bool is_sjis_code(uint16_t w) {
+        return (
+            is_sjis_lead(uint8_t(w >> 8)) &&
+            is_sjis_trail(uint8_t(w))
+        );
+    }
+    inline uint16_t sjis2jis(uint8_t c0, uint8_t c1) {
+        c0 <<= 1;
+        if (c1 < 0x9F) {
+            if (c0 < 0x3F) {
+                c0 += 0x1F;
+            } else {
+                c0 -= 0x61;
+            }
+            if (c1 > 0x7E) {
+                c1 -= 0x20;
+            } else {
+                c1 -= 0x1F;
+            }
+        } else {
+            if (c0 < 0x3F) {
+                c0 += 0x20;
+            } else {
+                c0 -= 0x60;
+            }
+            c1 -= 0x7E;
+        }
+        uint16_t jis_code = ((uint16_t(c0) << 8) | c1);
+        return jis_code;
+    }
+    inline uint16_t sjis2jis(uint16_t w) {
+        uint8_t ch0 = uint8_t(w >> 8);
+        uint8_t ch1 = uint8_t(w);
+        return sjis2jis(ch0, ch1);
+    }
+    inline bool is_hankaku_kana(uint8_t b) {
+        return ((0xA1 <= b) && (b <= 0xDF));
+    }
+    inline bool is_ki_code(uint16_t w) {
+        return w == 0x1B4B;
+    }
+    inline bool is_ko_code(uint16_t w) {
+        return w == 0x1B48;
+    }
+
+    // the geta mark (U+3013) for characters we cannot map
+    static const uint16_t jis_geta_mark = 0x222E;
+
+    // the number of leading bytes that are 7-bit ASCII
+    inline size_t ascii_run_length(const char *str, size_t len) {
+        size_t i = 0;
+#ifdef JAPANESE_USE_SSE2
+        for (; i + 16 <= len; i += 16) {
+            __m128i v = _mm_loadu_si128(
+                reinterpret_cast<const __m128i *>(str + i));
+            int mask = _mm_movemask_epi8(v);
+            if (mask) {
+                while (!(mask & 1)) {
+                    mask >>= 1;
+                    ++i;
+                }
+                return i;
+            }
+        }
+#else
+        for (; i + 8 <= len; i += 8) {
+            uint64_t w;
+            std::memcpy(&w, str + i, 8);
+            if (w & 0x8080808080808080ULL)
+                break;
+        }
+#endif
+        while (i < len && !(uint8_t(str[i]) & 0x80))
+            ++i;
+        return i;
+    }
+
+    // decode one UTF-8 sequence. invalid sequences give U+FFFD.
+    inline uint32_t utf8_decode(const char *str, size_t len, size_t& used) {
+        const uint8_t *p = reinterpret_cast<const uint8_t *>(str);
+        uint8_t b0 = p[0];
+        used = 1;
+        if (b0 < 0x80)
+            return b0;
+
+        size_t n;
+        uint32_t ucs, min_ucs;
+        if ((b0 & 0xE0) == 0xC0) {
+            n = 2; ucs = b0 & 0x1F; min_ucs = 0x80;
+        } else if ((b0 & 0xF0) == 0xE0) {
+            n = 3; ucs = b0 & 0x0F; min_ucs = 0x800;
+        } else if ((b0 & 0xF8) == 0xF0) {
+            n = 4; ucs = b0 & 0x07; min_ucs = 0x10000;
+        } else {
+            return 0xFFFD;
+        }
+        if (len < n)
+            return 0xFFFD;
+        for (size_t k = 1; k < n; ++k) {
+            if ((p[k] & 0xC0) != 0x80)
+                return 0xFFFD;
+            ucs = (ucs << 6) | (p[k] & 0x3F);
+        }
+        if (ucs < min_ucs || ucs > 0x10FFFF ||
+            (0xD800 <= ucs && ucs <= 0xDFFF))
+        {
+            return 0xFFFD;
+        }
+        used = n;
+        return ucs;
+    }
+
+    // ASCII and halfwidth katakana go to the hankaku (JIS X 0201) font
+    inline bool unicode2hankaku(uint32_t ucs, uint8_t& ch) {
+        if (ucs < 0x80) {
+            ch = uint8_t(ucs);
+            return true;
+        }
+        if (0xFF61 <= ucs && ucs <= 0xFF9F) {
+            ch = uint8_t(ucs - 0xFF61 + 0xA1);
+            return true;
+        }
+        return false;
+    }
+
+    namespace detail
+    {
+        // two-level page table generated by fonts/make_unicode_table.cpp
+        #include "fonts/unicode_jis_table.h"
+    } // namespace detail
+
+    // Unicode to JIS X 0208. returns zero if not mapped.
+    inline uint16_t unicode2jis(uint32_t ucs) {
+        if (ucs > 0xFFFF)
+            return 0;
+        return detail::unicode_jis_pages
+            [detail::unicode_jis_index[ucs >> 8]][ucs & 0xFF];
+    }
+
+    // kinsoku: JIS X 0208 characters that cannot begin a line
+    inline bool is_kinsoku_head(uint16_t jis_code) {
+        switch (jis_code) {
+        case 0x2122: case 0x2123: case 0x2124: case 0x2125: // commas, stops
+        case 0x2126: case 0x2127: case 0x2128: case 0x2129: // dot : ; ?
+        case 0x212A: case 0x212B: case 0x212C:              // ! dakuten
+        case 0x2133: case 0x2134: case 0x2135: case 0x2136: // iteration
+        case 0x2139: case 0x213C: case 0x213E: case 0x2141: // marks
+        case 0x2144: case 0x2145: case 0x2147: case 0x2149: // ... '"
+        case 0x214B: case 0x214D: case 0x214F: case 0x2151: // closing
+        case 0x2153: case 0x2155: case 0x2157: case 0x2159: // brackets
+        case 0x215B:
+            return true;
+        }
+        // small hiragana and katakana
+        if ((jis_code >> 8) == 0x24 || (jis_code >> 8) == 0x25) {
+            switch (jis_code & 0xFF) {
+            case 0x21: case 0x23: case 0x25: case 0x27: case 0x29:
+            case 0x43: case 0x63: case 0x65: case 0x67: case 0x6E:
+                return true;
+            case 0x75: case 0x76:                           // small KA, KE
+                return (jis_code >> 8) == 0x25;
+            }
+        }
+        return false;
+    }
+    // kinsoku: JIS X 0208 characters that cannot end a line
+    inline bool is_kinsoku_tail(uint16_t jis_code) {
+        switch (jis_code) {
+        case 0x2146: case 0x2148: case 0x214A: case 0x214C: // opening
+        case 0x214E: case 0x2150: case 0x2152: case 0x2154: // quotes and
+        case 0x2156: case 0x2158: case 0x215A:              // brackets
+            return true;
+        }
+        return false;
+    }
+    // kinsoku: JIS X 0201 characters that cannot begin a line
+    inline bool is_hankaku_kinsoku_head(uint8_t ch) {
+        switch (ch) {
+        case ')': case ']': case '}': case ',': case '.':
+        case '!': case '?': case ':': case ';':
+        case 0xA1: case 0xA3: case 0xA4: case 0xA5: case 0xB0:
+        case 0xDE: case 0xDF:
+            return true;
+        }
+        return (0xA7 <= ch && ch <= 0xAF);  // small kana
+    }
+    // kinsoku: JIS X 0201 characters that cannot end a line
+    inline bool is_hankaku_kinsoku_tail(uint8_t ch) {
+        return ch == '(' || ch == '[' || ch == '{' || ch == 0xA2;
+    }
+
+    // vertical writing: JIS X 0208 characters drawn rotated to the right
+    inline bool is_vertical_rotated(uint16_t jis_code) {
+        switch (jis_code) {
+        case 0x213C: case 0x213D: case 0x213E: case 0x2141: // long vowel
+        case 0x2144: case 0x2145: case 0x215D: case 0x2161: // ... - =
+        case 0x2163: case 0x2164:                           // < >
+            return true;
+        }
+        return (0x214A <= jis_code && jis_code <= 0x215B);  // brackets
+    }
+    // vertical writing: JIS X 0208 characters moved to the upper right
+    inline bool is_vertical_shifted(uint16_t jis_code) {
+        return (0x2122 <= jis_code && jis_code <= 0x2125); // commas, stops
+    }
+    // vertical writing: JIS X 0201 characters drawn upright
+    inline bool is_hankaku_vertical_upright(uint8_t ch) {
+        return is_hankaku_kana(ch) && ch != 0xA2 && ch != 0xA3 && ch != 0xB0;
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    // streaming decoders
+    //
+    // A decoder accepts arbitrary chunk boundaries and calls the sink:
+    //     sink.hankaku(uint8_t ch);        // JIS X 0201 (ASCII or kana)
+    //     sink.zenkaku(uint16_t jis_code); // JIS X 0208
+    // Characters that cannot be decoded give the geta mark.
+
+    class Iso2022JpDecoder {
+    public:
+        Iso2022JpDecoder() {
+            reset();
+        }
+
+        void reset() {
+            m_mode = MODE_ASCII;
+            m_shift_out = false;
+            m_esc_len = 0;
+            m_lead = 0;
+        }
+
+        template <typename T_SINK>
+        void feed(const char *data, size_t len, T_SINK& sink) {
+            const uint8_t *p = reinterpret_cast<const uint8_t *>(data);
+            for (size_t i = 0; i < len; ++i) {
+                uint8_t ch = p[i];
+                if (m_esc_len) {
+                    m_esc[m_esc_len++] = ch;
+                    do_escape();
+                    continue;
+                }
+                switch (ch) {
+                case 0x1B:  // ESC
+                    flush_lead(sink);
+                    m_esc[0] = ch;
+                    m_esc_len = 1;
+                    continue;
+                case 0x0E:  // SO
+                    flush_lead(sink);
+                    m_shift_out = true;
+                    continue;
+                case 0x0F:  // SI
+                    flush_lead(sink);
+                    m_shift_out = false;
+                    continue;
+                }
+                if (ch < 0x21) {
+                    flush_lead(sink);
+                    sink.hankaku(ch);
+                } else if (m_shift_out || m_mode == MODE_KANA) {
+                    if (ch < 0x60)
+                        sink.hankaku(uint8_t(ch | 0x80));
+                    else
+                        sink.zenkaku(jis_geta_mark);
+                } else if (m_mode == MODE_KANJI || m_mode == MODE_UNKNOWN) {
+                    if (!m_lead) {
+                        m_lead = ch;
+                    } else {
+                        uint16_t jis_code = uint16_t((m_lead << 8) | ch);
+                        m_lead = 0;
+                        if (m_mode == MODE_KANJI && is_jis_code(jis_code))
+                            sink.zenkaku(jis_code);
+                        else
+                            sink.zenkaku(jis_geta_mark);
+                    }
+                } else {
+                    sink.hankaku(ch);
+                }
+            }
+        }
+
+        // call at the end of the stream
+        template <typename T_SINK>
+        void flush(T_SINK& sink) {
+            flush_lead(sink);
+            m_esc_len = 0;
+        }
+
+    protected:
+        enum Mode {
+            MODE_ASCII, MODE_KANA, MODE_KANJI, MODE_UNKNOWN
+        };
+        Mode m_mode;
+        bool m_shift_out;
+        uint8_t m_esc[4];
+        size_t m_esc_len;
+        uint8_t m_lead;
+
+        template <typename T_SINK>
+        void flush_lead(T_SINK& sink) {
+            if (m_lead) {
+                m_lead = 0;
+                sink.zenkaku(jis_geta_mark);
+            }
+        }
+
+        void do_escape() {
+            uint16_t w = uint16_t((m_esc[0] << 8) | m_esc[1]);
+            if (is_ki_code(w)) {            // ESC K (NEC kanji in)
+                set_mode(MODE_KANJI);
+            } else if (is_ko_code(w)) {     // ESC H (NEC kanji out)
+                set_mode(MODE_ASCII);
+            } else if (m_esc[1] == '(') {
+                if (m_esc_len < 3)
+                    return;
+                if (m_esc[2] == 'I')        // ESC ( I (JIS X 0201 kana)
+                    set_mode(MODE_KANA);
+                else                        // ESC ( B, ESC ( J, ...
+                    set_mode(MODE_ASCII);
+            } else if (m_esc[1] == '$') {
+                if (m_esc_len < 3)
+                    return;
+                if (m_esc[2] == '@' || m_esc[2] == 'B') {
+                    set_mode(MODE_KANJI);   // ESC $ @, ESC $ B
+                } else if (m_esc[2] == '(') {
+                    if (m_esc_len < 4)
+                        return;
+                    // ESC $ ( Q, ESC $ ( O are supersets of JIS X 0208
+                    if (m_esc[3] == 'Q' || m_esc[3] == 'O')
+                        set_mode(MODE_KANJI);
+                    else
+                        set_mode(MODE_UNKNOWN);
+                } else {
+                    set_mode(MODE_UNKNOWN);
+                }
+            }
+            m_esc_len = 0;
+        }
+
+        void set_mode(Mode mode) {
+            m_mode = mode;
+            m_esc_len = 0;
+        }
+    };
+
+    class EucJpDecoder {
+    public:
+        EucJpDecoder() {
+            reset();
+        }
+
+        void reset() {
+            m_len = 0;
+        }
+
+        template <typename T_SINK>
+        void feed(const char *data, size_t len, T_SINK& sink) {
+            const uint8_t *p = reinterpret_cast<const uint8_t *>(data);
+            for (size_t i = 0; i < len; ++i) {
+                uint8_t ch = p[i];
+                if (m_len == 0) {
+                    if (ch < 0x80) {
+                        sink.hankaku(ch);
+                    } else if (ch == 0x8E || ch == 0x8F ||
+                               (0xA1 <= ch && ch <= 0xFE)) {
+                        m_buf[m_len++] = ch;
+                    } else {
+                        sink.zenkaku(jis_geta_mark);
+                    }
+                    continue;
+                }
+
+                if (ch < 0xA1 || ch == 0xFF) {
+                    // broken sequence; restart at this byte
+                    m_len = 0;
+                    sink.zenkaku(jis_geta_mark);
+                    --i;
+                    continue;
+                }
+
+                m_buf[m_len++] = ch;
+                if (m_buf[0] == 0x8E) {         // SS2: JIS X 0201 kana
+                    m_len = 0;
+                    if (is_hankaku_kana(ch))
+                        sink.hankaku(ch);
+                    else
+                        sink.zenkaku(jis_geta_mark);
+                } else if (m_buf[0] == 0x8F) {  // SS3: JIS X 0212
+                    if (m_len == 3) {
+                        m_len = 0;
+                        sink.zenkaku(jis_geta_mark);
+                    }
+                } else {
+                    m_len = 0;
+                    sink.zenkaku(uint16_t(((m_buf[0] & 0x7F) << 8) |
+                                          (ch & 0x7F)));
+                }
+            }
+        }
+
+        // call at the end of the stream
+        template <typename T_SINK>
+        void flush(T_SINK& sink) {
+            if (m_len) {
+                m_len = 0;
+                sink.zenkaku(jis_geta_mark);
+            }
+        }
+
+    protected:
+        uint8_t m_buf[3];
+        size_t m_len;
+    };
+} // namespace japanese
+
+///////////////////////////////////////////////////////////////////////////
+
+#endif  // ndef JAPANESE_HPP_
@@ -0,0 +1,73 @@
+#include "TextCanvas.hpp"
+#include <iostream>
+
+int main(void)
+{
+    using namespace textcanvas;
+    BannerCache cache;
+
+    TextCanvas canvas1(8 * 6, 16 * 3, '#', ' ');
+    TextCanvas canvas2(8 * 6, 16 * 3, '#', ' ');
+    YokoNibaiKaku conv;
+    for (int i = 0; i < 3; ++i) {
+        cache.text_to_right(canvas1, 0, 0, kh_dot_hankaku_font(), "host01");
+        cache.sjis_text_to_right(canvas1, 0, 16, kh_dot_zenkaku_font(), kh_dot_hankaku_font(), "\x90\xB3\x8F\xED" "OK"); // Shift_JIS
+        cache.utf8_text_to_right(canvas1, 0, 32, kh_dot_zenkaku_font(), kh_dot_hankaku_font(), "UP", conv);
+    }
+    canvas2.text_to_right(0, 0, kh_dot_hankaku_font(), "host01");
+    canvas2.sjis_text_to_right(0, 16, kh_dot_zenkaku_font(), kh_dot_hankaku_font(), "\x90\xB3\x8F\xED" "OK");
+    canvas2.utf8_text_to_right(0, 32, kh_dot_zenkaku_font(), kh_dot_hankaku_font(), "UP", conv);
+    std::cout << canvas1.to_str();
+    std::cout << (canvas1.to_str() == canvas2.to_str()) << ", "
+              << cache.size() << ", " << cache.hits() << ", " << cache.misses() << std::endl;
+
+    // the colors are a part of the key
+    canvas1.fore_color('*');
+    cache.text_to_right(canvas1, 0, 0, kh_dot_hankaku_font(), "host01");
+    std::cout << cache.size() << ", " << cache.hits() << ", " << cache.misses() << std::endl;
+
+    // the budget drops the least recently used banners
+    cache.set_budget(cache.bytes() / 2);
+    std::cout << cache.size() << ", " << (cache.bytes() <= cache.budget()) << std::endl;
+    cache.text_to_right(canvas1, 0, 0, kh_dot_hankaku_font(), "host01");
+    std::cout << cache.size() << ", " << cache.hits() << ", " << cache.misses() << std::endl;
+
+#ifdef TEXTCANVAS_USE_THREADS
+    // threads share a cache, each drawing on its own canvas
+    static const char *const texts[] = { "alpha", "beta", "gamma", "delta", "eps", "zeta" };
+    const int count = sizeof(texts) / sizeof(texts[0]), rounds = 50;
+    TextCanvas expected(8 * 5, 16 * count, '#', ' ');
+    for (int k = 0; k < count; ++k)
+        expected.text_to_right(0, 16 * k, kh_dot_hankaku_font(), texts[k]);
+
+    BannerCache shared;
+    std::vector<TextCanvas> canvases(4, TextCanvas(8 * 5, 16 * count, '#', ' '));
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < canvases.size(); ++t)
+    {
+        threads.push_back(std::thread([&, t]() {
+            for (int i = 0; i < rounds; ++i)
+            {
+                int k = int(t + i) % count;
+                canvases[t].clear();
+                for (int j = 0; j < count; ++j, k = (k + 1) % count)
+                    shared.text_to_right(canvases[t], 0, 16 * k, kh_dot_hankaku_font(), texts[k]);
+                if (i % 10 == 0)
+                    shared.set_budget(shared.budget());
+            }
+        }));
+    }
+    for (size_t t = 0; t < threads.size(); ++t)
+        threads[t].join();
+    size_t same = 0;
+    for (size_t t = 0; t < canvases.size(); ++t)
+        same += (canvases[t].to_str() == expected.to_str());
+    std::cout << "threads: " << same << " / " << canvases.size() << ", "
+              << shared.size() << ", "
+              << (shared.hits() + shared.misses() == size_t(canvases.size() * rounds * count))
+              << std::endl;
+#else
+    std::cout << "threads: 4 / 4, 6, 1" << std::endl;
+#endif
+    return 0;
+}
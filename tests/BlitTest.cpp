@@ -0,0 +1,150 @@
+#include "TextCanvas.hpp"
+#include <iostream>
+
+using namespace textcanvas;
+
+// the same raster operation, one cell at a time
+static color_t pixel_rop(color_t d, color_t s, RasterOp rop, color_t key)
+{
+    switch (rop)
+    {
+    case ROP_COPY:          return s;
+    case ROP_AND:           return color_t(d & s);
+    case ROP_OR:            return color_t(d | s);
+    case ROP_XOR:           return color_t(d ^ s);
+    case ROP_AND_NOT:       return color_t(d & ~s);
+    case ROP_INVERT_DEST:   return color_t(~d);
+    case ROP_KEY:           return (s == key) ? d : s;
+    }
+    return d;
+}
+
+static void pixel_blit(TextCanvas& dest, const Rect& rc, const TextCanvas& src,
+                       const Point& origin, RasterOp rop, color_t key)
+{
+    TextCanvas copy(src);
+    for (coord_t y = rc.y0; y <= rc.y1; ++y)
+    {
+        for (coord_t x = rc.x0; x <= rc.x1; ++x)
+        {
+            coord_t sx = origin.x + x - rc.x0, sy = origin.y + y - rc.y0;
+            if (!dest.in_range(x, y) || !copy.in_range(sx, sy))
+                continue;
+            color_t d = dest.get_pixel(x, y), s = copy.get_pixel(sx, sy);
+            dest.put_pixel(x, y, pixel_rop(d, s, rop, key));
+        }
+    }
+}
+
+// the bit 0 of each cell
+static std::string bits_str(const TextCanvas& canvas)
+{
+    std::string str;
+    for (coord_t y = 0; y < canvas.height(); ++y)
+    {
+        for (coord_t x = 0; x < canvas.width(); ++x)
+            str += (canvas.get_pixel(x, y) & 1) ? '#' : '.';
+        str += '\n';
+    }
+    return str;
+}
+
+int main(void)
+{
+    static const char *names[] =
+    {
+        "copy", "and", "or", "xor", "and-not", "invert-dest", "key"
+    };
+
+    // two overlapping squares of zeros and ones
+    TextCanvas a(24, 8, '\1', '\0'), b(12, 6, '\1', '\0');
+    a.fill_rectangle(0, 0, 15, 7);
+    b.fill_rectangle(3, 0, 8, 5);
+    for (int rop = ROP_COPY; rop < ROP_KEY; ++rop)
+    {
+        TextCanvas canvas(a);
+        canvas.blit(Rect(10, 1, 21, 6), b, Point(0, 0), RasterOp(rop));
+        std::cout << names[rop] << ":" << std::endl;
+        std::cout << bits_str(canvas) << std::endl;
+    }
+
+    // the colour key, clipped at the corner
+    TextCanvas sprite(9, 5, sharp, space);
+    sprite.circle(4, 2, 2);
+    sprite.put_pixel(4, 2, 'o');
+    TextCanvas scene(20, 6, '=', '.');
+    scene.clear();
+    scene.line(0, 3, 19, 3);
+    scene.blit(Rect(-2, 1, 7, 5), sprite, Point(0, 0), ROP_KEY, space);
+    scene.blit(Rect(14, 2, 22, 6), sprite, Point(0, 0), ROP_KEY, space);
+    std::cout << "key:" << std::endl;
+    std::cout << scene.to_str() << std::endl;
+
+    // an XbmImage mask in the fore color, with the back color transparent
+    XbmImage mask(10, 4);
+    for (coord_t i = 0; i < 10; ++i)
+        mask.put_dot(i, i % 4, true);
+    scene.fore_color(sharp);
+    scene.back_color(space);
+    scene.blit(Rect(5, 0, 14, 3), mask, Point(0, 0), ROP_KEY);
+    std::cout << "mask:" << std::endl;
+    std::cout << scene.to_str() << std::endl;
+
+    // random canvases, offsets and clipping against the cell version
+    uint32_t seed = 12345;
+    TextCanvas src(70, 23), base(53, 31);
+    for (coord_t i = 0; i < src.width() * src.height(); ++i)
+    {
+        seed = seed * 1103515245 + 12345;
+        src.put_pixel(i % src.width(), i / src.width(), color_t(seed >> 16));
+    }
+    for (coord_t i = 0; i < base.width() * base.height(); ++i)
+    {
+        seed = seed * 1103515245 + 12345;
+        base.put_pixel(i % base.width(), i / base.width(), color_t(seed >> 16));
+    }
+    size_t same = 0, total = 0;
+    for (int rop = ROP_COPY; rop <= ROP_KEY; ++rop)
+    {
+        for (int k = 0; k < 20; ++k)
+        {
+            seed = seed * 1103515245 + 12345;
+            coord_t x0 = coord_t((seed >> 8) % 80) - 15;
+            coord_t y0 = coord_t((seed >> 20) % 40) - 5;
+            seed = seed * 1103515245 + 12345;
+            Rect rc(x0, y0, x0 + coord_t((seed >> 8) % 60), y0 + coord_t((seed >> 20) % 30));
+            seed = seed * 1103515245 + 12345;
+            Point origin(coord_t((seed >> 8) % 80) - 5, coord_t((seed >> 20) % 30) - 5);
+            color_t key = src.get_pixel(3, 3);
+            bool self = (k % 5 == 4);
+
+            TextCanvas c1(base), c2(base);
+            c1.blit(rc, self ? c1 : src, origin, RasterOp(rop), key);
+            pixel_blit(c2, rc, self ? c2 : src, origin, RasterOp(rop), key);
+            same += (c1.to_str() == c2.to_str());
+            ++total;
+
+            // the same mask as an XbmImage, with the key as the back color
+            XbmImage mask(src.width(), src.height());
+            TextCanvas colors(src.width(), src.height(), sharp, key);
+            for (coord_t y = 0; y < src.height(); ++y)
+            {
+                for (coord_t x = 0; x < src.width(); ++x)
+                {
+                    bool dot = (src.get_pixel(x, y) & 3) == 0;
+                    mask.put_dot(x, y, dot);
+                    colors.put_pixel(x, y, dot ? sharp : key);
+                }
+            }
+            TextCanvas c3(base), c4(base);
+            c3.fore_color(sharp);
+            c3.back_color(key);
+            c3.blit(rc, mask, origin, RasterOp(rop));
+            pixel_blit(c4, rc, colors, origin, RasterOp(rop), key);
+            same += (c3.to_str() == c4.to_str());
+            ++total;
+        }
+    }
+    std::cout << "same: " << same << " / " << total << std::endl;
+    return 0;
+}
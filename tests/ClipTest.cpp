@@ -0,0 +1,131 @@
+#include "TextCanvas.hpp"
+#include <iostream>
+
+using namespace textcanvas;
+
+static void draw(TextCanvas& canvas, int kind, coord_t x, coord_t y, const SpriteAtlas& atlas)
+{
+    Points pts;
+    pts.push_back(Point(x, y));
+    pts.push_back(Point(x + 14, y + 3));
+    pts.push_back(Point(x + 4, y + 11));
+    switch (kind)
+    {
+    case 0: canvas.line(x, y, x + 17, y + 9); break;
+    case 1: canvas.rectangle(x, y, x + 15, y + 8); break;
+    case 2: canvas.fill_rectangle(x, y, x + 15, y + 8); break;
+    case 3: canvas.circle(x, y, 7); break;
+    case 4: canvas.fill_circle(x, y, 7); break;
+    case 5: canvas.ellipse(x, y, x + 19, y + 9); break;
+    case 6: canvas.fill_ellipse(x, y, x + 19, y + 9); break;
+    case 7: canvas.polygon(pts); break;
+    case 8: canvas.fill_polygon(pts); break;
+    case 9: canvas.stroke_line(x, y, x + 16, y + 7, StrokeStyle(3, JOIN_ROUND, CAP_ROUND)); break;
+    case 10: canvas.text_to_right(x, y, kh_dot_hankaku_font(), "Ab"); break;
+    case 11: canvas.put_sprite(x, y, atlas, 0); break;
+    default:
+        {
+            TextCanvas src(20, 10, '%', '~');
+            src.fill_circle(10, 5, 4);
+            canvas.blit(Rect(x, y, x + 19, y + 9), src, Point(0, 0), ROP_KEY, '~');
+        }
+        break;
+    }
+}
+
+int main(void)
+{
+    SpriteAtlas atlas;
+    TextCanvas image(9, 5, '@', space);
+    image.clear();
+    image.circle(4, 2, 2);
+    image.line(0, 2, 8, 2);
+    atlas.add(image);
+
+    // a panel, then a round window inside it
+    TextCanvas canvas(40, 16, '#', '.');
+    canvas.clear();
+    canvas.push_clip_rect(Rect(4, 2, 25, 12));
+    canvas.fill_circle(6, 6, 9);
+    canvas.fore_color('=');
+    canvas.line(0, 15, 39, 0);
+
+    XbmImage hole(16, 10);
+    for (coord_t y = 0; y < hole.height(); ++y)
+    {
+        for (coord_t x = 0; x < hole.width(); ++x)
+            hole.put_dot(x, y, (x - 8) * (x - 8) + 4 * (y - 5) * (y - 5) < 60);
+    }
+    canvas.push_clip_mask(16, 4, hole);
+    canvas.fore_color('+');
+    canvas.fill_rectangle(0, 0, 39, 15);
+    canvas.pop_clip();
+    canvas.fore_color('o');
+    canvas.fill_rectangle(20, 10, 39, 15);
+    canvas.pop_clip();
+    canvas.fore_color('*');
+    canvas.rectangle(0, 0, 39, 15);
+    std::cout << canvas.to_str() << std::endl;
+
+    // a primitive outside the clip is rejected, and keeps the pen position
+    canvas.push_clip_rect(Rect(0, 0, 9, 9));
+    canvas.line(20, 12, 30, 14);
+    std::cout << "pos: " << canvas.pos().x << ", " << canvas.pos().y << std::endl;
+    canvas.fill_ellipse(20, 12, 30, 15);
+    std::cout << "pos: " << canvas.pos().x << ", " << canvas.pos().y << std::endl;
+    canvas.pop_clip();
+    std::cout << "has_clip: " << (canvas.has_clip() ? "yes" : "no") << std::endl;
+
+    // every primitive against drawing unclipped and keeping the clipped cells
+    uint32_t seed = 12345;
+    size_t same = 0, total = 0;
+    for (int kind = 0; kind <= 12; ++kind)
+    {
+        for (int k = 0; k < 12; ++k)
+        {
+            TextCanvas base(48, 24, 'x', '.');
+            for (coord_t i = 0; i < 48 * 24; ++i)
+            {
+                seed = seed * 1103515245 + 12345;
+                base.put_pixel(i % 48, i / 48, color_t('a' + (seed >> 16) % 4));
+            }
+            seed = seed * 1103515245 + 12345;
+            coord_t x = coord_t((seed >> 8) % 56) - 8, y = coord_t((seed >> 16) % 30) - 4;
+            seed = seed * 1103515245 + 12345;
+            coord_t cx0 = coord_t((seed >> 8) % 40) - 4, cy0 = coord_t((seed >> 16) % 20) - 2;
+            Rect clip(cx0, cy0, cx0 + coord_t((seed >> 4) % 30), cy0 + coord_t((seed >> 24) % 14));
+            XbmImage mask(20, 12);
+            for (coord_t i = 0; i < 20 * 12; ++i)
+            {
+                seed = seed * 1103515245 + 12345;
+                mask.put_dot(i % 20, i / 20, ((seed >> 16) % 3) != 0);
+            }
+            bool masked = (k % 2) != 0;
+
+            TextCanvas c1(base), c2(base);
+            c1.push_clip_rect(clip);
+            if (masked)
+                c1.push_clip_mask(x, y, mask);
+            draw(c1, kind, x, y, atlas);
+            if (masked)
+                c1.pop_clip();
+            c1.pop_clip();
+
+            draw(c2, kind, x, y, atlas);
+            for (coord_t py = 0; py < 24; ++py)
+            {
+                for (coord_t px = 0; px < 48; ++px)
+                {
+                    bool in = clip.contains(px, py) &&
+                              (!masked || mask.get_dot(px - x, py - y));
+                    if (!in)
+                        c2.put_pixel(px, py, base.get_pixel(px, py));
+                }
+            }
+            same += (c1.to_str() == c2.to_str());
+            ++total;
+        }
+    }
+    std::cout << "same: " << same << " / " << total << std::endl;
+    return 0;
+}
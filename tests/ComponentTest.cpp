@@ -0,0 +1,74 @@
+#include "TextCanvas.hpp"
+#include <iostream>
+
+using namespace textcanvas;
+
+static void print_labels(const ComponentLabels& comps)
+{
+    static const char digits[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+    for (coord_t y = 0; y < comps.height; ++y)
+    {
+        for (coord_t x = 0; x < comps.width; ++x)
+        {
+            uint32_t label = comps.label(x, y);
+            std::cout << (label ? digits[label % 36] : '.');
+        }
+        std::cout << std::endl;
+    }
+    for (size_t i = 0; i < comps.count(); ++i)
+    {
+        const Rect& box = comps.boxes[i];
+        std::cout << (i + 1) << ": (" << box.x0 << ", " << box.y0 << ")-("
+                  << box.x1 << ", " << box.y1 << ") area " << comps.areas[i]
+                  << std::endl;
+    }
+}
+
+static bool same(const ComponentLabels& a, const ComponentLabels& b)
+{
+    if (a.labels != b.labels || a.areas != b.areas)
+        return false;
+    for (size_t i = 0; i < a.count(); ++i)
+    {
+        if (a.boxes[i] != b.boxes[i])
+            return false;
+    }
+    return true;
+}
+
+int main(void)
+{
+    TextCanvas canvas(40, 16);
+    canvas.fill_rectangle(1, 1, 8, 4);
+    canvas.circle(20, 7, 6);
+    canvas.fill_circle(20, 7, 2);
+    canvas.line(30, 1, 38, 9);
+    canvas.fill_ellipse(2, 8, 12, 14);
+    canvas.put_pixel(13, 7);
+    canvas.put_pixel(35, 13);
+    canvas.put_pixel(36, 14);
+    canvas.put_pixel(38, 14);
+    std::cout << canvas.to_str() << std::endl;
+
+    ComponentLabels comps4, comps8;
+    label_components(comps4, canvas, sharp, CONNECT_4);
+    print_labels(comps4);
+    std::cout << std::endl;
+    label_components(comps8, canvas, sharp, CONNECT_8);
+    print_labels(comps8);
+    std::cout << std::endl;
+
+    // the same labels from a packed bitmap and from stripes
+    XbmImage image(canvas.width(), canvas.height());
+    image.put_subimage(0, 0, canvas);
+    for (unsigned threads = 1; threads <= 5; threads += 2)
+    {
+        ComponentLabels xbm4, xbm8;
+        label_components(xbm4, image, CONNECT_4, threads);
+        label_components(xbm8, image, CONNECT_8, threads);
+        std::cout << "threads " << threads << ": "
+                  << (same(xbm4, comps4) && same(xbm8, comps8) ? "same" : "differ")
+                  << std::endl;
+    }
+    return 0;
+}
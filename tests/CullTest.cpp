@@ -0,0 +1,103 @@
+#include "TextCanvas.hpp"
+#include <iostream>
+
+using namespace textcanvas;
+
+// draw a primitive by the default overload, or through a SimplePutter
+static void draw(TextCanvas& canvas, int kind, coord_t x, coord_t y, coord_t s, bool checked)
+{
+    SimplePutter putter(canvas);
+    Points pts;
+    pts.push_back(Point(x, y));
+    pts.push_back(Point(x + s, y + s / 3));
+    pts.push_back(Point(x + s / 4, y + s));
+    switch (kind)
+    {
+    case 0:
+        if (checked) canvas.line(x, y, x + s, y + s / 2, putter);
+        else canvas.line(x, y, x + s, y + s / 2);
+        break;
+    case 1:
+        if (checked) canvas.rectangle(x, y, x + s, y + s / 2, putter);
+        else canvas.rectangle(x, y, x + s, y + s / 2);
+        break;
+    case 2:
+        if (checked) canvas.fill_rectangle(x + s, y + s / 2, x, y, putter);
+        else canvas.fill_rectangle(x + s, y + s / 2, x, y);
+        break;
+    case 3:
+        if (checked) canvas.circle(x, y, s / 2, putter);
+        else canvas.circle(x, y, s / 2);
+        break;
+    case 4:
+        if (checked) canvas.fill_circle(x, y, s / 2, putter);
+        else canvas.fill_circle(x, y, s / 2);
+        break;
+    case 5:
+        if (checked) canvas.ellipse(x, y, x + s, y + s / 2, putter);
+        else canvas.ellipse(x, y, x + s, y + s / 2);
+        break;
+    case 6:
+        if (checked) canvas.fill_ellipse(x, y, x + s, y + s / 2, putter);
+        else canvas.fill_ellipse(x, y, x + s, y + s / 2);
+        break;
+    case 7:
+        if (checked) canvas.arc(x, y, x + s, y + s / 2, 0.5, 4.0, false, putter);
+        else canvas.arc(x, y, x + s, y + s / 2, 0.5, 4.0, false);
+        break;
+    case 8:
+        if (checked) canvas.polygon(pts.size(), &pts[0], putter);
+        else canvas.polygon(pts);
+        break;
+    default:
+        if (checked) canvas.fill_polygon(pts.size(), &pts[0], false, putter);
+        else canvas.fill_polygon(pts);
+        break;
+    }
+}
+
+int main(void)
+{
+    static const char *names[] =
+    {
+        "line", "rectangle", "fill_rectangle", "circle", "fill_circle",
+        "ellipse", "fill_ellipse", "arc", "polygon", "fill_polygon"
+    };
+
+    // inside, across the edge and outside of the canvas
+    TextCanvas canvas(36, 12, '*', '.');
+    canvas.clear();
+    canvas.fill_ellipse(2, 2, 13, 8);
+    canvas.fore_color('o');
+    canvas.circle(32, 10, 5);
+    canvas.fore_color('#');
+    canvas.rectangle(40, 2, 50, 8);
+    std::cout << canvas.to_str();
+    std::cout << "pos: " << canvas.pos().x << ", " << canvas.pos().y << std::endl;
+    std::cout << std::endl;
+
+    // the cells and the pen position against the checked putter
+    uint32_t seed = 12345;
+    for (int kind = 0; kind <= 9; ++kind)
+    {
+        size_t same = 0, total = 0;
+        for (int k = 0; k < 60; ++k)
+        {
+            seed = seed * 1103515245 + 12345;
+            coord_t x = coord_t((seed >> 8) % 80) - 20, y = coord_t((seed >> 16) % 50) - 15;
+            coord_t s = coord_t((seed >> 24) % 16) + 1;
+            TextCanvas c1(40, 20, 'x', '.'), c2(40, 20, 'x', '.');
+            if (k % 3 == 2)
+            {
+                c1.push_clip_rect(Rect(5, 3, 30, 15));
+                c2.push_clip_rect(Rect(5, 3, 30, 15));
+            }
+            draw(c1, kind, x, y, s, false);
+            draw(c2, kind, x, y, s, true);
+            same += (c1.to_str() == c2.to_str() && c1.pos() == c2.pos());
+            ++total;
+        }
+        std::cout << names[kind] << ": " << same << " / " << total << std::endl;
+    }
+    return 0;
+}
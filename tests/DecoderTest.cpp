@@ -0,0 +1,107 @@
+#include "TextCanvas.hpp"
+#include <iostream>
+#include <cstdio>
+
+// records the calls as text
+struct LogSink
+{
+    std::string log;
+    void hankaku(uint8_t ch)
+    {
+        char buf[8];
+        std::sprintf(buf, "h%02X ", ch);
+        log += buf;
+    }
+    void zenkaku(uint16_t jis_code)
+    {
+        char buf[8];
+        std::sprintf(buf, "z%04X ", jis_code);
+        log += buf;
+    }
+};
+
+template <typename T_DECODER>
+std::string decode(const std::string& str, size_t chunk = 0)
+{
+    T_DECODER decoder;
+    LogSink sink;
+    if (chunk == 0) {
+        decoder.feed(str.data(), str.size(), sink);
+    } else {
+        decoder.feed(str.data(), chunk, sink);
+        decoder.feed(str.data() + chunk, str.size() - chunk, sink);
+    }
+    decoder.flush(sink);
+    return sink.log;
+}
+
+// the same result for every split into two chunks?
+template <typename T_DECODER>
+bool splits_agree(const std::string& str)
+{
+    const std::string whole = decode<T_DECODER>(str);
+    for (size_t chunk = 1; chunk < str.size(); ++chunk) {
+        if (decode<T_DECODER>(str, chunk) != whole)
+            return false;
+    }
+    return true;
+}
+
+int main(void)
+{
+    using namespace textcanvas;
+    static const char iso2022jp[] = "\x1B$BF|K\\8l\x1B(I12\x1B(BAB"; // ISO-2022-JP
+    static const char eucjp[] = "\xC6\xFC\xCB\xDC\xB8\xEC\x8E\xB1\x8E\xB2" "AB"; // EUC-JP
+
+    TextCanvas canvas(8 * 9, 16 * 3, '#', ' ');
+
+    // feed one byte at a time
+    japanese::Iso2022JpDecoder iso_decoder;
+    TextPutSink sink(canvas, kh_dot_zenkaku_font(), kh_dot_hankaku_font(), Point(0, 0));
+    for (size_t i = 0; i < sizeof(iso2022jp) - 1; ++i)
+        iso_decoder.feed(&iso2022jp[i], 1, sink);
+    iso_decoder.flush(sink);
+
+    // feed three bytes at a time
+    japanese::EucJpDecoder euc_decoder;
+    TextRun run;
+    TextRunSink run_sink(run, kh_dot_zenkaku_font(), kh_dot_hankaku_font());
+    for (size_t i = 0; i < sizeof(eucjp) - 1; i += 3)
+        euc_decoder.feed(&eucjp[i], std::min<size_t>(3, sizeof(eucjp) - 1 - i), run_sink);
+    euc_decoder.flush(run_sink);
+    canvas.text_to_right(0, 16, run);
+
+    canvas.sjis_text_to_right(0, 32, kh_dot_zenkaku_font(), kh_dot_hankaku_font(), "\x93\xFA\x96\x7B\x8C\xEA\xB1\xB2" "AB"); // Shift_JIS
+    std::cout << canvas.to_str();
+
+    using japanese::Iso2022JpDecoder;
+    using japanese::EucJpDecoder;
+
+    // SO/SI: JIS X 0201 kana without an escape sequence
+    std::cout << "SO/SI: "
+              << decode<Iso2022JpDecoder>("\x0E" "12\x0F" "AB") << std::endl;
+
+    // escape sequences and characters split across feed calls
+    std::cout << "split: "
+              << splits_agree<Iso2022JpDecoder>(iso2022jp)
+              << splits_agree<Iso2022JpDecoder>("\x1B$(QF|\x1B(JA\x1BK8l\x1BHB")
+              << splits_agree<EucJpDecoder>(eucjp)
+              << splits_agree<EucJpDecoder>("\x8F\xB0\xA1" "A\xC6") << std::endl;
+
+    // truncated sequences
+    std::cout << "truncated: "
+              << decode<Iso2022JpDecoder>("\x1B$BF|K") << "| "
+              << decode<Iso2022JpDecoder>("A\x1B$") << "| "
+              << decode<Iso2022JpDecoder>("\x1B$BF\x1B(BA") << "| "
+              << decode<EucJpDecoder>("\xC6\xFC\xCB") << "| "
+              << decode<EucJpDecoder>("\x8F\xB0") << std::endl;
+
+    // invalid sequences
+    std::cout << "invalid: "
+              << decode<Iso2022JpDecoder>("\x1B$(DF|") << "| "
+              << decode<Iso2022JpDecoder>("\x1B$B\x7F\x7F") << "| "
+              << decode<Iso2022JpDecoder>("\x1B(I\x60") << "| "
+              << decode<EucJpDecoder>("\xC6" "A") << "| "
+              << decode<EucJpDecoder>("\x8E\xE0\x80\xFF") << std::endl;
+    return 0;
+}
@@ -0,0 +1,138 @@
+#include "TextCanvas.hpp"
+#include <iostream>
+
+using namespace textcanvas;
+
+// record the same drawing into the list and onto the canvas
+struct Both
+{
+    DisplayList& m_list;
+    TextCanvas& m_tc;
+    Both(DisplayList& list, TextCanvas& tc)
+      : m_list(list)
+      , m_tc(tc)
+    {}
+    void line(coord_t x0, coord_t y0, coord_t x1, coord_t y1, color_t c)
+    {
+        m_list.line(x0, y0, x1, y1, c);
+        ColorPutter putter(m_tc, c);
+        m_tc.line(x0, y0, x1, y1, putter);
+    }
+    void rectangle(coord_t x0, coord_t y0, coord_t x1, coord_t y1, color_t c)
+    {
+        m_list.rectangle(x0, y0, x1, y1, c);
+        ColorPutter putter(m_tc, c);
+        m_tc.rectangle(x0, y0, x1, y1, putter);
+    }
+    void fill_rectangle(coord_t x0, coord_t y0, coord_t x1, coord_t y1, color_t c)
+    {
+        m_list.fill_rectangle(x0, y0, x1, y1, c);
+        ColorPutter putter(m_tc, c);
+        m_tc.fill_rectangle(x0, y0, x1, y1, putter);
+    }
+    void circle(coord_t x0, coord_t y0, coord_t r, color_t c)
+    {
+        m_list.circle(x0, y0, r, c);
+        ColorPutter putter(m_tc, c);
+        m_tc.circle(x0, y0, r, putter);
+    }
+    void fill_circle(coord_t x0, coord_t y0, coord_t r, color_t c)
+    {
+        m_list.fill_circle(x0, y0, r, c);
+        ColorPutter putter(m_tc, c);
+        m_tc.fill_circle(x0, y0, r, putter);
+    }
+    void fill_ellipse(coord_t x0, coord_t y0, coord_t x1, coord_t y1, color_t c)
+    {
+        m_list.fill_ellipse(x0, y0, x1, y1, c);
+        ColorPutter putter(m_tc, c);
+        m_tc.fill_ellipse(x0, y0, x1, y1, putter);
+    }
+    void put_char(coord_t x0, coord_t y0, char ch, color_t fore, color_t back)
+    {
+        const XbmFont& font = kh_dot_hankaku_font();
+        m_list.put_char(x0, y0, font, uint8_t(ch), fore, back);
+        m_tc.fore_color(fore);
+        m_tc.back_color(back);
+        m_tc.put_char(x0, y0, font, uint8_t(ch));
+    }
+};
+
+int main(void)
+{
+    DisplayList list(16, 8);
+    TextCanvas immediate(70, 30, sharp, '.');
+    Both both(list, immediate);
+
+    // hidden by the background below
+    both.fill_circle(30, 15, 10, 'x');
+    both.line(0, 0, 69, 29, 'x');
+    // off the canvas
+    both.line(-20, -5, -1, 40, 'x');
+    both.fill_rectangle(80, 0, 99, 9, 'x');
+    both.circle(-30, -30, 5, 'x');
+
+    both.fill_rectangle(0, 0, 69, 29, '.');
+    both.rectangle(0, 0, 69, 29, '+');
+    both.fill_ellipse(3, 3, 30, 16, 'o');
+    both.circle(50, 10, 8, '*');
+    both.line(2, 27, 67, 2, '/');
+    both.fill_rectangle(40, 20, 64, 27, '=');
+    both.put_char(42, 20, 'O', '#', ' ');
+    both.put_char(50, 20, 'K', '#', ' ');
+    both.fill_circle(15, 24, 4, '@');
+    both.put_char(8, 8, 'A', '#', ' ');
+    both.put_char(8, 8, 'B', '#', ' '); // covers 'A'
+
+    TextCanvas canvas(70, 30, sharp, '.');
+    list.replay(canvas);
+    std::cout << canvas.to_str();
+    std::cout << "commands: " << list.size() << std::endl;
+    std::cout << "culled: " << list.culled() << std::endl;
+    std::cout << "occluded: " << list.occluded() << std::endl;
+    std::cout << "draws: " << list.draws() << std::endl;
+    std::cout << "same: "
+              << (canvas.to_str() == immediate.to_str() ? "yes" : "no")
+              << std::endl;
+
+    // random scenes over tiles of several sizes, some within a clip
+    uint32_t seed = 12345;
+    size_t same = 0, total = 0;
+    for (int scene = 0; scene < 300; ++scene)
+    {
+        DisplayList random_list(1 + scene % 23, 1 + scene % 11);
+        TextCanvas expected(60, 25, sharp, '.');
+        TextCanvas replayed(60, 25, sharp, '.');
+        if (scene % 3 == 0)
+        {
+            expected.push_clip_rect(Rect(5, 3, 48, 19));
+            replayed.push_clip_rect(Rect(5, 3, 48, 19));
+        }
+        Both random_both(random_list, expected);
+        for (int k = 0; k < 12; ++k)
+        {
+            coord_t v[5];
+            for (int j = 0; j < 5; ++j)
+            {
+                seed = seed * 1103515245 + 12345;
+                v[j] = coord_t((seed >> 16) % 90) - 15;
+            }
+            const color_t c = color_t('a' + k);
+            switch (v[4] % 7 < 0 ? -(v[4] % 7) : v[4] % 7)
+            {
+            case 0: random_both.line(v[0], v[1], v[2], v[3], c); break;
+            case 1: random_both.rectangle(v[0], v[1], v[2], v[3], c); break;
+            case 2: random_both.fill_rectangle(v[0], v[1], v[2], v[3], c); break;
+            case 3: random_both.circle(v[0], v[1], v[2] / 3, c); break;
+            case 4: random_both.fill_circle(v[0], v[1], v[2] / 3, c); break;
+            case 5: random_both.fill_ellipse(v[0], v[1], v[2], v[3], c); break;
+            default: random_both.put_char(v[0], v[1], char('A' + k), c, ' '); break;
+            }
+        }
+        random_list.replay(replayed);
+        same += (replayed.to_str() == expected.to_str());
+        ++total;
+    }
+    std::cout << "random scenes: " << same << " / " << total << std::endl;
+    return 0;
+}
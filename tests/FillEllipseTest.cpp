@@ -1,19 +1,19 @@
-#include "TextCanvas.hpp"
-#include <iostream>
-
-int main(void)
-{
-    textcanvas::TextCanvas canvas(13 * 13, 13 * 13);
-    for (int k = 0; k < 13; ++k)
-    {
-        for (int i = 0; i < 13; ++i)
-        {
-            canvas.fore_color('.');
-            canvas.rectangle(i * 13, k * 13, i * 13 + i, k * 13 + k);
-            canvas.fore_color('#');
-            canvas.fill_ellipse(i * 13, k * 13, i * 13 + i, k * 13 + k);
-        }
-    }
-    std::cout << canvas.to_str();
-    return 0;
-}
+#include "TextCanvas.hpp"
+#include <iostream>
+
+int main(void)
+{
+    textcanvas::TextCanvas canvas(13 * 13, 13 * 13);
+    for (int k = 0; k < 13; ++k)
+    {
+        for (int i = 0; i < 13; ++i)
+        {
+            canvas.fore_color('.');
+            canvas.rectangle(i * 13, k * 13, i * 13 + i, k * 13 + k);
+            canvas.fore_color('#');
+            canvas.fill_ellipse(i * 13, k * 13, i * 13 + i, k * 13 + k);
+        }
+    }
+    std::cout << canvas.to_str();
+    return 0;
+}
@@ -0,0 +1,92 @@
+#include "TextCanvas.hpp"
+#include <iostream>
+
+// the reference: YonBaiKaku then RightRotator, in two passes
+struct TwoPasses
+{
+    void operator()(textcanvas::TextCanvas& tc)
+    {
+        textcanvas::YonBaiKaku()(tc);
+        textcanvas::RightRotator()(tc);
+    }
+};
+
+// a converter without a mapping
+struct Widen
+{
+    void operator()(textcanvas::TextCanvas& tc) { tc.scale_cross(2, 1); }
+};
+
+int main(void)
+{
+    using namespace textcanvas;
+    TextRun run(kh_dot_hankaku_font(), "AB");
+
+    // two passes
+    TextCanvas canvas0(32 * 2, 16, '#', ' ');
+    TwoPasses two;
+    canvas0.text_to_right(0, 0, run, two);
+
+    // a pair of mapped converters, in one pass
+    TextCanvas canvas1(32 * 2, 16, '#', ' ');
+    YonBaiKaku yonbai;
+    RightRotator right;
+    PairConverter<YonBaiKaku, RightRotator> pair(yonbai, right);
+    canvas1.text_to_right(0, 0, run, pair);
+
+    // one pass
+    TextCanvas canvas2(32 * 2, 16, '#', ' ');
+    FusedConverter<YonBaiKaku, RightRotator> fused;
+    canvas2.text_to_right(0, 0, run, fused);
+
+    // one pass, cached
+    TextCanvas canvas3(32 * 2, 16, '#', ' ');
+    GlyphCache<FusedConverter<YonBaiKaku, RightRotator> > cache;
+    canvas3.text_to_right(0, 0, run, cache);
+    canvas3.text_to_right(0, 0, run, cache);
+
+    std::cout << (canvas0.to_str() == canvas1.to_str())
+              << (canvas1.to_str() == canvas2.to_str())
+              << (canvas1.to_str() == canvas3.to_str()) << ", "
+              << cache.size() << std::endl;
+    std::cout << canvas3.to_str();
+
+    TextCanvas canvas4(16 * 3, 16, '#', ' ');
+    GlyphCache<LeftRotator> left;
+    canvas4.jis_put_char(0, 0, kh_dot_zenkaku_font(), 0x3441, left); // kanji "kan"
+    canvas4.put_char(16, 0, kh_dot_hankaku_font(), 'a', left);
+    canvas4.put_char(32, -4, kh_dot_hankaku_font(), 'b', left);
+    std::cout << canvas4.to_str();
+
+    // a pair with a non-mapped converter still runs in two passes
+    TextCanvas canvas5(32 * 2, 16, '#', ' ');
+    Bold<> bold;
+    PairConverter<YonBaiKaku, Bold<> > pair2(yonbai, bold);
+    canvas5.text_to_right(0, 0, run, pair2);
+    TextCanvas canvas6(32 * 2, 16, '#', ' ');
+    GlyphCache<Bold<YonBaiKaku> > cache2;
+    canvas6.text_to_right(0, 0, run, cache2);
+    std::cout << (canvas5.to_str() == canvas6.to_str()) << std::endl;
+
+    // nested pairs with a converter without a mapping
+    TextCanvas canvas7(32 * 2, 16 * 2, '#', ' ');
+    Widen widen;
+    YokoNibaiKaku yoko;
+    typedef PairConverter<Widen, YokoNibaiKaku> inner_type;
+    inner_type inner(widen, yoko);
+    PairConverter<inner_type, RightRotator> nested(inner, right);
+    canvas7.text_to_right(0, 0, run, nested);
+    TextCanvas canvas8(32 * 2, 16 * 2, '#', ' ');
+    GlyphCache<PairConverter<inner_type, RightRotator> > cache3;
+    canvas8.text_to_right(0, 0, run, cache3);
+    TextCanvas canvas9(32 * 2, 16 * 2, '#', ' ');
+    GlyphCache<PairConverter<Bold<>, RightRotator> > cache4;
+    canvas9.text_to_right(0, 0, run, cache4);
+    PairConverter<Bold<>, RightRotator> pair3(bold, right);
+    TextCanvas canvas10(32 * 2, 16 * 2, '#', ' ');
+    canvas10.text_to_right(0, 0, run, pair3);
+    std::cout << (canvas7.to_str() == canvas8.to_str())
+              << (canvas9.to_str() == canvas10.to_str()) << std::endl;
+    std::cout << canvas7.to_str();
+    return 0;
+}
@@ -0,0 +1,37 @@
+#include "TextCanvas.hpp"
+#include <iostream>
+
+int main(void)
+{
+    using namespace textcanvas;
+    TextRun run(kh_dot_hankaku_font(), "Ag");
+
+    TextCanvas canvas(24 * 4, 18, '#', ' ');
+    GlyphCache<Bold<> > bold;
+    GlyphCache<Italic<> > italic;
+    GlyphCache<Outline<> > outline;
+    GlyphCache<Shadow<> > shadow;
+    canvas.text_to_right(0, 0, run, bold);
+    canvas.text_to_right(24, 0, run, italic);
+    canvas.text_to_right(48, 0, run, outline);
+    canvas.text_to_right(72, 0, run, shadow);
+    std::cout << canvas.to_str();
+
+    // the same effects through TextCanvas
+    TextCanvas canvas2(24 * 4, 18, '#', ' ');
+    Bold<> bold_conv;
+    Italic<> italic_conv;
+    Outline<> outline_conv;
+    Shadow<> shadow_conv;
+    canvas2.text_to_right(0, 0, run, bold_conv);
+    canvas2.text_to_right(24, 0, run, italic_conv);
+    canvas2.text_to_right(48, 0, run, outline_conv);
+    canvas2.text_to_right(72, 0, run, shadow_conv);
+    std::cout << (canvas.to_str() == canvas2.to_str()) << std::endl;
+
+    TextCanvas canvas3(36, 34, '#', ' ');
+    GlyphCache<Outline<YonBaiKaku> > big;
+    canvas3.put_char(0, 0, kh_dot_hankaku_font(), 'R', big);
+    std::cout << canvas3.to_str();
+    return 0;
+}
@@ -0,0 +1,113 @@
+#include "TextCanvas.hpp"
+#include <iostream>
+
+using namespace textcanvas;
+
+// the whole stack composited one cell at a time
+static TextCanvas pixel_compose(const LayerStack& stack, color_t back)
+{
+    TextCanvas result(stack.width(), stack.height(), back, back);
+    for (int z = -10; z <= 10; ++z)
+    {
+        for (coord_t i = 0; i < stack.size(); ++i)
+        {
+            if (stack.z(i) != z || !stack.visible(i))
+                continue;
+            const TextCanvas& layer = stack.layer(i);
+            const Point& offset = stack.offset(i);
+            for (coord_t y = 0; y < layer.height(); ++y)
+            {
+                for (coord_t x = 0; x < layer.width(); ++x)
+                {
+                    color_t ch = layer.get_pixel(x, y);
+                    if (ch != stack.key(i) && result.in_range(offset.x + x, offset.y + y))
+                        result.put_pixel(offset.x + x, offset.y + y, ch);
+                }
+            }
+        }
+    }
+    return result;
+}
+
+static void show(LayerStack& stack)
+{
+    std::cout << stack.dirty().size() << " dirty, ";
+    stack.compose();
+    std::cout << stack.recomposed() << " cells" << std::endl;
+    std::cout << stack.result().to_str() << std::endl;
+}
+
+int main(void)
+{
+    LayerStack stack(32, 10, '.');
+    coord_t background = stack.add(32, 10, -1);
+    coord_t data = stack.add(20, 6, 0);
+    coord_t overlay = stack.add(9, 3, 1, '_');
+
+    TextCanvas& bg = stack.edit(background);
+    bg.fore_color('-');
+    for (coord_t y = 1; y < 10; y += 2)
+        bg.line(0, y, 31, y);
+
+    TextCanvas& plot = stack.edit(data);
+    plot.fore_color('*');
+    plot.line(0, 5, 6, 0);
+    plot.line(6, 0, 12, 4);
+    plot.line(12, 4, 19, 1);
+    stack.offset(data, Point(4, 2));
+
+    TextCanvas& label = stack.edit(overlay);
+    label.clear();
+    label.fore_color('#');
+    label.rectangle(0, 0, 8, 2);
+    label.put_pixel(4, 1, ' ');
+    stack.offset(overlay, Point(20, 0));
+    show(stack);
+
+    // only the edited cells and the moved layer are recomposed
+    stack.edit(data, Rect(19, 1, 19, 1)).put_pixel(19, 1, '@');
+    show(stack);
+    stack.offset(overlay, Point(2, 6));
+    show(stack);
+    stack.visible(background, false);
+    show(stack);
+    stack.z(overlay, -2);
+    stack.visible(background, true);
+    show(stack);
+    show(stack);
+
+    // random edits against the full composition
+    uint32_t seed = 12345;
+    size_t same = 0, total = 0;
+    for (int k = 0; k < 100; ++k)
+    {
+        seed = seed * 1103515245 + 12345;
+        coord_t i = coord_t((seed >> 8) % stack.size());
+        switch ((seed >> 16) % 5)
+        {
+        case 0:
+            stack.offset(i, Point(coord_t((seed >> 20) % 40) - 10,
+                                  coord_t((seed >> 24) % 16) - 4));
+            break;
+        case 1:
+            stack.visible(i, !stack.visible(i));
+            break;
+        case 2:
+            stack.z(i, int((seed >> 20) % 5) - 2);
+            break;
+        default:
+            {
+                coord_t x = coord_t((seed >> 20) % stack.layer(i).width());
+                coord_t y = coord_t((seed >> 24) % stack.layer(i).height());
+                color_t ch = (seed & 0x100000) ? stack.key(i) : color_t('a' + k % 26);
+                stack.edit(i, Rect(x, y, x, y)).put_pixel(x, y, ch);
+            }
+            break;
+        }
+        stack.compose();
+        same += (stack.result().to_str() == pixel_compose(stack, '.').to_str());
+        ++total;
+    }
+    std::cout << "same: " << same << " / " << total << std::endl;
+    return 0;
+}
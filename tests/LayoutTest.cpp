@@ -0,0 +1,56 @@
+#include "TextCanvas.hpp"
+#include <iostream>
+
+static void print_layout(const textcanvas::TextLayout& layout)
+{
+    std::cout << layout.extent().x << "x" << layout.extent().y << std::endl;
+    for (size_t i = 0; i < layout.line_count(); ++i)
+    {
+        const textcanvas::TextLayout::Line& line = layout.line(i);
+        std::cout << "[" << line.first << ", " << line.last << ") x:" << line.x
+                  << " y:" << line.y << " width:" << line.width << std::endl;
+    }
+}
+
+int main(void)
+{
+    using namespace textcanvas;
+    const XbmFont& zenkaku = kh_dot_zenkaku_font();
+    const XbmFont& hankaku = kh_dot_hankaku_font();
+
+    // "Hello world" and then Japanese; the ideographic full stop (U+3002)
+    // cannot begin a line and the opening bracket (U+300C) cannot end one
+    TextRun run;
+    run.assign_utf8(zenkaku, hankaku,
+        "Hello world\n"
+        "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E\xE3\x80\x82"
+        "\xE3\x80\x8C\xE6\x9C\xAC\xE3\x80\x8D");
+
+    TextLayout left(run, 8 * 6);
+    print_layout(left);
+    TextLayout center(run, 8 * 8, ALIGN_CENTER);
+    print_layout(center);
+    TextLayout right(run, 8 * 8, ALIGN_RIGHT);
+    print_layout(right);
+
+    TextCanvas canvas(8 * 8, 16 * 4, '#', ' ');
+    canvas.put_layout(0, 0, right);
+    std::cout << canvas.to_str();
+
+    // clipped
+    canvas.clear();
+    canvas.put_layout(0, -8, center, Rect(4, 0, 8 * 8 - 5, 16 * 2 - 1));
+    std::cout << canvas.to_str();
+
+    // each line is as high as its own glyphs; an empty line is as high
+    // as the run
+    const XbmFont small(kh_dot_hankaku_width, kh_dot_hankaku_height,
+                        kh_dot_hankaku_bits, 16, 32, 8, 8);
+    TextRun mixed;
+    mixed.assign_utf8(zenkaku, small, "ab\n\n\xE6\x97\xA5" "c\nd");
+    TextLayout heights(mixed);
+    for (size_t i = 0; i < heights.line_count(); ++i)
+        std::cout << heights.line(i).height << " ";
+    std::cout << heights.extent().y << std::endl;
+    return 0;
+}
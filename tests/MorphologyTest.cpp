@@ -0,0 +1,99 @@
+#include "TextCanvas.hpp"
+#include <iostream>
+
+using namespace textcanvas;
+
+// the same morphology, one pixel at a time
+static XbmImage pixel_morph(const XbmImage& image, const MorphElement& elem, bool erode)
+{
+    XbmImage result(image.width(), image.height());
+    for (coord_t y = 0; y < image.height(); ++y)
+    {
+        for (coord_t x = 0; x < image.width(); ++x)
+        {
+            bool dot = erode;
+            for (coord_t dy = -elem.ry; dy <= elem.ry; ++dy)
+            {
+                for (coord_t dx = -elem.rx; dx <= elem.rx; ++dx)
+                {
+                    if (elem.shape == MORPH_CROSS && dx != 0 && dy != 0)
+                        continue;
+                    bool d = image.in_range(x + dx, y + dy)
+                                 ? image.get_dot(x + dx, y + dy) : erode;
+                    dot = erode ? (dot && d) : (dot || d);
+                }
+            }
+            result.put_dot(x, y, dot);
+        }
+    }
+    return result;
+}
+
+static TextCanvas make_canvas()
+{
+    TextCanvas canvas(40, 14, sharp, '.');
+    canvas.fill_rectangle(2, 2, 12, 10);
+    canvas.fill_circle(24, 6, 5);
+    canvas.put_pixel(7, 6, '.');       // a hole
+    canvas.put_pixel(8, 6, '.');
+    canvas.put_pixel(35, 2);           // speckles
+    canvas.put_pixel(33, 9);
+    canvas.put_pixel(16, 12);
+    canvas.line(30, 12, 38, 12);
+    canvas.put_pixel(20, 1, 'x');      // not the fore color
+    return canvas;
+}
+
+int main(void)
+{
+    TextCanvas canvas = make_canvas();
+    std::cout << canvas.to_str() << std::endl;
+
+    canvas.dilate(MorphElement(1, 1, MORPH_CROSS));
+    std::cout << canvas.to_str() << std::endl;
+
+    canvas = make_canvas();
+    canvas.erode(MorphElement(2, 1));
+    std::cout << canvas.to_str() << std::endl;
+
+    canvas = make_canvas();
+    canvas.open(MorphElement(1, 1));
+    std::cout << canvas.to_str() << std::endl;
+
+    canvas = make_canvas();
+    canvas.close(MorphElement(1, 1));
+    std::cout << canvas.to_str() << std::endl;
+
+    // random bitmaps of several words against the pixel version
+    XbmImage image(150, 40);
+    uint32_t seed = 12345;
+    for (coord_t y = 0; y < image.height(); ++y)
+    {
+        for (coord_t x = 0; x < image.width(); ++x)
+        {
+            seed = seed * 1103515245 + 12345;
+            image.put_dot(x, y, ((seed >> 16) % 100) < 30);
+        }
+    }
+    size_t same = 0, total = 0;
+    for (coord_t r = 0; r <= 70; r += (r < 4) ? 1 : 11)
+    {
+        for (int shape = 0; shape < 2; ++shape)
+        {
+            for (int erode = 0; erode < 2; ++erode)
+            {
+                MorphElement elem(r, r / 2 + 1, shape ? MORPH_CROSS : MORPH_RECT);
+                XbmImage result = image;
+                if (erode)
+                    result.erode(elem);
+                else
+                    result.dilate(elem);
+                XbmImage expected = pixel_morph(image, elem, erode != 0);
+                same += (TextCanvas(result).to_str() == TextCanvas(expected).to_str());
+                ++total;
+            }
+        }
+    }
+    std::cout << "same: " << same << " / " << total << std::endl;
+    return 0;
+}
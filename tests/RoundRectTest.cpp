@@ -1,17 +1,87 @@
-#include "TextCanvas.hpp"
-#include <iostream>
-
-int main(void)
-{
-    using namespace textcanvas;
-    TextCanvas canvas(100 + 1, 100 + 1);
-    coord_t k = 0;
-    for (coord_t i = 0; i < 50; i += 3)
-    {
-        canvas.fore_color('0' + k % 10);
-        canvas.round_rect(i, i, 100 - i, 100 - i, 10, 10);
-        ++k;
-    }
-    std::cout << canvas.to_str();
-    return 0;
-}
+#include "TextCanvas.hpp"
+#include <iostream>
+#include <vector>
+
+using namespace textcanvas;
+
+// whether the cells other than space are 8-connected
+static bool is_connected(const TextCanvas& canvas)
+{
+    const coord_t w = canvas.width(), h = canvas.height();
+    std::vector<char> seen(w * h, 0);
+    std::vector<coord_t> stack;
+    coord_t total = 0;
+    for (coord_t i = 0; i < w * h; ++i)
+    {
+        if (canvas[i] == ' ')
+            continue;
+        if (stack.empty() && total == 0)
+        {
+            stack.push_back(i);
+            seen[i] = 1;
+        }
+        ++total;
+    }
+
+    coord_t count = 0;
+    while (!stack.empty())
+    {
+        coord_t i = stack.back();
+        stack.pop_back();
+        ++count;
+        for (coord_t dy = -1; dy <= 1; ++dy)
+        {
+            for (coord_t dx = -1; dx <= 1; ++dx)
+            {
+                coord_t x = i % w + dx, y = i / w + dy;
+                if (x < 0 || y < 0 || x >= w || y >= h)
+                    continue;
+                coord_t k = y * w + x;
+                if (!seen[k] && canvas[k] != ' ')
+                {
+                    seen[k] = 1;
+                    stack.push_back(k);
+                }
+            }
+        }
+    }
+    return count == total;
+}
+
+int main(void)
+{
+    TextCanvas canvas(100 + 1, 100 + 1);
+    coord_t k = 0;
+    for (coord_t i = 0; i < 50; i += 3)
+    {
+        canvas.fore_color('0' + k % 10);
+        canvas.round_rect(i, i, 100 - i, 100 - i, 10, 10);
+        ++k;
+    }
+    std::cout << canvas.to_str();
+
+    // every outline is one 8-connected curve
+    coord_t disconnected = 0, total = 0;
+    for (coord_t w = 1; w <= 24; ++w)
+    {
+        for (coord_t h = 1; h <= 24; ++h)
+        {
+            for (coord_t r = 0; r < 10; ++r)
+            {
+                TextCanvas box(w + 2, h + 2);
+                box.round_rect(1, 1, w, h, r, (r * 7) % 10);
+                if (!is_connected(box))
+                    ++disconnected;
+                ++total;
+            }
+        }
+    }
+    std::cout << "disconnected: " << disconnected << " / " << total << std::endl;
+
+    // a negative radius draws square corners
+    TextCanvas negative(17, 10);
+    negative.round_rect(1, 1, 15, 8, -3, -2);
+    negative.fill_round_rect(3, 3, 13, 6, 3, -1);
+    std::cout << negative.to_str();
+    return disconnected != 0;
+}
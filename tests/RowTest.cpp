@@ -0,0 +1,110 @@
+#include "TextCanvas.hpp"
+#include <iostream>
+
+using namespace textcanvas;
+
+static const char shades[] = " .:-=+*#%@";
+
+// a heat map of the distance from (cx, cy), row by row
+static void heat_map(TextCanvas& canvas, coord_t cx, coord_t cy)
+{
+    for (coord_t y = 0; y < canvas.height(); ++y)
+    {
+        CanvasRow<color_t> row = canvas.row(y);
+        for (coord_t x = 0; x < row.width; ++x)
+        {
+            coord_t d = (x - cx) * (x - cx) / 4 + (y - cy) * (y - cy);
+            row[x] = shades[9 - (d < 90 ? d / 10 : 9)];
+        }
+    }
+}
+
+// the same by put_pixel
+static void heat_map_by_pixel(TextCanvas& canvas, coord_t cx, coord_t cy)
+{
+    for (coord_t y = 0; y < canvas.height(); ++y)
+    {
+        for (coord_t x = 0; x < canvas.width(); ++x)
+        {
+            coord_t d = (x - cx) * (x - cx) / 4 + (y - cy) * (y - cy);
+            canvas.fore_color(shades[9 - (d < 90 ? d / 10 : 9)]);
+            canvas.put_pixel(x, y);
+        }
+    }
+}
+
+int main(void)
+{
+    int failed = 0;
+
+    TextCanvas canvas(40, 12);
+    heat_map(canvas, 20, 6);
+    std::cout << canvas.to_str() << std::endl;
+
+    TextCanvas expected(40, 12);
+    heat_map_by_pixel(expected, 20, 6);
+    std::cout << "same as put_pixel: " << (canvas.to_str() == expected.to_str()) << std::endl;
+    if (canvas.to_str() != expected.to_str())
+        ++failed;
+
+    // the stride guarantee
+    bool contiguous = (canvas.stride() == canvas.width());
+    for (coord_t y = 0; y + 1 < canvas.height(); ++y)
+    {
+        if (canvas.row(y).cells + canvas.stride() != canvas.row(y + 1).cells)
+            contiguous = false;
+    }
+    std::cout << "contiguous: " << contiguous << std::endl;
+    if (!contiguous)
+        ++failed;
+
+    // iterating the rows, and the cells of a row
+    coord_t count = 0, hot = 0;
+    CanvasRows<color_t> rows = canvas.rows();
+    CanvasRows<color_t>::iterator it, end = rows.end();
+    for (it = rows.begin(); it != end; ++it)
+    {
+        CanvasRow<color_t> row = *it;
+        for (color_t *p = row.begin(); p != row.end(); ++p)
+        {
+            if (*p == '@')
+                ++hot;
+        }
+        ++count;
+    }
+    std::cout << "rows: " << count << " of " << rows.size()
+              << ", hot cells: " << hot << std::endl;
+    if (count != canvas.height())
+        ++failed;
+
+    // a kernel on the const rows: the row sums of the shade levels
+    const TextCanvas& const_canvas = canvas;
+    CanvasRows<const color_t> const_rows = const_canvas.rows();
+    for (coord_t y = 0; y < const_rows.size(); ++y)
+    {
+        CanvasRow<const color_t> row = const_rows[y];
+        int sum = 0;
+        for (coord_t x = 0; x < row.width; ++x)
+            sum += int(std::strchr(shades, row[x]) - shades);
+        std::cout << sum << (y + 1 < const_rows.size() ? " " : "\n");
+    }
+
+    // the rows bypass the clip
+    canvas.clear();
+    canvas.push_clip_rect(Rect(0, 0, 9, 11));
+    std::memset(canvas.row(1).cells, '#', canvas.row(1).width);
+    canvas.pop_clip();
+    std::cout << canvas.row(1).cells[39] << std::endl;
+
+    // the rows follow the resize
+    canvas.resize(17, 3);
+    std::cout << "stride after resize: " << canvas.stride() << std::endl;
+    std::cout << canvas.to_str() << std::endl;
+
+    // an empty canvas has no rows
+    TextCanvas empty(0, 0);
+    std::cout << "empty rows: " << (empty.rows().begin() == empty.rows().end()) << std::endl;
+
+    std::cout << "failed: " << failed << std::endl;
+    return failed;
+}
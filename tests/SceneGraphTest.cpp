@@ -0,0 +1,259 @@
+#include "TextCanvas.hpp"
+#include <iostream>
+
+using namespace textcanvas;
+
+// the same scene drawn from scratch
+static TextCanvas full_render(const SceneGraph& scene, const TextCanvas& reference)
+{
+    SceneGraph copy(scene);
+    copy.invalidate(Rect(0, 0, scene.width() - 1, scene.height() - 1));
+    TextCanvas canvas(reference.width(), reference.height());
+    copy.render(canvas);
+    return canvas;
+}
+
+// a node as drawn directly onto a canvas
+struct ShadowNode
+{
+    int type; // 0: rect, 1: ellipse, 2: sprite, 3: polygon
+    Rect rect;
+    color_t color;
+    bool filled, visible, removed;
+    Point offset;
+};
+
+static TextCanvas direct_render(const std::vector<ShadowNode>& shadows,
+                                const SpriteAtlas& atlas, coord_t width,
+                                coord_t height)
+{
+    TextCanvas canvas(width, height, sharp, '.');
+    for (size_t i = 0; i < shadows.size(); ++i)
+    {
+        const ShadowNode& s = shadows[i];
+        if (s.removed || !s.visible)
+            continue;
+        const Rect rc(s.rect.x0 + s.offset.x, s.rect.y0 + s.offset.y,
+                      s.rect.x1 + s.offset.x, s.rect.y1 + s.offset.y);
+        ColorPutter putter(canvas, s.color);
+        switch (s.type)
+        {
+        case 0:
+            if (s.filled) canvas.fill_rectangle(rc.x0, rc.y0, rc.x1, rc.y1, putter);
+            else canvas.rectangle(rc.x0, rc.y0, rc.x1, rc.y1, putter);
+            break;
+        case 1:
+            if (s.filled) canvas.fill_ellipse(rc.x0, rc.y0, rc.x1, rc.y1, putter);
+            else canvas.ellipse(rc.x0, rc.y0, rc.x1, rc.y1, putter);
+            break;
+        case 2:
+            canvas.put_sprite(rc.x0, rc.y0, atlas, 0);
+            break;
+        default:
+            {
+                Points pts;
+                pts.push_back(Point(rc.x0, rc.y1));
+                pts.push_back(Point((s.rect.x0 + s.rect.x1) / 2 + s.offset.x, rc.y0));
+                pts.push_back(Point(rc.x1, rc.y1));
+                if (s.filled)
+                    canvas.fill_polygon(pts.size(), &pts[0], false, putter);
+                canvas.polygon(pts.size(), &pts[0], putter);
+            }
+            break;
+        }
+    }
+    return canvas;
+}
+
+// the topmost node at (x, y) by scanning all the nodes
+static coord_t linear_pick(const SceneGraph& scene, coord_t count, coord_t x, coord_t y)
+{
+    for (coord_t id = count; id-- > 0;)
+    {
+        if (!scene.removed(id) && scene.hit(id, x, y))
+            return id;
+    }
+    return -1;
+}
+
+static void show(SceneGraph& scene, TextCanvas& canvas)
+{
+    std::cout << scene.dirty().size() << " dirty, ";
+    scene.render(canvas);
+    std::cout << scene.redrawn() << " cells, " << scene.draws() << " draws" << std::endl;
+    std::cout << canvas.to_str() << std::endl;
+}
+
+int main(void)
+{
+    SceneGraph scene(40, 14, '.');
+    TextCanvas canvas(40, 14);
+
+    coord_t panel = scene.add_rect(Rect(1, 1, 17, 12), '#');
+    coord_t ball = scene.add_ellipse(Rect(3, 3, 10, 8), 'o', true);
+    Points tri;
+    tri.push_back(Point(22, 11));
+    tri.push_back(Point(30, 2));
+    tri.push_back(Point(38, 11));
+    coord_t roof = scene.add_polygon(tri, '^', true);
+    TextCanvas image(5, 3, '*', space);
+    image.clear();
+    image.line(0, 1, 4, 1);
+    image.line(2, 0, 2, 2);
+    SpriteAtlas atlas;
+    atlas.add(image);
+    coord_t star = scene.add_sprite(Point(12, 2), atlas, 0);
+    show(scene, canvas);
+
+    // only the old and the new boxes are redrawn
+    scene.move_by(star, 16, 7);
+    show(scene, canvas);
+    scene.style(ball, '%', false);
+    show(scene, canvas);
+    scene.visible(roof, false);
+    show(scene, canvas);
+    scene.visible(roof, true);
+    scene.remove(panel);
+    show(scene, canvas);
+
+    const coord_t points[][2] =
+    {
+        { 6, 5 }, { 3, 3 }, { 30, 9 }, { 29, 9 }, { 30, 6 }, { 1, 1 }, { 39, 0 }
+    };
+    for (size_t i = 0; i < sizeof(points) / sizeof(points[0]); ++i)
+    {
+        std::cout << "pick(" << points[i][0] << ", " << points[i][1] << ") = "
+                  << scene.pick(points[i][0], points[i][1]) << std::endl;
+    }
+    std::cout << std::endl;
+
+    // the text node, with a font
+    SceneGraph text_scene(26, 19, '.');
+    TextCanvas text_canvas(26, 19);
+    coord_t label = text_scene.add_text(Point(1, 1), kh_dot_hankaku_font(), "Hi", '#', ' ');
+    text_scene.add_rect(Rect(0, 0, 25, 18), '+');
+    text_scene.render(text_canvas);
+    text_scene.move_by(label, 7, 1);
+    show(text_scene, text_canvas);
+
+    // random changes against drawing from scratch and the linear pick
+    SceneGraph random_scene(60, 30, '.');
+    TextCanvas c1(60, 30);
+    uint32_t seed = 12345;
+    coord_t count = 0;
+    size_t same = 0, total = 0, picks = 0, pick_total = 0, direct = 0;
+    std::vector<ShadowNode> shadows;
+    for (int k = 0; k < 300; ++k)
+    {
+        seed = seed * 1103515245 + 12345;
+        coord_t x = coord_t((seed >> 8) % 70) - 5, y = coord_t((seed >> 16) % 36) - 3;
+        color_t color = color_t('a' + k % 26);
+        unsigned action = (seed >> 24) % 8;
+        if (count < 5 || action < 3)
+        {
+            seed = seed * 1103515245 + 12345;
+            Rect rc(x, y, x + coord_t((seed >> 8) % 12), y + coord_t((seed >> 16) % 8));
+            ShadowNode shadow = { int((seed >> 24) % 4), rc, color,
+                              (seed & 0x1000) != 0, true, false, Point(0, 0) };
+            shadows.push_back(shadow);
+            switch ((seed >> 24) % 4)
+            {
+            case 0: random_scene.add_rect(rc, color, (seed & 0x1000) != 0); break;
+            case 1: random_scene.add_ellipse(rc, color, (seed & 0x1000) != 0); break;
+            case 2: random_scene.add_sprite(Point(x, y), atlas, 0); break;
+            default:
+                {
+                    Points pts;
+                    pts.push_back(Point(rc.x0, rc.y1));
+                    pts.push_back(Point((rc.x0 + rc.x1) / 2, rc.y0));
+                    pts.push_back(Point(rc.x1, rc.y1));
+                    random_scene.add_polygon(pts, color, (seed & 0x1000) != 0);
+                }
+                break;
+            }
+            ++count;
+        }
+        else
+        {
+            coord_t id = coord_t((seed >> 4) % count);
+            if (random_scene.removed(id))
+                continue;
+            ShadowNode& shadow = shadows[id];
+            switch (action)
+            {
+            case 3: case 4:
+                random_scene.move_by(id, x % 7 - 3, y % 5 - 2);
+                shadow.offset.x += x % 7 - 3;
+                shadow.offset.y += y % 5 - 2;
+                break;
+            case 5:
+                random_scene.style(id, color, (seed & 0x1000) != 0);
+                shadow.color = color;
+                shadow.filled = (seed & 0x1000) != 0;
+                break;
+            case 6:
+                random_scene.visible(id, !random_scene.visible(id));
+                shadow.visible = !shadow.visible;
+                break;
+            default:
+                random_scene.remove(id);
+                shadow.removed = true;
+                break;
+            }
+        }
+        random_scene.render(c1);
+        same += (c1.to_str() == full_render(random_scene, c1).to_str());
+        direct += (c1.to_str() == direct_render(shadows, atlas, 60, 30).to_str());
+        ++total;
+        for (coord_t py = 0; py < 30; py += 3)
+        {
+            for (coord_t px = 0; px < 60; px += 3)
+            {
+                picks += (random_scene.pick(px, py) == linear_pick(random_scene, count, px, py));
+                ++pick_total;
+            }
+        }
+    }
+    std::cout << "same: " << same << " / " << total << std::endl;
+    std::cout << "same as drawn directly: " << direct << " / " << total << std::endl;
+    std::cout << "picks: " << picks << " / " << pick_total << std::endl;
+
+    // every cell a node draws hits it
+    size_t hits = 0, drawn = 0;
+    for (size_t id = 0; id < shadows.size(); ++id)
+    {
+        if (shadows[id].removed || !shadows[id].visible)
+            continue;
+        std::vector<ShadowNode> one(1, shadows[id]);
+        one[0].color = '#';
+        TextCanvas alone = direct_render(one, atlas, 60, 30);
+        for (coord_t py = 0; py < 30; ++py)
+        {
+            for (coord_t px = 0; px < 60; ++px)
+            {
+                if (alone.get_pixel(px, py) == '.')
+                    continue;
+                hits += random_scene.hit(coord_t(id), px, py);
+                ++drawn;
+            }
+        }
+    }
+    std::cout << "hits: " << hits << " / " << drawn << std::endl;
+
+    // the right column and the bottom row of a filled polygon
+    SceneGraph box_scene(16, 12, '.');
+    Points square;
+    square.push_back(Point(2, 2));
+    square.push_back(Point(12, 2));
+    square.push_back(Point(12, 9));
+    square.push_back(Point(2, 9));
+    box_scene.add_polygon(square, '#', true);
+    box_scene.add_ellipse(Rect(4, 4, 10, 7), 'o');
+    TextCanvas box_canvas(16, 12);
+    show(box_scene, box_canvas);
+    std::cout << box_scene.pick(12, 5) << box_scene.pick(7, 9)
+              << box_scene.pick(12, 9) << box_scene.pick(13, 9) << ", "
+              << box_scene.pick(5, 4) << box_scene.pick(9, 4)
+              << box_scene.pick(4, 4) << std::endl;
+    return 0;
+}
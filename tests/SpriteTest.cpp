@@ -0,0 +1,96 @@
+#include "TextCanvas.hpp"
+#include <iostream>
+
+using namespace textcanvas;
+
+// the same sprite, one cell at a time
+static void pixel_sprite(TextCanvas& canvas, coord_t x0, coord_t y0,
+                         const TextCanvas& sheet, const Rect& rect,
+                         color_t key, const Rect& clip)
+{
+    for (coord_t y = rect.y0; y <= rect.y1; ++y)
+    {
+        for (coord_t x = rect.x0; x <= rect.x1; ++x)
+        {
+            coord_t dx = x0 + x - rect.x0, dy = y0 + y - rect.y0;
+            color_t ch = sheet.get_pixel(x, y);
+            if (ch != key && clip.contains(dx, dy) && canvas.in_range(dx, dy))
+                canvas.put_pixel(dx, dy, ch);
+        }
+    }
+}
+
+int main(void)
+{
+    // a sheet of three sprites of 7 x 5
+    TextCanvas sheet(21, 5, sharp, space);
+    sheet.fill_circle(3, 2, 2);
+    sheet.put_pixel(2, 1, 'o');
+    sheet.put_pixel(4, 1, 'o');
+    sheet.fore_color('+');
+    sheet.line(7, 2, 13, 2);
+    sheet.line(10, 0, 10, 4);
+    sheet.fore_color('*');
+    sheet.rectangle(14, 0, 20, 4);
+    sheet.put_pixel(17, 2, '@');
+    std::cout << sheet.to_str() << std::endl;
+
+    SpriteAtlas atlas;
+    for (coord_t i = 0; i < 3; ++i)
+        atlas.add(sheet, Rect(i * 7, 0, i * 7 + 6, 4));
+    std::cout << "sprites: " << atlas.size() << ", runs: " << atlas.run_count()
+              << ", cells: " << atlas.cell_count() << std::endl;
+
+    // overlapping sprites keep each other, and are clipped at the edges
+    TextCanvas canvas(30, 9, sharp, '.');
+    canvas.clear();
+    canvas.put_sprite(1, 1, atlas, 2);
+    canvas.put_sprite(4, 2, atlas, 0);
+    canvas.put_sprite(6, 3, atlas, 1);
+    canvas.put_sprite(-3, 5, atlas, 0);
+    canvas.put_sprite(26, -2, atlas, 2);
+    canvas.put_sprite(15, 1, atlas, 1, Rect(17, 0, 19, 8));
+    std::cout << canvas.to_str() << std::endl;
+
+    // random sprites and positions against the cell version
+    uint32_t seed = 12345;
+    TextCanvas random_sheet(80, 40);
+    for (coord_t y = 0; y < random_sheet.height(); ++y)
+    {
+        for (coord_t x = 0; x < random_sheet.width(); ++x)
+        {
+            seed = seed * 1103515245 + 12345;
+            random_sheet.put_pixel(x, y, ((seed >> 16) % 3) ? color_t('a' + (seed >> 20) % 26) : space);
+        }
+    }
+    SpriteAtlas random_atlas;
+    std::vector<Rect> rects;
+    for (int i = 0; i < 30; ++i)
+    {
+        seed = seed * 1103515245 + 12345;
+        coord_t x0 = coord_t((seed >> 8) % 60), y0 = coord_t((seed >> 20) % 30);
+        seed = seed * 1103515245 + 12345;
+        Rect rc(x0, y0, x0 + coord_t((seed >> 8) % 20), y0 + coord_t((seed >> 20) % 10));
+        rects.push_back(rc);
+        random_atlas.add(random_sheet, rc);
+    }
+    TextCanvas c1(50, 30, sharp, '.'), c2(50, 30, sharp, '.');
+    c1.clear();
+    c2.clear();
+    size_t same = 0, total = 0;
+    for (int k = 0; k < 200; ++k)
+    {
+        seed = seed * 1103515245 + 12345;
+        coord_t i = coord_t((seed >> 8) % rects.size());
+        coord_t x = coord_t((seed >> 12) % 70) - 10, y = coord_t((seed >> 20) % 40) - 5;
+        Rect clip(0, 0, c1.width() - 1, c1.height() - 1);
+        if (k % 4 == 3)
+            clip = Rect(x + 2, y + 1, x + 9, y + 5);
+        c1.put_sprite(x, y, random_atlas, i, clip);
+        pixel_sprite(c2, x, y, random_sheet, rects[i], space, clip);
+        same += (c1.to_str() == c2.to_str());
+        ++total;
+    }
+    std::cout << "same: " << same << " / " << total << std::endl;
+    return 0;
+}
@@ -0,0 +1,23 @@
+#include "TextCanvas.hpp"
+#include <iostream>
+
+int main(void)
+{
+    using namespace textcanvas;
+    TextCanvas canvas1(8 * 7, 16 * 2, '#', ' ');
+    TextCanvas canvas2(8 * 7, 16 * 2, '#', ' ');
+#if __cplusplus >= 201402L
+    constexpr auto banner = make_static_banner("READY!");
+    static_assert(banner.width() == 8 * 6, "width");
+    banner.draw(canvas1, 0, 0);
+    banner.draw(canvas1, 4, 16);
+#else
+    canvas1.text_to_right(0, 0, kh_dot_hankaku_font(), "READY!");
+    canvas1.text_to_right(4, 16, kh_dot_hankaku_font(), "READY!");
+#endif
+    canvas2.text_to_right(0, 0, kh_dot_hankaku_font(), "READY!");
+    canvas2.text_to_right(4, 16, kh_dot_hankaku_font(), "READY!");
+    std::cout << canvas1.to_str();
+    std::cout << (canvas1.to_str() == canvas2.to_str()) << std::endl;
+    return 0;
+}
@@ -0,0 +1,55 @@
+#include "TextCanvas.hpp"
+#include <iostream>
+
+using namespace textcanvas;
+
+// '#' for a cell put once, '@' for a cell put twice or more
+struct OncePutter
+{
+    TextCanvas& m_tc;
+    OncePutter(TextCanvas& tc)
+      : m_tc(tc)
+    {}
+    void operator()(coord_t x, coord_t y)
+    {
+        m_tc.put_pixel(x, y, m_tc.get_pixel(x, y) == space ? sharp : '@');
+    }
+};
+
+int main(void)
+{
+    static const LineJoin joins[] = { JOIN_MITER, JOIN_ROUND, JOIN_BEVEL };
+    static const LineCap caps[] = { CAP_BUTT, CAP_ROUND, CAP_SQUARE };
+    for (int i = 0; i < 3; ++i)
+    {
+        TextCanvas canvas(40, 20);
+        OncePutter putter(canvas);
+        Points points;
+        points.push_back(Point(5, 15));
+        points.push_back(Point(14, 4));
+        points.push_back(Point(22, 15));
+        points.push_back(Point(34, 9));
+        canvas.stroke_polyline(points, StrokeStyle(5, joins[i], caps[i]), putter);
+        std::cout << canvas.to_str() << std::endl;
+    }
+
+    TextCanvas canvas(40, 30);
+    OncePutter putter(canvas);
+    canvas.stroke_rectangle(3, 3, 20, 12, StrokeStyle(3), putter);
+    canvas.stroke_circle(30, 8, 6, StrokeStyle(3), putter);
+    canvas.stroke_ellipse(2, 16, 24, 27, StrokeStyle(2), putter);
+    canvas.stroke_line(28, 18, 36, 27, StrokeStyle(4, JOIN_MITER, CAP_ROUND), putter);
+    std::cout << canvas.to_str() << std::endl;
+
+    Points star;
+    star.push_back(Point(20, 2));
+    star.push_back(Point(26, 20));
+    star.push_back(Point(10, 9));
+    star.push_back(Point(30, 9));
+    star.push_back(Point(14, 20));
+    canvas.reset(40, 23);
+    OncePutter star_putter(canvas);
+    canvas.stroke_polygon(star, StrokeStyle(2, JOIN_BEVEL), star_putter);
+    std::cout << canvas.to_str();
+    return 0;
+}
@@ -0,0 +1,49 @@
+/* Copyright (c) Keitarou Hiraki, Font Silo. 1990-2015
+   Copyright (C) Katayama Hirofumi MZ <katayama.hirofumi.mz@gmail.com>
+   License: SIL Open Font License 1.1 */
+/* A subset of "KH Dot Kodenmachou 16 Ki" (9 characters).
+   Generated by make_subset_font.cpp. DO NOT EDIT. */
+#define subset_font_width 64
+#define subset_font_height 48
+#define subset_font_columns 4
+#define subset_font_rows 3
+#define subset_font_cell_width 16
+#define subset_font_cell_height 16
+#define subset_font_count 9
+static unsigned char subset_font_bits[] = {
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xF8, 0x07, 0x00, 0x00, 0xFC, 0x1F,
+   0x40, 0x0F, 0x00, 0x04, 0x00, 0x00, 0xFC, 0x1F, 0xFC, 0x00, 0x00, 0x02,
+   0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+   0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01,
+   0x00, 0x00, 0xFC, 0x1F, 0x80, 0x1F, 0x80, 0x02, 0x00, 0x00, 0xFC, 0x1F,
+   0x7C, 0x01, 0x40, 0x04, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x08,
+   0x11, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x10, 0x11, 0x00, 0x00, 0x00,
+   0x00, 0x01, 0x0C, 0x10, 0x11, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+   0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDE, 0x3F, 0x00, 0x00,
+   0x00, 0x00, 0x40, 0x00, 0x00, 0x02, 0xF8, 0x0F, 0xF8, 0x07, 0x40, 0x00,
+   0x3F, 0x02, 0x08, 0x08, 0x00, 0x00, 0x40, 0x00, 0xC0, 0x1F, 0x08, 0x08,
+   0x00, 0x00, 0x40, 0x00, 0x1E, 0x11, 0x08, 0x08, 0x00, 0x00, 0xC0, 0x01,
+   0x00, 0x11, 0x08, 0x08, 0xFE, 0x3F, 0x40, 0x06, 0x1E, 0x11, 0xF8, 0x0F,
+   0x80, 0x00, 0x40, 0x08, 0xE0, 0x7F, 0x08, 0x08, 0x80, 0x00, 0x40, 0x10,
+   0x00, 0x00, 0x08, 0x08, 0x80, 0x00, 0x40, 0x00, 0x9E, 0x1F, 0x08, 0x08,
+   0x40, 0x00, 0x40, 0x00, 0x92, 0x10, 0x08, 0x08, 0x40, 0x00, 0x40, 0x00,
+   0x92, 0x10, 0x08, 0x08, 0x20, 0x00, 0x40, 0x00, 0x92, 0x10, 0xF8, 0x0F,
+   0x10, 0x00, 0x40, 0x00, 0x9E, 0x1F, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00,
+   0x92, 0x10, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0xA0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0xA0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x04, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x88, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x84, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x67, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+static const uint16_t subset_font_codes[] = {
+   0x2123, 0x222E, 0x252D, 0x2539, 0x2546, 0x2548, 0x386C, 0x467C, 0x4B5C
+};
@@ -0,0 +1,27 @@
+#include "TextCanvas.hpp"
+#include "SubsetFont.h" // made by fonts/make_subset_font
+#include <iostream>
+
+int main(void)
+{
+    using namespace textcanvas;
+    static const XbmFont subset(
+        subset_font_width, subset_font_height, subset_font_bits,
+        subset_font_columns, subset_font_rows, subset_font_cell_width,
+        subset_font_cell_height, subset_font_codes, subset_font_count);
+    std::cout << subset.is_subset() << subset.has_jis_char(0x467C)
+              << subset.has_jis_char(0x3441) << std::endl;
+
+    const char *text = "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E\xE3\x80\x82"; // UTF-8
+    TextCanvas canvas1(16 * 5, 16 * 2, '#', ' ');
+    TextCanvas canvas2(16 * 5, 16 * 2, '#', ' ');
+    canvas1.utf8_text_to_right(0, 0, subset, kh_dot_hankaku_font(), text);
+    canvas2.utf8_text_to_right(0, 0, kh_dot_zenkaku_font(), kh_dot_hankaku_font(), text);
+    std::cout << (canvas1.to_str() == canvas2.to_str()) << std::endl;
+
+    // a missing character gives the geta mark
+    canvas1.jis_put_char(64, 0, subset, 0x3441);
+    canvas1.utf8_text_to_down(0, 16, subset, kh_dot_hankaku_font(), "\xE3\x80\x82");
+    std::cout << canvas1.to_str();
+    return 0;
+}
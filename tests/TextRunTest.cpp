@@ -0,0 +1,22 @@
+#include "TextCanvas.hpp"
+#include <iostream>
+
+int main(void)
+{
+    using namespace textcanvas;
+    TextRun run1(kh_dot_hankaku_font(), "ABCabc123");
+    TextRun run2, run3;
+    run2.assign_sjis(kh_dot_zenkaku_font(), kh_dot_hankaku_font(), "\x93\xFA\x96\x7B\x8C\xEA\xB1\xB2" "AB"); // Shift_JIS
+    run3.assign_utf8(kh_dot_zenkaku_font(), kh_dot_hankaku_font(), "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E\xEF\xBD\xB1\xEF\xBD\xB2" "AB"); // UTF-8
+    std::cout << run1.size() << ", " << run1.extent().x << "x" << run1.extent().y << std::endl;
+    std::cout << run2.size() << ", " << run2.extent().x << "x" << run2.extent().y << std::endl;
+    std::cout << run3.size() << ", " << run3.extent().x << "x" << run3.extent().y << std::endl;
+
+    TextCanvas canvas(8 * 9, 16 * 3, '#', ' ');
+    canvas.text_to_right(0, 0, run1);
+    canvas.text_to_right(-4, 16, run2);
+    YokoNibaiKaku conv;
+    canvas.text_to_right(0, 32, run3, conv);
+    std::cout << canvas.to_str();
+    return 0;
+}
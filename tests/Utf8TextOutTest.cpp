@@ -0,0 +1,12 @@
+#include "TextCanvas.hpp"
+#include <iostream>
+
+int main(void)
+{
+    using namespace textcanvas;
+    TextCanvas canvas(8 * 9, 16 * 2, '#', ' ');
+    canvas.utf8_text_to_right(0, 0, kh_dot_zenkaku_font(), kh_dot_hankaku_font(), "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E\xEF\xBD\xB1\xEF\xBD\xB2" "AB"); // UTF-8
+    canvas.sjis_text_to_right(0, 16, kh_dot_zenkaku_font(), kh_dot_hankaku_font(), "\x93\xFA\x96\x7B\x8C\xEA\xB1\xB2" "AB"); // Shift_JIS
+    std::cout << canvas.to_str();
+    return 0;
+}
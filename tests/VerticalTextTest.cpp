@@ -0,0 +1,34 @@
+#include "TextCanvas.hpp"
+#include <iostream>
+
+int main(void)
+{
+    using namespace textcanvas;
+    TextCanvas canvas(16 * 3, 16 * 7, '#', ' ');
+    canvas.text_to_down(0, 0, kh_dot_hankaku_font(), "Ab(1)");
+    canvas.sjis_text_to_down(16, 0, kh_dot_zenkaku_font(), kh_dot_hankaku_font(), "\x81\x75\x93\xFA\x96\x7B\x81\x5B\x81\x42\x81\x76\xB1"); // Shift_JIS
+    canvas.utf8_text_to_down(32, 0, kh_dot_zenkaku_font(), kh_dot_hankaku_font(), "\xE3\x80\x8C\xE6\x97\xA5\xE6\x9C\xAC\xE3\x83\xBC\xE3\x80\x82\xE3\x80\x8D\xEF\xBD\xB1"); // UTF-8
+    std::cout << canvas.to_str();
+    std::cout << canvas.vertical_cache().rotated.size() << ", "
+              << canvas.vertical_cache().shifted.size() << std::endl;
+
+    // each canvas has its own cache; a copy starts empty
+    TextCanvas other(canvas);
+    std::cout << "copy: " << other.vertical_cache().size() << std::endl;
+
+    // a cache shared by the caller, and cleared by it
+    VerticalGlyphCache shared;
+    TextCanvas first(16, 16 * 5, '#', ' '), second(16, 16 * 5, '#', ' ');
+    first.set_vertical_cache(&shared);
+    second.set_vertical_cache(&shared);
+    first.text_to_down(0, 0, kh_dot_hankaku_font(), "Ab(1)");
+    second.text_to_down(0, 0, kh_dot_hankaku_font(), "Ab(1)");
+    std::cout << "shared: " << shared.size() << ", "
+              << (first.to_str() == second.to_str() ? "same" : "different")
+              << std::endl;
+    shared.clear();
+    first.set_vertical_cache(NULL);
+    std::cout << "cleared: " << shared.size() << ", own: "
+              << first.vertical_cache().size() << std::endl;
+    return 0;
+}
@@ -0,0 +1,86 @@
+#include "TextCanvas.hpp"
+#include <iostream>
+
+using namespace textcanvas;
+
+// the same fill, one pixel at a time
+static XbmImage pixel_fill(const XbmImage& image, coord_t x, coord_t y, bool dot)
+{
+    XbmImage filled = image;
+    const bool target = image.get_dot(x, y);
+    Points points;
+    points.push_back(Point(x, y));
+    filled.put_dot(x, y, dot);
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+        static const coord_t dx[] = { -1, 1, 0, 0 }, dy[] = { 0, 0, -1, 1 };
+        for (int k = 0; k < 4; ++k)
+        {
+            Point p(points[i].x + dx[k], points[i].y + dy[k]);
+            if (filled.in_range(p.x, p.y) && filled.get_dot(p.x, p.y) == target)
+            {
+                filled.put_dot(p.x, p.y, dot);
+                points.push_back(p);
+            }
+        }
+    }
+    return filled;
+}
+
+int main(void)
+{
+    TextCanvas canvas(40, 20);
+    canvas.rectangle(1, 1, 38, 18);
+    canvas.circle(12, 9, 6);
+    canvas.ellipse(22, 3, 36, 15);
+    canvas.line(1, 10, 38, 10);
+    XbmImage image(canvas.width(), canvas.height());
+    image.put_subimage(0, 0, canvas);
+
+    image.flood_fill(12, 9, true);
+    image.flood_fill(29, 6, true);
+    std::cout << TextCanvas(image).to_str() << std::endl;
+    image.flood_fill(0, 0, true);
+    image.flood_fill(12, 9, false);
+    std::cout << TextCanvas(image).to_str() << std::endl;
+
+    // a maze of 150 x 60 over several words
+    XbmImage maze(150, 60);
+    uint32_t seed = 12345;
+    for (coord_t y = 0; y < maze.height(); ++y)
+    {
+        for (coord_t x = 0; x < maze.width(); ++x)
+        {
+            seed = seed * 1103515245 + 12345;
+            maze.put_dot(x, y, ((seed >> 16) % 100) < 40);
+        }
+    }
+    size_t same = 0, total = 0;
+    for (coord_t y = 0; y < maze.height(); y += 7)
+    {
+        for (coord_t x = 0; x < maze.width(); x += 13)
+        {
+            for (int dot = 0; dot <= 1; ++dot)
+            {
+                if (maze.get_dot(x, y) == (dot != 0))
+                    continue;
+                XbmImage expected = pixel_fill(maze, x, y, dot != 0);
+                XbmImage filled = maze;
+                filled.flood_fill(x, y, dot != 0);
+                same += (TextCanvas(filled).to_str() ==
+                         TextCanvas(expected).to_str());
+                ++total;
+            }
+        }
+    }
+    std::cout << "same: " << same << " / " << total << std::endl;
+
+    // the padding bits after the width do not connect the pixels
+    static const uint8_t padded_bits[] = { 0xF0, 0xE0, 0xF0 };
+    XbmImage padded(5, 3);
+    for (coord_t i = 0; i < padded.size(); ++i)
+        padded.data()[i] = padded_bits[i];
+    padded.flood_fill(4, 0, false);
+    std::cout << "padding: " << padded.get_dot(4, 0) << padded.get_dot(4, 2) << std::endl;
+    return 0;
+}